@@ -0,0 +1,203 @@
+#define _GNU_SOURCE
+
+#include <glib.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "guestrace.h"
+#include "guestrace-private.h"
+#include "generated-linux.h"
+#include "generated-windows.h"
+#include "sim-guest.h"
+
+/*
+ * Measure the rate at which guestrace decodes system calls, by feeding the
+ * breakpoint callback a call and a return of each instrumented system call
+ * in turn, and print the rate as one line of JSON. The decoders print to
+ * stderr, which "make bench" discards. "make bench" also records the size
+ * of the program's text, which bounds the instruction-cache footprint of
+ * the decoders, and appends both to decode-timings.jsonl so that the
+ * decoders can be compared across revisions.
+ */
+
+static gint     events     = 200000;
+static gboolean windows    = FALSE;
+static gint64   text_bytes = 0;
+static gchar   *revision   = NULL;
+
+static GOptionEntry entries[] = {
+	{ "events", 'n', 0, G_OPTION_ARG_INT, &events,
+	  "Number of system calls to decode", "N" },
+	{ "windows", 'w', 0, G_OPTION_ARG_NONE, &windows,
+	  "Decode with the Windows tables rather than the Linux ones", NULL },
+	{ "text-bytes", 't', 0, G_OPTION_ARG_INT64, &text_bytes,
+	  "Size of the program's text, to record along with the timings", "BYTES" },
+	{ "revision", 'r', 0, G_OPTION_ARG_STRING, &revision,
+	  "Revision to record along with the timings", "REV" },
+	{ NULL }
+};
+
+/*
+ * Guest memory to which the arguments point, so that the decoders which
+ * read strings and structures find something to read.
+ */
+typedef struct bench_guest {
+	addr_t stack;
+	addr_t path;
+	addr_t unicode_string;
+	addr_t object_attributes;
+} bench_guest;
+
+static bool
+bench_guest_init(vmi_instance_t vmi, bench_guest *guest)
+{
+	static const char path[] = "/etc/passwd";
+	static const uint16_t name[] = { '\\', '?', '?', '\\', 'C', ':' };
+	struct {
+		uint16_t length;
+		uint16_t max_length;
+		uint32_t pad;
+		uint64_t buffer;
+	} unicode_string = { sizeof name, sizeof name, 0, 0 };
+	struct {
+		uint32_t length;
+		uint64_t root_directory;
+		uint64_t object_name;
+		uint32_t attributes;
+		uint64_t security_descriptor;
+		uint64_t security_quality_of_service;
+	} object_attributes = { sizeof object_attributes, 0, 0, 0x40, 0, 0 };
+	addr_t buffer;
+
+	guest->stack             = vmi_translate_ksym2v(vmi, "bench_stack");
+	guest->path              = vmi_translate_ksym2v(vmi, "bench_path");
+	guest->unicode_string    = vmi_translate_ksym2v(vmi, "bench_unicode_string");
+	guest->object_attributes = vmi_translate_ksym2v(vmi, "bench_object_attributes");
+	buffer                   = vmi_translate_ksym2v(vmi, "bench_name");
+
+	unicode_string.buffer         = buffer;
+	object_attributes.object_name = guest->unicode_string;
+
+	return sim_guest_write(guest->path, path, sizeof path)
+	    && sim_guest_write(buffer, name, sizeof name)
+	    && sim_guest_write(guest->unicode_string, &unicode_string, sizeof unicode_string)
+	    && sim_guest_write(guest->object_attributes, &object_attributes, sizeof object_attributes);
+}
+
+int
+main (int argc, char **argv)
+{
+	int rc = EXIT_FAILURE, count = 0;
+	GError *error = NULL;
+	GOptionContext *context;
+	GTLoop *loop = NULL;
+	const GTSyscallCallback *callbacks;
+	addr_t *addrs = NULL;
+	bench_guest guest;
+	x86_registers_t regs;
+	vmi_event_t event;
+	gint64 begin, usec;
+	char date[32];
+	time_t now = time(NULL);
+
+	context = g_option_context_new(NULL);
+	g_option_context_add_main_entries(context, entries, NULL);
+	if (!g_option_context_parse(context, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		goto done;
+	}
+
+	sim_guest_config config = {
+		.mem_size       = 1024UL << 20,
+		.vcpus          = 1,
+		.symbol_stride  = 512,
+		.hypercall_usec = 0,
+	};
+
+	sim_guest_configure(&config);
+
+	loop = gt_loop_new("sim-guest");
+	if (NULL == loop) {
+		fprintf(stderr, "could not initialize guestrace\n");
+		goto done;
+	}
+
+	callbacks = windows ? VM_WINDOWS_SYSCALLS : VM_LINUX_SYSCALLS;
+	while (NULL != callbacks[count].name) {
+		count++;
+	}
+
+	if (count != gt_loop_set_cbs(loop, callbacks)) {
+		fprintf(stderr, "could not instrument every system call\n");
+		goto done;
+	}
+
+	if (!bench_guest_init(loop->vmi, &guest)) {
+		fprintf(stderr, "could not write to the guest\n");
+		goto done;
+	}
+
+	addrs = g_new0(addr_t, count);
+	for (int i = 0; i < count; i++) {
+		addrs[i] = vmi_translate_ksym2v(loop->vmi, callbacks[i].name);
+	}
+
+	/* Point the arguments at the strings and structures written above. */
+	memset(&regs, 0, sizeof regs);
+	regs.rdi = guest.path;
+	regs.rsi = guest.object_attributes;
+	regs.rdx = guest.unicode_string;
+	regs.r10 = guest.path;
+	regs.r8  = 0x120089;
+	regs.r9  = 1;
+
+	memset(&event, 0, sizeof event);
+	event.data     = loop;
+	event.x86_regs = &regs;
+
+	begin = g_get_monotonic_time();
+
+	for (int i = 0; i < events; i++) {
+		/* Each call returns to the system-call handler's return point. */
+		sim_guest_write(guest.stack, &loop->return_point_addr, sizeof loop->return_point_addr);
+
+		regs.rax                      = i;
+		regs.rsp                      = guest.stack;
+		event.interrupt_event.gla     = addrs[i % count];
+		loop->breakpoint_event.callback(loop->vmi, &event);
+
+		regs.rsp                      = guest.stack + loop->return_address_width;
+		event.interrupt_event.gla     = loop->trampoline_addr;
+		loop->breakpoint_event.callback(loop->vmi, &event);
+	}
+
+	usec = g_get_monotonic_time() - begin;
+
+	strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+	printf("{\"date\": \"%s\", \"revision\": \"%s\", \"os\": \"%s\", "
+	       "\"syscalls\": %d, \"events\": %d, \"usec\": %" PRId64 ", "
+	       "\"events_per_sec\": %.0f, \"text_bytes\": %" PRId64 "}\n",
+	        date,
+	        revision ? revision : "unknown",
+	        windows ? "windows" : "linux",
+	        count,
+	        events,
+	        usec,
+	        usec ? events * 1e6 / usec : 0.0,
+	        text_bytes);
+
+	rc = EXIT_SUCCESS;
+
+done:
+	g_free(addrs);
+	gt_loop_free(loop);
+	g_free(revision);
+	g_option_context_free(context);
+
+	return rc;
+}
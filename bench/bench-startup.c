@@ -0,0 +1,189 @@
+#define _GNU_SOURCE
+
+#include <glib.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "guestrace.h"
+#include "sim-guest.h"
+
+/*
+ * Measure the time guestrace spends instrumenting a simulated guest, and
+ * print the startup report as one line of JSON along with the benchmark's
+ * parameters. With --lazy, the guest then executes each system call once,
+ * so that guestrace materializes every deferred page, and the line also
+ * holds the time this took. "make bench" appends these lines to startup-timings.jsonl so
+ * that the timings can be compared across revisions.
+ */
+
+static gint     syscalls       = 300;
+static gint     stride         = 512;
+static gint     hypercall_usec = 1;
+static gint     memory         = 1024;
+static gboolean lazy           = FALSE;
+static gchar   *revision       = NULL;
+
+static GTSyscallCallback *callbacks      = NULL;
+static gint               materialized   = 0;
+static gint64             materialize_us = 0;
+static uint64_t           hypercalls     = 0; /* As of the end of startup. */
+
+static GOptionEntry entries[] = {
+	{ "syscalls", 'n', 0, G_OPTION_ARG_INT, &syscalls,
+	  "Number of system calls to instrument", "N" },
+	{ "stride", 's', 0, G_OPTION_ARG_INT, &stride,
+	  "Bytes between consecutive system-call functions", "BYTES" },
+	{ "hypercall-usec", 'c', 0, G_OPTION_ARG_INT, &hypercall_usec,
+	  "Simulated cost of each hypercall", "USEC" },
+	{ "memory", 'm', 0, G_OPTION_ARG_INT, &memory,
+	  "Guest memory", "MiB" },
+	{ "lazy", 'l', 0, G_OPTION_ARG_NONE, &lazy,
+	  "Instrument each system call upon its first use", NULL },
+	{ "revision", 'r', 0, G_OPTION_ARG_STRING, &revision,
+	  "Revision to record along with the timings", "REV" },
+	{ NULL }
+};
+
+static void *
+bench_syscall_cb(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid,
+                 gt_tid_t tid, void *user_data)
+{
+	return NULL;
+}
+
+static void
+bench_sysret_cb(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid,
+                gt_tid_t tid, void *user_data)
+{
+}
+
+/*
+ * Stop as soon as the loop listens; but first, in lazy mode, execute each
+ * system call once, and count those which guestrace let the guest run.
+ */
+static void
+bench_on_listen(void *data)
+{
+	gint64 start = g_get_monotonic_time();
+
+	hypercalls = sim_guest_hypercalls();
+
+	for (int i = 0; lazy && i < syscalls; i++) {
+		if (sim_guest_execute(vmi_translate_ksym2v(NULL, callbacks[i].name))) {
+			materialized++;
+		}
+	}
+
+	materialize_us = g_get_monotonic_time() - start;
+
+	gt_loop_quit(data);
+}
+
+int
+main (int argc, char **argv)
+{
+	int rc = EXIT_FAILURE, traced;
+	GError *error = NULL;
+	GOptionContext *context;
+	GTLoop *loop = NULL;
+	char *report = NULL, date[32];
+	size_t report_len = 0;
+	FILE *stream;
+	time_t now = time(NULL);
+
+	context = g_option_context_new(NULL);
+	g_option_context_add_main_entries(context, entries, NULL);
+	if (!g_option_context_parse(context, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		goto done;
+	}
+
+	sim_guest_config config = {
+		.mem_size       = (uint64_t) memory << 20,
+		.vcpus          = 1,
+		.symbol_stride  = stride,
+		.hypercall_usec = hypercall_usec,
+		.on_listen      = bench_on_listen,
+	};
+
+	sim_guest_configure(&config);
+
+	loop = gt_loop_new("sim-guest");
+	if (NULL == loop) {
+		fprintf(stderr, "could not initialize guestrace\n");
+		goto done;
+	}
+
+	config.on_listen_data = loop;
+	sim_guest_configure(&config);
+
+	gt_loop_set_lazy(loop, lazy);
+
+	callbacks = g_new0(GTSyscallCallback, syscalls + 1);
+	for (int i = 0; i < syscalls; i++) {
+		callbacks[i].name       = g_strdup_printf("sim_sys_%04d", i);
+		callbacks[i].syscall_cb = bench_syscall_cb;
+		callbacks[i].sysret_cb  = bench_sysret_cb;
+	}
+
+	traced = gt_loop_set_cbs(loop, callbacks);
+	if (traced != syscalls) {
+		fprintf(stderr, "instrumented %d of %d system calls\n", traced, syscalls);
+		goto done;
+	}
+
+	gt_loop_run(loop);
+
+	if (lazy && materialized != syscalls) {
+		fprintf(stderr, "materialized %d of %d system calls\n", materialized, syscalls);
+		goto done;
+	}
+
+	stream = open_memstream(&report, &report_len);
+	if (NULL == stream) {
+		goto done;
+	}
+
+	gt_loop_print_startup_report(loop, stream);
+	fclose(stream);
+	g_strchomp(report);
+
+	strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+	printf("{\"date\": \"%s\", \"revision\": \"%s\", \"syscalls\": %d, "
+	       "\"stride\": %d, \"hypercall_us\": %d, \"memory_mib\": %d, "
+	       "\"lazy\": %s, \"materialize_us\": %" PRId64 ", "
+	       "\"sim_hypercalls\": %" PRIu64 ", \"startup\": %s}\n",
+	        date,
+	        revision ? revision : "unknown",
+	        syscalls,
+	        stride,
+	        hypercall_usec,
+	        memory,
+	        lazy ? "true" : "false",
+	        materialize_us,
+	        hypercalls,
+	        report);
+
+	rc = EXIT_SUCCESS;
+
+done:
+	gt_loop_free(loop);
+
+	if (NULL != callbacks) {
+		for (int i = 0; i < syscalls; i++) {
+			g_free(callbacks[i].name);
+		}
+		g_free(callbacks);
+	}
+
+	free(report);
+	g_free(revision);
+	g_option_context_free(context);
+
+	return rc;
+}
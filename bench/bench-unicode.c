@@ -0,0 +1,212 @@
+#define _GNU_SOURCE
+
+#include <glib.h>
+#include <iconv.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "scratch.h"
+#include "utf16.h"
+
+/*
+ * Measure the conversion of Windows UNICODE_STRINGs to UTF-8, both as
+ * libvmi's vmi_convert_str_encoding() does it, with iconv and the heap,
+ * and as gt_guest_read_unicode_string() does it, and print the timings as
+ * one line of JSON. The strings come from a corpus of Windows paths, one
+ * per line, in UTF-8; the benchmark first checks that both conversions
+ * agree on each of them. "make bench" appends the line to
+ * unicode-timings.jsonl.
+ */
+
+static gint    rounds   = 2000;
+static gchar  *corpus   = "windows-paths.txt";
+static gchar  *revision = NULL;
+
+static GOptionEntry entries[] = {
+	{ "rounds", 'n', 0, G_OPTION_ARG_INT, &rounds,
+	  "Number of times to convert the corpus", "N" },
+	{ "corpus", 'c', 0, G_OPTION_ARG_FILENAME, &corpus,
+	  "File of paths, one per line", "FILE" },
+	{ "revision", 'r', 0, G_OPTION_ARG_STRING, &revision,
+	  "Revision to record along with the timings", "REV" },
+	{ NULL }
+};
+
+typedef struct bench_string {
+	uint8_t *utf16;
+	size_t   length; /* In bytes, as in UNICODE_STRING.Length. */
+	char    *utf8;
+} bench_string;
+
+/*
+ * The conversion guestrace used to make through libvmi: copy the
+ * characters into a buffer of their own, open a converter, convert into a
+ * buffer of the result's own, and free it all once printed.
+ */
+static char *
+bench_convert_iconv(const bench_string *str)
+{
+	char *contents, *in, *out, *result = NULL;
+	size_t in_left = str->length, out_left = 2 * str->length + 1;
+	iconv_t cd;
+
+	contents = malloc(str->length + 2);
+	memcpy(contents, str->utf16, str->length);
+
+	cd = iconv_open("UTF-8", "UTF-16LE");
+	if ((iconv_t) -1 == cd) {
+		goto done;
+	}
+
+	result = calloc(1, out_left);
+	in     = contents;
+	out    = result;
+	if ((size_t) -1 == iconv(cd, &in, &in_left, &out, &out_left)) {
+		free(result);
+		result = NULL;
+	}
+
+	iconv_close(cd);
+
+done:
+	free(contents);
+	return result;
+}
+
+static char *
+bench_convert_scratch(gt_scratch *scratch, const bench_string *str)
+{
+	char *result = gt_scratch_alloc(scratch, GT_UTF8_MAX(str->length / 2));
+
+	gt_utf16le_to_utf8(str->utf16, str->length / 2, result);
+
+	return result;
+}
+
+int
+main (int argc, char **argv)
+{
+	int rc = EXIT_FAILURE;
+	GError *error = NULL;
+	GOptionContext *context;
+	GArray *strings = NULL;
+	gt_scratch *scratch = NULL;
+	gt_scratch_stats scratch_stats = { 0 };
+	gchar *contents = NULL, **lines = NULL;
+	size_t bytes = 0, ascii = 0;
+	gint64 begin, iconv_usec, scratch_usec;
+	volatile size_t sink = 0;
+	char date[32];
+	time_t now = time(NULL);
+
+	context = g_option_context_new(NULL);
+	g_option_context_add_main_entries(context, entries, NULL);
+	if (!g_option_context_parse(context, &argc, &argv, &error)
+	 || !g_file_get_contents(corpus, &contents, NULL, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		goto done;
+	}
+
+	strings = g_array_new(FALSE, TRUE, sizeof(bench_string));
+	lines   = g_strsplit(contents, "\n", -1);
+	for (int i = 0; NULL != lines[i]; i++) {
+		bench_string str;
+		gsize length;
+
+		if ('\0' == lines[i][0]) {
+			continue;
+		}
+
+		str.utf8  = lines[i];
+		str.utf16 = (uint8_t *) g_convert(lines[i], -1, "UTF-16LE", "UTF-8",
+		                                  NULL, &length, &error);
+		if (NULL == str.utf16) {
+			fprintf(stderr, "%s: %s\n", lines[i], error->message);
+			g_error_free(error);
+			goto done;
+		}
+
+		str.length = length;
+		bytes     += length;
+		ascii     += str.length / 2 == strlen(str.utf8);
+		g_array_append_val(strings, str);
+	}
+
+	scratch = gt_scratch_new(64 << 10, &scratch_stats);
+
+	/* Both conversions must reproduce the corpus. */
+	for (int i = 0; i < strings->len; i++) {
+		bench_string *str = &g_array_index(strings, bench_string, i);
+		char *expected = bench_convert_iconv(str);
+
+		if (NULL == expected
+		 || strcmp(expected, str->utf8)
+		 || strcmp(bench_convert_scratch(scratch, str), str->utf8)) {
+			fprintf(stderr, "conversions disagree on %s\n", str->utf8);
+			free(expected);
+			goto done;
+		}
+
+		free(expected);
+		gt_scratch_reset(scratch);
+	}
+
+	begin = g_get_monotonic_time();
+	for (int round = 0; round < rounds; round++) {
+		for (int i = 0; i < strings->len; i++) {
+			char *result = bench_convert_iconv(&g_array_index(strings, bench_string, i));
+
+			sink += result[0];
+			free(result);
+		}
+	}
+	iconv_usec = g_get_monotonic_time() - begin;
+
+	/* The event loop resets the arena after each event. */
+	begin = g_get_monotonic_time();
+	for (int round = 0; round < rounds; round++) {
+		for (int i = 0; i < strings->len; i++) {
+			sink += bench_convert_scratch(scratch, &g_array_index(strings, bench_string, i))[0];
+			gt_scratch_reset(scratch);
+		}
+	}
+	scratch_usec = g_get_monotonic_time() - begin;
+
+	strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+	printf("{\"date\": \"%s\", \"revision\": \"%s\", \"strings\": %u, "
+	       "\"ascii_strings\": %zu, \"utf16_bytes\": %zu, \"rounds\": %d, "
+	       "\"iconv_ns_per_string\": %.1f, \"scratch_ns_per_string\": %.1f, "
+	       "\"speedup\": %.2f}\n",
+	        date,
+	        revision ? revision : "unknown",
+	        strings->len,
+	        ascii,
+	        bytes,
+	        rounds,
+	        iconv_usec * 1000.0 / ((double) rounds * strings->len),
+	        scratch_usec * 1000.0 / ((double) rounds * strings->len),
+	        scratch_usec ? (double) iconv_usec / scratch_usec : 0.0);
+
+	rc = EXIT_SUCCESS;
+
+done:
+	if (NULL != strings) {
+		for (int i = 0; i < strings->len; i++) {
+			g_free(g_array_index(strings, bench_string, i).utf16);
+		}
+		g_array_free(strings, TRUE);
+	}
+
+	gt_scratch_free(scratch);
+	g_strfreev(lines);
+	g_free(contents);
+	g_free(revision);
+	g_option_context_free(context);
+
+	return rc;
+}
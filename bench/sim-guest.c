@@ -0,0 +1,700 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <glib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <libvmi/libvmi.h>
+#include <libvmi/events.h>
+#include <libxl.h>
+#include <libxl_utils.h>
+#include <xenctrl.h>
+#include <xen/hvm/save.h>
+
+#include "sim-guest.h"
+
+#define SIM_PAGE_SIZE   4096
+#define SIM_DOMID       1
+
+/* The kernel image is mapped at SIM_KERNEL_BASE and loaded at SIM_KERNEL_PHYS. */
+#define SIM_KERNEL_BASE 0xffffffff81000000UL
+#define SIM_KERNEL_PHYS 0x1000000UL
+
+/*
+ * The system-call handler pointed to by LSTAR: swapgs; call; int 3. This
+ * gives guestrace its return point and trampoline.
+ */
+static const uint8_t SIM_LSTAR_CODE[] = {
+	0x0f, 0x01, 0xf8,
+	0xe8, 0x00, 0x00, 0x00, 0x00,
+	0xcc,
+};
+
+static struct {
+	sim_guest_config config;
+	int         fd;           /* Guest memory. */
+	uint64_t    fd_size;
+	uint64_t    max_memkb;
+	addr_t      next_symbol;  /* Next address handed out to a symbol. */
+	GHashTable *symbols;
+	GHashTable *restrictions; /* Of the access set by vmi_set_mem_event(), by gfn. */
+	GPtrArray  *mem_events;   /* The generic memory events registered. */
+	uint64_t    hypercalls;
+} sim = {
+	.config = {
+		.mem_size      = 1024UL << 20,
+		.vcpus         = 1,
+		.symbol_stride = 512,
+	},
+	.fd = -1,
+};
+
+void
+sim_guest_configure(const sim_guest_config *config)
+{
+	sim.config = *config;
+}
+
+uint64_t
+sim_guest_hypercalls(void)
+{
+	return sim.hypercalls;
+}
+
+/* Write to the kernel's memory, as the guest itself would. */
+bool
+sim_guest_write(addr_t vaddr, const void *buf, size_t count)
+{
+	addr_t paddr = vmi_translate_kv2p(NULL, vaddr);
+
+	return 0 != paddr && count == pwrite(sim.fd, buf, count, paddr);
+}
+
+/*
+ * Execute the kernel's code at vaddr, as the guest would. If an access
+ * restriction covers the execution of its frame, hand the violation to the
+ * first generic memory event whose access mask covers it, as libvmi does.
+ * Returns false if the frame remains restricted, as when no event covers
+ * the violation or its callback did not lift the restriction.
+ */
+bool
+sim_guest_execute(addr_t vaddr)
+{
+	xen_pfn_t gfn = vmi_translate_kv2p(NULL, vaddr) / SIM_PAGE_SIZE;
+	vmi_mem_access_t access;
+
+	access = GPOINTER_TO_INT(g_hash_table_lookup(sim.restrictions, GSIZE_TO_POINTER(gfn)));
+	if (!(access & VMI_MEMACCESS_X)) {
+		return true;
+	}
+
+	for (guint i = 0; i < sim.mem_events->len; i++) {
+		vmi_event_t *registered = g_ptr_array_index(sim.mem_events, i);
+		vmi_event_t event;
+
+		if (!(registered->mem_event.in_access & VMI_MEMACCESS_X)) {
+			continue;
+		}
+
+		event                      = *registered;
+		event.mem_event.gfn        = gfn;
+		event.mem_event.gla        = vaddr;
+		event.mem_event.out_access = VMI_MEMACCESS_X;
+
+		registered->callback((vmi_instance_t) &sim, &event);
+		break;
+	}
+
+	access = GPOINTER_TO_INT(g_hash_table_lookup(sim.restrictions, GSIZE_TO_POINTER(gfn)));
+
+	return !(access & VMI_MEMACCESS_X);
+}
+
+/* Account for a hypercall, and spin for as long as Xen would take. */
+static void
+sim_hypercall(void)
+{
+	gint64 until = g_get_monotonic_time() + sim.config.hypercall_usec;
+
+	sim.hypercalls++;
+
+	while (g_get_monotonic_time() < until) {
+		;
+	}
+}
+
+static bool
+sim_ensure_gfn(xen_pfn_t gfn)
+{
+	uint64_t size = (gfn + 1) * SIM_PAGE_SIZE;
+
+	if (size > sim.fd_size) {
+		if (0 != ftruncate(sim.fd, size)) {
+			return false;
+		}
+		sim.fd_size = size;
+	}
+
+	return true;
+}
+
+/* libvmi. */
+
+status_t
+vmi_init(vmi_instance_t *vmi, uint32_t flags, const char *name)
+{
+	status_t status = VMI_FAILURE;
+
+	sim.fd = memfd_create("sim-guest", 0);
+	if (-1 == sim.fd) {
+		goto done;
+	}
+
+	sim.fd_size   = 0;
+	sim.max_memkb = sim.config.mem_size >> 10;
+	if (!sim_ensure_gfn(sim.config.mem_size / SIM_PAGE_SIZE - 1)) {
+		goto done;
+	}
+
+	if (sizeof SIM_LSTAR_CODE != pwrite(sim.fd,
+	                                    SIM_LSTAR_CODE,
+	                                    sizeof SIM_LSTAR_CODE,
+	                                    SIM_KERNEL_PHYS)) {
+		goto done;
+	}
+
+	sim.next_symbol = SIM_KERNEL_BASE + SIM_PAGE_SIZE;
+	sim.symbols      = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	sim.restrictions = g_hash_table_new(NULL, NULL);
+	sim.mem_events   = g_ptr_array_new();
+	sim.hypercalls   = 0;
+
+	*vmi   = (vmi_instance_t) &sim;
+	status = VMI_SUCCESS;
+
+done:
+	return status;
+}
+
+status_t
+vmi_destroy(vmi_instance_t vmi)
+{
+	g_hash_table_destroy(sim.symbols);
+	g_hash_table_destroy(sim.restrictions);
+	g_ptr_array_free(sim.mem_events, TRUE);
+	close(sim.fd);
+	sim.fd = -1;
+
+	return VMI_SUCCESS;
+}
+
+os_t
+vmi_get_ostype(vmi_instance_t vmi)
+{
+	return VMI_OS_LINUX;
+}
+
+uint8_t
+vmi_get_address_width(vmi_instance_t vmi)
+{
+	return 8;
+}
+
+unsigned int
+vmi_get_num_vcpus(vmi_instance_t vmi)
+{
+	return sim.config.vcpus;
+}
+
+status_t
+vmi_pause_vm(vmi_instance_t vmi)
+{
+	sim_hypercall();
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_resume_vm(vmi_instance_t vmi)
+{
+	sim_hypercall();
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_get_vcpureg(vmi_instance_t vmi, reg_t *value, registers_t reg, unsigned long vcpu)
+{
+	sim_hypercall();
+
+	*value = MSR_LSTAR == reg ? SIM_KERNEL_BASE : 0;
+
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_set_vcpureg(vmi_instance_t vmi, reg_t value, registers_t reg, unsigned long vcpu)
+{
+	sim_hypercall();
+	return VMI_SUCCESS;
+}
+
+addr_t
+vmi_translate_kv2p(vmi_instance_t vmi, addr_t vaddr)
+{
+	if (vaddr < SIM_KERNEL_BASE) {
+		return 0;
+	}
+
+	return vaddr - SIM_KERNEL_BASE + SIM_KERNEL_PHYS;
+}
+
+/* Each symbol lives symbol_stride bytes beyond the last one looked up. */
+addr_t
+vmi_translate_ksym2v(vmi_instance_t vmi, const char *symbol)
+{
+	addr_t va = GPOINTER_TO_SIZE(g_hash_table_lookup(sim.symbols, symbol));
+
+	if (0 == va) {
+		va = sim.next_symbol;
+		sim.next_symbol += sim.config.symbol_stride;
+		g_hash_table_insert(sim.symbols, g_strdup(symbol), GSIZE_TO_POINTER(va));
+	}
+
+	return va;
+}
+
+vmi_pid_t
+vmi_dtb_to_pid(vmi_instance_t vmi, addr_t dtb)
+{
+	return 0;
+}
+
+/* Every process shares the kernel's page tables. */
+addr_t
+vmi_pid_to_dtb(vmi_instance_t vmi, vmi_pid_t pid)
+{
+	return SIM_KERNEL_PHYS;
+}
+
+/*
+ * Likewise. As the simulated guest has no page tables, report each page as
+ * mapped by the same entry, in the first page of memory, which is zero and
+ * never changes.
+ */
+status_t
+vmi_pagetable_lookup_extended(vmi_instance_t vmi, addr_t dtb, addr_t vaddr, page_info_t *info)
+{
+	memset(info, 0, sizeof *info);
+	info->vaddr                  = vaddr;
+	info->dtb                    = dtb;
+	info->paddr                  = vmi_translate_kv2p(vmi, vaddr);
+	info->size                   = VMI_PS_4KB;
+	info->x86_ia32e.pte_location = SIM_PAGE_SIZE - sizeof(uint64_t);
+
+	return 0 == info->paddr ? VMI_FAILURE : VMI_SUCCESS;
+}
+
+void
+vmi_v2pcache_flush(vmi_instance_t vmi, addr_t dtb)
+{
+}
+
+size_t
+vmi_read_pa(vmi_instance_t vmi, addr_t paddr, void *buf, size_t count)
+{
+	ssize_t size = pread(sim.fd, buf, count, paddr);
+
+	return size < 0 ? 0 : size;
+}
+
+status_t
+vmi_read_64_pa(vmi_instance_t vmi, addr_t paddr, uint64_t *value)
+{
+	return sizeof *value == vmi_read_pa(vmi, paddr, value, sizeof *value)
+	     ? VMI_SUCCESS
+	     : VMI_FAILURE;
+}
+
+status_t
+vmi_write_64_pa(vmi_instance_t vmi, addr_t paddr, uint64_t *value)
+{
+	return sizeof *value == pwrite(sim.fd, value, sizeof *value, paddr)
+	     ? VMI_SUCCESS
+	     : VMI_FAILURE;
+}
+
+/* The simulated guest has no processes; kernel reads go straight to memory. */
+uint64_t
+vmi_get_offset(vmi_instance_t vmi, const char *offset_name)
+{
+	return 0;
+}
+
+const char *
+vmi_get_rekall_path(vmi_instance_t vmi)
+{
+	return NULL;
+}
+
+size_t
+vmi_read_va(vmi_instance_t vmi, addr_t vaddr, vmi_pid_t pid, void *buf, size_t count)
+{
+	addr_t paddr = vmi_translate_kv2p(vmi, vaddr);
+
+	return 0 == paddr ? 0 : vmi_read_pa(vmi, paddr, buf, count);
+}
+
+status_t
+vmi_read_32_va(vmi_instance_t vmi, addr_t vaddr, vmi_pid_t pid, uint32_t *value)
+{
+	return sizeof *value == vmi_read_va(vmi, vaddr, pid, value, sizeof *value)
+	     ? VMI_SUCCESS
+	     : VMI_FAILURE;
+}
+
+status_t
+vmi_read_64_va(vmi_instance_t vmi, addr_t vaddr, vmi_pid_t pid, uint64_t *value)
+{
+	return sizeof *value == vmi_read_va(vmi, vaddr, pid, value, sizeof *value)
+	     ? VMI_SUCCESS
+	     : VMI_FAILURE;
+}
+
+status_t
+vmi_read_addr_va(vmi_instance_t vmi, addr_t vaddr, vmi_pid_t pid, addr_t *value)
+{
+	return sizeof *value == vmi_read_va(vmi, vaddr, pid, value, sizeof *value)
+	     ? VMI_SUCCESS
+	     : VMI_FAILURE;
+}
+
+status_t
+vmi_read_addr_ksym(vmi_instance_t vmi, char *sym, addr_t *value)
+{
+	return vmi_read_addr_va(vmi, vmi_translate_ksym2v(vmi, sym), 0, value);
+}
+
+/* A Windows UNICODE_STRING: lengths in bytes, and then the buffer. */
+unicode_string_t *
+vmi_read_unicode_str_va(vmi_instance_t vmi, addr_t vaddr, vmi_pid_t pid)
+{
+	unicode_string_t *str = NULL;
+	uint16_t length;
+	addr_t buffer;
+
+	if (sizeof length != vmi_read_va(vmi, vaddr, pid, &length, sizeof length)
+	 || VMI_SUCCESS != vmi_read_addr_va(vmi, vaddr + 8, pid, &buffer)) {
+		goto done;
+	}
+
+	str           = g_new0(unicode_string_t, 1);
+	str->length   = length;
+	str->encoding = "UTF-16";
+	str->contents = g_malloc(length + 2);
+
+	if (length != vmi_read_va(vmi, buffer, pid, str->contents, length)) {
+		vmi_free_unicode_str(str);
+		str = NULL;
+		goto done;
+	}
+
+	str->contents[length] = str->contents[length + 1] = '\0';
+
+done:
+	return str;
+}
+
+status_t
+vmi_convert_str_encoding(const unicode_string_t *in, unicode_string_t *out, const char *outencoding)
+{
+	gsize length;
+
+	out->contents = (uint8_t *) g_convert((const gchar *) in->contents,
+	                                      in->length,
+	                                      outencoding,
+	                                      "UTF-16LE",
+	                                      NULL,
+	                                      &length,
+	                                      NULL);
+	out->length   = length;
+	out->encoding = outencoding;
+
+	return NULL == out->contents ? VMI_FAILURE : VMI_SUCCESS;
+}
+
+void
+vmi_free_unicode_str(unicode_string_t *str)
+{
+	g_free(str->contents);
+	g_free(str);
+}
+
+/* Keep the generic memory events, for sim_guest_execute() to deliver to. */
+status_t
+vmi_register_event(vmi_instance_t vmi, vmi_event_t *event)
+{
+	sim_hypercall();
+
+	if (VMI_EVENT_MEMORY == event->type && event->mem_event.generic) {
+		g_ptr_array_add(sim.mem_events, event);
+	}
+
+	return VMI_SUCCESS;
+}
+
+/* The simulated guest has but one view to restrict; ignore slat_id. */
+status_t
+vmi_set_mem_event(vmi_instance_t vmi, addr_t gfn, vmi_mem_access_t access, uint16_t slat_id)
+{
+	sim_hypercall();
+
+	if (VMI_MEMACCESS_N == access) {
+		g_hash_table_remove(sim.restrictions, GSIZE_TO_POINTER(gfn));
+	} else {
+		g_hash_table_insert(sim.restrictions, GSIZE_TO_POINTER(gfn), GINT_TO_POINTER(access));
+	}
+
+	return VMI_SUCCESS;
+}
+
+status_t
+vmi_events_listen(vmi_instance_t vmi, uint32_t timeout)
+{
+	if (NULL != sim.config.on_listen) {
+		sim.config.on_listen(sim.config.on_listen_data);
+	} else {
+		g_usleep(timeout * 1000);
+	}
+
+	return VMI_SUCCESS;
+}
+
+/* libxenctrl. */
+
+xc_interface *
+xc_interface_open(xentoollog_logger *logger,
+                  xentoollog_logger *dombuild_logger,
+                  unsigned open_flags)
+{
+	return (xc_interface *) &sim;
+}
+
+int
+xc_interface_close(xc_interface *xch)
+{
+	return 0;
+}
+
+int
+xc_domain_getinfo(xc_interface *xch,
+                  uint32_t first_domid,
+                  unsigned int max_doms,
+                  xc_dominfo_t *info)
+{
+	sim_hypercall();
+
+	memset(info, 0, sizeof *info);
+	info->domid     = SIM_DOMID;
+	info->max_memkb = sim.max_memkb;
+
+	return 1;
+}
+
+int
+xc_domain_setmaxmem(xc_interface *xch, uint32_t domid, uint64_t max_memkb)
+{
+	sim_hypercall();
+	sim.max_memkb = max_memkb;
+	return 0;
+}
+
+int
+xc_domain_maximum_gpfn(xc_interface *xch, domid_t domid, xen_pfn_t *gpfns)
+{
+	sim_hypercall();
+	*gpfns = sim.fd_size / SIM_PAGE_SIZE - 1;
+	return 0;
+}
+
+int
+xc_domain_decrease_reservation_exact(xc_interface *xch,
+                                     uint32_t domid,
+                                     unsigned long nr_extents,
+                                     unsigned int extent_order,
+                                     xen_pfn_t *extent_start)
+{
+	sim_hypercall();
+	return 0;
+}
+
+int
+xc_domain_populate_physmap_exact(xc_interface *xch,
+                                 uint32_t domid,
+                                 unsigned long nr_extents,
+                                 unsigned int extent_order,
+                                 unsigned int mem_flags,
+                                 xen_pfn_t *extent_start)
+{
+	sim_hypercall();
+
+	for (unsigned long i = 0; i < nr_extents; i++) {
+		if (!sim_ensure_gfn(extent_start[i])) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/* Map each page of guest memory in place, as privcmd would. */
+void *
+xc_map_foreign_pages(xc_interface *xch,
+                     uint32_t dom,
+                     int prot,
+                     const xen_pfn_t *arr,
+                     int num)
+{
+	uint8_t *map;
+
+	sim_hypercall();
+
+	map = mmap(NULL, num * SIM_PAGE_SIZE, PROT_NONE,
+	           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (MAP_FAILED == map) {
+		return NULL;
+	}
+
+	for (int i = 0; i < num; i++) {
+		if ((arr[i] + 1) * SIM_PAGE_SIZE > sim.fd_size
+		 || MAP_FAILED == mmap(map + i * SIM_PAGE_SIZE,
+		                       SIM_PAGE_SIZE,
+		                       prot,
+		                       MAP_SHARED | MAP_FIXED,
+		                       sim.fd,
+		                       arr[i] * SIM_PAGE_SIZE)) {
+			munmap(map, num * SIM_PAGE_SIZE);
+			errno = EINVAL;
+			return NULL;
+		}
+	}
+
+	return map;
+}
+
+/* The guest's TSC ticks at 1 GHz from the host's monotonic clock. */
+#define SIM_TSC_KHZ 1000000
+
+int
+xc_domain_hvm_getcontext_partial(xc_interface *xch,
+                                 uint32_t domid,
+                                 uint16_t typecode,
+                                 uint16_t instance,
+                                 void *ctxt_buf,
+                                 uint32_t size)
+{
+	struct hvm_hw_cpu *cpu = ctxt_buf;
+
+	sim_hypercall();
+
+	if (HVM_SAVE_CODE(CPU) != typecode || size < sizeof *cpu) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	memset(cpu, 0, sizeof *cpu);
+	cpu->tsc = g_get_monotonic_time() * (SIM_TSC_KHZ / 1000);
+
+	return 0;
+}
+
+int
+xc_domain_get_tsc_info(xc_interface *xch,
+                       uint32_t domid,
+                       uint32_t *tsc_mode,
+                       uint64_t *elapsed_nsec,
+                       uint32_t *gtsc_khz,
+                       uint32_t *incarnation)
+{
+	sim_hypercall();
+
+	*tsc_mode     = 0;
+	*elapsed_nsec = 0;
+	*gtsc_khz     = SIM_TSC_KHZ;
+	*incarnation  = 0;
+
+	return 0;
+}
+
+int
+xc_altp2m_get_domain_state(xc_interface *handle, domid_t dom, bool *state)
+{
+	sim_hypercall();
+	*state = true;
+	return 0;
+}
+
+int
+xc_altp2m_set_domain_state(xc_interface *handle, domid_t dom, bool state)
+{
+	sim_hypercall();
+	return 0;
+}
+
+int
+xc_altp2m_create_view(xc_interface *handle,
+                      domid_t domid,
+                      xenmem_access_t default_access,
+                      uint16_t *view_id)
+{
+	sim_hypercall();
+	*view_id = 1;
+	return 0;
+}
+
+int
+xc_altp2m_destroy_view(xc_interface *handle, domid_t domid, uint16_t view_id)
+{
+	sim_hypercall();
+	return 0;
+}
+
+int
+xc_altp2m_switch_to_view(xc_interface *handle, domid_t domid, uint16_t view_id)
+{
+	sim_hypercall();
+	return 0;
+}
+
+int
+xc_altp2m_change_gfn(xc_interface *handle,
+                     domid_t domid,
+                     uint16_t view_id,
+                     xen_pfn_t old_gfn,
+                     xen_pfn_t new_gfn)
+{
+	sim_hypercall();
+	return 0;
+}
+
+/* libxenlight. */
+
+int
+libxl_ctx_alloc(libxl_ctx **pctx, int version, unsigned flags, xentoollog_logger *lg)
+{
+	*pctx = (libxl_ctx *) &sim;
+	return 0;
+}
+
+int
+libxl_ctx_free(libxl_ctx *ctx)
+{
+	return 0;
+}
+
+int
+libxl_name_to_domid(libxl_ctx *ctx, const char *name, uint32_t *domid)
+{
+	*domid = SIM_DOMID;
+	return 0;
+}
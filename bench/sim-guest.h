@@ -0,0 +1,34 @@
+#ifndef SIM_GUEST_H
+#define SIM_GUEST_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <libvmi/libvmi.h>
+
+/*
+ * A simulated Linux guest which stands in for libvmi, libxenctrl, and
+ * libxenlight. It provides only the calls libguestrace makes while
+ * instrumenting a guest, and backs the guest's memory with an anonymous
+ * file so that foreign mappings behave as they do on Xen. This allows
+ * measuring guestrace's setup, and its handling of events which a benchmark
+ * feeds it, without a hypervisor.
+ */
+
+typedef struct sim_guest_config {
+	uint64_t mem_size;       /* Initial guest memory in bytes. */
+	unsigned vcpus;
+	unsigned symbol_stride;  /* Bytes between consecutive kernel symbols. */
+	unsigned hypercall_usec; /* Time each hypercall spends in Xen. */
+
+	/* Called by vmi_events_listen(); NULL means sleep for the timeout. */
+	void   (*on_listen) (void *data);
+	void    *on_listen_data;
+} sim_guest_config;
+
+void     sim_guest_configure(const sim_guest_config *config);
+uint64_t sim_guest_hypercalls(void);
+bool     sim_guest_write(addr_t vaddr, const void *buf, size_t count);
+bool     sim_guest_execute(addr_t vaddr);
+
+#endif
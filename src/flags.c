@@ -0,0 +1,143 @@
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "flags.h"
+
+#define GT_FLAGS_COUNT(flags) (sizeof (flags) / sizeof (flags)[0])
+
+/*
+ * Windows ACCESS_MASK. The masks which grant each of the common sets of
+ * rights print alone; otherwise the names follow the order of their bits,
+ * with the names which share a bit together.
+ */
+static const gt_flag ACCESS_MASK_FLAGS[] = {
+	GT_FLAG_ALL(0x1f01ff, "OWNER"),
+	GT_FLAG_ALL(0x1200a9, "READ_ONLY"),
+	GT_FLAG_ALL(0x1301bf, "CONTRIBUTOR"),
+	GT_FLAG_BIT(0x000001, "FILE_READ_DATA|FILE_LIST_DIRECTORY"),
+	GT_FLAG_BIT(0x000002, "FILE_WRITE_DATA|FILE_ADD_FILE"),
+	GT_FLAG_BIT(0x000004, "FILE_APPEND_DATA|FILE_ADD_SUBDIRECTORY"),
+	GT_FLAG_BIT(0x000008, "FILE_READ_EA"),
+	GT_FLAG_BIT(0x000010, "FILE_WRITE_EA"),
+	GT_FLAG_BIT(0x000020, "FILE_EXECUTE|FILE_TRAVERSE"),
+	GT_FLAG_BIT(0x000040, "FILE_DELETE_CHILD"),
+	GT_FLAG_BIT(0x000080, "FILE_READ_ATTRIBUTES"),
+	GT_FLAG_BIT(0x000100, "FILE_WRITE_ATTRIBUTES"),
+	GT_FLAG_BIT(0x010000, "DELETE"),
+	GT_FLAG_BIT(0x020000, "READ_CONTROL"),
+	GT_FLAG_BIT(0x040000, "WRITE_DAC"),
+	GT_FLAG_BIT(0x080000, "WRITE_OWNER"),
+	GT_FLAG_BIT(0x100000, "SYNCHRONIZE"),
+};
+
+/*
+ * Linux open() flags on x86-64, as the guest defines them rather than as
+ * the host does. O_SYNC and O_TMPFILE include O_DSYNC and O_DIRECTORY
+ * respectively, so they come first.
+ */
+static const gt_flag LINUX_OPEN_FLAGS[] = {
+	GT_FLAG(00000003, 00000000, "O_RDONLY"),
+	GT_FLAG(00000003, 00000001, "O_WRONLY"),
+	GT_FLAG(00000003, 00000002, "O_RDWR"),
+	GT_FLAG_BIT(00000100, "O_CREAT"),
+	GT_FLAG_BIT(00000200, "O_EXCL"),
+	GT_FLAG_BIT(00000400, "O_NOCTTY"),
+	GT_FLAG_BIT(00001000, "O_TRUNC"),
+	GT_FLAG_BIT(00002000, "O_APPEND"),
+	GT_FLAG_BIT(00004000, "O_NONBLOCK"),
+	GT_FLAG_BIT(04010000, "O_SYNC"),
+	GT_FLAG_BIT(00010000, "O_DSYNC"),
+	GT_FLAG_BIT(00020000, "O_ASYNC"),
+	GT_FLAG_BIT(00040000, "O_DIRECT"),
+	GT_FLAG_BIT(00100000, "O_LARGEFILE"),
+	GT_FLAG_BIT(020200000, "O_TMPFILE"),
+	GT_FLAG_BIT(00200000, "O_DIRECTORY"),
+	GT_FLAG_BIT(00400000, "O_NOFOLLOW"),
+	GT_FLAG_BIT(01000000, "O_NOATIME"),
+	GT_FLAG_BIT(02000000, "O_CLOEXEC"),
+	GT_FLAG_BIT(010000000, "O_PATH"),
+};
+
+/* Linux mmap() and mprotect() protections. */
+static const gt_flag LINUX_PROT_FLAGS[] = {
+	GT_FLAG_BIT(0x00000001, "PROT_READ"),
+	GT_FLAG_BIT(0x00000002, "PROT_WRITE"),
+	GT_FLAG_BIT(0x00000004, "PROT_EXEC"),
+	GT_FLAG_BIT(0x00000008, "PROT_SEM"),
+	GT_FLAG_BIT(0x01000000, "PROT_GROWSDOWN"),
+	GT_FLAG_BIT(0x02000000, "PROT_GROWSUP"),
+};
+
+/* Unlike the other tables, this drops the bits it cannot name. */
+const gt_flag_table GT_FLAGS_ACCESS_MASK = {
+	ACCESS_MASK_FLAGS, GT_FLAGS_COUNT(ACCESS_MASK_FLAGS), "NONE", false
+};
+
+const gt_flag_table GT_FLAGS_LINUX_OPEN = {
+	LINUX_OPEN_FLAGS, GT_FLAGS_COUNT(LINUX_OPEN_FLAGS), "0", true
+};
+
+const gt_flag_table GT_FLAGS_LINUX_PROT = {
+	LINUX_PROT_FLAGS, GT_FLAGS_COUNT(LINUX_PROT_FLAGS), "PROT_NONE", true
+};
+
+/* Append what of str fits in buf, and count all of it in *len. */
+static void
+gt_flags_append(char *buf, size_t size, size_t *len, const char *str, size_t n)
+{
+	if (*len < size) {
+		size_t room = size - *len;
+
+		memcpy(buf + *len, str, n < room ? n : room);
+	}
+
+	*len += n;
+}
+
+/*
+ * Print value as the names of its bits, separated by "|", into buf. Each
+ * entry of table which matches the bits of value which no earlier entry
+ * named contributes its name. Like snprintf(), this writes at most size
+ * bytes, terminator included, and returns the length of the whole result,
+ * so that a caller whose buffer is too small can flush it and try again.
+ */
+size_t
+gt_flags_format(const gt_flag_table *table, uint64_t value, char *buf, size_t size)
+{
+	size_t len = 0;
+	uint64_t rest = value;
+
+	for (size_t i = 0; i < table->count; i++) {
+		const gt_flag *flag = &table->flags[i];
+
+		if ((rest & flag->mask) != flag->value) {
+			continue;
+		}
+
+		if (0 != len) {
+			gt_flags_append(buf, size, &len, "|", 1);
+		}
+
+		gt_flags_append(buf, size, &len, flag->name, flag->len);
+		rest &= ~flag->mask;
+	}
+
+	if (table->show_rest && 0 != rest) {
+		char hex[sizeof "|0x" + 16];
+		int n = snprintf(hex, sizeof hex, "|0x%" PRIx64, rest);
+
+		gt_flags_append(buf, size, &len, 0 == len ? hex + 1 : hex, 0 == len ? n - 1 : n);
+	}
+
+	if (0 == len) {
+		gt_flags_append(buf, size, &len, table->none, strlen(table->none));
+	}
+
+	if (size > 0) {
+		buf[len < size ? len : size - 1] = '\0';
+	}
+
+	return len;
+}
@@ -0,0 +1,44 @@
+#ifndef FLAGS_H
+#define FLAGS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Tables of the names of the bits of bitmask arguments, and a formatter
+ * which prints a bitmask through such a table into a caller's buffer.
+ */
+
+/*
+ * A name for the bits of mask which hold value. Most entries name a
+ * single bit, with mask and value both that bit; an entry which names a
+ * field, such as the access mode of open(), has a mask wider than its
+ * value, and an entry which names the whole of a bitmask has a mask of
+ * every bit.
+ */
+typedef struct gt_flag {
+	uint64_t    mask;
+	uint64_t    value;
+	const char *name;
+	size_t      len;
+} gt_flag;
+
+#define GT_FLAG(mask, value, name) { (mask), (value), (name), sizeof (name) - 1 }
+#define GT_FLAG_BIT(bit, name)     GT_FLAG((bit), (bit), (name))
+#define GT_FLAG_ALL(value, name)   GT_FLAG(UINT64_MAX, (value), (name))
+
+typedef struct gt_flag_table {
+	const gt_flag *flags;
+	size_t         count;
+	const char    *none;       /* Printed if no entry matches. */
+	bool           show_rest;  /* Print bits which no entry names, in hex. */
+} gt_flag_table;
+
+extern const gt_flag_table GT_FLAGS_ACCESS_MASK;
+extern const gt_flag_table GT_FLAGS_LINUX_OPEN;
+extern const gt_flag_table GT_FLAGS_LINUX_PROT;
+
+size_t gt_flags_format(const gt_flag_table *table, uint64_t value, char *buf, size_t size);
+
+#endif
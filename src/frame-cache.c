@@ -0,0 +1,356 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "frame-cache.h"
+
+#define GT_FRAME_SIZE 4096
+
+/* The accessed and dirty bits of a page-table entry, which the CPU sets. */
+#define GT_FRAME_ENTRY_AD ((1 << 5) | (1 << 6))
+
+typedef struct gt_frame_key {
+	addr_t dtb;
+	addr_t vpage;
+} gt_frame_key;
+
+/*
+ * A mapped frame. As in the string table, the LRU queue links the frames
+ * through their lru members.
+ */
+typedef struct gt_frame {
+	GList        lru;        /* lru.data points back to this gt_frame. */
+	gt_frame_key key;
+	xen_pfn_t    gfn;
+	uint64_t     generation; /* Of the cache, when last translated. */
+	uint64_t     event;      /* Of the cache, when last checked; see gt_frame_entry_unchanged(). */
+	addr_t       entry;      /* The page-table entry which maps a process's page, or 0... */
+	uint64_t     entry_value; /* ...and its value then. */
+	uint8_t     *map;
+} gt_frame;
+
+struct gt_frame_cache {
+	vmi_instance_t vmi;
+	xc_interface  *xch;
+	uint32_t       domid;
+
+	GHashTable    *frames;   /* Of gt_frame by key; owns the frames. */
+	GQueue         lru;      /* Most recently used at the head. */
+	uint64_t       generation;
+	uint64_t       event;    /* See gt_frame_cache_next_event(). */
+	size_t         max_frames;
+
+	uint64_t       hits;
+	uint64_t       misses;
+	uint64_t       revalidations; /* Hits which needed a new translation. */
+	uint64_t       entry_checks;  /* Hits which needed a read of their entry. */
+	uint64_t       failures;      /* Pages guestrace could not map. */
+	uint64_t       evictions;
+	uint64_t       invalidations;
+	uint64_t       bytes_saved;   /* Read from frames already mapped. */
+};
+
+static guint
+gt_frame_key_hash(gconstpointer key)
+{
+	const gt_frame_key *k = key;
+
+	return g_int64_hash(&k->vpage) ^ g_int64_hash(&k->dtb);
+}
+
+static gboolean
+gt_frame_key_equal(gconstpointer a, gconstpointer b)
+{
+	const gt_frame_key *ka = a, *kb = b;
+
+	return ka->vpage == kb->vpage && ka->dtb == kb->dtb;
+}
+
+static void
+gt_frame_destroy(gpointer data)
+{
+	gt_frame *frame = data;
+
+	munmap(frame->map, GT_FRAME_SIZE);
+	g_free(frame);
+}
+
+gt_frame_cache *
+gt_frame_cache_new(vmi_instance_t vmi, xc_interface *xch, uint32_t domid, size_t max_bytes)
+{
+	gt_frame_cache *cache = g_new0(gt_frame_cache, 1);
+
+	cache->vmi        = vmi;
+	cache->xch        = xch;
+	cache->domid      = domid;
+	cache->frames     = g_hash_table_new_full(gt_frame_key_hash,
+	                                          gt_frame_key_equal,
+	                                          NULL,
+	                                          gt_frame_destroy);
+	cache->max_frames = MAX(max_bytes / GT_FRAME_SIZE, 1);
+	g_queue_init(&cache->lru);
+
+	return cache;
+}
+
+void
+gt_frame_cache_free(gt_frame_cache *cache)
+{
+	if (NULL == cache) {
+		return;
+	}
+
+	g_hash_table_destroy(cache->frames);
+	g_free(cache);
+}
+
+/*
+ * Return the frame which holds vpage in the address space dtb, or 0. For
+ * a process's page, also find the page-table entry which maps it, and its
+ * value; see gt_frame_entry_unchanged().
+ */
+static xen_pfn_t
+gt_frame_cache_translate(gt_frame_cache *cache,
+                         addr_t dtb,
+                         addr_t vpage,
+                         addr_t *entry,
+                         uint64_t *entry_value)
+{
+	page_info_t info;
+
+	*entry       = 0;
+	*entry_value = 0;
+
+	if (GT_FRAME_KERNEL_DTB == dtb) {
+		return vmi_translate_kv2p(cache->vmi, vpage) / GT_FRAME_SIZE;
+	}
+
+	if (VMI_SUCCESS != vmi_pagetable_lookup_extended(cache->vmi, dtb, vpage, &info)) {
+		return 0;
+	}
+
+	switch (info.size) {
+	case VMI_PS_4KB:
+		*entry       = info.x86_ia32e.pte_location;
+		*entry_value = info.x86_ia32e.pte_value;
+		break;
+	case VMI_PS_2MB:
+		*entry       = info.x86_ia32e.pgd_location;
+		*entry_value = info.x86_ia32e.pgd_value;
+		break;
+	case VMI_PS_1GB:
+		*entry       = info.x86_ia32e.pdpte_location;
+		*entry_value = info.x86_ia32e.pdpte_value;
+		break;
+	default:
+		break;
+	}
+
+	return info.paddr / GT_FRAME_SIZE;
+}
+
+/*
+ * Whether the process's page which frame holds still translates to it, as
+ * it does unless the entry which mapped it has since changed: upon
+ * copy-on-write or swapping, say, which involve no system call. This costs
+ * a read of one entry, rather than a walk of the page tables.
+ */
+static gboolean
+gt_frame_entry_unchanged(gt_frame_cache *cache, gt_frame *frame)
+{
+	uint64_t value;
+
+	cache->entry_checks++;
+
+	return 0 != frame->entry
+	    && VMI_SUCCESS == vmi_read_64_pa(cache->vmi, frame->entry, &value)
+	    && 0 == ((value ^ frame->entry_value) & ~(uint64_t) GT_FRAME_ENTRY_AD);
+}
+
+/* Unmap the least recently used frames until the cache fits its budget. */
+static void
+gt_frame_cache_trim(gt_frame_cache *cache)
+{
+	while (g_hash_table_size(cache->frames) > cache->max_frames) {
+		gt_frame *frame = cache->lru.tail->data;
+
+		g_queue_unlink(&cache->lru, &frame->lru);
+		cache->evictions++;
+
+		/* Frees frame. */
+		g_hash_table_remove(cache->frames, &frame->key);
+	}
+}
+
+/*
+ * Find or map the frame which holds vpage. A frame from an earlier
+ * generation remains mapped if the page still translates to it. A
+ * process's frame from an earlier event remains in use if the entry which
+ * mapped it is unchanged.
+ */
+static gt_frame *
+gt_frame_cache_lookup(gt_frame_cache *cache, addr_t dtb, addr_t vpage, gboolean *hit)
+{
+	gt_frame_key key = { dtb, vpage };
+	gt_frame *frame = g_hash_table_lookup(cache->frames, &key);
+	addr_t entry;
+	uint64_t entry_value;
+	xen_pfn_t gfn;
+	uint8_t *map;
+
+	if (NULL != frame
+	 && frame->generation == cache->generation
+	 && (GT_FRAME_KERNEL_DTB == dtb
+	  || frame->event == cache->event
+	  || gt_frame_entry_unchanged(cache, frame))) {
+		cache->hits++;
+		frame->event = cache->event;
+		*hit = TRUE;
+		goto found;
+	}
+
+	gfn = gt_frame_cache_translate(cache, dtb, vpage, &entry, &entry_value);
+
+	if (NULL != frame) {
+		if (0 != gfn && gfn == frame->gfn) {
+			cache->hits++;
+			cache->revalidations++;
+			frame->generation  = cache->generation;
+			frame->event       = cache->event;
+			frame->entry       = entry;
+			frame->entry_value = entry_value;
+			*hit = TRUE;
+			goto found;
+		}
+
+		/* Frees frame. */
+		g_queue_unlink(&cache->lru, &frame->lru);
+		g_hash_table_remove(cache->frames, &key);
+		frame = NULL;
+	}
+
+	cache->misses++;
+	*hit = FALSE;
+
+	if (0 == gfn) {
+		cache->failures++;
+		goto done;
+	}
+
+	map = xc_map_foreign_pages(cache->xch, cache->domid, PROT_READ, &gfn, 1);
+	if (NULL == map) {
+		cache->failures++;
+		goto done;
+	}
+
+	frame              = g_new0(gt_frame, 1);
+	frame->lru.data    = frame;
+	frame->key         = key;
+	frame->gfn         = gfn;
+	frame->generation  = cache->generation;
+	frame->event       = cache->event;
+	frame->entry       = entry;
+	frame->entry_value = entry_value;
+	frame->map         = map;
+
+	g_hash_table_insert(cache->frames, &frame->key, frame);
+	g_queue_push_head_link(&cache->lru, &frame->lru);
+	gt_frame_cache_trim(cache);
+
+	goto done;
+
+found:
+	g_queue_unlink(&cache->lru, &frame->lru);
+	g_queue_push_head_link(&cache->lru, &frame->lru);
+
+done:
+	return frame;
+}
+
+/*
+ * Read count bytes at vaddr in the address space dtb, which is
+ * GT_FRAME_KERNEL_DTB for kernel addresses, into buf. Return the number of
+ * bytes read, which falls short of count at the first page guestrace
+ * cannot map.
+ */
+size_t
+gt_frame_cache_read(gt_frame_cache *cache, addr_t dtb, addr_t vaddr, void *buf, size_t count)
+{
+	size_t done = 0;
+
+	while (done < count) {
+		size_t offset = vaddr % GT_FRAME_SIZE;
+		size_t chunk  = MIN(GT_FRAME_SIZE - offset, count - done);
+		gboolean hit;
+		gt_frame *frame = gt_frame_cache_lookup(cache, dtb, vaddr - offset, &hit);
+
+		if (NULL == frame) {
+			break;
+		}
+
+		memcpy((uint8_t *) buf + done, frame->map + offset, chunk);
+
+		if (hit) {
+			cache->bytes_saved += chunk;
+		}
+
+		done  += chunk;
+		vaddr += chunk;
+	}
+
+	return done;
+}
+
+/*
+ * Begin a new generation, after which the cache translates each page anew
+ * before reading it again. The cache keeps the frames mapped, and unmaps
+ * only those to which their pages no longer translate.
+ */
+void
+gt_frame_cache_invalidate(gt_frame_cache *cache)
+{
+	cache->generation++;
+	cache->invalidations++;
+}
+
+/*
+ * Begin a new event, after which the cache checks the entry which maps
+ * each page of a process before reading the page again; see
+ * gt_frame_entry_unchanged(). The kernel's pages stay as they are.
+ */
+void
+gt_frame_cache_next_event(gt_frame_cache *cache)
+{
+	cache->event++;
+}
+
+/* Write the cache's statistics to stream as a JSON object. */
+void
+gt_frame_cache_print_stats(gt_frame_cache *cache, FILE *stream)
+{
+	uint64_t lookups = cache->hits + cache->misses;
+
+	fprintf(stream, "{\"frames\": %u, "
+	                "\"bytes\": %zu, "
+	                "\"hits\": %" PRIu64 ", "
+	                "\"misses\": %" PRIu64 ", "
+	                "\"revalidations\": %" PRIu64 ", "
+	                "\"entry_checks\": %" PRIu64 ", "
+	                "\"failures\": %" PRIu64 ", "
+	                "\"evictions\": %" PRIu64 ", "
+	                "\"invalidations\": %" PRIu64 ", "
+	                "\"bytes_saved\": %" PRIu64 ", "
+	                "\"hit_rate\": %.4f}",
+	        g_hash_table_size(cache->frames),
+	        (size_t) g_hash_table_size(cache->frames) * GT_FRAME_SIZE,
+	        cache->hits,
+	        cache->misses,
+	        cache->revalidations,
+	        cache->entry_checks,
+	        cache->failures,
+	        cache->evictions,
+	        cache->invalidations,
+	        cache->bytes_saved,
+	        lookups ? (double) cache->hits / lookups : 0.0);
+}
@@ -0,0 +1,38 @@
+#ifndef FRAME_CACHE_H
+#define FRAME_CACHE_H
+
+#include <stdio.h>
+#include <libvmi/libvmi.h>
+#include <xenctrl.h>
+
+/*
+ * A cache of guest frames which guestrace has mapped for reading, by the
+ * address space and virtual page through which it found them. Decoders
+ * chase the same pointers from one system call to the next, so reading
+ * through the cache spares most reads a translation and a mapping. The
+ * cache unmaps the least recently used frames once they exceed its budget.
+ *
+ * The cache keeps its translations until a new generation begins; see
+ * gt_guest_invalidate_frames(). Since the frames are mapped rather than
+ * copied, reads always see the guest's current memory.
+ */
+typedef struct gt_frame_cache gt_frame_cache;
+
+/* The address space of the kernel, which every process shares. */
+#define GT_FRAME_KERNEL_DTB 0
+
+gt_frame_cache *gt_frame_cache_new(vmi_instance_t vmi,
+                                   xc_interface *xch,
+                                   uint32_t domid,
+                                   size_t max_bytes);
+void            gt_frame_cache_free(gt_frame_cache *cache);
+size_t          gt_frame_cache_read(gt_frame_cache *cache,
+                                    addr_t dtb,
+                                    addr_t vaddr,
+                                    void *buf,
+                                    size_t count);
+void            gt_frame_cache_invalidate(gt_frame_cache *cache);
+void            gt_frame_cache_next_event(gt_frame_cache *cache);
+void            gt_frame_cache_print_stats(gt_frame_cache *cache, FILE *stream);
+
+#endif
@@ -4,6 +4,12 @@
 #include "guestrace-private.h"
 #include "trace-syscalls.h"
 
+/* Size of a kernel stack on x86-64; the stack is aligned to its size. */
+#define GT_LINUX_THREAD_SIZE (16 * 1024)
+
+/* Kernel addresses occupy the upper half of the address space. */
+#define GT_LINUX_KERNEL_ADDR(addr) (0 != ((addr) >> 63))
+
 /*
  * Within the kernel's system-call handler function (that function pointed to
  * by the value in register LSTAR) there exists a call instruction which
@@ -24,6 +30,8 @@ _gt_linux_find_return_point_addr(GTLoop *loop)
 		goto done;
 	}
 
+	_gt_count_hypercall(loop);
+
 	return_point_addr = _gt_find_addr_after_instruction(loop,
 	                                                   lstar,
 	                                                  "call",
@@ -33,6 +41,192 @@ done:
 	return return_point_addr;
 }
 
+/* Read the PID and name (comm) of the task_struct at addr. */
+static bool
+_gt_linux_read_process(GTLoop *loop, addr_t addr, gt_process *process)
+{
+	bool status = false;
+	uint32_t pid;
+	unsigned long pid_offset  = vmi_get_offset(loop->vmi, "linux_pid");
+	unsigned long name_offset = vmi_get_offset(loop->vmi, "linux_name");
+
+	if (VMI_SUCCESS != vmi_read_32_va(loop->vmi, addr + pid_offset, 0, &pid)) {
+		goto done;
+	}
+
+	if (GT_PROCESS_NAME_MAX != vmi_read_va(loop->vmi,
+	                                       addr + name_offset,
+	                                       0,
+	                                       process->name,
+	                                       GT_PROCESS_NAME_MAX)) {
+		goto done;
+	}
+
+	process->name[GT_PROCESS_NAME_MAX - 1] = '\0';
+	process->pid  = pid;
+	process->addr = addr;
+
+	status = true;
+
+done:
+	return status;
+}
+
+/* Find the task_struct of the process with the given PID in the task list. */
+static bool
+_gt_linux_find_process(GTLoop *loop, vmi_pid_t pid, gt_process *process)
+{
+	bool status = false;
+	unsigned long task_offset = vmi_get_offset(loop->vmi, "linux_tasks");
+	unsigned long pid_offset  = vmi_get_offset(loop->vmi, "linux_pid");
+	addr_t list_head, list_curr;
+	vmi_pid_t curr_pid;
+
+	list_head = vmi_translate_ksym2v(loop->vmi, "init_task");
+	if (0 == list_head) {
+		fprintf(stderr, "failed to read address for init_task\n");
+		goto done;
+	}
+
+	list_head += task_offset;
+	list_curr  = list_head;
+
+	/* The task list is circular and doubly linked. */
+	do {
+		addr_t curr_task = list_curr - task_offset;
+
+		if (VMI_SUCCESS != vmi_read_32_va(loop->vmi,
+		                                  curr_task + pid_offset,
+		                                  0,
+		                                 (uint32_t *) &curr_pid)) {
+			fprintf(stderr, "failed to get the pid of the process we are examining\n");
+			goto done;
+		}
+
+		if (pid == curr_pid) {
+			status = _gt_linux_read_process(loop, curr_task, process);
+			goto done;
+		}
+
+		if (VMI_SUCCESS != vmi_read_addr_va(loop->vmi, list_curr, 0, &list_curr)) {
+			fprintf(stderr, "failed to get the next task in the process list\n");
+			goto done;
+		}
+	} while (list_curr != list_head);
+
+done:
+	return status;
+}
+
+/*
+ * Look up what _gt_linux_find_current_task and _gt_linux_read_task need.
+ * The value of a per-CPU symbol such as current_task is its offset from the
+ * CPU's per-CPU area, which the kernel keeps in the GS base.
+ */
+static bool
+_gt_linux_init_task_layout(GTLoop *loop)
+{
+	bool status = false;
+	gt_task_layout *layout = &loop->task_layout;
+
+	layout->tid  = vmi_get_offset(loop->vmi, "linux_pid");
+	layout->name = vmi_get_offset(loop->vmi, "linux_name");
+	if (0 == layout->tid || 0 == layout->name) {
+		fprintf(stderr, "failed to read task_struct offsets\n");
+		goto done;
+	}
+
+	/* The tgid immediately follows the pid in every task_struct. */
+	layout->pid = layout->tid + sizeof(uint32_t);
+
+	/* Kernels which lack current_task keep the task at the stack's base. */
+	layout->current_task = vmi_translate_ksym2v(loop->vmi, "current_task");
+
+	status = true;
+
+done:
+	return status;
+}
+
+/*
+ * Read the current task from the per-CPU area, or failing that from the
+ * thread_info at the base of the kernel stack, which begins with a pointer
+ * to the task on kernels older than 4.9.
+ */
+static bool
+_gt_linux_find_current_task(GTLoop *loop, vmi_event_t *event, addr_t *addr)
+{
+	addr_t current_task;
+
+	if (0 != loop->task_layout.current_task) {
+		current_task = _gt_kernel_gs_base(event) + loop->task_layout.current_task;
+	} else {
+		current_task = event->x86_regs->rsp & ~((addr_t) GT_LINUX_THREAD_SIZE - 1);
+	}
+
+	*addr = 0;
+
+	return loop->return_address_width == _gt_read_va(loop, event, current_task, 0, addr, loop->return_address_width)
+	    && GT_LINUX_KERNEL_ADDR(*addr);
+}
+
+/* Read the IDs and comm of the task_struct at addr. */
+static bool
+_gt_linux_read_task(GTLoop *loop, addr_t addr, GTTask *task)
+{
+	bool status = false;
+	uint32_t pid, tid;
+
+	if (sizeof pid != _gt_read_va(loop, NULL, addr + loop->task_layout.pid, 0, &pid, sizeof pid)
+	 || sizeof tid != _gt_read_va(loop, NULL, addr + loop->task_layout.tid, 0, &tid, sizeof tid)) {
+		goto done;
+	}
+
+	if (GT_TASK_NAME_MAX != _gt_read_va(loop,
+	                                    NULL,
+	                                    addr + loop->task_layout.name,
+	                                    0,
+	                                    task->name,
+	                                    GT_TASK_NAME_MAX)) {
+		goto done;
+	}
+
+	task->name[GT_TASK_NAME_MAX - 1] = '\0';
+	task->addr = addr;
+	task->pid  = pid;
+	task->tid  = tid;
+
+	/* Only a thread group's leader is also its process. */
+	task->process = pid == tid ? addr : 0;
+
+	status = true;
+
+done:
+	return status;
+}
+
+/* System calls take their arguments in registers, as the generator expects. */
+static void
+_gt_linux_get_args(GTLoop *loop,
+                   vmi_event_t *event,
+                   vmi_pid_t pid,
+                   uint64_t *args,
+                   int count)
+{
+	x86_registers_t *regs = event->x86_regs;
+	reg_t reg_args[] = { regs->rdi, regs->rsi, regs->rdx, regs->r10, regs->r8, regs->r9 };
+
+	for (int i = 0; i < count; i++) {
+		args[i] = i < G_N_ELEMENTS(reg_args) ? reg_args[i] : 0;
+	}
+}
+
 struct os_functions os_functions_linux = {
-	.find_return_point_addr = _gt_linux_find_return_point_addr
+	.find_return_point_addr = _gt_linux_find_return_point_addr,
+	.find_process           = _gt_linux_find_process,
+	.read_process           = _gt_linux_read_process,
+	.init_task_layout       = _gt_linux_init_task_layout,
+	.find_current_task      = _gt_linux_find_current_task,
+	.read_task              = _gt_linux_read_task,
+	.get_args               = _gt_linux_get_args,
 };
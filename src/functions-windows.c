@@ -1,4 +1,6 @@
+#include <json-c/json.h>
 #include <libvmi/libvmi.h>
+#include <string.h>
 
 #include "guestrace.h"
 #include "guestrace-private.h"
@@ -24,6 +26,8 @@ _gt_windows_find_return_point_addr(GTLoop *loop)
 		goto done;
 	}
 
+	_gt_count_hypercall(loop);
+
 	return_point_addr = _gt_find_addr_after_instruction(loop,
 	                                                   lstar,
 	                                                  "call",
@@ -33,6 +37,299 @@ done:
 	return return_point_addr;
 }
 
+/* Read the PID and image name of the EPROCESS at addr. */
+static bool
+_gt_windows_read_process(GTLoop *loop, addr_t addr, gt_process *process)
+{
+	bool status = false;
+	uint32_t pid;
+	unsigned long pid_offset  = vmi_get_offset(loop->vmi, "win_pid");
+	unsigned long name_offset = vmi_get_offset(loop->vmi, "win_pname");
+
+	if (VMI_SUCCESS != vmi_read_32_va(loop->vmi, addr + pid_offset, 0, &pid)) {
+		goto done;
+	}
+
+	/* ImageFileName holds 15 characters; we terminate the name ourselves. */
+	if (GT_PROCESS_NAME_MAX != vmi_read_va(loop->vmi,
+	                                       addr + name_offset,
+	                                       0,
+	                                       process->name,
+	                                       GT_PROCESS_NAME_MAX)) {
+		goto done;
+	}
+
+	process->name[GT_PROCESS_NAME_MAX - 1] = '\0';
+	process->pid  = pid;
+	process->addr = addr;
+
+	status = true;
+
+done:
+	return status;
+}
+
+/* Find the EPROCESS of the process with the given PID in PsActiveProcessHead. */
+static bool
+_gt_windows_find_process(GTLoop *loop, vmi_pid_t pid, gt_process *process)
+{
+	bool status = false;
+	unsigned long task_offset = vmi_get_offset(loop->vmi, "win_tasks");
+	unsigned long pid_offset  = vmi_get_offset(loop->vmi, "win_pid");
+	addr_t list_head = 0, list_curr;
+	vmi_pid_t curr_pid;
+
+	if (VMI_SUCCESS != vmi_read_addr_ksym(loop->vmi, "PsActiveProcessHead", &list_head)) {
+		fprintf(stderr, "failed to find PsActiveProcessHead\n");
+		goto done;
+	}
+
+	list_curr = list_head;
+
+	/* The process list is circular and doubly linked. */
+	do {
+		addr_t curr_proc = list_curr - task_offset;
+
+		if (VMI_SUCCESS != vmi_read_32_va(loop->vmi,
+		                                  curr_proc + pid_offset,
+		                                  0,
+		                                 (uint32_t *) &curr_pid)) {
+			fprintf(stderr, "failed to get the pid of the process we are examining\n");
+			goto done;
+		}
+
+		if (pid == curr_pid) {
+			status = _gt_windows_read_process(loop, curr_proc, process);
+			goto done;
+		}
+
+		if (VMI_SUCCESS != vmi_read_addr_va(loop->vmi, list_curr, 0, &list_curr)) {
+			fprintf(stderr, "failed to get the next process in the process list\n");
+			goto done;
+		}
+	} while (list_curr != list_head);
+
+done:
+	return status;
+}
+
+/*
+ * Find the offset of member within type in a Rekall profile, which
+ * describes each structure as [size, {member: [offset, type]}].
+ */
+static bool
+_gt_windows_rekall_offset(struct json_object *profile,
+                          const char *type,
+                          const char *member,
+                          addr_t *offset)
+{
+	bool status = false;
+	struct json_object *structs, *type_desc, *members, *member_desc, *value;
+
+	if (!json_object_object_get_ex(profile, "$STRUCTS", &structs)
+	 || !json_object_object_get_ex(structs, type, &type_desc)) {
+		goto done;
+	}
+
+	members = json_object_array_get_idx(type_desc, 1);
+	if (NULL == members
+	 || !json_object_object_get_ex(members, member, &member_desc)) {
+		goto done;
+	}
+
+	value = json_object_array_get_idx(member_desc, 0);
+	if (NULL == value) {
+		goto done;
+	}
+
+	*offset = json_object_get_int64(value);
+
+	status = true;
+
+done:
+	if (!status) {
+		fprintf(stderr, "failed to find %s.%s in Rekall profile\n", type, member);
+	}
+
+	return status;
+}
+
+/*
+ * Look up what _gt_windows_find_current_task and _gt_windows_read_task need
+ * in the guest's Rekall profile. The KPCR, at the kernel's GS base, embeds
+ * the KPRCB, whose CurrentThread points to the running ETHREAD. On x64,
+ * this works out to gs:[0x188].
+ */
+static bool
+_gt_windows_init_task_layout(GTLoop *loop)
+{
+	bool status = false;
+	gt_task_layout *layout = &loop->task_layout;
+	const char *path = vmi_get_rekall_path(loop->vmi);
+	struct json_object *profile = NULL;
+	addr_t prcb, current_thread, cid, unique_process, unique_thread;
+
+	if (NULL == path) {
+		fprintf(stderr, "failed to find Rekall profile\n");
+		goto done;
+	}
+
+	profile = json_object_from_file(path);
+	if (NULL == profile) {
+		fprintf(stderr, "failed to read Rekall profile %s\n", path);
+		goto done;
+	}
+
+	if (!_gt_windows_rekall_offset(profile, "_KPCR", "Prcb", &prcb)
+	 || !_gt_windows_rekall_offset(profile, "_KPRCB", "CurrentThread", &current_thread)
+	 || !_gt_windows_rekall_offset(profile, "_KTHREAD", "Process", &layout->process)
+	 || !_gt_windows_rekall_offset(profile, "_ETHREAD", "Cid", &cid)
+	 || !_gt_windows_rekall_offset(profile, "_CLIENT_ID", "UniqueProcess", &unique_process)
+	 || !_gt_windows_rekall_offset(profile, "_CLIENT_ID", "UniqueThread", &unique_thread)
+	 || !_gt_windows_rekall_offset(profile, "_EPROCESS", "ImageFileName", &layout->name)) {
+		goto done;
+	}
+
+	layout->current_task = prcb + current_thread;
+	layout->pid          = cid + unique_process;
+	layout->tid          = cid + unique_thread;
+
+	status = true;
+
+done:
+	if (NULL != profile) {
+		json_object_put(profile);
+	}
+
+	return status;
+}
+
+/* Read the ETHREAD which the current processor block names CurrentThread. */
+static bool
+_gt_windows_find_current_task(GTLoop *loop, vmi_event_t *event, addr_t *addr)
+{
+	*addr = 0;
+
+	return loop->return_address_width == _gt_read_va(loop,
+	                                                 event,
+	                                                 _gt_kernel_gs_base(event)
+	                                               + loop->task_layout.current_task,
+	                                                 0,
+	                                                 addr,
+	                                                 loop->return_address_width)
+	    && 0 != *addr;
+}
+
+/*
+ * Read the IDs of the ETHREAD at addr, and the image name of its process.
+ * Guestrace caches the image name by EPROCESS, and it reads the name again
+ * only if the EPROCESS no longer bears the thread's process ID.
+ */
+static bool
+_gt_windows_read_task(GTLoop *loop, addr_t addr, GTTask *task)
+{
+	bool status = false;
+	uint32_t pid, tid;
+	addr_t eprocess;
+	gt_process *process;
+
+	/* Client IDs are handles, but their values fit in 32 bits. */
+	eprocess = 0;
+	if (sizeof pid != _gt_read_va(loop, NULL, addr + loop->task_layout.pid, 0, &pid, sizeof pid)
+	 || sizeof tid != _gt_read_va(loop, NULL, addr + loop->task_layout.tid, 0, &tid, sizeof tid)
+	 || loop->return_address_width != _gt_read_va(loop,
+	                                              NULL,
+	                                              addr + loop->task_layout.process,
+	                                              0,
+	                                             &eprocess,
+	                                              loop->return_address_width)) {
+		goto done;
+	}
+
+	process = g_hash_table_lookup(loop->gt_task_processes, GSIZE_TO_POINTER(eprocess));
+	if (NULL == process || pid != process->pid) {
+		if (NULL == process) {
+			if (g_hash_table_size(loop->gt_task_processes) >= GT_PROCESS_CACHE_MAX) {
+				g_hash_table_remove_all(loop->gt_task_processes);
+			}
+
+			process = g_new0(gt_process, 1);
+			g_hash_table_insert(loop->gt_task_processes,
+			                    GSIZE_TO_POINTER(eprocess),
+			                    process);
+		}
+
+		/* ImageFileName holds 15 characters; we terminate the name ourselves. */
+		if (GT_PROCESS_NAME_MAX != _gt_read_va(loop,
+		                                       NULL,
+		                                       eprocess + loop->task_layout.name,
+		                                       0,
+		                                       process->name,
+		                                       GT_PROCESS_NAME_MAX)) {
+			g_hash_table_remove(loop->gt_task_processes, GSIZE_TO_POINTER(eprocess));
+			goto done;
+		}
+
+		process->name[GT_PROCESS_NAME_MAX - 1] = '\0';
+		process->pid  = pid;
+		process->addr = eprocess;
+	}
+
+	task->addr    = addr;
+	task->process = eprocess;
+	task->pid     = pid;
+	task->tid     = tid;
+	memcpy(task->name, process->name, GT_TASK_NAME_MAX);
+
+	status = true;
+
+done:
+	return status;
+}
+
+/*
+ * The x64 calling convention passes the first four arguments in registers
+ * and the rest on the stack, above the return address and the 32 bytes of
+ * home space reserved for the register arguments.
+ */
+static void
+_gt_windows_get_args(GTLoop *loop,
+                     vmi_event_t *event,
+                     vmi_pid_t pid,
+                     uint64_t *args,
+                     int count)
+{
+	x86_registers_t *regs = event->x86_regs;
+	reg_t reg_args[] = { regs->rcx, regs->rdx, regs->r8, regs->r9 };
+	int reg_count = G_N_ELEMENTS(reg_args);
+	size_t stack_size, size;
+
+	for (int i = 0; i < count && i < reg_count; i++) {
+		args[i] = reg_args[i];
+	}
+
+	if (count <= reg_count) {
+		return;
+	}
+
+	stack_size = (count - reg_count) * sizeof *args;
+	size = _gt_read_va(loop,
+	                   event,
+	                   regs->rsp + loop->return_address_width * 5,
+	                   pid,
+	                  &args[reg_count],
+	                   stack_size);
+	if (size < stack_size) {
+		memset((uint8_t *) &args[reg_count] + size, 0, stack_size - size);
+	}
+}
+
 struct os_functions os_functions_windows = {
-	.find_return_point_addr = _gt_windows_find_return_point_addr
+	.find_return_point_addr = _gt_windows_find_return_point_addr,
+	.find_process           = _gt_windows_find_process,
+	.read_process           = _gt_windows_read_process,
+	.init_task_layout       = _gt_windows_init_task_layout,
+	.find_current_task      = _gt_windows_find_current_task,
+	.read_task              = _gt_windows_read_task,
+	.get_args               = _gt_windows_get_args,
 };
@@ -15,3842 +15,1503 @@ _gt_linux_find_syscalls_and_setup_mem_traps(GTLoop *loop)
         return gt_loop_set_cbs(loop, VM_LINUX_SYSCALLS);
 }
 
-static char *
-get_process_name(vmi_instance_t vmi, vmi_pid_t pid) 
-{
-	/* Gets the process name of the process with the input pid */
-	/* offsets from the LibVMI config file */	
-	unsigned long task_offset = vmi_get_offset(vmi, "linux_tasks");
-	unsigned long pid_offset = vmi_get_offset(vmi, "linux_pid");
-	unsigned long name_offset = vmi_get_offset(vmi, "linux_name");
-	
-	/* addresses for the linux process list and current process */
-	addr_t list_head = 0;
-	addr_t list_curr = 0;
-	addr_t curr_proc = 0;
-	
-	vmi_pid_t curr_pid = 0;		/* pid of the processes task struct we are examining */
-	char *proc = NULL;		/* process name of the current process we are examining */
-
-	list_head = vmi_translate_ksym2v(vmi, "init_task") + task_offset; 	/* get the address to the head of the process list */
-
-	if (list_head == task_offset) {
-		fprintf(stderr, "failed to read address for init_task\n");
-		goto done;
-	}
-	
-	list_curr = list_head;							/* set the current process to the head */
-
-	do{
-		curr_proc = list_curr - task_offset;						/* subtract the task offset to get to the start of the task_struct */
-		if (VMI_FAILURE == vmi_read_32_va(vmi, curr_proc + pid_offset, 0, (uint32_t*)&curr_pid)) {		/* read the current pid using the pid offset from the start of the task struct */
-			fprintf(stderr, "failed to get the pid of the process we are examining\n");
-			goto done;
-		}
-	
-		if (pid == curr_pid) {
-			proc = vmi_read_str_va(vmi, curr_proc + name_offset, 0);		/* get the process name if the current pid is equal to the pis we are looking for */
-			goto done;								/* go to done to exit */
-		}
-	
-		if (VMI_FAILURE == vmi_read_addr_va(vmi, list_curr, 0, &list_curr)) {				/* read the memory from the address of list_curr which will return a pointer to the */
-			fprintf(stderr, "failed to get the next task in the process list\n");
-			goto done;
-		}
-
-	} while (list_curr != list_head);							/* next task_struct. Continue the loop until we get back to the beginning as the  */
-												/* process list is doubly linked and circular */
-
-done:
-	if (NULL == proc) {		/* if proc is NULL we don't know the process name */
-		return "unknown";
-	}
-	
-	return proc;
-
-}
-
-void *gt_linux_print_syscall_sys_read(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_read", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_write(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_write", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_open(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	char *arg0 = vmi_read_str_va(vmi, event->x86_regs->rdi, pid);
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(\"%s\", %i, %lu)\n", pid, rsp, proc, "sys_open", (char *) arg0, (int) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_close(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_close", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_stat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_stat", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fstat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_fstat", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_lstat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_lstat", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_poll(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu, %i)\n", pid, rsp, proc, "sys_poll", (unsigned long) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_lseek(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_lseek", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mmap(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_mmap");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mprotect(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu)\n", pid, rsp, proc, "sys_mprotect", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_munmap(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_munmap", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_brk(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_brk", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rt_sigaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_rt_sigaction", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rt_sigprocmask(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_rt_sigprocmask", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rt_sigreturn(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_rt_sigreturn");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_ioctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu)\n", pid, rsp, proc, "sys_ioctl", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_pread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu, %li)\n", pid, rsp, proc, "sys_pread", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (long int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_pwrite(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu, %li)\n", pid, rsp, proc, "sys_pwrite", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (long int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_readv(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_readv", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_writev(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_writev", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_access(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_access", (unsigned long) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_pipe(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_pipe", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_select(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_select", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_yield(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_sched_yield");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mremap(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu, %lu, %lu)\n", pid, rsp, proc, "sys_mremap", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_msync(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %i)\n", pid, rsp, proc, "sys_msync", (unsigned long) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mincore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_mincore", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_madvise(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %i)\n", pid, rsp, proc, "sys_madvise", (unsigned long) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_shmget(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, %i)\n", pid, rsp, proc, "sys_shmget", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_shmat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_shmat", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_shmctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_shmctl", (int) arg0, (int) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_dup(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_dup", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_dup2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_dup2", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_pause(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_pause");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_nanosleep(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_nanosleep", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getitimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_getitimer", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_alarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_alarm", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setitimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_setitimer", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getpid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_getpid");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sendfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_sendfile", (int) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_socket(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i)\n", pid, rsp, proc, "sys_socket", (int) arg0, (int) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_connect(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_connect", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_accept(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_accept", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sendto(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_sendto", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4, (int) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_recvfrom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_recvfrom", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sendmsg(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_sendmsg", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_recvmsg(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_recvmsg", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_shutdown(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_shutdown", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_bind(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_bind", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_listen(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_listen", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getsockname(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_getsockname", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getpeername(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_getpeername", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_socketpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_socketpair", (int) arg0, (int) arg1, (int) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setsockopt(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_setsockopt", (int) arg0, (int) arg1, (int) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getsockopt(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_getsockopt", (int) arg0, (int) arg1, (int) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_clone(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, 0x%"PRIx64", %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_clone", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fork(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_fork");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_vfork(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_vfork");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_execve(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_execve", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_exit(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_exit", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_wait4(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_wait4", (int) arg0, (unsigned long) arg1, (int) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_kill(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_kill", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_uname(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_uname", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_semget(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i)\n", pid, rsp, proc, "sys_semget", (int) arg0, (int) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_semop(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_semop", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_semctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i, %lu)\n", pid, rsp, proc, "sys_semctl", (int) arg0, (int) arg1, (int) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_shmdt(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_shmdt", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_msgget(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_msgget", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_msgsnd(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %i)\n", pid, rsp, proc, "sys_msgsnd", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_msgrcv(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %li, %i)\n", pid, rsp, proc, "sys_msgrcv", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (long int) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_msgctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_msgctl", (int) arg0, (int) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fcntl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu)\n", pid, rsp, proc, "sys_fcntl", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_flock(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_flock", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fsync(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_fsync", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fdatasync(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_fdatasync", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_truncate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %li)\n", pid, rsp, proc, "sys_truncate", (unsigned long) arg0, (long int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_ftruncate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_ftruncate", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getdents(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_getdents", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getcwd(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_getcwd", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_chdir(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_chdir", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fchdir(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_fchdir", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rename(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_rename", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mkdir(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_mkdir", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rmdir(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_rmdir", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_creat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_creat", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_link(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_link", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_unlink(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_unlink", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_symlink(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_symlink", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_readlink(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_readlink", (unsigned long) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_chmod(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_chmod", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fchmod(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_fchmod", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_chown(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_chown", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fchown(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu)\n", pid, rsp, proc, "sys_fchown", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_lchown(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_lchown", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_umask(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_umask", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_gettimeofday(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_gettimeofday", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getrlimit(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_getrlimit", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getrusage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_getrusage", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sysinfo(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_sysinfo", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_times(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_times", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_ptrace(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%li, %li, %lu, %lu)\n", pid, rsp, proc, "sys_ptrace", (long int) arg0, (long int) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getuid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_getuid");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_syslog(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_syslog", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getgid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_getgid");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setuid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_setuid", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setgid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_setgid", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_geteuid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_geteuid");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getegid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_getegid");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setpgid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_setpgid", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getppid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_getppid");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getpgrp(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_getpgrp");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setsid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_setsid");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setreuid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_setreuid", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setregid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_setregid", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getgroups(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_getgroups", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setgroups(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_setgroups", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setresuid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu)\n", pid, rsp, proc, "sys_setresuid", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getresuid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_getresuid", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setresgid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu)\n", pid, rsp, proc, "sys_setresgid", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getresgid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_getresgid", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getpgid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_getpgid", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setfsuid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_setfsuid", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setfsgid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_setfsgid", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getsid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_getsid", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_capget(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_capget", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_capset(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_capset", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rt_sigpending(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_rt_sigpending", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rt_sigtimedwait(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_rt_sigtimedwait", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rt_sigqueueinfo(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_rt_sigqueueinfo", (int) arg0, (int) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rt_sigsuspend(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_rt_sigsuspend", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sigaltstack(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_sigaltstack", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_utime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_utime", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mknod(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_mknod", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_uselib(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_uselib", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_personality(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_personality", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_ustat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_ustat", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_statfs(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_statfs", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fstatfs(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_fstatfs", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sysfs(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, %lu)\n", pid, rsp, proc, "sys_sysfs", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getpriority(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_getpriority", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setpriority(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i)\n", pid, rsp, proc, "sys_setpriority", (int) arg0, (int) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_setparam(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_sched_setparam", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_getparam(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_sched_getparam", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_setscheduler(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_sched_setscheduler", (int) arg0, (int) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_getscheduler(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_sched_getscheduler", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_get_priority_max(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_sched_get_priority_max", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_get_priority_min(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_sched_get_priority_min", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_rr_get_interval(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_sched_rr_get_interval", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mlock(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_mlock", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_munlock(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_munlock", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mlockall(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_mlockall", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_munlockall(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_munlockall");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_vhangup(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_vhangup");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_modify_ldt(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_modify_ldt");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_pivot_root(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_pivot_root", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sysctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_sysctl", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_prctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, %lu, %lu, %lu)\n", pid, rsp, proc, "sys_prctl", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_arch_prctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_arch_prctl");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_adjtimex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_adjtimex", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setrlimit(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_setrlimit", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_chroot(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_chroot", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sync(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_sync");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_acct(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_acct", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_settimeofday(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_settimeofday", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mount(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_mount", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_umount2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_umount2");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_swapon(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_swapon", (unsigned long) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_swapoff(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_swapoff", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_reboot(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_reboot", (int) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sethostname(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_sethostname", (unsigned long) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setdomainname(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_setdomainname", (unsigned long) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_iopl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_iopl");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_ioperm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %i)\n", pid, rsp, proc, "sys_ioperm", (unsigned long) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_create_module(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_create_module");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_init_module(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_init_module", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_delete_module(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_delete_module", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_get_kernel_syms(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_get_kernel_syms");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_query_module(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_query_module");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_quotactl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_quotactl", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_nfsservctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_nfsservctl");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getpmsg(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_getpmsg");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_putpmsg(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_putpmsg");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_afs_syscall(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_afs_syscall");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_tuxcall(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_tuxcall");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_security(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_security");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_gettid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_gettid");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_readahead(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %li, %lu)\n", pid, rsp, proc, "sys_readahead", (int) arg0, (long int) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %lu, %i)\n", pid, rsp, proc, "sys_setxattr", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_lsetxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %lu, %i)\n", pid, rsp, proc, "sys_lsetxattr", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fsetxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", %lu, %i)\n", pid, rsp, proc, "sys_fsetxattr", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_getxattr", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_lgetxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_lgetxattr", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fgetxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_fgetxattr", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_listxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_listxattr", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_llistxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_llistxattr", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_flistxattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_flistxattr", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_removexattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_removexattr", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_lremovexattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_lremovexattr", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fremovexattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_fremovexattr", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_tkill(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_tkill", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_time(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_time", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_futex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_futex", (unsigned long) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_setaffinity(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_sched_setaffinity", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_getaffinity(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_sched_getaffinity", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_set_thread_area(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_set_thread_area");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_io_setup(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_io_setup", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_io_destroy(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_io_destroy", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_io_getevents(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %li, %li, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_io_getevents", (unsigned long) arg0, (long int) arg1, (long int) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_io_submit(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %li, 0x%"PRIx64")\n", pid, rsp, proc, "sys_io_submit", (unsigned long) arg0, (long int) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_io_cancel(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_io_cancel", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_get_thread_area(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_get_thread_area");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_lookup_dcookie(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_lookup_dcookie", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_epoll_create(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_epoll_create", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_epoll_ctl_old(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_epoll_ctl_old");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_epoll_wait_old(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_epoll_wait_old");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_remap_file_pages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu, %lu, %lu)\n", pid, rsp, proc, "sys_remap_file_pages", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getdents64(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_getdents64", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_set_tid_address(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_set_tid_address", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_restart_syscall(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_restart_syscall");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_semtimedop(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_semtimedop", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fadvise64(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %li, %lu, %i)\n", pid, rsp, proc, "sys_fadvise64", (int) arg0, (long int) arg1, (unsigned long) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_timer_create(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_timer_create", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_timer_settime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_timer_settime", (unsigned long) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_timer_gettime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_timer_gettime", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_timer_getoverrun(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_timer_getoverrun", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_timer_delete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_timer_delete", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_clock_settime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_clock_settime", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_clock_gettime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_clock_gettime", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_clock_getres(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_clock_getres", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_clock_nanosleep(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_clock_nanosleep", (unsigned long) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_exit_group(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_exit_group", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_epoll_wait(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, %i)\n", pid, rsp, proc, "sys_epoll_wait", (int) arg0, (unsigned long) arg1, (int) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_epoll_ctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_epoll_ctl", (int) arg0, (int) arg1, (int) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_tgkill(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i)\n", pid, rsp, proc, "sys_tgkill", (int) arg0, (int) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_utimes(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_utimes", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_vserver(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_vserver");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mbind(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %lu, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_mbind", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_set_mempolicy(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_set_mempolicy", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_get_mempolicy(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", %lu, %lu, %lu)\n", pid, rsp, proc, "sys_get_mempolicy", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mq_open(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i, %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_mq_open", (unsigned long) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mq_unlink(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64")\n", pid, rsp, proc, "sys_mq_unlink", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mq_timedsend(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_mq_timedsend", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mq_timedreceive(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_mq_timedreceive", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mq_notify(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_mq_notify", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mq_getsetattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_mq_getsetattr", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_kexec_load(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_kexec_load", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_waitid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, 0x%"PRIx64", %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_waitid", (int) arg0, (int) arg1, (unsigned long) arg2, (int) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_add_key(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %lu, %i)\n", pid, rsp, proc, "sys_add_key", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_request_key(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_request_key", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_keyctl(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, %lu, %lu, %lu)\n", pid, rsp, proc, "sys_keyctl", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_ioprio_set(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i)\n", pid, rsp, proc, "sys_ioprio_set", (int) arg0, (int) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_ioprio_get(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_ioprio_get", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_inotify_init(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_inotify_init");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_inotify_add_watch(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_inotify_add_watch", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_inotify_rm_watch(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_inotify_rm_watch", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_migrate_pages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_migrate_pages", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_openat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, %lu)\n", pid, rsp, proc, "sys_openat", (int) arg0, (unsigned long) arg1, (int) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mkdirat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_mkdirat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mknodat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_mknodat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fchownat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %lu, %i)\n", pid, rsp, proc, "sys_fchownat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_futimesat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_futimesat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_newfstatat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_newfstatat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_unlinkat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_unlinkat", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_renameat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_renameat", (int) arg0, (unsigned long) arg1, (int) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_linkat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_linkat", (int) arg0, (unsigned long) arg1, (int) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_symlinkat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_symlinkat", (unsigned long) arg0, (int) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_readlinkat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_readlinkat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fchmodat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_fchmodat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_faccessat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_faccessat", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_pselect6(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_pselect6", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_ppoll(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_ppoll", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_unshare(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_unshare", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_set_robust_list(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_set_robust_list", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_get_robust_list(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_get_robust_list", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_splice(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_splice", (int) arg0, (unsigned long) arg1, (int) arg2, (unsigned long) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_tee(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %lu, %lu)\n", pid, rsp, proc, "sys_tee", (int) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sync_file_range(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %li, %li, %lu)\n", pid, rsp, proc, "sys_sync_file_range", (int) arg0, (long int) arg1, (long int) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_vmsplice(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_vmsplice", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_move_pages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_move_pages", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4, (int) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_utimensat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_utimensat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_epoll_pwait(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, %i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_epoll_pwait", (int) arg0, (unsigned long) arg1, (int) arg2, (int) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_signalfd(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_signalfd", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_timerfd(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s()\n", pid, rsp, proc, "sys_timerfd");
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_eventfd(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu)\n", pid, rsp, proc, "sys_eventfd", (unsigned long) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fallocate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %li, %li)\n", pid, rsp, proc, "sys_fallocate", (int) arg0, (int) arg1, (long int) arg2, (long int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_timerfd_settime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_timerfd_settime", (int) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_timerfd_gettime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_timerfd_gettime", (int) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_accept4(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_accept4", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_signalfd4(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %i)\n", pid, rsp, proc, "sys_signalfd4", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (int) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_eventfd2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %i)\n", pid, rsp, proc, "sys_eventfd2", (unsigned long) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_epoll_create1(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_epoll_create1", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_dup3(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %i)\n", pid, rsp, proc, "sys_dup3", (unsigned long) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_pipe2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_pipe2", (unsigned long) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_inotify_init1(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_inotify_init1", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_preadv(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu, %lu, %lu)\n", pid, rsp, proc, "sys_preadv", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_pwritev(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64", %lu, %lu, %lu)\n", pid, rsp, proc, "sys_pwritev", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_rt_tgsigqueueinfo(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_rt_tgsigqueueinfo", (int) arg0, (int) arg1, (int) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_perf_event_open(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %i, %i, %i, %lu)\n", pid, rsp, proc, "sys_perf_event_open", (unsigned long) arg0, (int) arg1, (int) arg2, (int) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_recvmmsg(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_recvmmsg", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fanotify_init(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu)\n", pid, rsp, proc, "sys_fanotify_init", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_fanotify_mark(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, %lu, %i, 0x%"PRIx64")\n", pid, rsp, proc, "sys_fanotify_mark", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (int) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_prlimit64(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %lu, 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_prlimit64", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_name_to_handle_at(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_name_to_handle_at", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_open_by_handle_at(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_open_by_handle_at", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_clock_adjtime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_clock_adjtime", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_syncfs(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_syncfs", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sendmmsg(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_sendmmsg", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_setns(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_setns", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getcpu(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64")\n", pid, rsp, proc, "sys_getcpu", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_process_vm_readv(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_process_vm_readv", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_process_vm_writev(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_process_vm_writev", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_kcmp(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %i, %lu, %lu)\n", pid, rsp, proc, "sys_kcmp", (int) arg0, (int) arg1, (int) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_finit_module(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_finit_module", (int) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_setattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_sched_setattr", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_sched_getattr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_sched_getattr", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_renameat2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_renameat2", (int) arg0, (unsigned long) arg1, (int) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_seccomp(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, 0x%"PRIx64")\n", pid, rsp, proc, "sys_seccomp", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_getrandom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_getrandom", (unsigned long) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_memfd_create(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_memfd_create", (unsigned long) arg0, (unsigned long) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_kexec_file_load(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i, %lu, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_kexec_file_load", (int) arg0, (int) arg1, (unsigned long) arg2, (unsigned long) arg3, (unsigned long) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_bpf(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %lu)\n", pid, rsp, proc, "sys_bpf", (int) arg0, (unsigned long) arg1, (unsigned long) arg2);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_execveat(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", 0x%"PRIx64", 0x%"PRIx64", %i)\n", pid, rsp, proc, "sys_execveat", (int) arg0, (unsigned long) arg1, (unsigned long) arg2, (unsigned long) arg3, (int) arg4);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_userfaultfd(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i)\n", pid, rsp, proc, "sys_userfaultfd", (int) arg0);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_membarrier(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, %i)\n", pid, rsp, proc, "sys_membarrier", (int) arg0, (int) arg1);
-	return NULL;
-}
-
-void *gt_linux_print_syscall_sys_mlock2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%lu, %lu, %i)\n", pid, rsp, proc, "sys_mlock2", (unsigned long) arg0, (unsigned long) arg1, (int) arg2);
-	return NULL;
-}
+static const gt_syscall_arg LINUX_SYSCALL_ARGS[] = {
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_STRING, GT_ARG_IN },
+	{ NULL, GT_ARG_OPEN_FLAGS, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_PROT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_OPEN_FLAGS, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_LONG, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_INT, GT_ARG_IN },
+	{ NULL, GT_ARG_HEX, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+	{ NULL, GT_ARG_UINT, GT_ARG_IN },
+};
 
-void *gt_linux_print_syscall_sys_copy_file_range(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data)
-{
-	char *proc = get_process_name(vmi, pid);
-	reg_t arg0 = event->x86_regs->rdi;
-	reg_t arg1 = event->x86_regs->rsi;
-	reg_t arg2 = event->x86_regs->rdx;
-	reg_t arg3 = event->x86_regs->r10;
-	reg_t arg4 = event->x86_regs->r8;
-	reg_t arg5 = event->x86_regs->r9;
-	reg_t rsp = event->x86_regs->rsp;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) syscall: %s(%i, 0x%"PRIx64", %i, 0x%"PRIx64", %lu, %lu)\n", pid, rsp, proc, "sys_copy_file_range", (int) arg0, (unsigned long) arg1, (int) arg2, (unsigned long) arg3, (unsigned long) arg4, (unsigned long) arg5);
-	return NULL;
-}
+static const gt_syscall_desc LINUX_SYSCALL_DESCS[] = {
+	{ "sys_read", &LINUX_SYSCALL_ARGS[0], 3, 0 },
+	{ "sys_write", &LINUX_SYSCALL_ARGS[3], 3, 0 },
+	{ "sys_open", &LINUX_SYSCALL_ARGS[6], 3, 0 },
+	{ "sys_close", &LINUX_SYSCALL_ARGS[9], 1, 0 },
+	{ "sys_stat", &LINUX_SYSCALL_ARGS[10], 2, 0 },
+	{ "sys_fstat", &LINUX_SYSCALL_ARGS[12], 2, 0 },
+	{ "sys_lstat", &LINUX_SYSCALL_ARGS[14], 2, 0 },
+	{ "sys_poll", &LINUX_SYSCALL_ARGS[16], 3, 0 },
+	{ "sys_lseek", &LINUX_SYSCALL_ARGS[19], 3, 0 },
+	{ "sys_mmap", NULL, 0, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "sys_mprotect", &LINUX_SYSCALL_ARGS[22], 3, 0 },
+	{ "sys_munmap", &LINUX_SYSCALL_ARGS[25], 2, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "sys_brk", &LINUX_SYSCALL_ARGS[27], 1, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "sys_rt_sigaction", &LINUX_SYSCALL_ARGS[28], 4, 0 },
+	{ "sys_rt_sigprocmask", &LINUX_SYSCALL_ARGS[32], 4, 0 },
+	{ "sys_rt_sigreturn", NULL, 0, 0 },
+	{ "sys_ioctl", &LINUX_SYSCALL_ARGS[36], 3, 0 },
+	{ "sys_pread", &LINUX_SYSCALL_ARGS[39], 4, 0 },
+	{ "sys_pwrite", &LINUX_SYSCALL_ARGS[43], 4, 0 },
+	{ "sys_readv", &LINUX_SYSCALL_ARGS[47], 3, 0 },
+	{ "sys_writev", &LINUX_SYSCALL_ARGS[50], 3, 0 },
+	{ "sys_access", &LINUX_SYSCALL_ARGS[53], 2, 0 },
+	{ "sys_pipe", &LINUX_SYSCALL_ARGS[55], 1, 0 },
+	{ "sys_select", &LINUX_SYSCALL_ARGS[56], 5, 0 },
+	{ "sys_sched_yield", NULL, 0, 0 },
+	{ "sys_mremap", &LINUX_SYSCALL_ARGS[61], 5, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "sys_msync", &LINUX_SYSCALL_ARGS[66], 3, 0 },
+	{ "sys_mincore", &LINUX_SYSCALL_ARGS[69], 3, 0 },
+	{ "sys_madvise", &LINUX_SYSCALL_ARGS[72], 3, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "sys_shmget", &LINUX_SYSCALL_ARGS[75], 3, 0 },
+	{ "sys_shmat", &LINUX_SYSCALL_ARGS[78], 3, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "sys_shmctl", &LINUX_SYSCALL_ARGS[81], 3, 0 },
+	{ "sys_dup", &LINUX_SYSCALL_ARGS[84], 1, 0 },
+	{ "sys_dup2", &LINUX_SYSCALL_ARGS[85], 2, 0 },
+	{ "sys_pause", NULL, 0, 0 },
+	{ "sys_nanosleep", &LINUX_SYSCALL_ARGS[87], 2, 0 },
+	{ "sys_getitimer", &LINUX_SYSCALL_ARGS[89], 2, 0 },
+	{ "sys_alarm", &LINUX_SYSCALL_ARGS[91], 1, 0 },
+	{ "sys_setitimer", &LINUX_SYSCALL_ARGS[92], 3, 0 },
+	{ "sys_getpid", NULL, 0, 0 },
+	{ "sys_sendfile", &LINUX_SYSCALL_ARGS[95], 4, 0 },
+	{ "sys_socket", &LINUX_SYSCALL_ARGS[99], 3, 0 },
+	{ "sys_connect", &LINUX_SYSCALL_ARGS[102], 3, 0 },
+	{ "sys_accept", &LINUX_SYSCALL_ARGS[105], 3, 0 },
+	{ "sys_sendto", &LINUX_SYSCALL_ARGS[108], 6, 0 },
+	{ "sys_recvfrom", &LINUX_SYSCALL_ARGS[114], 6, 0 },
+	{ "sys_sendmsg", &LINUX_SYSCALL_ARGS[120], 3, 0 },
+	{ "sys_recvmsg", &LINUX_SYSCALL_ARGS[123], 3, 0 },
+	{ "sys_shutdown", &LINUX_SYSCALL_ARGS[126], 2, 0 },
+	{ "sys_bind", &LINUX_SYSCALL_ARGS[128], 3, 0 },
+	{ "sys_listen", &LINUX_SYSCALL_ARGS[131], 2, 0 },
+	{ "sys_getsockname", &LINUX_SYSCALL_ARGS[133], 3, 0 },
+	{ "sys_getpeername", &LINUX_SYSCALL_ARGS[136], 3, 0 },
+	{ "sys_socketpair", &LINUX_SYSCALL_ARGS[139], 4, 0 },
+	{ "sys_setsockopt", &LINUX_SYSCALL_ARGS[143], 5, 0 },
+	{ "sys_getsockopt", &LINUX_SYSCALL_ARGS[148], 5, 0 },
+	{ "sys_clone", &LINUX_SYSCALL_ARGS[153], 5, 0 },
+	{ "sys_fork", NULL, 0, 0 },
+	{ "sys_vfork", NULL, 0, 0 },
+	{ "sys_execve", &LINUX_SYSCALL_ARGS[158], 3, GT_SYSCALL_ENDS_PROCESS },
+	{ "sys_exit", &LINUX_SYSCALL_ARGS[161], 1, GT_SYSCALL_ENDS_PROCESS },
+	{ "sys_wait4", &LINUX_SYSCALL_ARGS[162], 4, 0 },
+	{ "sys_kill", &LINUX_SYSCALL_ARGS[166], 2, 0 },
+	{ "sys_uname", &LINUX_SYSCALL_ARGS[168], 1, 0 },
+	{ "sys_semget", &LINUX_SYSCALL_ARGS[169], 3, 0 },
+	{ "sys_semop", &LINUX_SYSCALL_ARGS[172], 3, 0 },
+	{ "sys_semctl", &LINUX_SYSCALL_ARGS[175], 4, 0 },
+	{ "sys_shmdt", &LINUX_SYSCALL_ARGS[179], 1, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "sys_msgget", &LINUX_SYSCALL_ARGS[180], 2, 0 },
+	{ "sys_msgsnd", &LINUX_SYSCALL_ARGS[182], 4, 0 },
+	{ "sys_msgrcv", &LINUX_SYSCALL_ARGS[186], 5, 0 },
+	{ "sys_msgctl", &LINUX_SYSCALL_ARGS[191], 3, 0 },
+	{ "sys_fcntl", &LINUX_SYSCALL_ARGS[194], 3, 0 },
+	{ "sys_flock", &LINUX_SYSCALL_ARGS[197], 2, 0 },
+	{ "sys_fsync", &LINUX_SYSCALL_ARGS[199], 1, 0 },
+	{ "sys_fdatasync", &LINUX_SYSCALL_ARGS[200], 1, 0 },
+	{ "sys_truncate", &LINUX_SYSCALL_ARGS[201], 2, 0 },
+	{ "sys_ftruncate", &LINUX_SYSCALL_ARGS[203], 2, 0 },
+	{ "sys_getdents", &LINUX_SYSCALL_ARGS[205], 3, 0 },
+	{ "sys_getcwd", &LINUX_SYSCALL_ARGS[208], 2, 0 },
+	{ "sys_chdir", &LINUX_SYSCALL_ARGS[210], 1, 0 },
+	{ "sys_fchdir", &LINUX_SYSCALL_ARGS[211], 1, 0 },
+	{ "sys_rename", &LINUX_SYSCALL_ARGS[212], 2, 0 },
+	{ "sys_mkdir", &LINUX_SYSCALL_ARGS[214], 2, 0 },
+	{ "sys_rmdir", &LINUX_SYSCALL_ARGS[216], 1, 0 },
+	{ "sys_creat", &LINUX_SYSCALL_ARGS[217], 2, 0 },
+	{ "sys_link", &LINUX_SYSCALL_ARGS[219], 2, 0 },
+	{ "sys_unlink", &LINUX_SYSCALL_ARGS[221], 1, 0 },
+	{ "sys_symlink", &LINUX_SYSCALL_ARGS[222], 2, 0 },
+	{ "sys_readlink", &LINUX_SYSCALL_ARGS[224], 3, 0 },
+	{ "sys_chmod", &LINUX_SYSCALL_ARGS[227], 2, 0 },
+	{ "sys_fchmod", &LINUX_SYSCALL_ARGS[229], 2, 0 },
+	{ "sys_chown", &LINUX_SYSCALL_ARGS[231], 3, 0 },
+	{ "sys_fchown", &LINUX_SYSCALL_ARGS[234], 3, 0 },
+	{ "sys_lchown", &LINUX_SYSCALL_ARGS[237], 3, 0 },
+	{ "sys_umask", &LINUX_SYSCALL_ARGS[240], 1, 0 },
+	{ "sys_gettimeofday", &LINUX_SYSCALL_ARGS[241], 2, 0 },
+	{ "sys_getrlimit", &LINUX_SYSCALL_ARGS[243], 2, 0 },
+	{ "sys_getrusage", &LINUX_SYSCALL_ARGS[245], 2, 0 },
+	{ "sys_sysinfo", &LINUX_SYSCALL_ARGS[247], 1, 0 },
+	{ "sys_times", &LINUX_SYSCALL_ARGS[248], 1, 0 },
+	{ "sys_ptrace", &LINUX_SYSCALL_ARGS[249], 4, 0 },
+	{ "sys_getuid", NULL, 0, 0 },
+	{ "sys_syslog", &LINUX_SYSCALL_ARGS[253], 3, 0 },
+	{ "sys_getgid", NULL, 0, 0 },
+	{ "sys_setuid", &LINUX_SYSCALL_ARGS[256], 1, 0 },
+	{ "sys_setgid", &LINUX_SYSCALL_ARGS[257], 1, 0 },
+	{ "sys_geteuid", NULL, 0, 0 },
+	{ "sys_getegid", NULL, 0, 0 },
+	{ "sys_setpgid", &LINUX_SYSCALL_ARGS[258], 2, 0 },
+	{ "sys_getppid", NULL, 0, 0 },
+	{ "sys_getpgrp", NULL, 0, 0 },
+	{ "sys_setsid", NULL, 0, 0 },
+	{ "sys_setreuid", &LINUX_SYSCALL_ARGS[260], 2, 0 },
+	{ "sys_setregid", &LINUX_SYSCALL_ARGS[262], 2, 0 },
+	{ "sys_getgroups", &LINUX_SYSCALL_ARGS[264], 2, 0 },
+	{ "sys_setgroups", &LINUX_SYSCALL_ARGS[266], 2, 0 },
+	{ "sys_setresuid", &LINUX_SYSCALL_ARGS[268], 3, 0 },
+	{ "sys_getresuid", &LINUX_SYSCALL_ARGS[271], 3, 0 },
+	{ "sys_setresgid", &LINUX_SYSCALL_ARGS[274], 3, 0 },
+	{ "sys_getresgid", &LINUX_SYSCALL_ARGS[277], 3, 0 },
+	{ "sys_getpgid", &LINUX_SYSCALL_ARGS[280], 1, 0 },
+	{ "sys_setfsuid", &LINUX_SYSCALL_ARGS[281], 1, 0 },
+	{ "sys_setfsgid", &LINUX_SYSCALL_ARGS[282], 1, 0 },
+	{ "sys_getsid", &LINUX_SYSCALL_ARGS[283], 1, 0 },
+	{ "sys_capget", &LINUX_SYSCALL_ARGS[284], 2, 0 },
+	{ "sys_capset", &LINUX_SYSCALL_ARGS[286], 2, 0 },
+	{ "sys_rt_sigpending", &LINUX_SYSCALL_ARGS[288], 2, 0 },
+	{ "sys_rt_sigtimedwait", &LINUX_SYSCALL_ARGS[290], 4, 0 },
+	{ "sys_rt_sigqueueinfo", &LINUX_SYSCALL_ARGS[294], 3, 0 },
+	{ "sys_rt_sigsuspend", &LINUX_SYSCALL_ARGS[297], 2, 0 },
+	{ "sys_sigaltstack", &LINUX_SYSCALL_ARGS[299], 2, 0 },
+	{ "sys_utime", &LINUX_SYSCALL_ARGS[301], 2, 0 },
+	{ "sys_mknod", &LINUX_SYSCALL_ARGS[303], 3, 0 },
+	{ "sys_uselib", &LINUX_SYSCALL_ARGS[306], 1, 0 },
+	{ "sys_personality", &LINUX_SYSCALL_ARGS[307], 1, 0 },
+	{ "sys_ustat", &LINUX_SYSCALL_ARGS[308], 2, 0 },
+	{ "sys_statfs", &LINUX_SYSCALL_ARGS[310], 2, 0 },
+	{ "sys_fstatfs", &LINUX_SYSCALL_ARGS[312], 2, 0 },
+	{ "sys_sysfs", &LINUX_SYSCALL_ARGS[314], 3, 0 },
+	{ "sys_getpriority", &LINUX_SYSCALL_ARGS[317], 2, 0 },
+	{ "sys_setpriority", &LINUX_SYSCALL_ARGS[319], 3, 0 },
+	{ "sys_sched_setparam", &LINUX_SYSCALL_ARGS[322], 2, 0 },
+	{ "sys_sched_getparam", &LINUX_SYSCALL_ARGS[324], 2, 0 },
+	{ "sys_sched_setscheduler", &LINUX_SYSCALL_ARGS[326], 3, 0 },
+	{ "sys_sched_getscheduler", &LINUX_SYSCALL_ARGS[329], 1, 0 },
+	{ "sys_sched_get_priority_max", &LINUX_SYSCALL_ARGS[330], 1, 0 },
+	{ "sys_sched_get_priority_min", &LINUX_SYSCALL_ARGS[331], 1, 0 },
+	{ "sys_sched_rr_get_interval", &LINUX_SYSCALL_ARGS[332], 2, 0 },
+	{ "sys_mlock", &LINUX_SYSCALL_ARGS[334], 2, 0 },
+	{ "sys_munlock", &LINUX_SYSCALL_ARGS[336], 2, 0 },
+	{ "sys_mlockall", &LINUX_SYSCALL_ARGS[338], 1, 0 },
+	{ "sys_munlockall", NULL, 0, 0 },
+	{ "sys_vhangup", NULL, 0, 0 },
+	{ "sys_modify_ldt", NULL, 0, 0 },
+	{ "sys_pivot_root", &LINUX_SYSCALL_ARGS[339], 2, 0 },
+	{ "sys_sysctl", &LINUX_SYSCALL_ARGS[341], 1, 0 },
+	{ "sys_prctl", &LINUX_SYSCALL_ARGS[342], 5, 0 },
+	{ "sys_arch_prctl", NULL, 0, 0 },
+	{ "sys_adjtimex", &LINUX_SYSCALL_ARGS[347], 1, 0 },
+	{ "sys_setrlimit", &LINUX_SYSCALL_ARGS[348], 2, 0 },
+	{ "sys_chroot", &LINUX_SYSCALL_ARGS[350], 1, 0 },
+	{ "sys_sync", NULL, 0, 0 },
+	{ "sys_acct", &LINUX_SYSCALL_ARGS[351], 1, 0 },
+	{ "sys_settimeofday", &LINUX_SYSCALL_ARGS[352], 2, 0 },
+	{ "sys_mount", &LINUX_SYSCALL_ARGS[354], 5, 0 },
+	{ "sys_umount2", NULL, 0, 0 },
+	{ "sys_swapon", &LINUX_SYSCALL_ARGS[359], 2, 0 },
+	{ "sys_swapoff", &LINUX_SYSCALL_ARGS[361], 1, 0 },
+	{ "sys_reboot", &LINUX_SYSCALL_ARGS[362], 4, 0 },
+	{ "sys_sethostname", &LINUX_SYSCALL_ARGS[366], 2, 0 },
+	{ "sys_setdomainname", &LINUX_SYSCALL_ARGS[368], 2, 0 },
+	{ "sys_iopl", NULL, 0, 0 },
+	{ "sys_ioperm", &LINUX_SYSCALL_ARGS[370], 3, 0 },
+	{ "sys_create_module", NULL, 0, 0 },
+	{ "sys_init_module", &LINUX_SYSCALL_ARGS[373], 3, 0 },
+	{ "sys_delete_module", &LINUX_SYSCALL_ARGS[376], 2, 0 },
+	{ "sys_get_kernel_syms", NULL, 0, 0 },
+	{ "sys_query_module", NULL, 0, 0 },
+	{ "sys_quotactl", &LINUX_SYSCALL_ARGS[378], 4, 0 },
+	{ "sys_nfsservctl", NULL, 0, 0 },
+	{ "sys_getpmsg", NULL, 0, 0 },
+	{ "sys_putpmsg", NULL, 0, 0 },
+	{ "sys_afs_syscall", NULL, 0, 0 },
+	{ "sys_tuxcall", NULL, 0, 0 },
+	{ "sys_security", NULL, 0, 0 },
+	{ "sys_gettid", NULL, 0, 0 },
+	{ "sys_readahead", &LINUX_SYSCALL_ARGS[382], 3, 0 },
+	{ "sys_setxattr", &LINUX_SYSCALL_ARGS[385], 5, 0 },
+	{ "sys_lsetxattr", &LINUX_SYSCALL_ARGS[390], 5, 0 },
+	{ "sys_fsetxattr", &LINUX_SYSCALL_ARGS[395], 5, 0 },
+	{ "sys_getxattr", &LINUX_SYSCALL_ARGS[400], 4, 0 },
+	{ "sys_lgetxattr", &LINUX_SYSCALL_ARGS[404], 4, 0 },
+	{ "sys_fgetxattr", &LINUX_SYSCALL_ARGS[408], 4, 0 },
+	{ "sys_listxattr", &LINUX_SYSCALL_ARGS[412], 3, 0 },
+	{ "sys_llistxattr", &LINUX_SYSCALL_ARGS[415], 3, 0 },
+	{ "sys_flistxattr", &LINUX_SYSCALL_ARGS[418], 3, 0 },
+	{ "sys_removexattr", &LINUX_SYSCALL_ARGS[421], 2, 0 },
+	{ "sys_lremovexattr", &LINUX_SYSCALL_ARGS[423], 2, 0 },
+	{ "sys_fremovexattr", &LINUX_SYSCALL_ARGS[425], 2, 0 },
+	{ "sys_tkill", &LINUX_SYSCALL_ARGS[427], 2, 0 },
+	{ "sys_time", &LINUX_SYSCALL_ARGS[429], 1, 0 },
+	{ "sys_futex", &LINUX_SYSCALL_ARGS[430], 6, 0 },
+	{ "sys_sched_setaffinity", &LINUX_SYSCALL_ARGS[436], 3, 0 },
+	{ "sys_sched_getaffinity", &LINUX_SYSCALL_ARGS[439], 3, 0 },
+	{ "sys_set_thread_area", NULL, 0, 0 },
+	{ "sys_io_setup", &LINUX_SYSCALL_ARGS[442], 2, 0 },
+	{ "sys_io_destroy", &LINUX_SYSCALL_ARGS[444], 1, 0 },
+	{ "sys_io_getevents", &LINUX_SYSCALL_ARGS[445], 5, 0 },
+	{ "sys_io_submit", &LINUX_SYSCALL_ARGS[450], 3, 0 },
+	{ "sys_io_cancel", &LINUX_SYSCALL_ARGS[453], 3, 0 },
+	{ "sys_get_thread_area", NULL, 0, 0 },
+	{ "sys_lookup_dcookie", &LINUX_SYSCALL_ARGS[456], 3, 0 },
+	{ "sys_epoll_create", &LINUX_SYSCALL_ARGS[459], 1, 0 },
+	{ "sys_epoll_ctl_old", NULL, 0, 0 },
+	{ "sys_epoll_wait_old", NULL, 0, 0 },
+	{ "sys_remap_file_pages", &LINUX_SYSCALL_ARGS[460], 5, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "sys_getdents64", &LINUX_SYSCALL_ARGS[465], 3, 0 },
+	{ "sys_set_tid_address", &LINUX_SYSCALL_ARGS[468], 1, 0 },
+	{ "sys_restart_syscall", NULL, 0, 0 },
+	{ "sys_semtimedop", &LINUX_SYSCALL_ARGS[469], 4, 0 },
+	{ "sys_fadvise64", &LINUX_SYSCALL_ARGS[473], 4, 0 },
+	{ "sys_timer_create", &LINUX_SYSCALL_ARGS[477], 3, 0 },
+	{ "sys_timer_settime", &LINUX_SYSCALL_ARGS[480], 4, 0 },
+	{ "sys_timer_gettime", &LINUX_SYSCALL_ARGS[484], 2, 0 },
+	{ "sys_timer_getoverrun", &LINUX_SYSCALL_ARGS[486], 1, 0 },
+	{ "sys_timer_delete", &LINUX_SYSCALL_ARGS[487], 1, 0 },
+	{ "sys_clock_settime", &LINUX_SYSCALL_ARGS[488], 2, 0 },
+	{ "sys_clock_gettime", &LINUX_SYSCALL_ARGS[490], 2, 0 },
+	{ "sys_clock_getres", &LINUX_SYSCALL_ARGS[492], 2, 0 },
+	{ "sys_clock_nanosleep", &LINUX_SYSCALL_ARGS[494], 4, 0 },
+	{ "sys_exit_group", &LINUX_SYSCALL_ARGS[498], 1, GT_SYSCALL_ENDS_PROCESS },
+	{ "sys_epoll_wait", &LINUX_SYSCALL_ARGS[499], 4, 0 },
+	{ "sys_epoll_ctl", &LINUX_SYSCALL_ARGS[503], 4, 0 },
+	{ "sys_tgkill", &LINUX_SYSCALL_ARGS[507], 3, 0 },
+	{ "sys_utimes", &LINUX_SYSCALL_ARGS[510], 2, 0 },
+	{ "sys_vserver", NULL, 0, 0 },
+	{ "sys_mbind", &LINUX_SYSCALL_ARGS[512], 6, 0 },
+	{ "sys_set_mempolicy", &LINUX_SYSCALL_ARGS[518], 3, 0 },
+	{ "sys_get_mempolicy", &LINUX_SYSCALL_ARGS[521], 5, 0 },
+	{ "sys_mq_open", &LINUX_SYSCALL_ARGS[526], 4, 0 },
+	{ "sys_mq_unlink", &LINUX_SYSCALL_ARGS[530], 1, 0 },
+	{ "sys_mq_timedsend", &LINUX_SYSCALL_ARGS[531], 5, 0 },
+	{ "sys_mq_timedreceive", &LINUX_SYSCALL_ARGS[536], 5, 0 },
+	{ "sys_mq_notify", &LINUX_SYSCALL_ARGS[541], 2, 0 },
+	{ "sys_mq_getsetattr", &LINUX_SYSCALL_ARGS[543], 3, 0 },
+	{ "sys_kexec_load", &LINUX_SYSCALL_ARGS[546], 4, 0 },
+	{ "sys_waitid", &LINUX_SYSCALL_ARGS[550], 5, 0 },
+	{ "sys_add_key", &LINUX_SYSCALL_ARGS[555], 5, 0 },
+	{ "sys_request_key", &LINUX_SYSCALL_ARGS[560], 4, 0 },
+	{ "sys_keyctl", &LINUX_SYSCALL_ARGS[564], 5, 0 },
+	{ "sys_ioprio_set", &LINUX_SYSCALL_ARGS[569], 3, 0 },
+	{ "sys_ioprio_get", &LINUX_SYSCALL_ARGS[572], 2, 0 },
+	{ "sys_inotify_init", NULL, 0, 0 },
+	{ "sys_inotify_add_watch", &LINUX_SYSCALL_ARGS[574], 3, 0 },
+	{ "sys_inotify_rm_watch", &LINUX_SYSCALL_ARGS[577], 2, 0 },
+	{ "sys_migrate_pages", &LINUX_SYSCALL_ARGS[579], 4, 0 },
+	{ "sys_openat", &LINUX_SYSCALL_ARGS[583], 4, 0 },
+	{ "sys_mkdirat", &LINUX_SYSCALL_ARGS[587], 3, 0 },
+	{ "sys_mknodat", &LINUX_SYSCALL_ARGS[590], 4, 0 },
+	{ "sys_fchownat", &LINUX_SYSCALL_ARGS[594], 5, 0 },
+	{ "sys_futimesat", &LINUX_SYSCALL_ARGS[599], 3, 0 },
+	{ "sys_newfstatat", &LINUX_SYSCALL_ARGS[602], 4, 0 },
+	{ "sys_unlinkat", &LINUX_SYSCALL_ARGS[606], 3, 0 },
+	{ "sys_renameat", &LINUX_SYSCALL_ARGS[609], 4, 0 },
+	{ "sys_linkat", &LINUX_SYSCALL_ARGS[613], 5, 0 },
+	{ "sys_symlinkat", &LINUX_SYSCALL_ARGS[618], 3, 0 },
+	{ "sys_readlinkat", &LINUX_SYSCALL_ARGS[621], 4, 0 },
+	{ "sys_fchmodat", &LINUX_SYSCALL_ARGS[625], 3, 0 },
+	{ "sys_faccessat", &LINUX_SYSCALL_ARGS[628], 3, 0 },
+	{ "sys_pselect6", &LINUX_SYSCALL_ARGS[631], 6, 0 },
+	{ "sys_ppoll", &LINUX_SYSCALL_ARGS[637], 5, 0 },
+	{ "sys_unshare", &LINUX_SYSCALL_ARGS[642], 1, 0 },
+	{ "sys_set_robust_list", &LINUX_SYSCALL_ARGS[643], 2, 0 },
+	{ "sys_get_robust_list", &LINUX_SYSCALL_ARGS[645], 3, 0 },
+	{ "sys_splice", &LINUX_SYSCALL_ARGS[648], 6, 0 },
+	{ "sys_tee", &LINUX_SYSCALL_ARGS[654], 4, 0 },
+	{ "sys_sync_file_range", &LINUX_SYSCALL_ARGS[658], 4, 0 },
+	{ "sys_vmsplice", &LINUX_SYSCALL_ARGS[662], 4, 0 },
+	{ "sys_move_pages", &LINUX_SYSCALL_ARGS[666], 6, 0 },
+	{ "sys_utimensat", &LINUX_SYSCALL_ARGS[672], 4, 0 },
+	{ "sys_epoll_pwait", &LINUX_SYSCALL_ARGS[676], 6, 0 },
+	{ "sys_signalfd", &LINUX_SYSCALL_ARGS[682], 3, 0 },
+	{ "sys_timerfd", NULL, 0, 0 },
+	{ "sys_eventfd", &LINUX_SYSCALL_ARGS[685], 1, 0 },
+	{ "sys_fallocate", &LINUX_SYSCALL_ARGS[686], 4, 0 },
+	{ "sys_timerfd_settime", &LINUX_SYSCALL_ARGS[690], 4, 0 },
+	{ "sys_timerfd_gettime", &LINUX_SYSCALL_ARGS[694], 2, 0 },
+	{ "sys_accept4", &LINUX_SYSCALL_ARGS[696], 4, 0 },
+	{ "sys_signalfd4", &LINUX_SYSCALL_ARGS[700], 4, 0 },
+	{ "sys_eventfd2", &LINUX_SYSCALL_ARGS[704], 2, 0 },
+	{ "sys_epoll_create1", &LINUX_SYSCALL_ARGS[706], 1, 0 },
+	{ "sys_dup3", &LINUX_SYSCALL_ARGS[707], 3, 0 },
+	{ "sys_pipe2", &LINUX_SYSCALL_ARGS[710], 2, 0 },
+	{ "sys_inotify_init1", &LINUX_SYSCALL_ARGS[712], 1, 0 },
+	{ "sys_preadv", &LINUX_SYSCALL_ARGS[713], 5, 0 },
+	{ "sys_pwritev", &LINUX_SYSCALL_ARGS[718], 5, 0 },
+	{ "sys_rt_tgsigqueueinfo", &LINUX_SYSCALL_ARGS[723], 4, 0 },
+	{ "sys_perf_event_open", &LINUX_SYSCALL_ARGS[727], 5, 0 },
+	{ "sys_recvmmsg", &LINUX_SYSCALL_ARGS[732], 5, 0 },
+	{ "sys_fanotify_init", &LINUX_SYSCALL_ARGS[737], 2, 0 },
+	{ "sys_fanotify_mark", &LINUX_SYSCALL_ARGS[739], 5, 0 },
+	{ "sys_prlimit64", &LINUX_SYSCALL_ARGS[744], 4, 0 },
+	{ "sys_name_to_handle_at", &LINUX_SYSCALL_ARGS[748], 5, 0 },
+	{ "sys_open_by_handle_at", &LINUX_SYSCALL_ARGS[753], 3, 0 },
+	{ "sys_clock_adjtime", &LINUX_SYSCALL_ARGS[756], 2, 0 },
+	{ "sys_syncfs", &LINUX_SYSCALL_ARGS[758], 1, 0 },
+	{ "sys_sendmmsg", &LINUX_SYSCALL_ARGS[759], 4, 0 },
+	{ "sys_setns", &LINUX_SYSCALL_ARGS[763], 2, 0 },
+	{ "sys_getcpu", &LINUX_SYSCALL_ARGS[765], 3, 0 },
+	{ "sys_process_vm_readv", &LINUX_SYSCALL_ARGS[768], 6, 0 },
+	{ "sys_process_vm_writev", &LINUX_SYSCALL_ARGS[774], 6, 0 },
+	{ "sys_kcmp", &LINUX_SYSCALL_ARGS[780], 5, 0 },
+	{ "sys_finit_module", &LINUX_SYSCALL_ARGS[785], 3, 0 },
+	{ "sys_sched_setattr", &LINUX_SYSCALL_ARGS[788], 3, 0 },
+	{ "sys_sched_getattr", &LINUX_SYSCALL_ARGS[791], 4, 0 },
+	{ "sys_renameat2", &LINUX_SYSCALL_ARGS[795], 5, 0 },
+	{ "sys_seccomp", &LINUX_SYSCALL_ARGS[800], 3, 0 },
+	{ "sys_getrandom", &LINUX_SYSCALL_ARGS[803], 3, 0 },
+	{ "sys_memfd_create", &LINUX_SYSCALL_ARGS[806], 2, 0 },
+	{ "sys_kexec_file_load", &LINUX_SYSCALL_ARGS[808], 5, 0 },
+	{ "sys_bpf", &LINUX_SYSCALL_ARGS[813], 3, 0 },
+	{ "sys_execveat", &LINUX_SYSCALL_ARGS[816], 5, GT_SYSCALL_ENDS_PROCESS },
+	{ "sys_userfaultfd", &LINUX_SYSCALL_ARGS[821], 1, 0 },
+	{ "sys_membarrier", &LINUX_SYSCALL_ARGS[822], 2, 0 },
+	{ "sys_mlock2", &LINUX_SYSCALL_ARGS[824], 3, 0 },
+	{ "sys_copy_file_range", &LINUX_SYSCALL_ARGS[827], 6, 0 },
+};
 
-void gt_linux_print_sysret(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *user_data) {
-	reg_t syscall_return = event->x86_regs->rax;
-	fprintf(stderr, "pid: %u/0x%"PRIx64" (%s) return: 0x%"PRIx64"\n", pid, tid, get_process_name(vmi, pid), syscall_return);
-}
+const gt_syscall_table LINUX_SYSCALL_TABLE = {
+	GT_OS_LINUX, LINUX_SYSCALL_DESCS, G_N_ELEMENTS(LINUX_SYSCALL_DESCS)
+};
 
 const GTSyscallCallback VM_LINUX_SYSCALLS[] = {
-	{ "sys_read", gt_linux_print_syscall_sys_read, gt_linux_print_sysret },
-	{ "sys_write", gt_linux_print_syscall_sys_write, gt_linux_print_sysret },
-	{ "sys_open", gt_linux_print_syscall_sys_open, gt_linux_print_sysret },
-	{ "sys_close", gt_linux_print_syscall_sys_close, gt_linux_print_sysret },
-	{ "sys_stat", gt_linux_print_syscall_sys_stat, gt_linux_print_sysret },
-	{ "sys_fstat", gt_linux_print_syscall_sys_fstat, gt_linux_print_sysret },
-	{ "sys_lstat", gt_linux_print_syscall_sys_lstat, gt_linux_print_sysret },
-	{ "sys_poll", gt_linux_print_syscall_sys_poll, gt_linux_print_sysret },
-	{ "sys_lseek", gt_linux_print_syscall_sys_lseek, gt_linux_print_sysret },
-	{ "sys_mmap", gt_linux_print_syscall_sys_mmap, gt_linux_print_sysret },
-	{ "sys_mprotect", gt_linux_print_syscall_sys_mprotect, gt_linux_print_sysret },
-	{ "sys_munmap", gt_linux_print_syscall_sys_munmap, gt_linux_print_sysret },
-	{ "sys_brk", gt_linux_print_syscall_sys_brk, gt_linux_print_sysret },
-	{ "sys_rt_sigaction", gt_linux_print_syscall_sys_rt_sigaction, gt_linux_print_sysret },
-	{ "sys_rt_sigprocmask", gt_linux_print_syscall_sys_rt_sigprocmask, gt_linux_print_sysret },
-	{ "sys_rt_sigreturn", gt_linux_print_syscall_sys_rt_sigreturn, gt_linux_print_sysret },
-	{ "sys_ioctl", gt_linux_print_syscall_sys_ioctl, gt_linux_print_sysret },
-	{ "sys_pread", gt_linux_print_syscall_sys_pread, gt_linux_print_sysret },
-	{ "sys_pwrite", gt_linux_print_syscall_sys_pwrite, gt_linux_print_sysret },
-	{ "sys_readv", gt_linux_print_syscall_sys_readv, gt_linux_print_sysret },
-	{ "sys_writev", gt_linux_print_syscall_sys_writev, gt_linux_print_sysret },
-	{ "sys_access", gt_linux_print_syscall_sys_access, gt_linux_print_sysret },
-	{ "sys_pipe", gt_linux_print_syscall_sys_pipe, gt_linux_print_sysret },
-	{ "sys_select", gt_linux_print_syscall_sys_select, gt_linux_print_sysret },
-	{ "sys_sched_yield", gt_linux_print_syscall_sys_sched_yield, gt_linux_print_sysret },
-	{ "sys_mremap", gt_linux_print_syscall_sys_mremap, gt_linux_print_sysret },
-	{ "sys_msync", gt_linux_print_syscall_sys_msync, gt_linux_print_sysret },
-	{ "sys_mincore", gt_linux_print_syscall_sys_mincore, gt_linux_print_sysret },
-	{ "sys_madvise", gt_linux_print_syscall_sys_madvise, gt_linux_print_sysret },
-	{ "sys_shmget", gt_linux_print_syscall_sys_shmget, gt_linux_print_sysret },
-	{ "sys_shmat", gt_linux_print_syscall_sys_shmat, gt_linux_print_sysret },
-	{ "sys_shmctl", gt_linux_print_syscall_sys_shmctl, gt_linux_print_sysret },
-	{ "sys_dup", gt_linux_print_syscall_sys_dup, gt_linux_print_sysret },
-	{ "sys_dup2", gt_linux_print_syscall_sys_dup2, gt_linux_print_sysret },
-	{ "sys_pause", gt_linux_print_syscall_sys_pause, gt_linux_print_sysret },
-	{ "sys_nanosleep", gt_linux_print_syscall_sys_nanosleep, gt_linux_print_sysret },
-	{ "sys_getitimer", gt_linux_print_syscall_sys_getitimer, gt_linux_print_sysret },
-	{ "sys_alarm", gt_linux_print_syscall_sys_alarm, gt_linux_print_sysret },
-	{ "sys_setitimer", gt_linux_print_syscall_sys_setitimer, gt_linux_print_sysret },
-	{ "sys_getpid", gt_linux_print_syscall_sys_getpid, gt_linux_print_sysret },
-	{ "sys_sendfile", gt_linux_print_syscall_sys_sendfile, gt_linux_print_sysret },
-	{ "sys_socket", gt_linux_print_syscall_sys_socket, gt_linux_print_sysret },
-	{ "sys_connect", gt_linux_print_syscall_sys_connect, gt_linux_print_sysret },
-	{ "sys_accept", gt_linux_print_syscall_sys_accept, gt_linux_print_sysret },
-	{ "sys_sendto", gt_linux_print_syscall_sys_sendto, gt_linux_print_sysret },
-	{ "sys_recvfrom", gt_linux_print_syscall_sys_recvfrom, gt_linux_print_sysret },
-	{ "sys_sendmsg", gt_linux_print_syscall_sys_sendmsg, gt_linux_print_sysret },
-	{ "sys_recvmsg", gt_linux_print_syscall_sys_recvmsg, gt_linux_print_sysret },
-	{ "sys_shutdown", gt_linux_print_syscall_sys_shutdown, gt_linux_print_sysret },
-	{ "sys_bind", gt_linux_print_syscall_sys_bind, gt_linux_print_sysret },
-	{ "sys_listen", gt_linux_print_syscall_sys_listen, gt_linux_print_sysret },
-	{ "sys_getsockname", gt_linux_print_syscall_sys_getsockname, gt_linux_print_sysret },
-	{ "sys_getpeername", gt_linux_print_syscall_sys_getpeername, gt_linux_print_sysret },
-	{ "sys_socketpair", gt_linux_print_syscall_sys_socketpair, gt_linux_print_sysret },
-	{ "sys_setsockopt", gt_linux_print_syscall_sys_setsockopt, gt_linux_print_sysret },
-	{ "sys_getsockopt", gt_linux_print_syscall_sys_getsockopt, gt_linux_print_sysret },
-	{ "sys_clone", gt_linux_print_syscall_sys_clone, gt_linux_print_sysret },
-	{ "sys_fork", gt_linux_print_syscall_sys_fork, gt_linux_print_sysret },
-	{ "sys_vfork", gt_linux_print_syscall_sys_vfork, gt_linux_print_sysret },
-	{ "sys_execve", gt_linux_print_syscall_sys_execve, gt_linux_print_sysret },
-	{ "sys_exit", gt_linux_print_syscall_sys_exit, gt_linux_print_sysret },
-	{ "sys_wait4", gt_linux_print_syscall_sys_wait4, gt_linux_print_sysret },
-	{ "sys_kill", gt_linux_print_syscall_sys_kill, gt_linux_print_sysret },
-	{ "sys_uname", gt_linux_print_syscall_sys_uname, gt_linux_print_sysret },
-	{ "sys_semget", gt_linux_print_syscall_sys_semget, gt_linux_print_sysret },
-	{ "sys_semop", gt_linux_print_syscall_sys_semop, gt_linux_print_sysret },
-	{ "sys_semctl", gt_linux_print_syscall_sys_semctl, gt_linux_print_sysret },
-	{ "sys_shmdt", gt_linux_print_syscall_sys_shmdt, gt_linux_print_sysret },
-	{ "sys_msgget", gt_linux_print_syscall_sys_msgget, gt_linux_print_sysret },
-	{ "sys_msgsnd", gt_linux_print_syscall_sys_msgsnd, gt_linux_print_sysret },
-	{ "sys_msgrcv", gt_linux_print_syscall_sys_msgrcv, gt_linux_print_sysret },
-	{ "sys_msgctl", gt_linux_print_syscall_sys_msgctl, gt_linux_print_sysret },
-	{ "sys_fcntl", gt_linux_print_syscall_sys_fcntl, gt_linux_print_sysret },
-	{ "sys_flock", gt_linux_print_syscall_sys_flock, gt_linux_print_sysret },
-	{ "sys_fsync", gt_linux_print_syscall_sys_fsync, gt_linux_print_sysret },
-	{ "sys_fdatasync", gt_linux_print_syscall_sys_fdatasync, gt_linux_print_sysret },
-	{ "sys_truncate", gt_linux_print_syscall_sys_truncate, gt_linux_print_sysret },
-	{ "sys_ftruncate", gt_linux_print_syscall_sys_ftruncate, gt_linux_print_sysret },
-	{ "sys_getdents", gt_linux_print_syscall_sys_getdents, gt_linux_print_sysret },
-	{ "sys_getcwd", gt_linux_print_syscall_sys_getcwd, gt_linux_print_sysret },
-	{ "sys_chdir", gt_linux_print_syscall_sys_chdir, gt_linux_print_sysret },
-	{ "sys_fchdir", gt_linux_print_syscall_sys_fchdir, gt_linux_print_sysret },
-	{ "sys_rename", gt_linux_print_syscall_sys_rename, gt_linux_print_sysret },
-	{ "sys_mkdir", gt_linux_print_syscall_sys_mkdir, gt_linux_print_sysret },
-	{ "sys_rmdir", gt_linux_print_syscall_sys_rmdir, gt_linux_print_sysret },
-	{ "sys_creat", gt_linux_print_syscall_sys_creat, gt_linux_print_sysret },
-	{ "sys_link", gt_linux_print_syscall_sys_link, gt_linux_print_sysret },
-	{ "sys_unlink", gt_linux_print_syscall_sys_unlink, gt_linux_print_sysret },
-	{ "sys_symlink", gt_linux_print_syscall_sys_symlink, gt_linux_print_sysret },
-	{ "sys_readlink", gt_linux_print_syscall_sys_readlink, gt_linux_print_sysret },
-	{ "sys_chmod", gt_linux_print_syscall_sys_chmod, gt_linux_print_sysret },
-	{ "sys_fchmod", gt_linux_print_syscall_sys_fchmod, gt_linux_print_sysret },
-	{ "sys_chown", gt_linux_print_syscall_sys_chown, gt_linux_print_sysret },
-	{ "sys_fchown", gt_linux_print_syscall_sys_fchown, gt_linux_print_sysret },
-	{ "sys_lchown", gt_linux_print_syscall_sys_lchown, gt_linux_print_sysret },
-	{ "sys_umask", gt_linux_print_syscall_sys_umask, gt_linux_print_sysret },
-	{ "sys_gettimeofday", gt_linux_print_syscall_sys_gettimeofday, gt_linux_print_sysret },
-	{ "sys_getrlimit", gt_linux_print_syscall_sys_getrlimit, gt_linux_print_sysret },
-	{ "sys_getrusage", gt_linux_print_syscall_sys_getrusage, gt_linux_print_sysret },
-	{ "sys_sysinfo", gt_linux_print_syscall_sys_sysinfo, gt_linux_print_sysret },
-	{ "sys_times", gt_linux_print_syscall_sys_times, gt_linux_print_sysret },
-	{ "sys_ptrace", gt_linux_print_syscall_sys_ptrace, gt_linux_print_sysret },
-	{ "sys_getuid", gt_linux_print_syscall_sys_getuid, gt_linux_print_sysret },
-	{ "sys_syslog", gt_linux_print_syscall_sys_syslog, gt_linux_print_sysret },
-	{ "sys_getgid", gt_linux_print_syscall_sys_getgid, gt_linux_print_sysret },
-	{ "sys_setuid", gt_linux_print_syscall_sys_setuid, gt_linux_print_sysret },
-	{ "sys_setgid", gt_linux_print_syscall_sys_setgid, gt_linux_print_sysret },
-	{ "sys_geteuid", gt_linux_print_syscall_sys_geteuid, gt_linux_print_sysret },
-	{ "sys_getegid", gt_linux_print_syscall_sys_getegid, gt_linux_print_sysret },
-	{ "sys_setpgid", gt_linux_print_syscall_sys_setpgid, gt_linux_print_sysret },
-	{ "sys_getppid", gt_linux_print_syscall_sys_getppid, gt_linux_print_sysret },
-	{ "sys_getpgrp", gt_linux_print_syscall_sys_getpgrp, gt_linux_print_sysret },
-	{ "sys_setsid", gt_linux_print_syscall_sys_setsid, gt_linux_print_sysret },
-	{ "sys_setreuid", gt_linux_print_syscall_sys_setreuid, gt_linux_print_sysret },
-	{ "sys_setregid", gt_linux_print_syscall_sys_setregid, gt_linux_print_sysret },
-	{ "sys_getgroups", gt_linux_print_syscall_sys_getgroups, gt_linux_print_sysret },
-	{ "sys_setgroups", gt_linux_print_syscall_sys_setgroups, gt_linux_print_sysret },
-	{ "sys_setresuid", gt_linux_print_syscall_sys_setresuid, gt_linux_print_sysret },
-	{ "sys_getresuid", gt_linux_print_syscall_sys_getresuid, gt_linux_print_sysret },
-	{ "sys_setresgid", gt_linux_print_syscall_sys_setresgid, gt_linux_print_sysret },
-	{ "sys_getresgid", gt_linux_print_syscall_sys_getresgid, gt_linux_print_sysret },
-	{ "sys_getpgid", gt_linux_print_syscall_sys_getpgid, gt_linux_print_sysret },
-	{ "sys_setfsuid", gt_linux_print_syscall_sys_setfsuid, gt_linux_print_sysret },
-	{ "sys_setfsgid", gt_linux_print_syscall_sys_setfsgid, gt_linux_print_sysret },
-	{ "sys_getsid", gt_linux_print_syscall_sys_getsid, gt_linux_print_sysret },
-	{ "sys_capget", gt_linux_print_syscall_sys_capget, gt_linux_print_sysret },
-	{ "sys_capset", gt_linux_print_syscall_sys_capset, gt_linux_print_sysret },
-	{ "sys_rt_sigpending", gt_linux_print_syscall_sys_rt_sigpending, gt_linux_print_sysret },
-	{ "sys_rt_sigtimedwait", gt_linux_print_syscall_sys_rt_sigtimedwait, gt_linux_print_sysret },
-	{ "sys_rt_sigqueueinfo", gt_linux_print_syscall_sys_rt_sigqueueinfo, gt_linux_print_sysret },
-	{ "sys_rt_sigsuspend", gt_linux_print_syscall_sys_rt_sigsuspend, gt_linux_print_sysret },
-	{ "sys_sigaltstack", gt_linux_print_syscall_sys_sigaltstack, gt_linux_print_sysret },
-	{ "sys_utime", gt_linux_print_syscall_sys_utime, gt_linux_print_sysret },
-	{ "sys_mknod", gt_linux_print_syscall_sys_mknod, gt_linux_print_sysret },
-	{ "sys_uselib", gt_linux_print_syscall_sys_uselib, gt_linux_print_sysret },
-	{ "sys_personality", gt_linux_print_syscall_sys_personality, gt_linux_print_sysret },
-	{ "sys_ustat", gt_linux_print_syscall_sys_ustat, gt_linux_print_sysret },
-	{ "sys_statfs", gt_linux_print_syscall_sys_statfs, gt_linux_print_sysret },
-	{ "sys_fstatfs", gt_linux_print_syscall_sys_fstatfs, gt_linux_print_sysret },
-	{ "sys_sysfs", gt_linux_print_syscall_sys_sysfs, gt_linux_print_sysret },
-	{ "sys_getpriority", gt_linux_print_syscall_sys_getpriority, gt_linux_print_sysret },
-	{ "sys_setpriority", gt_linux_print_syscall_sys_setpriority, gt_linux_print_sysret },
-	{ "sys_sched_setparam", gt_linux_print_syscall_sys_sched_setparam, gt_linux_print_sysret },
-	{ "sys_sched_getparam", gt_linux_print_syscall_sys_sched_getparam, gt_linux_print_sysret },
-	{ "sys_sched_setscheduler", gt_linux_print_syscall_sys_sched_setscheduler, gt_linux_print_sysret },
-	{ "sys_sched_getscheduler", gt_linux_print_syscall_sys_sched_getscheduler, gt_linux_print_sysret },
-	{ "sys_sched_get_priority_max", gt_linux_print_syscall_sys_sched_get_priority_max, gt_linux_print_sysret },
-	{ "sys_sched_get_priority_min", gt_linux_print_syscall_sys_sched_get_priority_min, gt_linux_print_sysret },
-	{ "sys_sched_rr_get_interval", gt_linux_print_syscall_sys_sched_rr_get_interval, gt_linux_print_sysret },
-	{ "sys_mlock", gt_linux_print_syscall_sys_mlock, gt_linux_print_sysret },
-	{ "sys_munlock", gt_linux_print_syscall_sys_munlock, gt_linux_print_sysret },
-	{ "sys_mlockall", gt_linux_print_syscall_sys_mlockall, gt_linux_print_sysret },
-	{ "sys_munlockall", gt_linux_print_syscall_sys_munlockall, gt_linux_print_sysret },
-	{ "sys_vhangup", gt_linux_print_syscall_sys_vhangup, gt_linux_print_sysret },
-	{ "sys_modify_ldt", gt_linux_print_syscall_sys_modify_ldt, gt_linux_print_sysret },
-	{ "sys_pivot_root", gt_linux_print_syscall_sys_pivot_root, gt_linux_print_sysret },
-	{ "sys_sysctl", gt_linux_print_syscall_sys_sysctl, gt_linux_print_sysret },
-	{ "sys_prctl", gt_linux_print_syscall_sys_prctl, gt_linux_print_sysret },
-	{ "sys_arch_prctl", gt_linux_print_syscall_sys_arch_prctl, gt_linux_print_sysret },
-	{ "sys_adjtimex", gt_linux_print_syscall_sys_adjtimex, gt_linux_print_sysret },
-	{ "sys_setrlimit", gt_linux_print_syscall_sys_setrlimit, gt_linux_print_sysret },
-	{ "sys_chroot", gt_linux_print_syscall_sys_chroot, gt_linux_print_sysret },
-	{ "sys_sync", gt_linux_print_syscall_sys_sync, gt_linux_print_sysret },
-	{ "sys_acct", gt_linux_print_syscall_sys_acct, gt_linux_print_sysret },
-	{ "sys_settimeofday", gt_linux_print_syscall_sys_settimeofday, gt_linux_print_sysret },
-	{ "sys_mount", gt_linux_print_syscall_sys_mount, gt_linux_print_sysret },
-	{ "sys_umount2", gt_linux_print_syscall_sys_umount2, gt_linux_print_sysret },
-	{ "sys_swapon", gt_linux_print_syscall_sys_swapon, gt_linux_print_sysret },
-	{ "sys_swapoff", gt_linux_print_syscall_sys_swapoff, gt_linux_print_sysret },
-	{ "sys_reboot", gt_linux_print_syscall_sys_reboot, gt_linux_print_sysret },
-	{ "sys_sethostname", gt_linux_print_syscall_sys_sethostname, gt_linux_print_sysret },
-	{ "sys_setdomainname", gt_linux_print_syscall_sys_setdomainname, gt_linux_print_sysret },
-	{ "sys_iopl", gt_linux_print_syscall_sys_iopl, gt_linux_print_sysret },
-	{ "sys_ioperm", gt_linux_print_syscall_sys_ioperm, gt_linux_print_sysret },
-	{ "sys_create_module", gt_linux_print_syscall_sys_create_module, gt_linux_print_sysret },
-	{ "sys_init_module", gt_linux_print_syscall_sys_init_module, gt_linux_print_sysret },
-	{ "sys_delete_module", gt_linux_print_syscall_sys_delete_module, gt_linux_print_sysret },
-	{ "sys_get_kernel_syms", gt_linux_print_syscall_sys_get_kernel_syms, gt_linux_print_sysret },
-	{ "sys_query_module", gt_linux_print_syscall_sys_query_module, gt_linux_print_sysret },
-	{ "sys_quotactl", gt_linux_print_syscall_sys_quotactl, gt_linux_print_sysret },
-	{ "sys_nfsservctl", gt_linux_print_syscall_sys_nfsservctl, gt_linux_print_sysret },
-	{ "sys_getpmsg", gt_linux_print_syscall_sys_getpmsg, gt_linux_print_sysret },
-	{ "sys_putpmsg", gt_linux_print_syscall_sys_putpmsg, gt_linux_print_sysret },
-	{ "sys_afs_syscall", gt_linux_print_syscall_sys_afs_syscall, gt_linux_print_sysret },
-	{ "sys_tuxcall", gt_linux_print_syscall_sys_tuxcall, gt_linux_print_sysret },
-	{ "sys_security", gt_linux_print_syscall_sys_security, gt_linux_print_sysret },
-	{ "sys_gettid", gt_linux_print_syscall_sys_gettid, gt_linux_print_sysret },
-	{ "sys_readahead", gt_linux_print_syscall_sys_readahead, gt_linux_print_sysret },
-	{ "sys_setxattr", gt_linux_print_syscall_sys_setxattr, gt_linux_print_sysret },
-	{ "sys_lsetxattr", gt_linux_print_syscall_sys_lsetxattr, gt_linux_print_sysret },
-	{ "sys_fsetxattr", gt_linux_print_syscall_sys_fsetxattr, gt_linux_print_sysret },
-	{ "sys_getxattr", gt_linux_print_syscall_sys_getxattr, gt_linux_print_sysret },
-	{ "sys_lgetxattr", gt_linux_print_syscall_sys_lgetxattr, gt_linux_print_sysret },
-	{ "sys_fgetxattr", gt_linux_print_syscall_sys_fgetxattr, gt_linux_print_sysret },
-	{ "sys_listxattr", gt_linux_print_syscall_sys_listxattr, gt_linux_print_sysret },
-	{ "sys_llistxattr", gt_linux_print_syscall_sys_llistxattr, gt_linux_print_sysret },
-	{ "sys_flistxattr", gt_linux_print_syscall_sys_flistxattr, gt_linux_print_sysret },
-	{ "sys_removexattr", gt_linux_print_syscall_sys_removexattr, gt_linux_print_sysret },
-	{ "sys_lremovexattr", gt_linux_print_syscall_sys_lremovexattr, gt_linux_print_sysret },
-	{ "sys_fremovexattr", gt_linux_print_syscall_sys_fremovexattr, gt_linux_print_sysret },
-	{ "sys_tkill", gt_linux_print_syscall_sys_tkill, gt_linux_print_sysret },
-	{ "sys_time", gt_linux_print_syscall_sys_time, gt_linux_print_sysret },
-	{ "sys_futex", gt_linux_print_syscall_sys_futex, gt_linux_print_sysret },
-	{ "sys_sched_setaffinity", gt_linux_print_syscall_sys_sched_setaffinity, gt_linux_print_sysret },
-	{ "sys_sched_getaffinity", gt_linux_print_syscall_sys_sched_getaffinity, gt_linux_print_sysret },
-	{ "sys_set_thread_area", gt_linux_print_syscall_sys_set_thread_area, gt_linux_print_sysret },
-	{ "sys_io_setup", gt_linux_print_syscall_sys_io_setup, gt_linux_print_sysret },
-	{ "sys_io_destroy", gt_linux_print_syscall_sys_io_destroy, gt_linux_print_sysret },
-	{ "sys_io_getevents", gt_linux_print_syscall_sys_io_getevents, gt_linux_print_sysret },
-	{ "sys_io_submit", gt_linux_print_syscall_sys_io_submit, gt_linux_print_sysret },
-	{ "sys_io_cancel", gt_linux_print_syscall_sys_io_cancel, gt_linux_print_sysret },
-	{ "sys_get_thread_area", gt_linux_print_syscall_sys_get_thread_area, gt_linux_print_sysret },
-	{ "sys_lookup_dcookie", gt_linux_print_syscall_sys_lookup_dcookie, gt_linux_print_sysret },
-	{ "sys_epoll_create", gt_linux_print_syscall_sys_epoll_create, gt_linux_print_sysret },
-	{ "sys_epoll_ctl_old", gt_linux_print_syscall_sys_epoll_ctl_old, gt_linux_print_sysret },
-	{ "sys_epoll_wait_old", gt_linux_print_syscall_sys_epoll_wait_old, gt_linux_print_sysret },
-	{ "sys_remap_file_pages", gt_linux_print_syscall_sys_remap_file_pages, gt_linux_print_sysret },
-	{ "sys_getdents64", gt_linux_print_syscall_sys_getdents64, gt_linux_print_sysret },
-	{ "sys_set_tid_address", gt_linux_print_syscall_sys_set_tid_address, gt_linux_print_sysret },
-	{ "sys_restart_syscall", gt_linux_print_syscall_sys_restart_syscall, gt_linux_print_sysret },
-	{ "sys_semtimedop", gt_linux_print_syscall_sys_semtimedop, gt_linux_print_sysret },
-	{ "sys_fadvise64", gt_linux_print_syscall_sys_fadvise64, gt_linux_print_sysret },
-	{ "sys_timer_create", gt_linux_print_syscall_sys_timer_create, gt_linux_print_sysret },
-	{ "sys_timer_settime", gt_linux_print_syscall_sys_timer_settime, gt_linux_print_sysret },
-	{ "sys_timer_gettime", gt_linux_print_syscall_sys_timer_gettime, gt_linux_print_sysret },
-	{ "sys_timer_getoverrun", gt_linux_print_syscall_sys_timer_getoverrun, gt_linux_print_sysret },
-	{ "sys_timer_delete", gt_linux_print_syscall_sys_timer_delete, gt_linux_print_sysret },
-	{ "sys_clock_settime", gt_linux_print_syscall_sys_clock_settime, gt_linux_print_sysret },
-	{ "sys_clock_gettime", gt_linux_print_syscall_sys_clock_gettime, gt_linux_print_sysret },
-	{ "sys_clock_getres", gt_linux_print_syscall_sys_clock_getres, gt_linux_print_sysret },
-	{ "sys_clock_nanosleep", gt_linux_print_syscall_sys_clock_nanosleep, gt_linux_print_sysret },
-	{ "sys_exit_group", gt_linux_print_syscall_sys_exit_group, gt_linux_print_sysret },
-	{ "sys_epoll_wait", gt_linux_print_syscall_sys_epoll_wait, gt_linux_print_sysret },
-	{ "sys_epoll_ctl", gt_linux_print_syscall_sys_epoll_ctl, gt_linux_print_sysret },
-	{ "sys_tgkill", gt_linux_print_syscall_sys_tgkill, gt_linux_print_sysret },
-	{ "sys_utimes", gt_linux_print_syscall_sys_utimes, gt_linux_print_sysret },
-	{ "sys_vserver", gt_linux_print_syscall_sys_vserver, gt_linux_print_sysret },
-	{ "sys_mbind", gt_linux_print_syscall_sys_mbind, gt_linux_print_sysret },
-	{ "sys_set_mempolicy", gt_linux_print_syscall_sys_set_mempolicy, gt_linux_print_sysret },
-	{ "sys_get_mempolicy", gt_linux_print_syscall_sys_get_mempolicy, gt_linux_print_sysret },
-	{ "sys_mq_open", gt_linux_print_syscall_sys_mq_open, gt_linux_print_sysret },
-	{ "sys_mq_unlink", gt_linux_print_syscall_sys_mq_unlink, gt_linux_print_sysret },
-	{ "sys_mq_timedsend", gt_linux_print_syscall_sys_mq_timedsend, gt_linux_print_sysret },
-	{ "sys_mq_timedreceive", gt_linux_print_syscall_sys_mq_timedreceive, gt_linux_print_sysret },
-	{ "sys_mq_notify", gt_linux_print_syscall_sys_mq_notify, gt_linux_print_sysret },
-	{ "sys_mq_getsetattr", gt_linux_print_syscall_sys_mq_getsetattr, gt_linux_print_sysret },
-	{ "sys_kexec_load", gt_linux_print_syscall_sys_kexec_load, gt_linux_print_sysret },
-	{ "sys_waitid", gt_linux_print_syscall_sys_waitid, gt_linux_print_sysret },
-	{ "sys_add_key", gt_linux_print_syscall_sys_add_key, gt_linux_print_sysret },
-	{ "sys_request_key", gt_linux_print_syscall_sys_request_key, gt_linux_print_sysret },
-	{ "sys_keyctl", gt_linux_print_syscall_sys_keyctl, gt_linux_print_sysret },
-	{ "sys_ioprio_set", gt_linux_print_syscall_sys_ioprio_set, gt_linux_print_sysret },
-	{ "sys_ioprio_get", gt_linux_print_syscall_sys_ioprio_get, gt_linux_print_sysret },
-	{ "sys_inotify_init", gt_linux_print_syscall_sys_inotify_init, gt_linux_print_sysret },
-	{ "sys_inotify_add_watch", gt_linux_print_syscall_sys_inotify_add_watch, gt_linux_print_sysret },
-	{ "sys_inotify_rm_watch", gt_linux_print_syscall_sys_inotify_rm_watch, gt_linux_print_sysret },
-	{ "sys_migrate_pages", gt_linux_print_syscall_sys_migrate_pages, gt_linux_print_sysret },
-	{ "sys_openat", gt_linux_print_syscall_sys_openat, gt_linux_print_sysret },
-	{ "sys_mkdirat", gt_linux_print_syscall_sys_mkdirat, gt_linux_print_sysret },
-	{ "sys_mknodat", gt_linux_print_syscall_sys_mknodat, gt_linux_print_sysret },
-	{ "sys_fchownat", gt_linux_print_syscall_sys_fchownat, gt_linux_print_sysret },
-	{ "sys_futimesat", gt_linux_print_syscall_sys_futimesat, gt_linux_print_sysret },
-	{ "sys_newfstatat", gt_linux_print_syscall_sys_newfstatat, gt_linux_print_sysret },
-	{ "sys_unlinkat", gt_linux_print_syscall_sys_unlinkat, gt_linux_print_sysret },
-	{ "sys_renameat", gt_linux_print_syscall_sys_renameat, gt_linux_print_sysret },
-	{ "sys_linkat", gt_linux_print_syscall_sys_linkat, gt_linux_print_sysret },
-	{ "sys_symlinkat", gt_linux_print_syscall_sys_symlinkat, gt_linux_print_sysret },
-	{ "sys_readlinkat", gt_linux_print_syscall_sys_readlinkat, gt_linux_print_sysret },
-	{ "sys_fchmodat", gt_linux_print_syscall_sys_fchmodat, gt_linux_print_sysret },
-	{ "sys_faccessat", gt_linux_print_syscall_sys_faccessat, gt_linux_print_sysret },
-	{ "sys_pselect6", gt_linux_print_syscall_sys_pselect6, gt_linux_print_sysret },
-	{ "sys_ppoll", gt_linux_print_syscall_sys_ppoll, gt_linux_print_sysret },
-	{ "sys_unshare", gt_linux_print_syscall_sys_unshare, gt_linux_print_sysret },
-	{ "sys_set_robust_list", gt_linux_print_syscall_sys_set_robust_list, gt_linux_print_sysret },
-	{ "sys_get_robust_list", gt_linux_print_syscall_sys_get_robust_list, gt_linux_print_sysret },
-	{ "sys_splice", gt_linux_print_syscall_sys_splice, gt_linux_print_sysret },
-	{ "sys_tee", gt_linux_print_syscall_sys_tee, gt_linux_print_sysret },
-	{ "sys_sync_file_range", gt_linux_print_syscall_sys_sync_file_range, gt_linux_print_sysret },
-	{ "sys_vmsplice", gt_linux_print_syscall_sys_vmsplice, gt_linux_print_sysret },
-	{ "sys_move_pages", gt_linux_print_syscall_sys_move_pages, gt_linux_print_sysret },
-	{ "sys_utimensat", gt_linux_print_syscall_sys_utimensat, gt_linux_print_sysret },
-	{ "sys_epoll_pwait", gt_linux_print_syscall_sys_epoll_pwait, gt_linux_print_sysret },
-	{ "sys_signalfd", gt_linux_print_syscall_sys_signalfd, gt_linux_print_sysret },
-	{ "sys_timerfd", gt_linux_print_syscall_sys_timerfd, gt_linux_print_sysret },
-	{ "sys_eventfd", gt_linux_print_syscall_sys_eventfd, gt_linux_print_sysret },
-	{ "sys_fallocate", gt_linux_print_syscall_sys_fallocate, gt_linux_print_sysret },
-	{ "sys_timerfd_settime", gt_linux_print_syscall_sys_timerfd_settime, gt_linux_print_sysret },
-	{ "sys_timerfd_gettime", gt_linux_print_syscall_sys_timerfd_gettime, gt_linux_print_sysret },
-	{ "sys_accept4", gt_linux_print_syscall_sys_accept4, gt_linux_print_sysret },
-	{ "sys_signalfd4", gt_linux_print_syscall_sys_signalfd4, gt_linux_print_sysret },
-	{ "sys_eventfd2", gt_linux_print_syscall_sys_eventfd2, gt_linux_print_sysret },
-	{ "sys_epoll_create1", gt_linux_print_syscall_sys_epoll_create1, gt_linux_print_sysret },
-	{ "sys_dup3", gt_linux_print_syscall_sys_dup3, gt_linux_print_sysret },
-	{ "sys_pipe2", gt_linux_print_syscall_sys_pipe2, gt_linux_print_sysret },
-	{ "sys_inotify_init1", gt_linux_print_syscall_sys_inotify_init1, gt_linux_print_sysret },
-	{ "sys_preadv", gt_linux_print_syscall_sys_preadv, gt_linux_print_sysret },
-	{ "sys_pwritev", gt_linux_print_syscall_sys_pwritev, gt_linux_print_sysret },
-	{ "sys_rt_tgsigqueueinfo", gt_linux_print_syscall_sys_rt_tgsigqueueinfo, gt_linux_print_sysret },
-	{ "sys_perf_event_open", gt_linux_print_syscall_sys_perf_event_open, gt_linux_print_sysret },
-	{ "sys_recvmmsg", gt_linux_print_syscall_sys_recvmmsg, gt_linux_print_sysret },
-	{ "sys_fanotify_init", gt_linux_print_syscall_sys_fanotify_init, gt_linux_print_sysret },
-	{ "sys_fanotify_mark", gt_linux_print_syscall_sys_fanotify_mark, gt_linux_print_sysret },
-	{ "sys_prlimit64", gt_linux_print_syscall_sys_prlimit64, gt_linux_print_sysret },
-	{ "sys_name_to_handle_at", gt_linux_print_syscall_sys_name_to_handle_at, gt_linux_print_sysret },
-	{ "sys_open_by_handle_at", gt_linux_print_syscall_sys_open_by_handle_at, gt_linux_print_sysret },
-	{ "sys_clock_adjtime", gt_linux_print_syscall_sys_clock_adjtime, gt_linux_print_sysret },
-	{ "sys_syncfs", gt_linux_print_syscall_sys_syncfs, gt_linux_print_sysret },
-	{ "sys_sendmmsg", gt_linux_print_syscall_sys_sendmmsg, gt_linux_print_sysret },
-	{ "sys_setns", gt_linux_print_syscall_sys_setns, gt_linux_print_sysret },
-	{ "sys_getcpu", gt_linux_print_syscall_sys_getcpu, gt_linux_print_sysret },
-	{ "sys_process_vm_readv", gt_linux_print_syscall_sys_process_vm_readv, gt_linux_print_sysret },
-	{ "sys_process_vm_writev", gt_linux_print_syscall_sys_process_vm_writev, gt_linux_print_sysret },
-	{ "sys_kcmp", gt_linux_print_syscall_sys_kcmp, gt_linux_print_sysret },
-	{ "sys_finit_module", gt_linux_print_syscall_sys_finit_module, gt_linux_print_sysret },
-	{ "sys_sched_setattr", gt_linux_print_syscall_sys_sched_setattr, gt_linux_print_sysret },
-	{ "sys_sched_getattr", gt_linux_print_syscall_sys_sched_getattr, gt_linux_print_sysret },
-	{ "sys_renameat2", gt_linux_print_syscall_sys_renameat2, gt_linux_print_sysret },
-	{ "sys_seccomp", gt_linux_print_syscall_sys_seccomp, gt_linux_print_sysret },
-	{ "sys_getrandom", gt_linux_print_syscall_sys_getrandom, gt_linux_print_sysret },
-	{ "sys_memfd_create", gt_linux_print_syscall_sys_memfd_create, gt_linux_print_sysret },
-	{ "sys_kexec_file_load", gt_linux_print_syscall_sys_kexec_file_load, gt_linux_print_sysret },
-	{ "sys_bpf", gt_linux_print_syscall_sys_bpf, gt_linux_print_sysret },
-	{ "sys_execveat", gt_linux_print_syscall_sys_execveat, gt_linux_print_sysret },
-	{ "sys_userfaultfd", gt_linux_print_syscall_sys_userfaultfd, gt_linux_print_sysret },
-	{ "sys_membarrier", gt_linux_print_syscall_sys_membarrier, gt_linux_print_sysret },
-	{ "sys_mlock2", gt_linux_print_syscall_sys_mlock2, gt_linux_print_sysret },
-	{ "sys_copy_file_range", gt_linux_print_syscall_sys_copy_file_range, gt_linux_print_sysret },
+	{ "sys_read", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[0] },
+	{ "sys_write", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[1] },
+	{ "sys_open", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[2] },
+	{ "sys_close", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[3] },
+	{ "sys_stat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[4] },
+	{ "sys_fstat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[5] },
+	{ "sys_lstat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[6] },
+	{ "sys_poll", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[7] },
+	{ "sys_lseek", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[8] },
+	{ "sys_mmap", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[9] },
+	{ "sys_mprotect", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[10] },
+	{ "sys_munmap", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[11] },
+	{ "sys_brk", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[12] },
+	{ "sys_rt_sigaction", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[13] },
+	{ "sys_rt_sigprocmask", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[14] },
+	{ "sys_rt_sigreturn", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[15] },
+	{ "sys_ioctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[16] },
+	{ "sys_pread", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[17] },
+	{ "sys_pwrite", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[18] },
+	{ "sys_readv", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[19] },
+	{ "sys_writev", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[20] },
+	{ "sys_access", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[21] },
+	{ "sys_pipe", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[22] },
+	{ "sys_select", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[23] },
+	{ "sys_sched_yield", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[24] },
+	{ "sys_mremap", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[25] },
+	{ "sys_msync", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[26] },
+	{ "sys_mincore", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[27] },
+	{ "sys_madvise", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[28] },
+	{ "sys_shmget", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[29] },
+	{ "sys_shmat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[30] },
+	{ "sys_shmctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[31] },
+	{ "sys_dup", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[32] },
+	{ "sys_dup2", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[33] },
+	{ "sys_pause", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[34] },
+	{ "sys_nanosleep", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[35] },
+	{ "sys_getitimer", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[36] },
+	{ "sys_alarm", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[37] },
+	{ "sys_setitimer", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[38] },
+	{ "sys_getpid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[39] },
+	{ "sys_sendfile", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[40] },
+	{ "sys_socket", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[41] },
+	{ "sys_connect", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[42] },
+	{ "sys_accept", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[43] },
+	{ "sys_sendto", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[44] },
+	{ "sys_recvfrom", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[45] },
+	{ "sys_sendmsg", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[46] },
+	{ "sys_recvmsg", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[47] },
+	{ "sys_shutdown", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[48] },
+	{ "sys_bind", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[49] },
+	{ "sys_listen", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[50] },
+	{ "sys_getsockname", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[51] },
+	{ "sys_getpeername", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[52] },
+	{ "sys_socketpair", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[53] },
+	{ "sys_setsockopt", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[54] },
+	{ "sys_getsockopt", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[55] },
+	{ "sys_clone", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[56] },
+	{ "sys_fork", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[57] },
+	{ "sys_vfork", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[58] },
+	{ "sys_execve", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[59] },
+	{ "sys_exit", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[60] },
+	{ "sys_wait4", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[61] },
+	{ "sys_kill", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[62] },
+	{ "sys_uname", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[63] },
+	{ "sys_semget", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[64] },
+	{ "sys_semop", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[65] },
+	{ "sys_semctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[66] },
+	{ "sys_shmdt", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[67] },
+	{ "sys_msgget", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[68] },
+	{ "sys_msgsnd", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[69] },
+	{ "sys_msgrcv", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[70] },
+	{ "sys_msgctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[71] },
+	{ "sys_fcntl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[72] },
+	{ "sys_flock", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[73] },
+	{ "sys_fsync", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[74] },
+	{ "sys_fdatasync", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[75] },
+	{ "sys_truncate", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[76] },
+	{ "sys_ftruncate", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[77] },
+	{ "sys_getdents", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[78] },
+	{ "sys_getcwd", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[79] },
+	{ "sys_chdir", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[80] },
+	{ "sys_fchdir", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[81] },
+	{ "sys_rename", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[82] },
+	{ "sys_mkdir", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[83] },
+	{ "sys_rmdir", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[84] },
+	{ "sys_creat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[85] },
+	{ "sys_link", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[86] },
+	{ "sys_unlink", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[87] },
+	{ "sys_symlink", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[88] },
+	{ "sys_readlink", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[89] },
+	{ "sys_chmod", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[90] },
+	{ "sys_fchmod", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[91] },
+	{ "sys_chown", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[92] },
+	{ "sys_fchown", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[93] },
+	{ "sys_lchown", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[94] },
+	{ "sys_umask", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[95] },
+	{ "sys_gettimeofday", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[96] },
+	{ "sys_getrlimit", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[97] },
+	{ "sys_getrusage", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[98] },
+	{ "sys_sysinfo", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[99] },
+	{ "sys_times", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[100] },
+	{ "sys_ptrace", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[101] },
+	{ "sys_getuid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[102] },
+	{ "sys_syslog", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[103] },
+	{ "sys_getgid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[104] },
+	{ "sys_setuid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[105] },
+	{ "sys_setgid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[106] },
+	{ "sys_geteuid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[107] },
+	{ "sys_getegid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[108] },
+	{ "sys_setpgid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[109] },
+	{ "sys_getppid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[110] },
+	{ "sys_getpgrp", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[111] },
+	{ "sys_setsid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[112] },
+	{ "sys_setreuid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[113] },
+	{ "sys_setregid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[114] },
+	{ "sys_getgroups", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[115] },
+	{ "sys_setgroups", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[116] },
+	{ "sys_setresuid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[117] },
+	{ "sys_getresuid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[118] },
+	{ "sys_setresgid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[119] },
+	{ "sys_getresgid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[120] },
+	{ "sys_getpgid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[121] },
+	{ "sys_setfsuid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[122] },
+	{ "sys_setfsgid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[123] },
+	{ "sys_getsid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[124] },
+	{ "sys_capget", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[125] },
+	{ "sys_capset", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[126] },
+	{ "sys_rt_sigpending", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[127] },
+	{ "sys_rt_sigtimedwait", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[128] },
+	{ "sys_rt_sigqueueinfo", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[129] },
+	{ "sys_rt_sigsuspend", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[130] },
+	{ "sys_sigaltstack", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[131] },
+	{ "sys_utime", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[132] },
+	{ "sys_mknod", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[133] },
+	{ "sys_uselib", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[134] },
+	{ "sys_personality", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[135] },
+	{ "sys_ustat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[136] },
+	{ "sys_statfs", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[137] },
+	{ "sys_fstatfs", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[138] },
+	{ "sys_sysfs", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[139] },
+	{ "sys_getpriority", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[140] },
+	{ "sys_setpriority", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[141] },
+	{ "sys_sched_setparam", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[142] },
+	{ "sys_sched_getparam", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[143] },
+	{ "sys_sched_setscheduler", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[144] },
+	{ "sys_sched_getscheduler", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[145] },
+	{ "sys_sched_get_priority_max", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[146] },
+	{ "sys_sched_get_priority_min", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[147] },
+	{ "sys_sched_rr_get_interval", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[148] },
+	{ "sys_mlock", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[149] },
+	{ "sys_munlock", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[150] },
+	{ "sys_mlockall", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[151] },
+	{ "sys_munlockall", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[152] },
+	{ "sys_vhangup", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[153] },
+	{ "sys_modify_ldt", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[154] },
+	{ "sys_pivot_root", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[155] },
+	{ "sys_sysctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[156] },
+	{ "sys_prctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[157] },
+	{ "sys_arch_prctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[158] },
+	{ "sys_adjtimex", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[159] },
+	{ "sys_setrlimit", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[160] },
+	{ "sys_chroot", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[161] },
+	{ "sys_sync", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[162] },
+	{ "sys_acct", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[163] },
+	{ "sys_settimeofday", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[164] },
+	{ "sys_mount", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[165] },
+	{ "sys_umount2", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[166] },
+	{ "sys_swapon", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[167] },
+	{ "sys_swapoff", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[168] },
+	{ "sys_reboot", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[169] },
+	{ "sys_sethostname", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[170] },
+	{ "sys_setdomainname", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[171] },
+	{ "sys_iopl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[172] },
+	{ "sys_ioperm", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[173] },
+	{ "sys_create_module", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[174] },
+	{ "sys_init_module", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[175] },
+	{ "sys_delete_module", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[176] },
+	{ "sys_get_kernel_syms", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[177] },
+	{ "sys_query_module", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[178] },
+	{ "sys_quotactl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[179] },
+	{ "sys_nfsservctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[180] },
+	{ "sys_getpmsg", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[181] },
+	{ "sys_putpmsg", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[182] },
+	{ "sys_afs_syscall", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[183] },
+	{ "sys_tuxcall", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[184] },
+	{ "sys_security", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[185] },
+	{ "sys_gettid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[186] },
+	{ "sys_readahead", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[187] },
+	{ "sys_setxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[188] },
+	{ "sys_lsetxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[189] },
+	{ "sys_fsetxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[190] },
+	{ "sys_getxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[191] },
+	{ "sys_lgetxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[192] },
+	{ "sys_fgetxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[193] },
+	{ "sys_listxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[194] },
+	{ "sys_llistxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[195] },
+	{ "sys_flistxattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[196] },
+	{ "sys_removexattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[197] },
+	{ "sys_lremovexattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[198] },
+	{ "sys_fremovexattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[199] },
+	{ "sys_tkill", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[200] },
+	{ "sys_time", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[201] },
+	{ "sys_futex", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[202] },
+	{ "sys_sched_setaffinity", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[203] },
+	{ "sys_sched_getaffinity", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[204] },
+	{ "sys_set_thread_area", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[205] },
+	{ "sys_io_setup", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[206] },
+	{ "sys_io_destroy", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[207] },
+	{ "sys_io_getevents", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[208] },
+	{ "sys_io_submit", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[209] },
+	{ "sys_io_cancel", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[210] },
+	{ "sys_get_thread_area", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[211] },
+	{ "sys_lookup_dcookie", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[212] },
+	{ "sys_epoll_create", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[213] },
+	{ "sys_epoll_ctl_old", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[214] },
+	{ "sys_epoll_wait_old", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[215] },
+	{ "sys_remap_file_pages", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[216] },
+	{ "sys_getdents64", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[217] },
+	{ "sys_set_tid_address", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[218] },
+	{ "sys_restart_syscall", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[219] },
+	{ "sys_semtimedop", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[220] },
+	{ "sys_fadvise64", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[221] },
+	{ "sys_timer_create", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[222] },
+	{ "sys_timer_settime", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[223] },
+	{ "sys_timer_gettime", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[224] },
+	{ "sys_timer_getoverrun", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[225] },
+	{ "sys_timer_delete", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[226] },
+	{ "sys_clock_settime", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[227] },
+	{ "sys_clock_gettime", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[228] },
+	{ "sys_clock_getres", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[229] },
+	{ "sys_clock_nanosleep", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[230] },
+	{ "sys_exit_group", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[231] },
+	{ "sys_epoll_wait", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[232] },
+	{ "sys_epoll_ctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[233] },
+	{ "sys_tgkill", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[234] },
+	{ "sys_utimes", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[235] },
+	{ "sys_vserver", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[236] },
+	{ "sys_mbind", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[237] },
+	{ "sys_set_mempolicy", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[238] },
+	{ "sys_get_mempolicy", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[239] },
+	{ "sys_mq_open", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[240] },
+	{ "sys_mq_unlink", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[241] },
+	{ "sys_mq_timedsend", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[242] },
+	{ "sys_mq_timedreceive", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[243] },
+	{ "sys_mq_notify", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[244] },
+	{ "sys_mq_getsetattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[245] },
+	{ "sys_kexec_load", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[246] },
+	{ "sys_waitid", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[247] },
+	{ "sys_add_key", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[248] },
+	{ "sys_request_key", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[249] },
+	{ "sys_keyctl", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[250] },
+	{ "sys_ioprio_set", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[251] },
+	{ "sys_ioprio_get", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[252] },
+	{ "sys_inotify_init", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[253] },
+	{ "sys_inotify_add_watch", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[254] },
+	{ "sys_inotify_rm_watch", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[255] },
+	{ "sys_migrate_pages", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[256] },
+	{ "sys_openat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[257] },
+	{ "sys_mkdirat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[258] },
+	{ "sys_mknodat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[259] },
+	{ "sys_fchownat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[260] },
+	{ "sys_futimesat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[261] },
+	{ "sys_newfstatat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[262] },
+	{ "sys_unlinkat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[263] },
+	{ "sys_renameat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[264] },
+	{ "sys_linkat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[265] },
+	{ "sys_symlinkat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[266] },
+	{ "sys_readlinkat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[267] },
+	{ "sys_fchmodat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[268] },
+	{ "sys_faccessat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[269] },
+	{ "sys_pselect6", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[270] },
+	{ "sys_ppoll", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[271] },
+	{ "sys_unshare", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[272] },
+	{ "sys_set_robust_list", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[273] },
+	{ "sys_get_robust_list", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[274] },
+	{ "sys_splice", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[275] },
+	{ "sys_tee", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[276] },
+	{ "sys_sync_file_range", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[277] },
+	{ "sys_vmsplice", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[278] },
+	{ "sys_move_pages", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[279] },
+	{ "sys_utimensat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[280] },
+	{ "sys_epoll_pwait", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[281] },
+	{ "sys_signalfd", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[282] },
+	{ "sys_timerfd", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[283] },
+	{ "sys_eventfd", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[284] },
+	{ "sys_fallocate", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[285] },
+	{ "sys_timerfd_settime", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[286] },
+	{ "sys_timerfd_gettime", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[287] },
+	{ "sys_accept4", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[288] },
+	{ "sys_signalfd4", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[289] },
+	{ "sys_eventfd2", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[290] },
+	{ "sys_epoll_create1", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[291] },
+	{ "sys_dup3", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[292] },
+	{ "sys_pipe2", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[293] },
+	{ "sys_inotify_init1", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[294] },
+	{ "sys_preadv", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[295] },
+	{ "sys_pwritev", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[296] },
+	{ "sys_rt_tgsigqueueinfo", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[297] },
+	{ "sys_perf_event_open", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[298] },
+	{ "sys_recvmmsg", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[299] },
+	{ "sys_fanotify_init", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[300] },
+	{ "sys_fanotify_mark", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[301] },
+	{ "sys_prlimit64", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[302] },
+	{ "sys_name_to_handle_at", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[303] },
+	{ "sys_open_by_handle_at", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[304] },
+	{ "sys_clock_adjtime", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[305] },
+	{ "sys_syncfs", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[306] },
+	{ "sys_sendmmsg", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[307] },
+	{ "sys_setns", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[308] },
+	{ "sys_getcpu", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[309] },
+	{ "sys_process_vm_readv", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[310] },
+	{ "sys_process_vm_writev", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[311] },
+	{ "sys_kcmp", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[312] },
+	{ "sys_finit_module", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[313] },
+	{ "sys_sched_setattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[314] },
+	{ "sys_sched_getattr", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[315] },
+	{ "sys_renameat2", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[316] },
+	{ "sys_seccomp", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[317] },
+	{ "sys_getrandom", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[318] },
+	{ "sys_memfd_create", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[319] },
+	{ "sys_kexec_file_load", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[320] },
+	{ "sys_bpf", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[321] },
+	{ "sys_execveat", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[322] },
+	{ "sys_userfaultfd", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[323] },
+	{ "sys_membarrier", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[324] },
+	{ "sys_mlock2", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[325] },
+	{ "sys_copy_file_range", gt_linux_decode_syscall, gt_linux_decode_sysret, (void *) &LINUX_SYSCALL_DESCS[326] },
 	{ NULL, NULL, NULL }
 };
@@ -4,10 +4,12 @@
 #define GENERATED_LINUX_H
 
 #include "guestrace.h"
+#include "syscall-decoder.h"
 #include "trace-syscalls.h"
 
 int _gt_linux_find_syscalls_and_setup_mem_traps(GTLoop *loop);
 
 extern const GTSyscallCallback VM_LINUX_SYSCALLS[];
+extern const gt_syscall_table LINUX_SYSCALL_TABLE;
 
 #endif
@@ -3,8976 +3,2405 @@
 #include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "guestrace.h"
 #include "generated-windows.h"
 
-#define NUM_SYSCALL_ARGS 18
-
-enum AccessMaskEnum
-{
-    FILE_READ_DATA        = 0x000001,
-    FILE_LIST_DIRECTORY   = 0x000001,
-    FILE_WRITE_DATA       = 0x000002,
-    FILE_ADD_FILE         = 0x000002,
-    FILE_APPEND_DATA      = 0x000004,
-    FILE_ADD_SUBDIRECTORY = 0x000004,
-    FILE_READ_EA          = 0x000008,
-    FILE_WRITE_EA         = 0x000010,
-    FILE_EXECUTE          = 0x000020,
-    FILE_TRAVERSE         = 0x000020,
-    FILE_DELETE_CHILD     = 0x000040,
-    FILE_READ_ATTRIBUTES  = 0x000080,
-    FILE_WRITE_ATTRIBUTES = 0x000100,
-    DELETE                = 0x010000,
-    READ_CONTROL          = 0x020000,
-    WRITE_DAC             = 0x040000,
-    WRITE_OWNER           = 0x080000,
-    SYNCHRONIZE           = 0x100000,
-    OWNER                 = FILE_READ_DATA | FILE_LIST_DIRECTORY | FILE_WRITE_DATA |
-                            FILE_ADD_FILE  | FILE_APPEND_DATA    | FILE_ADD_SUBDIRECTORY |
-                            FILE_READ_EA   | FILE_WRITE_EA       | FILE_EXECUTE |
-                            FILE_TRAVERSE  | FILE_DELETE_CHILD   | FILE_READ_ATTRIBUTES |
-                            FILE_WRITE_ATTRIBUTES | DELETE       | READ_CONTROL | 
-                            WRITE_DAC      | WRITE_OWNER         | SYNCHRONIZE,
-    READ_ONLY             = FILE_READ_DATA | FILE_LIST_DIRECTORY | FILE_READ_EA |
-                            FILE_EXECUTE   | FILE_TRAVERSE | FILE_READ_ATTRIBUTES |
-                            READ_CONTROL   | SYNCHRONIZE, 
-    CONTRIBUTOR           = OWNER & ~(FILE_DELETE_CHILD | WRITE_DAC | WRITE_OWNER)
-};
-
-struct win64_obj_attr {
-	uint32_t length; // sizeof given struct
-	uint64_t root_directory; // if not null, object_name is relative to this directory
-	uint64_t object_name; // pointer to unicode string
-	uint32_t attributes; // see microsoft documentation
-	uint64_t security_descriptor; // see microsoft documentation
-	uint64_t security_quality_of_service; // see microsoft documentation
-};
-
-struct win64_client_id {
-	uint64_t unique_process; /* process id */
-	uint64_t unique_thread; /* thread id */
-};
-
-/*
- * Get ObjectAttributes struct from virtual address
- */
-static struct win64_obj_attr *
-obj_attr_from_va(vmi_instance_t vmi, addr_t vaddr, vmi_pid_t pid) {
-	struct win64_obj_attr * buff = NULL;
-
-	uint32_t struct_size = 0;
-
-	if (VMI_SUCCESS != vmi_read_32_va(vmi, vaddr, pid, &struct_size)) {
-		goto done;
-	}
-
-	struct_size = struct_size <= sizeof(struct win64_obj_attr) ? struct_size : sizeof(struct win64_obj_attr); // don't wanna read too much data
-
-	buff = calloc(1, sizeof(struct win64_obj_attr));
-
-	if (struct_size != vmi_read_va(vmi, vaddr, pid, buff, struct_size)) {
-		free(buff);
-		buff = NULL;
-		goto done;
-	}
-
-done:
-	return buff;
-}
-
-static char *
-vf_get_simple_permissions(uint32_t permissions)
-{
-	char *buff = calloc(1, 1024);
-	if (OWNER == permissions) {
-		strcpy(buff, "OWNER");
-		return buff;
-	}
-	if (READ_ONLY == permissions) {
-		strcpy(buff, "READ_ONLY");
-		return buff;
-	}
-	if (CONTRIBUTOR == permissions) {
-		strcpy(buff, "CONTRIBUTOR");
-		return buff;
-	}
-	if (permissions & FILE_READ_DATA)
-		strcat(buff, "FILE_READ_DATA|");
-	if (permissions & FILE_LIST_DIRECTORY)
-		strcat(buff, "FILE_LIST_DIRECTORY|");
-	if (permissions & FILE_WRITE_DATA)
-		strcat(buff, "FILE_WRITE_DATA|");
-	if (permissions & FILE_ADD_FILE)
-		strcat(buff, "FILE_ADD_FILE|");
-	if (permissions & FILE_APPEND_DATA)
-		strcat(buff, "FILE_APPEND_DATA|");
-	if (permissions & FILE_ADD_SUBDIRECTORY)
-		strcat(buff, "FILE_ADD_SUBDIRECTORY|");
-	if (permissions & FILE_READ_EA)
-		strcat(buff, "FILE_READ_EA|");
-	if (permissions & FILE_WRITE_EA)
-		strcat(buff, "FILE_WRITE_EA|");
-	if (permissions & FILE_EXECUTE)
-		strcat(buff, "FILE_EXECUTE|");
-	if (permissions & FILE_TRAVERSE)
-		strcat(buff, "FILE_TRAVERSE|");
-	if (permissions & FILE_DELETE_CHILD)
-		strcat(buff, "FILE_DELETE_CHILD|");
-	if (permissions & FILE_READ_ATTRIBUTES)
-		strcat(buff, "FILE_READ_ATTRIBUTES|");
-	if (permissions & FILE_WRITE_ATTRIBUTES)
-		strcat(buff, "FILE_WRITE_ATTRIBUTES|");
-	if (permissions & DELETE)
-		strcat(buff, "DELETE|");
-	if (permissions & READ_CONTROL)
-		strcat(buff, "READ_CONTROL|");
-	if (permissions & WRITE_DAC)
-		strcat(buff, "WRITE_DAC|");
-	if (permissions & WRITE_OWNER)
-		strcat(buff, "WRITE_OWNER|");
-	if (permissions & SYNCHRONIZE)
-		strcat(buff, "SYNCHRONIZE|");
-	if (strlen(buff) > 0) {
-		buff[strlen(buff)-1] = 0;
-	} else {
-		strcpy(buff, "NONE");
-	}
-	return buff;
-}
-
-static uint8_t *
-unicode_str_from_va(vmi_instance_t vmi, addr_t va, vmi_pid_t pid) {
-	uint8_t *res = NULL;
-	unicode_string_t * unicode_str = vmi_read_unicode_str_va(vmi, va, pid);
-
-	if (unicode_str == NULL) {
-		goto done;
-	}
-
-	unicode_string_t nunicode_str;
-	if (VMI_SUCCESS != vmi_convert_str_encoding(unicode_str, &nunicode_str, "UTF-8")) {
-		vmi_free_unicode_str(unicode_str);
-		goto done;
-	}
-
-	res = nunicode_str.contents; /* points to malloc'd memory */
-	vmi_free_unicode_str(unicode_str);
-
-done:
-	return res;
-}
-
-static uint64_t *
-vf_get_args(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid) {
-	uint64_t *args = calloc(NUM_SYSCALL_ARGS, sizeof(uint64_t));
-	args[0] = event->x86_regs->rcx;
-	args[1] = event->x86_regs->rdx;
-	args[2] = event->x86_regs->r8;
-	args[3] = event->x86_regs->r9;
-	
-	vmi_read_va(vmi, event->x86_regs->rsp + vmi_get_address_width(vmi) * 5, pid, &args[4], sizeof(uint64_t) * (NUM_SYSCALL_ARGS - 4));
-	return args;
-}
-
-/* Gets the process name of the process with the PID that is input. */
-static char *
-get_process_name(vmi_instance_t vmi, vmi_pid_t pid) 
-{
-	/* Gets the process name of the process with the input pid */
-	/* offsets from the LibVMI config file */	
-	unsigned long task_offset = vmi_get_offset(vmi, "win_tasks");
-	unsigned long pid_offset = vmi_get_offset(vmi, "win_pid");
-	unsigned long name_offset = vmi_get_offset(vmi, "win_pname");
-	
-	/* addresses for the linux process list and current process */
-	addr_t list_head = 0;
-	addr_t list_curr = 0;
-	addr_t curr_proc = 0;
-	
-	vmi_pid_t curr_pid = 0;		/* pid of the processes task struct we are examining */
-	char *proc = NULL;		/* process name of the current process we are examining */
-
-    if(VMI_FAILURE == vmi_read_addr_ksym(vmi, "PsActiveProcessHead", &list_head)) {
-        printf("Failed to find PsActiveProcessHead\n");
-        goto done;
-    }
-
-	list_curr = list_head;							/* set the current process to the head */
-
-	do{
-		curr_proc = list_curr - task_offset;						/* subtract the task offset to get to the start of the task_struct */
-		if (VMI_FAILURE == vmi_read_32_va(vmi, curr_proc + pid_offset, 0, (uint32_t*)&curr_pid)) {		/* read the current pid using the pid offset from the start of the task struct */
-			printf("Failed to get the pid of the process we are examining!\n");
-			goto done;
-		}
-	
-		if (pid == curr_pid) {
-			proc = vmi_read_str_va(vmi, curr_proc + name_offset, 0);		/* get the process name if the current pid is equal to the pis we are looking for */
-			goto done;								/* go to done to exit */
-		}
-	
-		if (VMI_FAILURE == vmi_read_addr_va(vmi, list_curr, 0, &list_curr)) {				/* read the memory from the address of list_curr which will return a pointer to the */
-			printf("Failed to get the next task in the process list!\n");
-			goto done;
-		}
-
-	} while (list_curr != list_head);							/* next task_struct. Continue the loop until we get back to the beginning as the  */
-												/* process list is doubly linked and circular */
-
-done:	
-	return proc;
-
-}
-void *gt_windows_print_syscall_ntacceptconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_3 = args[3] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAcceptConnectPort(PortContext: 0x%lx, ConnectionRequest: 0x%lx, AcceptConnection: %s, ServerView: 0x%lx)\n", pid, tid, proc, args[1], args[2], bool_3, args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntacceptconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PortHandle: 0x%lx, ServerView: 0x%lx, ClientView: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[4], args[5]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaccesscheckandauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint8_t *unicode_str_2 = unicode_str_from_va(vmi, args[2], pid);
-	uint8_t *unicode_str_3 = unicode_str_from_va(vmi, args[3], pid);
-	char *permissions_5 = vf_get_simple_permissions(args[5]);
-	char *bool_7 = args[7] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAccessCheckAndAuditAlarm(SubsystemName: %s, HandleId: 0x%lx, ObjectTypeName: %s, ObjectName: %s, SecurityDescriptor: 0x%lx, DesiredAccess: %s [0x%lx], GenericMapping: 0x%lx, ObjectCreation: %s)\n", pid, tid, proc, unicode_str_0, args[1], unicode_str_2, unicode_str_3, args[4], permissions_5, args[5], args[6], bool_7);
-	free(unicode_str_0);
-	free(unicode_str_2);
-	free(unicode_str_3);
-	free(permissions_5);	return args;
-}
-
-void gt_windows_print_sysret_ntaccesscheckandauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(GrantedAccess: 0x%lx, AccessStatus: 0x%lx, GenerateOnClose: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[8], args[9], args[10]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaccesscheckbytypeandauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint8_t *unicode_str_2 = unicode_str_from_va(vmi, args[2], pid);
-	uint8_t *unicode_str_3 = unicode_str_from_va(vmi, args[3], pid);
-	char *permissions_6 = vf_get_simple_permissions(args[6]);
-	char *bool_12 = args[12] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAccessCheckByTypeAndAuditAlarm(SubsystemName: %s, HandleId: 0x%lx, ObjectTypeName: %s, ObjectName: %s, SecurityDescriptor: 0x%lx, PrincipalSelfSid: 0x%lx, DesiredAccess: %s [0x%lx], AuditType: 0x%lx, Flags: 0x%lx, ObjectTypeListLength: 0x%lx, GenericMapping: 0x%lx, ObjectCreation: %s)\n", pid, tid, proc, unicode_str_0, args[1], unicode_str_2, unicode_str_3, args[4], args[5], permissions_6, args[6], args[7], args[8], args[10], args[11], bool_12);
-	free(unicode_str_0);
-	free(unicode_str_2);
-	free(unicode_str_3);
-	free(permissions_6);	return args;
-}
-
-void gt_windows_print_sysret_ntaccesscheckbytypeandauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(GrantedAccess: 0x%lx, AccessStatus: 0x%lx, GenerateOnClose: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[13], args[14], args[15]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaccesscheckbytype(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_3 = vf_get_simple_permissions(args[3]);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAccessCheckByType(SecurityDescriptor: 0x%lx, PrincipalSelfSid: 0x%lx, ClientToken: 0x%lx, DesiredAccess: %s [0x%lx], ObjectTypeListLength: 0x%lx, GenericMapping: 0x%lx, PrivilegeSetLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], permissions_3, args[3], args[5], args[6], pulong_8);
-	free(permissions_3);	return args;
-}
-
-void gt_windows_print_sysret_ntaccesscheckbytype(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PrivilegeSetLength: 0x%lx, GrantedAccess: 0x%lx, AccessStatus: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_8, args[9], args[10]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaccesscheckbytyperesultlistandauditalarmbyhandle(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint8_t *unicode_str_3 = unicode_str_from_va(vmi, args[3], pid);
-	uint8_t *unicode_str_4 = unicode_str_from_va(vmi, args[4], pid);
-	char *permissions_7 = vf_get_simple_permissions(args[7]);
-	char *bool_13 = args[13] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAccessCheckByTypeResultListAndAuditAlarmByHandle(SubsystemName: %s, HandleId: 0x%lx, ClientToken: 0x%lx, ObjectTypeName: %s, ObjectName: %s, SecurityDescriptor: 0x%lx, PrincipalSelfSid: 0x%lx, DesiredAccess: %s [0x%lx], AuditType: 0x%lx, Flags: 0x%lx, ObjectTypeListLength: 0x%lx, GenericMapping: 0x%lx, ObjectCreation: %s)\n", pid, tid, proc, unicode_str_0, args[1], args[2], unicode_str_3, unicode_str_4, args[5], args[6], permissions_7, args[7], args[8], args[9], args[11], args[12], bool_13);
-	free(unicode_str_0);
-	free(unicode_str_3);
-	free(unicode_str_4);
-	free(permissions_7);	return args;
-}
-
-void gt_windows_print_sysret_ntaccesscheckbytyperesultlistandauditalarmbyhandle(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(GenerateOnClose: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[16]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaccesscheckbytyperesultlistandauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint8_t *unicode_str_2 = unicode_str_from_va(vmi, args[2], pid);
-	uint8_t *unicode_str_3 = unicode_str_from_va(vmi, args[3], pid);
-	char *permissions_6 = vf_get_simple_permissions(args[6]);
-	char *bool_12 = args[12] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAccessCheckByTypeResultListAndAuditAlarm(SubsystemName: %s, HandleId: 0x%lx, ObjectTypeName: %s, ObjectName: %s, SecurityDescriptor: 0x%lx, PrincipalSelfSid: 0x%lx, DesiredAccess: %s [0x%lx], AuditType: 0x%lx, Flags: 0x%lx, ObjectTypeListLength: 0x%lx, GenericMapping: 0x%lx, ObjectCreation: %s)\n", pid, tid, proc, unicode_str_0, args[1], unicode_str_2, unicode_str_3, args[4], args[5], permissions_6, args[6], args[7], args[8], args[10], args[11], bool_12);
-	free(unicode_str_0);
-	free(unicode_str_2);
-	free(unicode_str_3);
-	free(permissions_6);	return args;
-}
-
-void gt_windows_print_sysret_ntaccesscheckbytyperesultlistandauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(GenerateOnClose: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[15]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaccesscheckbytyperesultlist(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_3 = vf_get_simple_permissions(args[3]);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAccessCheckByTypeResultList(SecurityDescriptor: 0x%lx, PrincipalSelfSid: 0x%lx, ClientToken: 0x%lx, DesiredAccess: %s [0x%lx], ObjectTypeListLength: 0x%lx, GenericMapping: 0x%lx, PrivilegeSetLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], permissions_3, args[3], args[5], args[6], pulong_8);
-	free(permissions_3);	return args;
-}
-
-void gt_windows_print_sysret_ntaccesscheckbytyperesultlist(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PrivilegeSetLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_8);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaccesscheck(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_2 = vf_get_simple_permissions(args[2]);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAccessCheck(SecurityDescriptor: 0x%lx, ClientToken: 0x%lx, DesiredAccess: %s [0x%lx], GenericMapping: 0x%lx, PrivilegeSetLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], permissions_2, args[2], args[3], pulong_5);
-	free(permissions_2);	return args;
-}
-
-void gt_windows_print_sysret_ntaccesscheck(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PrivilegeSetLength: 0x%lx, GrantedAccess: 0x%lx, AccessStatus: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5, args[6], args[7]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaddatom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAddAtom(Length: 0x%lx)\n", pid, tid, proc, args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntaddatom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Atom: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaddbootentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAddBootEntry(BootEntry: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntaddbootentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Id: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntadddriverentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAddDriverEntry(DriverEntry: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntadddriverentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Id: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntadjustgroupstoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_1 = args[1] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAdjustGroupsToken(TokenHandle: 0x%lx, ResetToDefault: %s, NewState: 0x%lx, BufferLength: 0x%lx)\n", pid, tid, proc, args[0], bool_1, args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntadjustgroupstoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntadjustprivilegestoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_1 = args[1] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAdjustPrivilegesToken(TokenHandle: 0x%lx, DisableAllPrivileges: %s, NewState: 0x%lx, BufferLength: 0x%lx)\n", pid, tid, proc, args[0], bool_1, args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntadjustprivilegestoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalertresumethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlertResumeThread(ThreadHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalertresumethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousSuspendCount: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalertthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlertThread(ThreadHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalertthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntallocatelocallyuniqueid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAllocateLocallyUniqueId()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntallocatelocallyuniqueid(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Luid: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntallocatereserveobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = NULL;
-	uint64_t root_dir_1 = 0;
-	uint64_t attributes_1 = 0;
-	struct win64_obj_attr *obj_attr_1 = obj_attr_from_va(vmi, args[1], pid);
-	if (NULL != obj_attr_1) {
-		unicode_str_1 = unicode_str_from_va(vmi, obj_attr_1->object_name, pid);
-		root_dir_1 = obj_attr_1->root_directory;
-		attributes_1 = obj_attr_1->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAllocateReserveObject(ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Type: 0x%lx)\n", pid, tid, proc, root_dir_1, unicode_str_1, attributes_1, args[2]);
-	free(unicode_str_1);
-	free(obj_attr_1);	return args;
-}
-
-void gt_windows_print_sysret_ntallocatereserveobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(MemoryReserveHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntallocateuserphysicalpages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAllocateUserPhysicalPages(ProcessHandle: 0x%lx, NumberOfPages: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntallocateuserphysicalpages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NumberOfPages: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntallocateuuids(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAllocateUuids()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntallocateuuids(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	uint64_t pulong_2 = 0;
-	vmi_read_64_va(vmi, args[2], pid, &pulong_2);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Time: 0x%lx, Range: 0x%lx, Sequence: 0x%lx, Seed: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], pulong_1, pulong_2, args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntallocatevirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAllocateVirtualMemory(ProcessHandle: 0x%lx, *BaseAddress: 0x%lx, ZeroBits: 0x%lx, RegionSize: 0x%lx, AllocationType: 0x%lx, Protect: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4], args[5]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntallocatevirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*BaseAddress: 0x%lx, RegionSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcacceptconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_3 = NULL;
-	uint64_t root_dir_3 = 0;
-	uint64_t attributes_3 = 0;
-	struct win64_obj_attr *obj_attr_3 = obj_attr_from_va(vmi, args[3], pid);
-	if (NULL != obj_attr_3) {
-		unicode_str_3 = unicode_str_from_va(vmi, obj_attr_3->object_name, pid);
-		root_dir_3 = obj_attr_3->root_directory;
-		attributes_3 = obj_attr_3->attributes;
-	}
-	char *bool_8 = args[8] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcAcceptConnectPort(ConnectionPortHandle: 0x%lx, Flags: 0x%lx, ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, PortAttributes: 0x%lx, PortContext: 0x%lx, ConnectionRequest: 0x%lx, ConnectionMessageAttributes: 0x%lx, AcceptConnection: %s)\n", pid, tid, proc, args[1], args[2], root_dir_3, unicode_str_3, attributes_3, args[4], args[5], args[6], args[7], bool_8);
-	free(unicode_str_3);
-	free(obj_attr_3);	return args;
-}
-
-void gt_windows_print_sysret_ntalpcacceptconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PortHandle: 0x%lx, ConnectionMessageAttributes: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[7]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpccancelmessage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcCancelMessage(PortHandle: 0x%lx, Flags: 0x%lx, MessageContext: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpccancelmessage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	uint64_t pulong_7 = 0;
-	vmi_read_64_va(vmi, args[7], pid, &pulong_7);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcConnectPort(PortName: %s, ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, PortAttributes: 0x%lx, Flags: 0x%lx, RequiredServerSid: 0x%lx, ConnectionMessage: 0x%lx, BufferLength: 0x%lx, OutMessageAttributes: 0x%lx, InMessageAttributes: 0x%lx, Timeout: 0x%lx)\n", pid, tid, proc, unicode_str_1, root_dir_2, unicode_str_2, attributes_2, args[3], args[4], args[5], args[6], pulong_7, args[8], args[9], args[10]);
-	free(unicode_str_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntalpcconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	uint64_t pulong_7 = 0;
-	vmi_read_64_va(vmi, args[7], pid, &pulong_7);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PortHandle: 0x%lx, ConnectionMessage: 0x%lx, BufferLength: 0x%lx, OutMessageAttributes: 0x%lx, InMessageAttributes: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[6], pulong_7, args[8], args[9]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpccreateport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = NULL;
-	uint64_t root_dir_1 = 0;
-	uint64_t attributes_1 = 0;
-	struct win64_obj_attr *obj_attr_1 = obj_attr_from_va(vmi, args[1], pid);
-	if (NULL != obj_attr_1) {
-		unicode_str_1 = unicode_str_from_va(vmi, obj_attr_1->object_name, pid);
-		root_dir_1 = obj_attr_1->root_directory;
-		attributes_1 = obj_attr_1->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcCreatePort(ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, PortAttributes: 0x%lx)\n", pid, tid, proc, root_dir_1, unicode_str_1, attributes_1, args[2]);
-	free(unicode_str_1);
-	free(obj_attr_1);	return args;
-}
-
-void gt_windows_print_sysret_ntalpccreateport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PortHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpccreateportsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcCreatePortSection(PortHandle: 0x%lx, Flags: 0x%lx, SectionHandle: 0x%lx, SectionSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpccreateportsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(AlpcSectionHandle: 0x%lx, ActualSectionSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4], args[5]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpccreateresourcereserve(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcCreateResourceReserve(PortHandle: 0x%lx, MessageSize: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpccreateresourcereserve(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ResourceId: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpccreatesectionview(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcCreateSectionView(PortHandle: 0x%lx, ViewAttributes: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpccreatesectionview(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ViewAttributes: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpccreatesecuritycontext(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcCreateSecurityContext(PortHandle: 0x%lx, SecurityAttribute: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpccreatesecuritycontext(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(SecurityAttribute: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcdeleteportsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcDeletePortSection(PortHandle: 0x%lx, SectionHandle: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcdeleteportsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcdeleteresourcereserve(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcDeleteResourceReserve(PortHandle: 0x%lx, ResourceId: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcdeleteresourcereserve(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcdeletesectionview(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcDeleteSectionView(PortHandle: 0x%lx, ViewBase: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcdeletesectionview(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcdeletesecuritycontext(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcDeleteSecurityContext(PortHandle: 0x%lx, ContextHandle: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcdeletesecuritycontext(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcdisconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcDisconnectPort(PortHandle: 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcdisconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcimpersonateclientofport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcImpersonateClientOfPort(PortHandle: 0x%lx, PortMessage: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcimpersonateclientofport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcopensenderprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_4 = vf_get_simple_permissions(args[4]);
-	uint8_t *unicode_str_5 = NULL;
-	uint64_t root_dir_5 = 0;
-	uint64_t attributes_5 = 0;
-	struct win64_obj_attr *obj_attr_5 = obj_attr_from_va(vmi, args[5], pid);
-	if (NULL != obj_attr_5) {
-		unicode_str_5 = unicode_str_from_va(vmi, obj_attr_5->object_name, pid);
-		root_dir_5 = obj_attr_5->root_directory;
-		attributes_5 = obj_attr_5->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcOpenSenderProcess(PortHandle: 0x%lx, PortMessage: 0x%lx, DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, args[1], args[2], permissions_4, args[4], root_dir_5, unicode_str_5, attributes_5);
-	free(permissions_4);
-	free(unicode_str_5);
-	free(obj_attr_5);	return args;
-}
-
-void gt_windows_print_sysret_ntalpcopensenderprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProcessHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcopensenderthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_4 = vf_get_simple_permissions(args[4]);
-	uint8_t *unicode_str_5 = NULL;
-	uint64_t root_dir_5 = 0;
-	uint64_t attributes_5 = 0;
-	struct win64_obj_attr *obj_attr_5 = obj_attr_from_va(vmi, args[5], pid);
-	if (NULL != obj_attr_5) {
-		unicode_str_5 = unicode_str_from_va(vmi, obj_attr_5->object_name, pid);
-		root_dir_5 = obj_attr_5->root_directory;
-		attributes_5 = obj_attr_5->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcOpenSenderThread(PortHandle: 0x%lx, PortMessage: 0x%lx, DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, args[1], args[2], permissions_4, args[4], root_dir_5, unicode_str_5, attributes_5);
-	free(permissions_4);
-	free(unicode_str_5);
-	free(obj_attr_5);	return args;
-}
-
-void gt_windows_print_sysret_ntalpcopensenderthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ThreadHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcqueryinformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcQueryInformation(PortHandle: 0x%lx, PortInformationClass: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcqueryinformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcqueryinformationmessage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcQueryInformationMessage(PortHandle: 0x%lx, PortMessage: 0x%lx, MessageInformationClass: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcqueryinformationmessage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcrevokesecuritycontext(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcRevokeSecurityContext(PortHandle: 0x%lx, ContextHandle: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcrevokesecuritycontext(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcsendwaitreceiveport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcSendWaitReceivePort(PortHandle: 0x%lx, Flags: 0x%lx, SendMessage: 0x%lx, SendMessageAttributes: 0x%lx, ReceiveMessage: 0x%lx, BufferLength: 0x%lx, ReceiveMessageAttributes: 0x%lx, Timeout: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4], pulong_5, args[6], args[7]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcsendwaitreceiveport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReceiveMessage: 0x%lx, BufferLength: 0x%lx, ReceiveMessageAttributes: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4], pulong_5, args[6]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntalpcsetinformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAlpcSetInformation(PortHandle: 0x%lx, PortInformationClass: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntalpcsetinformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntapphelpcachecontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtApphelpCacheControl(type: 0x%lx, buf: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntapphelpcachecontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntaremappedfilesthesame(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAreMappedFilesTheSame(File1MappedAsAnImage: 0x%lx, File2MappedAsFile: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntaremappedfilesthesame(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntassignprocesstojobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtAssignProcessToJobObject(JobHandle: 0x%lx, ProcessHandle: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntassignprocesstojobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcallbackreturn(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCallbackReturn(OutputBuffer: 0x%lx, OutputLength: 0x%lx, Status: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcallbackreturn(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcanceliofileex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCancelIoFileEx(FileHandle: 0x%lx, IoRequestToCancel: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcanceliofileex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcanceliofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCancelIoFile(FileHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcanceliofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcancelsynchronousiofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCancelSynchronousIoFile(ThreadHandle: 0x%lx, IoRequestToCancel: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcancelsynchronousiofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcanceltimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCancelTimer(TimerHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcanceltimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(CurrentState: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntclearevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtClearEvent(EventHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntclearevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntclose(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtClose(Handle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntclose(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcloseobjectauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCloseObjectAuditAlarm(SubsystemName: %s, HandleId: 0x%lx, GenerateOnClose: %s)\n", pid, tid, proc, unicode_str_0, args[1], bool_2);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntcloseobjectauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcommitcomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCommitComplete(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcommitcomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcommitenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCommitEnlistment(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcommitenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcommittransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_1 = args[1] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCommitTransaction(TransactionHandle: 0x%lx, Wait: %s)\n", pid, tid, proc, args[0], bool_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcommittransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcompactkeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCompactKeys(Count: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcompactkeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcomparetokens(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCompareTokens(FirstTokenHandle: 0x%lx, SecondTokenHandle: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcomparetokens(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Equal: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcompleteconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCompleteConnectPort(PortHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcompleteconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcompresskey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCompressKey(Key: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcompresskey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	uint64_t pulong_7 = 0;
-	vmi_read_64_va(vmi, args[7], pid, &pulong_7);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtConnectPort(PortName: %s, SecurityQos: 0x%lx, ClientView: 0x%lx, ServerView: 0x%lx, ConnectionInformation: 0x%lx, ConnectionInformationLength: 0x%lx)\n", pid, tid, proc, unicode_str_1, args[2], args[3], args[4], args[6], pulong_7);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	uint64_t pulong_7 = 0;
-	vmi_read_64_va(vmi, args[7], pid, &pulong_7);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PortHandle: 0x%lx, ClientView: 0x%lx, ServerView: 0x%lx, MaxMessageLength: 0x%lx, ConnectionInformation: 0x%lx, ConnectionInformationLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[3], args[4], pulong_5, args[6], pulong_7);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcontinue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtContinue()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcontinue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	char *bool_1 = args[1] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ContextRecord: 0x%lx, TestAlert: %s)\n", pid, tid, proc, event->x86_regs->rax, args[0], bool_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatedebugobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateDebugObject()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcreatedebugobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(DebugObjectHandle: 0x%lx, DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatedirectoryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateDirectoryObject(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatedirectoryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(DirectoryHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_4 = NULL;
-	uint64_t root_dir_4 = 0;
-	uint64_t attributes_4 = 0;
-	struct win64_obj_attr *obj_attr_4 = obj_attr_from_va(vmi, args[4], pid);
-	if (NULL != obj_attr_4) {
-		unicode_str_4 = unicode_str_from_va(vmi, obj_attr_4->object_name, pid);
-		root_dir_4 = obj_attr_4->root_directory;
-		attributes_4 = obj_attr_4->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateEnlistment(DesiredAccess: %s [0x%lx], ResourceManagerHandle: 0x%lx, TransactionHandle: 0x%lx, ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, CreateOptions: 0x%lx, NotificationMask: 0x%lx, EnlistmentKey: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], args[2], args[3], root_dir_4, unicode_str_4, attributes_4, args[5], args[6], args[7]);
-	free(permissions_1);
-	free(unicode_str_4);
-	free(obj_attr_4);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(EnlistmentHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	char *bool_4 = args[4] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateEvent(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, EventType: 0x%lx, InitialState: %s)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], bool_4);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(EventHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateeventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateEventPair(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateeventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(EventPairHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatefile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateFile(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, AllocationSize: 0x%lx, FileAttributes: 0x%lx, ShareAccess: 0x%lx, CreateDisposition: 0x%lx, CreateOptions: 0x%lx, EaLength: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[4], args[5], args[6], args[7], args[8], args[10]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatefile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(FileHandle: 0x%lx, IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateiocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateIoCompletion(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Count: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateiocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoCompletionHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatejobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateJobObject(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatejobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(JobHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatejobset(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateJobSet(NumJob: 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcreatejobset(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatekeyedevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateKeyedEvent(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatekeyedevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(KeyedEventHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	uint8_t *unicode_str_4 = unicode_str_from_va(vmi, args[4], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateKey(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Class: %s, CreateOptions: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, unicode_str_4, args[5]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);
-	free(unicode_str_4);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	uint64_t pulong_6 = 0;
-	vmi_read_64_va(vmi, args[6], pid, &pulong_6);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(KeyHandle: 0x%lx, Disposition: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, pulong_6);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatekeytransacted(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	uint8_t *unicode_str_4 = unicode_str_from_va(vmi, args[4], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateKeyTransacted(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Class: %s, CreateOptions: 0x%lx, TransactionHandle: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, unicode_str_4, args[5], args[6]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);
-	free(unicode_str_4);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatekeytransacted(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	uint64_t pulong_7 = 0;
-	vmi_read_64_va(vmi, args[7], pid, &pulong_7);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(KeyHandle: 0x%lx, Disposition: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, pulong_7);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatemailslotfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateMailslotFile(DesiredAccess: 0x%lx, ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, CreateOptions: 0x%lx, MailslotQuota: 0x%lx, MaximumMessageSize: 0x%lx, ReadTimeout: 0x%lx)\n", pid, tid, proc, args[1], root_dir_2, unicode_str_2, attributes_2, args[4], args[5], args[6], args[7]);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatemailslotfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(FileHandle: 0x%lx, IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatemutant(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	char *bool_3 = args[3] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateMutant(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, InitialOwner: %s)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, bool_3);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatemutant(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(MutantHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatenamedpipefile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateNamedPipeFile(DesiredAccess: 0x%lx, ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ShareAccess: 0x%lx, CreateDisposition: 0x%lx, CreateOptions: 0x%lx, NamedPipeType: 0x%lx, ReadMode: 0x%lx, CompletionMode: 0x%lx, MaximumInstances: 0x%lx, InboundQuota: 0x%lx, OutboundQuota: 0x%lx, DefaultTimeout: 0x%lx)\n", pid, tid, proc, args[1], root_dir_2, unicode_str_2, attributes_2, args[4], args[5], args[6], args[7], args[8], args[9], args[10], args[11], args[12], args[13]);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatenamedpipefile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(FileHandle: 0x%lx, IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatepagingfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreatePagingFile(PageFileName: %s, MinimumSize: 0x%lx, MaximumSize: 0x%lx, Priority: 0x%lx)\n", pid, tid, proc, unicode_str_0, args[1], args[2], args[3]);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatepagingfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = NULL;
-	uint64_t root_dir_1 = 0;
-	uint64_t attributes_1 = 0;
-	struct win64_obj_attr *obj_attr_1 = obj_attr_from_va(vmi, args[1], pid);
-	if (NULL != obj_attr_1) {
-		unicode_str_1 = unicode_str_from_va(vmi, obj_attr_1->object_name, pid);
-		root_dir_1 = obj_attr_1->root_directory;
-		attributes_1 = obj_attr_1->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreatePort(ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, MaxConnectionInfoLength: 0x%lx, MaxMessageLength: 0x%lx, MaxPoolUsage: 0x%lx)\n", pid, tid, proc, root_dir_1, unicode_str_1, attributes_1, args[2], args[3], args[4]);
-	free(unicode_str_1);
-	free(obj_attr_1);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PortHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateprivatenamespace(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreatePrivateNamespace(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, BoundaryDescriptor: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateprivatenamespace(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NamespaceHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateprocessex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateProcessEx(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ParentProcess: 0x%lx, Flags: 0x%lx, SectionHandle: 0x%lx, DebugPort: 0x%lx, ExceptionPort: 0x%lx, JobMemberLevel: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4], args[5], args[6], args[7], args[8]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateprocessex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProcessHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	char *bool_4 = args[4] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateProcess(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ParentProcess: 0x%lx, InheritObjectTable: %s, SectionHandle: 0x%lx, DebugPort: 0x%lx, ExceptionPort: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], bool_4, args[5], args[6], args[7]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProcessHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateprofileex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateProfileEx(Process: 0x%lx, ProfileBase: 0x%lx, ProfileSize: 0x%lx, BucketSize: 0x%lx, Buffer: 0x%lx, BufferSize: 0x%lx, ProfileSource: 0x%lx, GroupAffinityCount: 0x%lx, GroupAffinity: 0x%lx)\n", pid, tid, proc, args[1], args[2], args[3], args[4], pulong_5, args[6], args[7], args[8], args[9]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcreateprofileex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProfileHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateProfile(Process: 0x%lx, RangeBase: 0x%lx, RangeSize: 0x%lx, BucketSize: 0x%lx, Buffer: 0x%lx, BufferSize: 0x%lx, ProfileSource: 0x%lx, Affinity: 0x%lx)\n", pid, tid, proc, args[1], args[2], args[3], args[4], pulong_5, args[6], args[7], args[8]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntcreateprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProfileHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_4 = NULL;
-	uint64_t root_dir_4 = 0;
-	uint64_t attributes_4 = 0;
-	struct win64_obj_attr *obj_attr_4 = obj_attr_from_va(vmi, args[4], pid);
-	if (NULL != obj_attr_4) {
-		unicode_str_4 = unicode_str_from_va(vmi, obj_attr_4->object_name, pid);
-		root_dir_4 = obj_attr_4->root_directory;
-		attributes_4 = obj_attr_4->attributes;
-	}
-	uint8_t *unicode_str_6 = unicode_str_from_va(vmi, args[6], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateResourceManager(DesiredAccess: %s [0x%lx], TmHandle: 0x%lx, RmGuid: 0x%lx, ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, CreateOptions: 0x%lx, Description: %s)\n", pid, tid, proc, permissions_1, args[1], args[2], args[3], root_dir_4, unicode_str_4, attributes_4, args[5], unicode_str_6);
-	free(permissions_1);
-	free(unicode_str_4);
-	free(obj_attr_4);
-	free(unicode_str_6);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ResourceManagerHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatesection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateSection(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, MaximumSize: 0x%lx, SectionPageProtection: 0x%lx, AllocationAttributes: 0x%lx, FileHandle: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4], args[5], args[6]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatesection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(SectionHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatesemaphore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateSemaphore(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, InitialCount: 0x%lx, MaximumCount: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatesemaphore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(SemaphoreHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatesymboliclinkobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	uint8_t *unicode_str_3 = unicode_str_from_va(vmi, args[3], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateSymbolicLinkObject(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, LinkTarget: %s)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, unicode_str_3);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);
-	free(unicode_str_3);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatesymboliclinkobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(LinkHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatethreadex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateThreadEx(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ProcessHandle: 0x%lx, StartRoutine: 0x%lx, Argument: 0x%lx, CreateFlags: 0x%lx, ZeroBits: 0x%lx, StackSize: 0x%lx, MaximumStackSize: 0x%lx, AttributeList: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4], args[5], args[6], args[7], args[8], args[9], args[10]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatethreadex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ThreadHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	char *bool_7 = args[7] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateThread(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ProcessHandle: 0x%lx, ThreadContext: 0x%lx, InitialTeb: 0x%lx, CreateSuspended: %s)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[5], args[6], bool_7);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ThreadHandle: 0x%lx, ClientId: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatetimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateTimer(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, TimerType: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatetimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TimerHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatetoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateToken(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, TokenType: 0x%lx, AuthenticationId: 0x%lx, ExpirationTime: 0x%lx, User: 0x%lx, Groups: 0x%lx, Privileges: 0x%lx, Owner: 0x%lx, PrimaryGroup: 0x%lx, DefaultDacl: 0x%lx, TokenSource: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4], args[5], args[6], args[7], args[8], args[9], args[10], args[11], args[12]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatetoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TokenHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatetransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	uint8_t *unicode_str_3 = unicode_str_from_va(vmi, args[3], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateTransactionManager(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, LogFileName: %s, CreateOptions: 0x%lx, CommitStrength: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, unicode_str_3, args[4], args[5]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);
-	free(unicode_str_3);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatetransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TmHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatetransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	uint8_t *unicode_str_9 = unicode_str_from_va(vmi, args[9], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateTransaction(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Uow: 0x%lx, TmHandle: 0x%lx, CreateOptions: 0x%lx, IsolationLevel: 0x%lx, IsolationFlags: 0x%lx, Timeout: 0x%lx, Description: %s)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4], args[5], args[6], args[7], args[8], unicode_str_9);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);
-	free(unicode_str_9);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatetransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TransactionHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateuserprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_2 = vf_get_simple_permissions(args[2]);
-	char *permissions_3 = vf_get_simple_permissions(args[3]);
-	uint8_t *unicode_str_4 = NULL;
-	uint64_t root_dir_4 = 0;
-	uint64_t attributes_4 = 0;
-	struct win64_obj_attr *obj_attr_4 = obj_attr_from_va(vmi, args[4], pid);
-	if (NULL != obj_attr_4) {
-		unicode_str_4 = unicode_str_from_va(vmi, obj_attr_4->object_name, pid);
-		root_dir_4 = obj_attr_4->root_directory;
-		attributes_4 = obj_attr_4->attributes;
-	}
-	uint8_t *unicode_str_5 = NULL;
-	uint64_t root_dir_5 = 0;
-	uint64_t attributes_5 = 0;
-	struct win64_obj_attr *obj_attr_5 = obj_attr_from_va(vmi, args[5], pid);
-	if (NULL != obj_attr_5) {
-		unicode_str_5 = unicode_str_from_va(vmi, obj_attr_5->object_name, pid);
-		root_dir_5 = obj_attr_5->root_directory;
-		attributes_5 = obj_attr_5->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateUserProcess(ProcessDesiredAccess: %s [0x%lx], ThreadDesiredAccess: %s [0x%lx], ProcessObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ThreadObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ProcessFlags: 0x%lx, ThreadFlags: 0x%lx, ProcessParameters: 0x%lx, CreateInfo: 0x%lx, AttributeList: 0x%lx)\n", pid, tid, proc, permissions_2, args[2], permissions_3, args[3], root_dir_4, unicode_str_4, attributes_4, root_dir_5, unicode_str_5, attributes_5, args[6], args[7], args[8], args[9], args[10]);
-	free(permissions_2);
-	free(permissions_3);
-	free(unicode_str_4);
-	free(obj_attr_4);
-	free(unicode_str_5);
-	free(obj_attr_5);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateuserprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	uint64_t phandle_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &phandle_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProcessHandle: 0x%lx, ThreadHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, phandle_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreatewaitableport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = NULL;
-	uint64_t root_dir_1 = 0;
-	uint64_t attributes_1 = 0;
-	struct win64_obj_attr *obj_attr_1 = obj_attr_from_va(vmi, args[1], pid);
-	if (NULL != obj_attr_1) {
-		unicode_str_1 = unicode_str_from_va(vmi, obj_attr_1->object_name, pid);
-		root_dir_1 = obj_attr_1->root_directory;
-		attributes_1 = obj_attr_1->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateWaitablePort(ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, MaxConnectionInfoLength: 0x%lx, MaxMessageLength: 0x%lx, MaxPoolUsage: 0x%lx)\n", pid, tid, proc, root_dir_1, unicode_str_1, attributes_1, args[2], args[3], args[4]);
-	free(unicode_str_1);
-	free(obj_attr_1);	return args;
-}
-
-void gt_windows_print_sysret_ntcreatewaitableport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PortHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntcreateworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtCreateWorkerFactory(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, CompletionPortHandle: 0x%lx, WorkerProcessHandle: 0x%lx, StartRoutine: 0x%lx, StartParameter: 0x%lx, MaxThreadCount: 0x%lx, StackReserve: 0x%lx, StackCommit: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4], args[5], args[6], args[7], args[8], args[9]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntcreateworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(WorkerFactoryHandleReturn: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdebugactiveprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDebugActiveProcess()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdebugactiveprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProcessHandle: 0x%lx, DebugObjectHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdebugcontinue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDebugContinue()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdebugcontinue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(DebugObjectHandle: 0x%lx, ClientId: 0x%lx, ContinueStatus: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], args[1], args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdelayexecution(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_0 = args[0] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDelayExecution(Alertable: %s, DelayInterval: 0x%lx)\n", pid, tid, proc, bool_0, args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdelayexecution(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeleteatom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeleteAtom(Atom: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdeleteatom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeletebootentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeleteBootEntry(Id: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdeletebootentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeletedriverentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeleteDriverEntry(Id: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdeletedriverentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeletefile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeleteFile(ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0);
-	free(unicode_str_0);
-	free(obj_attr_0);	return args;
-}
-
-void gt_windows_print_sysret_ntdeletefile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeletekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeleteKey(KeyHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdeletekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeleteobjectauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeleteObjectAuditAlarm(SubsystemName: %s, HandleId: 0x%lx, GenerateOnClose: %s)\n", pid, tid, proc, unicode_str_0, args[1], bool_2);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntdeleteobjectauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeleteprivatenamespace(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeletePrivateNamespace(NamespaceHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdeleteprivatenamespace(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeletevaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeleteValueKey(KeyHandle: 0x%lx, ValueName: %s)\n", pid, tid, proc, args[0], unicode_str_1);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntdeletevaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdeviceiocontrolfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDeviceIoControlFile(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, IoControlCode: 0x%lx, InputBufferLength: 0x%lx, OutputBufferLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[5], args[7], args[9]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdeviceiocontrolfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdisablelastknowngood(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDisableLastKnownGood()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntdisablelastknowngood(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdisplaystring(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDisplayString(String: %s)\n", pid, tid, proc, unicode_str_0);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntdisplaystring(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntdrawtext(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDrawText(Text: %s)\n", pid, tid, proc, unicode_str_0);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntdrawtext(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntduplicateobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_4 = vf_get_simple_permissions(args[4]);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDuplicateObject(SourceProcessHandle: 0x%lx, SourceHandle: 0x%lx, TargetProcessHandle: 0x%lx, DesiredAccess: %s [0x%lx], HandleAttributes: 0x%lx, Options: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], permissions_4, args[4], args[5], args[6]);
-	free(permissions_4);	return args;
-}
-
-void gt_windows_print_sysret_ntduplicateobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &phandle_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TargetHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_3);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntduplicatetoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	char *bool_3 = args[3] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtDuplicateToken(ExistingTokenHandle: 0x%lx, DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, EffectiveOnly: %s, TokenType: 0x%lx)\n", pid, tid, proc, args[0], permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, bool_3, args[4]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntduplicatetoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &phandle_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NewTokenHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntenablelastknowngood(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtEnableLastKnownGood()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntenablelastknowngood(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntenumeratebootentries(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtEnumerateBootEntries(BufferLength: 0x%lx)\n", pid, tid, proc, pulong_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntenumeratebootentries(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(BufferLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntenumeratedriverentries(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtEnumerateDriverEntries(BufferLength: 0x%lx)\n", pid, tid, proc, pulong_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntenumeratedriverentries(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(BufferLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntenumeratekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtEnumerateKey(KeyHandle: 0x%lx, Index: 0x%lx, KeyInformationClass: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntenumeratekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ResultLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntenumeratesystemenvironmentvaluesex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_2 = 0;
-	vmi_read_64_va(vmi, args[2], pid, &pulong_2);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtEnumerateSystemEnvironmentValuesEx(InformationClass: 0x%lx, BufferLength: 0x%lx)\n", pid, tid, proc, args[0], pulong_2);
-	return args;
-}
-
-void gt_windows_print_sysret_ntenumeratesystemenvironmentvaluesex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_2 = 0;
-	vmi_read_64_va(vmi, args[2], pid, &pulong_2);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Buffer: 0x%lx, BufferLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], pulong_2);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntenumeratetransactionobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtEnumerateTransactionObject(RootObjectHandle: 0x%lx, QueryType: 0x%lx, ObjectCursorLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntenumeratetransactionobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntenumeratevaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtEnumerateValueKey(KeyHandle: 0x%lx, Index: 0x%lx, KeyValueInformationClass: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntenumeratevaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ResultLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntextendsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtExtendSection(SectionHandle: 0x%lx, NewSectionSize: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntextendsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NewSectionSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntfiltertoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFilterToken(ExistingTokenHandle: 0x%lx, Flags: 0x%lx, SidsToDisable: 0x%lx, PrivilegesToDelete: 0x%lx, RestrictedSids: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntfiltertoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &phandle_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NewTokenHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntfindatom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFindAtom(Length: 0x%lx)\n", pid, tid, proc, args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntfindatom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Atom: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntflushbuffersfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFlushBuffersFile(FileHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntflushbuffersfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntflushinstalluilanguage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFlushInstallUILanguage(InstallUILanguage: 0x%lx, SetComittedFlag: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntflushinstalluilanguage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntflushinstructioncache(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFlushInstructionCache(ProcessHandle: 0x%lx, BaseAddress: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntflushinstructioncache(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntflushkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFlushKey(KeyHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntflushkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntflushprocesswritebuffers(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFlushProcessWriteBuffers()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntflushprocesswritebuffers(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntflushvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFlushVirtualMemory(ProcessHandle: 0x%lx, *BaseAddress: 0x%lx, RegionSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntflushvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*BaseAddress: 0x%lx, RegionSize: 0x%lx, IoStatus: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[2], args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntflushwritebuffer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFlushWriteBuffer()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntflushwritebuffer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntfreeuserphysicalpages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFreeUserPhysicalPages(ProcessHandle: 0x%lx, NumberOfPages: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntfreeuserphysicalpages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NumberOfPages: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntfreevirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFreeVirtualMemory(ProcessHandle: 0x%lx, *BaseAddress: 0x%lx, RegionSize: 0x%lx, FreeType: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntfreevirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*BaseAddress: 0x%lx, RegionSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntfreezeregistry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFreezeRegistry(TimeOutInSeconds: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntfreezeregistry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntfreezetransactions(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFreezeTransactions(FreezeTimeout: 0x%lx, ThawTimeout: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntfreezetransactions(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntfscontrolfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtFsControlFile(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, IoControlCode: 0x%lx, InputBufferLength: 0x%lx, OutputBufferLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[5], args[7], args[9]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntfscontrolfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetcontextthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetContextThread(ThreadHandle: 0x%lx, ThreadContext: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntgetcontextthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ThreadContext: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetcurrentprocessornumber(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetCurrentProcessorNumber()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntgetcurrentprocessornumber(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetdevicepowerstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetDevicePowerState(Device: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntgetdevicepowerstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*State: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetmuiregistryinfo(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetMUIRegistryInfo(Flags: 0x%lx, DataSize: 0x%lx)\n", pid, tid, proc, args[0], pulong_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntgetmuiregistryinfo(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(DataSize: 0x%lx, Data: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetnextprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetNextProcess(ProcessHandle: 0x%lx, DesiredAccess: %s [0x%lx], HandleAttributes: 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, args[0], permissions_1, args[1], args[2], args[3]);
-	free(permissions_1);	return args;
-}
-
-void gt_windows_print_sysret_ntgetnextprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &phandle_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NewProcessHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetnextthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_2 = vf_get_simple_permissions(args[2]);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetNextThread(ProcessHandle: 0x%lx, ThreadHandle: 0x%lx, DesiredAccess: %s [0x%lx], HandleAttributes: 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, args[0], args[1], permissions_2, args[2], args[3], args[4]);
-	free(permissions_2);	return args;
-}
-
-void gt_windows_print_sysret_ntgetnextthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &phandle_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NewThreadHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetnlssectionptr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetNlsSectionPtr(SectionType: 0x%lx, SectionData: 0x%lx, ContextData: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntgetnlssectionptr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*SectionPointer: 0x%lx, SectionSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[3], pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetnotificationresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetNotificationResourceManager(ResourceManagerHandle: 0x%lx, NotificationLength: 0x%lx, Timeout: 0x%lx, Asynchronous: 0x%lx, AsynchronousContext: 0x%lx)\n", pid, tid, proc, args[0], args[2], args[3], args[5], args[6]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntgetnotificationresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TransactionNotification: 0x%lx, ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetplugplayevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetPlugPlayEvent(EventHandle: 0x%lx, Context: 0x%lx, EventBufferSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntgetplugplayevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntgetwritewatch(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtGetWriteWatch(ProcessHandle: 0x%lx, Flags: 0x%lx, BaseAddress: 0x%lx, RegionSize: 0x%lx, EntriesInUserAddressArray: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[5]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntgetwritewatch(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_6 = 0;
-	vmi_read_64_va(vmi, args[6], pid, &pulong_6);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(EntriesInUserAddressArray: 0x%lx, Granularity: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[5], pulong_6);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntimpersonateanonymoustoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtImpersonateAnonymousToken(ThreadHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntimpersonateanonymoustoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntimpersonateclientofport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtImpersonateClientOfPort(PortHandle: 0x%lx, Message: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntimpersonateclientofport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntimpersonatethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtImpersonateThread(ServerThreadHandle: 0x%lx, ClientThreadHandle: 0x%lx, SecurityQos: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntimpersonatethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntinitializenlsfiles(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtInitializeNlsFiles()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntinitializenlsfiles(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*BaseAddress: 0x%lx, DefaultLocaleId: 0x%lx, DefaultCasingTableSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], args[1], args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntinitializeregistry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtInitializeRegistry(BootCondition: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntinitializeregistry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntinitiatepoweraction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_3 = args[3] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtInitiatePowerAction(SystemAction: 0x%lx, MinSystemState: 0x%lx, Flags: 0x%lx, Asynchronous: %s)\n", pid, tid, proc, args[0], args[1], args[2], bool_3);
-	return args;
-}
-
-void gt_windows_print_sysret_ntinitiatepoweraction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntisprocessinjob(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtIsProcessInJob(ProcessHandle: 0x%lx, JobHandle: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntisprocessinjob(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntissystemresumeautomatic(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtIsSystemResumeAutomatic()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntissystemresumeautomatic(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntisuilanguagecomitted(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtIsUILanguageComitted()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntisuilanguagecomitted(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntlistenport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtListenPort(PortHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntlistenport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ConnectionRequest: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntloaddriver(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtLoadDriver(DriverServiceName: %s)\n", pid, tid, proc, unicode_str_0);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntloaddriver(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntloadkey2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	uint8_t *unicode_str_1 = NULL;
-	uint64_t root_dir_1 = 0;
-	uint64_t attributes_1 = 0;
-	struct win64_obj_attr *obj_attr_1 = obj_attr_from_va(vmi, args[1], pid);
-	if (NULL != obj_attr_1) {
-		unicode_str_1 = unicode_str_from_va(vmi, obj_attr_1->object_name, pid);
-		root_dir_1 = obj_attr_1->root_directory;
-		attributes_1 = obj_attr_1->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtLoadKey2(TargetKey: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, SourceFile: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0, root_dir_1, unicode_str_1, attributes_1, args[2]);
-	free(unicode_str_0);
-	free(obj_attr_0);
-	free(unicode_str_1);
-	free(obj_attr_1);	return args;
-}
-
-void gt_windows_print_sysret_ntloadkey2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntloadkeyex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	uint8_t *unicode_str_1 = NULL;
-	uint64_t root_dir_1 = 0;
-	uint64_t attributes_1 = 0;
-	struct win64_obj_attr *obj_attr_1 = obj_attr_from_va(vmi, args[1], pid);
-	if (NULL != obj_attr_1) {
-		unicode_str_1 = unicode_str_from_va(vmi, obj_attr_1->object_name, pid);
-		root_dir_1 = obj_attr_1->root_directory;
-		attributes_1 = obj_attr_1->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtLoadKeyEx(TargetKey: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, SourceFile: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Flags: 0x%lx, TrustClassKey: 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0, root_dir_1, unicode_str_1, attributes_1, args[2], args[3]);
-	free(unicode_str_0);
-	free(obj_attr_0);
-	free(unicode_str_1);
-	free(obj_attr_1);	return args;
-}
-
-void gt_windows_print_sysret_ntloadkeyex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntloadkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	uint8_t *unicode_str_1 = NULL;
-	uint64_t root_dir_1 = 0;
-	uint64_t attributes_1 = 0;
-	struct win64_obj_attr *obj_attr_1 = obj_attr_from_va(vmi, args[1], pid);
-	if (NULL != obj_attr_1) {
-		unicode_str_1 = unicode_str_from_va(vmi, obj_attr_1->object_name, pid);
-		root_dir_1 = obj_attr_1->root_directory;
-		attributes_1 = obj_attr_1->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtLoadKey(TargetKey: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, SourceFile: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0, root_dir_1, unicode_str_1, attributes_1);
-	free(unicode_str_0);
-	free(obj_attr_0);
-	free(unicode_str_1);
-	free(obj_attr_1);	return args;
-}
-
-void gt_windows_print_sysret_ntloadkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntlockfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_8 = args[8] ? "TRUE" : "FALSE";
-	char *bool_9 = args[9] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtLockFile(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, ByteOffset: 0x%lx, Length: 0x%lx, Key: 0x%lx, FailImmediately: %s, ExclusiveLock: %s)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[5], args[6], args[7], bool_8, bool_9);
-	return args;
-}
-
-void gt_windows_print_sysret_ntlockfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntlockproductactivationkeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtLockProductActivationKeys(*pPrivateVer: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntlockproductactivationkeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*pPrivateVer: 0x%lx, *pSafeMode: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntlockregistrykey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtLockRegistryKey(KeyHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntlockregistrykey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntlockvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtLockVirtualMemory(ProcessHandle: 0x%lx, *BaseAddress: 0x%lx, RegionSize: 0x%lx, MapType: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntlockvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*BaseAddress: 0x%lx, RegionSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntmakepermanentobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtMakePermanentObject(Handle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntmakepermanentobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntmaketemporaryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtMakeTemporaryObject(Handle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntmaketemporaryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntmapcmfmodule(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtMapCMFModule(What: 0x%lx, Index: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntmapcmfmodule(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_2 = 0;
-	vmi_read_64_va(vmi, args[2], pid, &pulong_2);
-	uint64_t pulong_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &pulong_3);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(CacheIndexOut: 0x%lx, CacheFlagsOut: 0x%lx, ViewSizeOut: 0x%lx, *BaseAddress: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_2, pulong_3, pulong_4, args[5]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntmapuserphysicalpages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtMapUserPhysicalPages(VirtualAddress: 0x%lx, NumberOfPages: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntmapuserphysicalpages(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntmapuserphysicalpagesscatter(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtMapUserPhysicalPagesScatter(NumberOfPages: 0x%lx)\n", pid, tid, proc, args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntmapuserphysicalpagesscatter(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntmapviewofsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtMapViewOfSection(SectionHandle: 0x%lx, ProcessHandle: 0x%lx, *BaseAddress: 0x%lx, ZeroBits: 0x%lx, CommitSize: 0x%lx, SectionOffset: 0x%lx, ViewSize: 0x%lx, InheritDisposition: 0x%lx, AllocationType: 0x%lx, Win32Protect: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7], args[8], args[9]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntmapviewofsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*BaseAddress: 0x%lx, SectionOffset: 0x%lx, ViewSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2], args[5], args[6]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntmodifybootentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtModifyBootEntry(BootEntry: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntmodifybootentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntmodifydriverentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtModifyDriverEntry(DriverEntry: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntmodifydriverentry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntnotifychangedirectoryfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_8 = args[8] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtNotifyChangeDirectoryFile(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, Length: 0x%lx, CompletionFilter: 0x%lx, WatchTree: %s)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[6], args[7], bool_8);
-	return args;
-}
-
-void gt_windows_print_sysret_ntnotifychangedirectoryfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntnotifychangekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_6 = args[6] ? "TRUE" : "FALSE";
-	char *bool_9 = args[9] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtNotifyChangeKey(KeyHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, CompletionFilter: 0x%lx, WatchTree: %s, BufferSize: 0x%lx, Asynchronous: %s)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[5], bool_6, args[8], bool_9);
-	return args;
-}
-
-void gt_windows_print_sysret_ntnotifychangekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntnotifychangemultiplekeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_8 = args[8] ? "TRUE" : "FALSE";
-	char *bool_11 = args[11] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtNotifyChangeMultipleKeys(MasterKeyHandle: 0x%lx, Count: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, CompletionFilter: 0x%lx, WatchTree: %s, BufferSize: 0x%lx, Asynchronous: %s)\n", pid, tid, proc, args[0], args[1], args[3], args[4], args[5], args[7], bool_8, args[10], bool_11);
-	return args;
-}
-
-void gt_windows_print_sysret_ntnotifychangemultiplekeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[6]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntnotifychangesession(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtNotifyChangeSession(Session: 0x%lx, IoStateSequence: 0x%lx, Reserved: 0x%lx, Action: 0x%lx, IoState: 0x%lx, IoState2: 0x%lx, Buffer: 0x%lx, BufferSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntnotifychangesession(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopendirectoryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenDirectoryObject(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopendirectoryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(DirectoryHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_4 = NULL;
-	uint64_t root_dir_4 = 0;
-	uint64_t attributes_4 = 0;
-	struct win64_obj_attr *obj_attr_4 = obj_attr_from_va(vmi, args[4], pid);
-	if (NULL != obj_attr_4) {
-		unicode_str_4 = unicode_str_from_va(vmi, obj_attr_4->object_name, pid);
-		root_dir_4 = obj_attr_4->root_directory;
-		attributes_4 = obj_attr_4->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenEnlistment(DesiredAccess: %s [0x%lx], ResourceManagerHandle: 0x%lx, EnlistmentGuid: 0x%lx, ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], args[2], args[3], root_dir_4, unicode_str_4, attributes_4);
-	free(permissions_1);
-	free(unicode_str_4);
-	free(obj_attr_4);	return args;
-}
-
-void gt_windows_print_sysret_ntopenenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(EnlistmentHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenEvent(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(EventHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopeneventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenEventPair(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopeneventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(EventPairHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenFile(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ShareAccess: 0x%lx, OpenOptions: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[4], args[5]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(FileHandle: 0x%lx, IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopeniocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenIoCompletion(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopeniocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoCompletionHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenjobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenJobObject(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenjobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(JobHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenkeyedevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenKeyedEvent(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenkeyedevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(KeyedEventHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenkeyex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenKeyEx(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, OpenOptions: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenkeyex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(KeyHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenKey(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(KeyHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenkeytransactedex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenKeyTransactedEx(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, OpenOptions: 0x%lx, TransactionHandle: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenkeytransactedex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(KeyHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenkeytransacted(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenKeyTransacted(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, TransactionHandle: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenkeytransacted(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(KeyHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenmutant(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenMutant(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenmutant(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(MutantHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenobjectauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint8_t *unicode_str_2 = unicode_str_from_va(vmi, args[2], pid);
-	uint8_t *unicode_str_3 = unicode_str_from_va(vmi, args[3], pid);
-	char *permissions_6 = vf_get_simple_permissions(args[6]);
-	char *permissions_7 = vf_get_simple_permissions(args[7]);
-	char *bool_9 = args[9] ? "TRUE" : "FALSE";
-	char *bool_10 = args[10] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenObjectAuditAlarm(SubsystemName: %s, HandleId: 0x%lx, ObjectTypeName: %s, ObjectName: %s, SecurityDescriptor: 0x%lx, ClientToken: 0x%lx, DesiredAccess: %s [0x%lx], GrantedAccess: %s [0x%lx], Privileges: 0x%lx, ObjectCreation: %s, AccessGranted: %s)\n", pid, tid, proc, unicode_str_0, args[1], unicode_str_2, unicode_str_3, args[4], args[5], permissions_6, args[6], permissions_7, args[7], args[8], bool_9, bool_10);
-	free(unicode_str_0);
-	free(unicode_str_2);
-	free(unicode_str_3);
-	free(permissions_6);
-	free(permissions_7);	return args;
-}
-
-void gt_windows_print_sysret_ntopenobjectauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(GenerateOnClose: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[11]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenprivatenamespace(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenPrivateNamespace(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, BoundaryDescriptor: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenprivatenamespace(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NamespaceHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenProcess(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ClientId: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProcessHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenprocesstokenex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenProcessTokenEx(ProcessHandle: 0x%lx, DesiredAccess: %s [0x%lx], HandleAttributes: 0x%lx)\n", pid, tid, proc, args[0], permissions_1, args[1], args[2]);
-	free(permissions_1);	return args;
-}
-
-void gt_windows_print_sysret_ntopenprocesstokenex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &phandle_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TokenHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_3);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenprocesstoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenProcessToken(ProcessHandle: 0x%lx, DesiredAccess: %s [0x%lx])\n", pid, tid, proc, args[0], permissions_1, args[1]);
-	free(permissions_1);	return args;
-}
-
-void gt_windows_print_sysret_ntopenprocesstoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_2 = 0;
-	vmi_read_64_va(vmi, args[2], pid, &phandle_2);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TokenHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_2);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_4 = NULL;
-	uint64_t root_dir_4 = 0;
-	uint64_t attributes_4 = 0;
-	struct win64_obj_attr *obj_attr_4 = obj_attr_from_va(vmi, args[4], pid);
-	if (NULL != obj_attr_4) {
-		unicode_str_4 = unicode_str_from_va(vmi, obj_attr_4->object_name, pid);
-		root_dir_4 = obj_attr_4->root_directory;
-		attributes_4 = obj_attr_4->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenResourceManager(DesiredAccess: %s [0x%lx], TmHandle: 0x%lx, ResourceManagerGuid: 0x%lx, ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], args[2], args[3], root_dir_4, unicode_str_4, attributes_4);
-	free(permissions_1);
-	free(unicode_str_4);
-	free(obj_attr_4);	return args;
-}
-
-void gt_windows_print_sysret_ntopenresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ResourceManagerHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopensection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenSection(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopensection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(SectionHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopensemaphore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenSemaphore(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopensemaphore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(SemaphoreHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopensession(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenSession(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopensession(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(SessionHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopensymboliclinkobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenSymbolicLinkObject(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopensymboliclinkobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(LinkHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenThread(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, ClientId: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopenthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ThreadHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenthreadtokenex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenThreadTokenEx(ThreadHandle: 0x%lx, DesiredAccess: %s [0x%lx], OpenAsSelf: %s, HandleAttributes: 0x%lx)\n", pid, tid, proc, args[0], permissions_1, args[1], bool_2, args[3]);
-	free(permissions_1);	return args;
-}
-
-void gt_windows_print_sysret_ntopenthreadtokenex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &phandle_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TokenHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopenthreadtoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenThreadToken(ThreadHandle: 0x%lx, DesiredAccess: %s [0x%lx], OpenAsSelf: %s)\n", pid, tid, proc, args[0], permissions_1, args[1], bool_2);
-	free(permissions_1);	return args;
-}
-
-void gt_windows_print_sysret_ntopenthreadtoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &phandle_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TokenHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_3);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopentimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenTimer(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopentimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TimerHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopentransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	uint8_t *unicode_str_3 = unicode_str_from_va(vmi, args[3], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenTransactionManager(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, LogFileName: %s, TmIdentity: 0x%lx, OpenOptions: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, unicode_str_3, args[4], args[5]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);
-	free(unicode_str_3);	return args;
-}
-
-void gt_windows_print_sysret_ntopentransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TmHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntopentransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *permissions_1 = vf_get_simple_permissions(args[1]);
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtOpenTransaction(DesiredAccess: %s [0x%lx], ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Uow: 0x%lx, TmHandle: 0x%lx)\n", pid, tid, proc, permissions_1, args[1], root_dir_2, unicode_str_2, attributes_2, args[3], args[4]);
-	free(permissions_1);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntopentransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(TransactionHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntplugplaycontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPlugPlayControl(PnPControlClass: 0x%lx, PnPControlDataLength: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntplugplaycontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntpowerinformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPowerInformation(InformationLevel: 0x%lx, InputBufferLength: 0x%lx, OutputBufferLength: 0x%lx)\n", pid, tid, proc, args[0], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntpowerinformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntpreparecomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPrepareComplete(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntpreparecomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntprepareenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPrepareEnlistment(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntprepareenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntprepreparecomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPrePrepareComplete(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntprepreparecomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntpreprepareenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPrePrepareEnlistment(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntpreprepareenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntprivilegecheck(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPrivilegeCheck(ClientToken: 0x%lx, RequiredPrivileges: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntprivilegecheck(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(RequiredPrivileges: 0x%lx, Result: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntprivilegedserviceauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	char *bool_4 = args[4] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPrivilegedServiceAuditAlarm(SubsystemName: %s, ServiceName: %s, ClientToken: 0x%lx, Privileges: 0x%lx, AccessGranted: %s)\n", pid, tid, proc, unicode_str_0, unicode_str_1, args[2], args[3], bool_4);
-	free(unicode_str_0);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntprivilegedserviceauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntprivilegeobjectauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	char *permissions_3 = vf_get_simple_permissions(args[3]);
-	char *bool_5 = args[5] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPrivilegeObjectAuditAlarm(SubsystemName: %s, HandleId: 0x%lx, ClientToken: 0x%lx, DesiredAccess: %s [0x%lx], Privileges: 0x%lx, AccessGranted: %s)\n", pid, tid, proc, unicode_str_0, args[1], args[2], permissions_3, args[3], args[4], bool_5);
-	free(unicode_str_0);
-	free(permissions_3);	return args;
-}
-
-void gt_windows_print_sysret_ntprivilegeobjectauditalarm(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntpropagationcomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPropagationComplete(ResourceManagerHandle: 0x%lx, RequestCookie: 0x%lx, BufferLength: 0x%lx, Buffer: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntpropagationcomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntpropagationfailed(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPropagationFailed(ResourceManagerHandle: 0x%lx, RequestCookie: 0x%lx, PropStatus: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntpropagationfailed(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntprotectvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtProtectVirtualMemory(ProcessHandle: 0x%lx, *BaseAddress: 0x%lx, RegionSize: 0x%lx, NewProtectWin32: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntprotectvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*BaseAddress: 0x%lx, RegionSize: 0x%lx, OldProtect: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[2], pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntpulseevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtPulseEvent(EventHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntpulseevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousState: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryattributesfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryAttributesFile(ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0);
-	free(unicode_str_0);
-	free(obj_attr_0);	return args;
-}
-
-void gt_windows_print_sysret_ntqueryattributesfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(FileInformation: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerybootentryorder(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryBootEntryOrder(Count: 0x%lx)\n", pid, tid, proc, pulong_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerybootentryorder(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Count: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerybootoptions(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryBootOptions(BootOptionsLength: 0x%lx)\n", pid, tid, proc, pulong_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerybootoptions(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(BootOptionsLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerydebugfilterstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryDebugFilterState(ComponentId: 0x%lx, Level: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerydebugfilterstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerydefaultlocale(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_0 = args[0] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryDefaultLocale(UserProfile: %s)\n", pid, tid, proc, bool_0);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerydefaultlocale(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(DefaultLocaleId: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerydefaultuilanguage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryDefaultUILanguage()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerydefaultuilanguage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*DefaultUILanguageId: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerydirectoryfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_8 = args[8] ? "TRUE" : "FALSE";
-	uint8_t *unicode_str_9 = unicode_str_from_va(vmi, args[9], pid);
-	char *bool_10 = args[10] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryDirectoryFile(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, Length: 0x%lx, FileInformationClass: 0x%lx, ReturnSingleEntry: %s, FileName: %s, RestartScan: %s)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[6], args[7], bool_8, unicode_str_9, bool_10);
-	free(unicode_str_9);	return args;
-}
-
-void gt_windows_print_sysret_ntquerydirectoryfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerydirectoryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_3 = args[3] ? "TRUE" : "FALSE";
-	char *bool_4 = args[4] ? "TRUE" : "FALSE";
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryDirectoryObject(DirectoryHandle: 0x%lx, Length: 0x%lx, ReturnSingleEntry: %s, RestartScan: %s, Context: 0x%lx)\n", pid, tid, proc, args[0], args[2], bool_3, bool_4, pulong_5);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerydirectoryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	uint64_t pulong_6 = 0;
-	vmi_read_64_va(vmi, args[6], pid, &pulong_6);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Context: 0x%lx, ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5, pulong_6);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerydriverentryorder(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryDriverEntryOrder(Count: 0x%lx)\n", pid, tid, proc, pulong_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerydriverentryorder(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Count: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryeafile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_4 = args[4] ? "TRUE" : "FALSE";
-	uint64_t pulong_7 = 0;
-	vmi_read_64_va(vmi, args[7], pid, &pulong_7);
-	char *bool_8 = args[8] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryEaFile(FileHandle: 0x%lx, Length: 0x%lx, ReturnSingleEntry: %s, EaListLength: 0x%lx, EaIndex: 0x%lx, RestartScan: %s)\n", pid, tid, proc, args[0], args[3], bool_4, args[6], pulong_7, bool_8);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryeafile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryEvent(EventHandle: 0x%lx, EventInformationClass: 0x%lx, EventInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryfullattributesfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryFullAttributesFile(ObjectAttributes: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0);
-	free(unicode_str_0);
-	free(obj_attr_0);	return args;
-}
-
-void gt_windows_print_sysret_ntqueryfullattributesfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(FileInformation: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationatom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationAtom(Atom: 0x%lx, InformationClass: 0x%lx, AtomInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationatom(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationEnlistment(EnlistmentHandle: 0x%lx, EnlistmentInformationClass: 0x%lx, EnlistmentInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationFile(FileHandle: 0x%lx, Length: 0x%lx, FileInformationClass: 0x%lx)\n", pid, tid, proc, args[0], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationjobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationJobObject(JobHandle: 0x%lx, JobObjectInformationClass: 0x%lx, JobObjectInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationjobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationPort(PortHandle: 0x%lx, PortInformationClass: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationProcess(ProcessHandle: 0x%lx, ProcessInformationClass: 0x%lx, ProcessInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationResourceManager(ResourceManagerHandle: 0x%lx, ResourceManagerInformationClass: 0x%lx, ResourceManagerInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationThread(ThreadHandle: 0x%lx, ThreadInformationClass: 0x%lx, ThreadInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationtoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationToken(TokenHandle: 0x%lx, TokenInformationClass: 0x%lx, TokenInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationtoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationtransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationTransaction(TransactionHandle: 0x%lx, TransactionInformationClass: 0x%lx, TransactionInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationtransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationtransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationTransactionManager(TransactionManagerHandle: 0x%lx, TransactionManagerInformationClass: 0x%lx, TransactionManagerInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationtransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinformationworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInformationWorkerFactory(WorkerFactoryHandle: 0x%lx, WorkerFactoryInformationClass: 0x%lx, WorkerFactoryInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinformationworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryinstalluilanguage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryInstallUILanguage()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryinstalluilanguage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*InstallUILanguageId: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryintervalprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryIntervalProfile(ProfileSource: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryintervalprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Interval: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryiocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryIoCompletion(IoCompletionHandle: 0x%lx, IoCompletionInformationClass: 0x%lx, IoCompletionInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryiocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerykey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryKey(KeyHandle: 0x%lx, KeyInformationClass: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerykey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ResultLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerylicensevalue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryLicenseValue(Name: %s, Length: 0x%lx)\n", pid, tid, proc, unicode_str_0, args[3]);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntquerylicensevalue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Type: 0x%lx, ReturnedLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerymultiplevaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryMultipleValueKey(KeyHandle: 0x%lx, EntryCount: 0x%lx, BufferLength: 0x%lx)\n", pid, tid, proc, args[0], args[2], pulong_4);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerymultiplevaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(BufferLength: 0x%lx, RequiredBufferLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerymutant(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryMutant(MutantHandle: 0x%lx, MutantInformationClass: 0x%lx, MutantInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerymutant(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryObject(Handle: 0x%lx, ObjectInformationClass: 0x%lx, ObjectInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryopensubkeysex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryOpenSubKeysEx(TargetKey: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, BufferLength: 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0, args[1]);
-	free(unicode_str_0);
-	free(obj_attr_0);	return args;
-}
-
-void gt_windows_print_sysret_ntqueryopensubkeysex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &pulong_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(RequiredSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_3);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryopensubkeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryOpenSubKeys(TargetKey: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0);
-	free(unicode_str_0);
-	free(obj_attr_0);	return args;
-}
-
-void gt_windows_print_sysret_ntqueryopensubkeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(HandleCount: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryperformancecounter(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryPerformanceCounter()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryperformancecounter(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PerformanceCounter: 0x%lx, PerformanceFrequency: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryportinformationprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryPortInformationProcess()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryportinformationprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryquotainformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_4 = args[4] ? "TRUE" : "FALSE";
-	uint64_t pulong_7 = 0;
-	vmi_read_64_va(vmi, args[7], pid, &pulong_7);
-	char *bool_8 = args[8] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryQuotaInformationFile(FileHandle: 0x%lx, Length: 0x%lx, ReturnSingleEntry: %s, SidListLength: 0x%lx, StartSid: 0x%lx, RestartScan: %s)\n", pid, tid, proc, args[0], args[3], bool_4, args[6], pulong_7, bool_8);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryquotainformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySection(SectionHandle: 0x%lx, SectionInformationClass: 0x%lx, SectionInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerysection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysecurityattributestoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySecurityAttributesToken(TokenHandle: 0x%lx, NumberOfAttributes: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerysecurityattributestoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysecurityobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySecurityObject(Handle: 0x%lx, SecurityInformation: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerysecurityobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(LengthNeeded: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysemaphore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySemaphore(SemaphoreHandle: 0x%lx, SemaphoreInformationClass: 0x%lx, SemaphoreInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerysemaphore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysymboliclinkobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySymbolicLinkObject(LinkHandle: 0x%lx, LinkTarget: %s)\n", pid, tid, proc, args[0], unicode_str_1);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntquerysymboliclinkobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	uint64_t pulong_2 = 0;
-	vmi_read_64_va(vmi, args[2], pid, &pulong_2);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(LinkTarget: %s, ReturnedLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, unicode_str_1, pulong_2);
-	free(unicode_str_1);	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysystemenvironmentvalueex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint64_t pulong_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &pulong_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySystemEnvironmentValueEx(VariableName: %s, VendorGuid: 0x%lx, ValueLength: 0x%lx)\n", pid, tid, proc, unicode_str_0, args[1], pulong_3);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntquerysystemenvironmentvalueex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &pulong_3);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ValueLength: 0x%lx, Attributes: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_3, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysystemenvironmentvalue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySystemEnvironmentValue(VariableName: %s, ValueLength: 0x%lx)\n", pid, tid, proc, unicode_str_0, args[2]);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntquerysystemenvironmentvalue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysysteminformationex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySystemInformationEx(SystemInformationClass: 0x%lx, QueryInformationLength: 0x%lx, SystemInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerysysteminformationex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysysteminformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySystemInformation(SystemInformationClass: 0x%lx, SystemInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerysysteminformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &pulong_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_3);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerysystemtime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQuerySystemTime()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerysystemtime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(SystemTime: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerytimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryTimer(TimerHandle: 0x%lx, TimerInformationClass: 0x%lx, TimerInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerytimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntquerytimerresolution(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryTimerResolution()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntquerytimerresolution(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &pulong_0);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	uint64_t pulong_2 = 0;
-	vmi_read_64_va(vmi, args[2], pid, &pulong_2);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(MaximumTime: 0x%lx, MinimumTime: 0x%lx, CurrentTime: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_0, pulong_1, pulong_2);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryvaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryValueKey(KeyHandle: 0x%lx, ValueName: %s, KeyValueInformationClass: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], unicode_str_1, args[2], args[4]);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntqueryvaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ResultLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryVirtualMemory(ProcessHandle: 0x%lx, BaseAddress: 0x%lx, MemoryInformationClass: 0x%lx, MemoryInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[5]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueryvolumeinformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueryVolumeInformationFile(FileHandle: 0x%lx, Length: 0x%lx, FsInformationClass: 0x%lx)\n", pid, tid, proc, args[0], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueryvolumeinformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueueapcthreadex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueueApcThreadEx(ThreadHandle: 0x%lx, UserApcReserveHandle: 0x%lx, ApcRoutine: 0x%lx, ApcArgument1: 0x%lx, ApcArgument2: 0x%lx, ApcArgument3: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4], args[5]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueueapcthreadex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntqueueapcthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtQueueApcThread(ThreadHandle: 0x%lx, ApcRoutine: 0x%lx, ApcArgument1: 0x%lx, ApcArgument2: 0x%lx, ApcArgument3: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntqueueapcthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntraiseexception(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRaiseException()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntraiseexception(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ExceptionRecord: 0x%lx, ContextRecord: 0x%lx, FirstChance: %s)\n", pid, tid, proc, event->x86_regs->rax, args[0], args[1], bool_2);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntraiseharderror(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRaiseHardError(ErrorStatus: 0x%lx, NumberOfParameters: 0x%lx, UnicodeStringParameterMask: 0x%lx, ValidResponseOptions: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntraiseharderror(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(Response: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreadfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReadFile(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, Length: 0x%lx, ByteOffset: 0x%lx, Key: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[6], args[7], pulong_8);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreadfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreadfilescatter(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReadFileScatter(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, SegmentArray: 0x%lx, Length: 0x%lx, ByteOffset: 0x%lx, Key: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[5], args[6], args[7], pulong_8);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreadfilescatter(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreadonlyenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReadOnlyEnlistment(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreadonlyenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreadrequestdata(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReadRequestData(PortHandle: 0x%lx, Message: 0x%lx, DataEntryIndex: 0x%lx, BufferSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreadrequestdata(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NumberOfBytesRead: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[5]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreadvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReadVirtualMemory(ProcessHandle: 0x%lx, BaseAddress: 0x%lx, BufferSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreadvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NumberOfBytesRead: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrecoverenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRecoverEnlistment(EnlistmentHandle: 0x%lx, EnlistmentKey: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrecoverenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrecoverresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRecoverResourceManager(ResourceManagerHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrecoverresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrecovertransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRecoverTransactionManager(TransactionManagerHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrecovertransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntregisterprotocoladdressinformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRegisterProtocolAddressInformation(ResourceManager: 0x%lx, ProtocolId: 0x%lx, ProtocolInformationSize: 0x%lx, ProtocolInformation: 0x%lx, CreateOptions: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntregisterprotocoladdressinformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntregisterthreadterminateport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRegisterThreadTerminatePort(PortHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntregisterthreadterminateport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreleasekeyedevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReleaseKeyedEvent(KeyedEventHandle: 0x%lx, KeyValue: 0x%lx, Alertable: %s, Timeout: 0x%lx)\n", pid, tid, proc, args[0], args[1], bool_2, args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreleasekeyedevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreleasemutant(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReleaseMutant(MutantHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreleasemutant(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousCount: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreleasesemaphore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReleaseSemaphore(SemaphoreHandle: 0x%lx, ReleaseCount: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreleasesemaphore(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousCount: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreleaseworkerfactoryworker(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReleaseWorkerFactoryWorker(WorkerFactoryHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreleaseworkerfactoryworker(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntremoveiocompletionex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_5 = args[5] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRemoveIoCompletionEx(IoCompletionHandle: 0x%lx, Count: 0x%lx, Timeout: 0x%lx, Alertable: %s)\n", pid, tid, proc, args[0], args[2], args[4], bool_5);
-	return args;
-}
-
-void gt_windows_print_sysret_ntremoveiocompletionex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &pulong_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NumEntriesRemoved: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_3);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntremoveiocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRemoveIoCompletion(IoCompletionHandle: 0x%lx, Timeout: 0x%lx)\n", pid, tid, proc, args[0], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntremoveiocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*KeyContext: 0x%lx, *ApcContext: 0x%lx, IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[2], args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntremoveprocessdebug(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRemoveProcessDebug()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntremoveprocessdebug(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ProcessHandle: 0x%lx, DebugObjectHandle: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrenamekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRenameKey(KeyHandle: 0x%lx, NewName: %s)\n", pid, tid, proc, args[0], unicode_str_1);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntrenamekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrenametransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRenameTransactionManager(LogFileName: %s, ExistingTransactionManagerGuid: 0x%lx)\n", pid, tid, proc, unicode_str_0, args[1]);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntrenametransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreplacekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	uint8_t *unicode_str_2 = NULL;
-	uint64_t root_dir_2 = 0;
-	uint64_t attributes_2 = 0;
-	struct win64_obj_attr *obj_attr_2 = obj_attr_from_va(vmi, args[2], pid);
-	if (NULL != obj_attr_2) {
-		unicode_str_2 = unicode_str_from_va(vmi, obj_attr_2->object_name, pid);
-		root_dir_2 = obj_attr_2->root_directory;
-		attributes_2 = obj_attr_2->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReplaceKey(NewFile: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, TargetHandle: 0x%lx, OldFile: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0, args[1], root_dir_2, unicode_str_2, attributes_2);
-	free(unicode_str_0);
-	free(obj_attr_0);
-	free(unicode_str_2);
-	free(obj_attr_2);	return args;
-}
-
-void gt_windows_print_sysret_ntreplacekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreplacepartitionunit(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReplacePartitionUnit(TargetInstancePath: %s, SpareInstancePath: %s, Flags: 0x%lx)\n", pid, tid, proc, unicode_str_0, unicode_str_1, args[2]);
-	free(unicode_str_0);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntreplacepartitionunit(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreplyport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReplyPort(PortHandle: 0x%lx, ReplyMessage: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreplyport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreplywaitreceiveportex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReplyWaitReceivePortEx(PortHandle: 0x%lx, ReplyMessage: 0x%lx, Timeout: 0x%lx)\n", pid, tid, proc, args[0], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreplywaitreceiveportex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*PortContext: 0x%lx, ReceiveMessage: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreplywaitreceiveport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReplyWaitReceivePort(PortHandle: 0x%lx, ReplyMessage: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreplywaitreceiveport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*PortContext: 0x%lx, ReceiveMessage: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntreplywaitreplyport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtReplyWaitReplyPort(PortHandle: 0x%lx, ReplyMessage: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntreplywaitreplyport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReplyMessage: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrequestport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRequestPort(PortHandle: 0x%lx, RequestMessage: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrequestport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrequestwaitreplyport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRequestWaitReplyPort(PortHandle: 0x%lx, RequestMessage: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrequestwaitreplyport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReplyMessage: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntresetevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtResetEvent(EventHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntresetevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousState: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntresetwritewatch(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtResetWriteWatch(ProcessHandle: 0x%lx, BaseAddress: 0x%lx, RegionSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntresetwritewatch(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrestorekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRestoreKey(KeyHandle: 0x%lx, FileHandle: 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrestorekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntresumeprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtResumeProcess(ProcessHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntresumeprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntresumethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtResumeThread(ThreadHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntresumethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousSuspendCount: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrollbackcomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRollbackComplete(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrollbackcomplete(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrollbackenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRollbackEnlistment(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrollbackenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrollbacktransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_1 = args[1] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRollbackTransaction(TransactionHandle: 0x%lx, Wait: %s)\n", pid, tid, proc, args[0], bool_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrollbacktransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntrollforwardtransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtRollforwardTransactionManager(TransactionManagerHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntrollforwardtransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsavekeyex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSaveKeyEx(KeyHandle: 0x%lx, FileHandle: 0x%lx, Format: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsavekeyex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsavekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSaveKey(KeyHandle: 0x%lx, FileHandle: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsavekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsavemergedkeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSaveMergedKeys(HighPrecedenceKeyHandle: 0x%lx, LowPrecedenceKeyHandle: 0x%lx, FileHandle: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsavemergedkeys(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsecureconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSecureConnectPort(PortName: %s, SecurityQos: 0x%lx, ClientView: 0x%lx, RequiredServerSid: 0x%lx, ServerView: 0x%lx, ConnectionInformation: 0x%lx, ConnectionInformationLength: 0x%lx)\n", pid, tid, proc, unicode_str_1, args[2], args[3], args[4], args[5], args[7], pulong_8);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntsecureconnectport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t phandle_0 = 0;
-	vmi_read_64_va(vmi, args[0], pid, &phandle_0);
-	uint64_t pulong_6 = 0;
-	vmi_read_64_va(vmi, args[6], pid, &pulong_6);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PortHandle: 0x%lx, ClientView: 0x%lx, ServerView: 0x%lx, MaxMessageLength: 0x%lx, ConnectionInformation: 0x%lx, ConnectionInformationLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, phandle_0, args[3], args[5], pulong_6, args[7], pulong_8);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntserializeboot(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSerializeBoot()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntserializeboot(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetbootentryorder(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetBootEntryOrder(Count: 0x%lx)\n", pid, tid, proc, args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetbootentryorder(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetbootoptions(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetBootOptions(BootOptions: 0x%lx, FieldsToChange: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetbootoptions(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetcontextthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetContextThread(ThreadHandle: 0x%lx, ThreadContext: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetcontextthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetdebugfilterstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetDebugFilterState(ComponentId: 0x%lx, Level: 0x%lx, State: %s)\n", pid, tid, proc, args[0], args[1], bool_2);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetdebugfilterstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetdefaultharderrorport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetDefaultHardErrorPort(DefaultHardErrorPort: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetdefaultharderrorport(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetdefaultlocale(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_0 = args[0] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetDefaultLocale(UserProfile: %s, DefaultLocaleId: 0x%lx)\n", pid, tid, proc, bool_0, args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetdefaultlocale(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetdefaultuilanguage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetDefaultUILanguage(DefaultUILanguageId: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetdefaultuilanguage(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetdriverentryorder(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetDriverEntryOrder(Count: 0x%lx)\n", pid, tid, proc, args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetdriverentryorder(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntseteafile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetEaFile(FileHandle: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntseteafile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntseteventboostpriority(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetEventBoostPriority(EventHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntseteventboostpriority(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetEvent(EventHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousState: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsethigheventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetHighEventPair(EventPairHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsethigheventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsethighwaitloweventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetHighWaitLowEventPair(EventPairHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsethighwaitloweventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationdebugobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationDebugObject()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationdebugobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_4 = 0;
-	vmi_read_64_va(vmi, args[4], pid, &pulong_4);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(DebugObjectHandle: 0x%lx, DebugObjectInformationClass: 0x%lx, DebugInformation: 0x%lx, DebugInformationLength: 0x%lx, ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], args[1], args[2], args[3], pulong_4);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationEnlistment(EnlistmentHandle: 0x%lx, EnlistmentInformationClass: 0x%lx, EnlistmentInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationenlistment(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationFile(FileHandle: 0x%lx, Length: 0x%lx, FileInformationClass: 0x%lx)\n", pid, tid, proc, args[0], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationjobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationJobObject(JobHandle: 0x%lx, JobObjectInformationClass: 0x%lx, JobObjectInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationjobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationKey(KeyHandle: 0x%lx, KeySetInformationClass: 0x%lx, KeySetInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationObject(Handle: 0x%lx, ObjectInformationClass: 0x%lx, ObjectInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationProcess(ProcessHandle: 0x%lx, ProcessInformationClass: 0x%lx, ProcessInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationResourceManager(ResourceManagerHandle: 0x%lx, ResourceManagerInformationClass: 0x%lx, ResourceManagerInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationresourcemanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationThread(ThreadHandle: 0x%lx, ThreadInformationClass: 0x%lx, ThreadInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationtoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationToken(TokenHandle: 0x%lx, TokenInformationClass: 0x%lx, TokenInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationtoken(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationtransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationTransaction(TransactionHandle: 0x%lx, TransactionInformationClass: 0x%lx, TransactionInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationtransaction(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationtransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationTransactionManager(TmHandle: 0x%lx, TransactionManagerInformationClass: 0x%lx, TransactionManagerInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationtransactionmanager(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetinformationworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetInformationWorkerFactory(WorkerFactoryHandle: 0x%lx, WorkerFactoryInformationClass: 0x%lx, WorkerFactoryInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetinformationworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetintervalprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetIntervalProfile(Interval: 0x%lx, Source: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetintervalprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetiocompletionex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetIoCompletionEx(IoCompletionHandle: 0x%lx, IoCompletionReserveHandle: 0x%lx, KeyContext: 0x%lx, ApcContext: 0x%lx, IoStatus: 0x%lx, IoStatusInformation: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4], args[5]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetiocompletionex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetiocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetIoCompletion(IoCompletionHandle: 0x%lx, KeyContext: 0x%lx, ApcContext: 0x%lx, IoStatus: 0x%lx, IoStatusInformation: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetiocompletion(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetldtentries(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetLdtEntries(Selector0: 0x%lx, Entry0Low: 0x%lx, Entry0Hi: 0x%lx, Selector1: 0x%lx, Entry1Low: 0x%lx, Entry1Hi: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[4], args[5]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetldtentries(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetloweventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetLowEventPair(EventPairHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetloweventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetlowwaithigheventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetLowWaitHighEventPair(EventPairHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetlowwaithigheventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetquotainformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetQuotaInformationFile(FileHandle: 0x%lx, Length: 0x%lx)\n", pid, tid, proc, args[0], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetquotainformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetsecurityobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetSecurityObject(Handle: 0x%lx, SecurityInformation: 0x%lx, SecurityDescriptor: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetsecurityobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetsystemenvironmentvalueex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetSystemEnvironmentValueEx(VariableName: %s, VendorGuid: 0x%lx, ValueLength: 0x%lx, Attributes: 0x%lx)\n", pid, tid, proc, unicode_str_0, args[1], args[3], args[4]);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntsetsystemenvironmentvalueex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetsystemenvironmentvalue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetSystemEnvironmentValue(VariableName: %s, VariableValue: %s)\n", pid, tid, proc, unicode_str_0, unicode_str_1);
-	free(unicode_str_0);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntsetsystemenvironmentvalue(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetsysteminformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetSystemInformation(SystemInformationClass: 0x%lx, SystemInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetsysteminformation(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetsystempowerstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetSystemPowerState(SystemAction: 0x%lx, MinSystemState: 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetsystempowerstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetsystemtime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetSystemTime(SystemTime: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetsystemtime(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousTime: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetthreadexecutionstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetThreadExecutionState(esFlags: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetthreadexecutionstate(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*PreviousFlags: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsettimerex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetTimerEx(TimerHandle: 0x%lx, TimerSetInformationClass: 0x%lx, TimerSetInformationLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsettimerex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsettimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_4 = args[4] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetTimer(TimerHandle: 0x%lx, DueTime: 0x%lx, TimerApcRoutine: 0x%lx, TimerContext: 0x%lx, WakeTimer: %s, Period: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], bool_4, args[5]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsettimer(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousState: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[6]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsettimerresolution(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_1 = args[1] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetTimerResolution(DesiredTime: 0x%lx, SetResolution: %s)\n", pid, tid, proc, args[0], bool_1);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsettimerresolution(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_2 = 0;
-	vmi_read_64_va(vmi, args[2], pid, &pulong_2);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ActualTime: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_2);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetuuidseed(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetUuidSeed(Seed: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetuuidseed(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetvaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_1 = unicode_str_from_va(vmi, args[1], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetValueKey(KeyHandle: 0x%lx, ValueName: %s, TitleIndex: 0x%lx, Type: 0x%lx, DataSize: 0x%lx)\n", pid, tid, proc, args[0], unicode_str_1, args[2], args[3], args[5]);
-	free(unicode_str_1);	return args;
-}
-
-void gt_windows_print_sysret_ntsetvaluekey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsetvolumeinformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSetVolumeInformationFile(FileHandle: 0x%lx, Length: 0x%lx, FsInformationClass: 0x%lx)\n", pid, tid, proc, args[0], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsetvolumeinformationfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntshutdownsystem(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtShutdownSystem(Action: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntshutdownsystem(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntshutdownworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtShutdownWorkerFactory(WorkerFactoryHandle: 0x%lx, *PendingWorkerCount: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntshutdownworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*PendingWorkerCount: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsignalandwaitforsingleobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSignalAndWaitForSingleObject(SignalHandle: 0x%lx, WaitHandle: 0x%lx, Alertable: %s, Timeout: 0x%lx)\n", pid, tid, proc, args[0], args[1], bool_2, args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsignalandwaitforsingleobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsinglephasereject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSinglePhaseReject(EnlistmentHandle: 0x%lx, TmVirtualClock: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsinglephasereject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntstartprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtStartProfile(ProfileHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntstartprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntstopprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtStopProfile(ProfileHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntstopprofile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsuspendprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSuspendProcess(ProcessHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsuspendprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsuspendthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSuspendThread(ThreadHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsuspendthread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_1 = 0;
-	vmi_read_64_va(vmi, args[1], pid, &pulong_1);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(PreviousSuspendCount: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_1);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntsystemdebugcontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtSystemDebugControl(Command: 0x%lx, InputBufferLength: 0x%lx, OutputBufferLength: 0x%lx)\n", pid, tid, proc, args[0], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntsystemdebugcontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntterminatejobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtTerminateJobObject(JobHandle: 0x%lx, ExitStatus: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntterminatejobobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntterminateprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtTerminateProcess(ProcessHandle: 0x%lx, ExitStatus: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntterminateprocess(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntterminatethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtTerminateThread(ThreadHandle: 0x%lx, ExitStatus: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntterminatethread(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_nttestalert(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtTestAlert()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_nttestalert(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntthawregistry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtThawRegistry()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntthawregistry(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntthawtransactions(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtThawTransactions()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntthawtransactions(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_nttracecontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtTraceControl(FunctionCode: 0x%lx, InBufferLen: 0x%lx, OutBufferLen: 0x%lx)\n", pid, tid, proc, args[0], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_nttracecontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_5 = 0;
-	vmi_read_64_va(vmi, args[5], pid, &pulong_5);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ReturnLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_5);
-	free(args);
-}
-
-void *gt_windows_print_syscall_nttraceevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtTraceEvent(TraceHandle: 0x%lx, Flags: 0x%lx, FieldSize: 0x%lx, Fields: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_nttraceevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_nttranslatefilepath(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &pulong_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtTranslateFilePath(InputFilePath: 0x%lx, OutputType: 0x%lx, OutputFilePathLength: 0x%lx)\n", pid, tid, proc, args[0], args[1], pulong_3);
-	return args;
-}
-
-void gt_windows_print_sysret_nttranslatefilepath(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	uint64_t pulong_3 = 0;
-	vmi_read_64_va(vmi, args[3], pid, &pulong_3);
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(OutputFilePathLength: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, pulong_3);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntumsthreadyield(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtUmsThreadYield(SchedulerParam: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntumsthreadyield(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntunloaddriver(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = unicode_str_from_va(vmi, args[0], pid);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtUnloadDriver(DriverServiceName: %s)\n", pid, tid, proc, unicode_str_0);
-	free(unicode_str_0);	return args;
-}
-
-void gt_windows_print_sysret_ntunloaddriver(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntunloadkey2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtUnloadKey2(TargetKey: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Flags: 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0, args[1]);
-	free(unicode_str_0);
-	free(obj_attr_0);	return args;
-}
-
-void gt_windows_print_sysret_ntunloadkey2(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntunloadkeyex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtUnloadKeyEx(TargetKey: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx, Event: 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0, args[1]);
-	free(unicode_str_0);
-	free(obj_attr_0);	return args;
-}
-
-void gt_windows_print_sysret_ntunloadkeyex(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntunloadkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint8_t *unicode_str_0 = NULL;
-	uint64_t root_dir_0 = 0;
-	uint64_t attributes_0 = 0;
-	struct win64_obj_attr *obj_attr_0 = obj_attr_from_va(vmi, args[0], pid);
-	if (NULL != obj_attr_0) {
-		unicode_str_0 = unicode_str_from_va(vmi, obj_attr_0->object_name, pid);
-		root_dir_0 = obj_attr_0->root_directory;
-		attributes_0 = obj_attr_0->attributes;
-	}
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtUnloadKey(TargetKey: RootDirectory = 0x%lx | ObjectName = %s | Attributes = 0x%lx)\n", pid, tid, proc, root_dir_0, unicode_str_0, attributes_0);
-	free(unicode_str_0);
-	free(obj_attr_0);	return args;
-}
-
-void gt_windows_print_sysret_ntunloadkey(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntunlockfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtUnlockFile(FileHandle: 0x%lx, ByteOffset: 0x%lx, Length: 0x%lx, Key: 0x%lx)\n", pid, tid, proc, args[0], args[2], args[3], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntunlockfile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntunlockvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtUnlockVirtualMemory(ProcessHandle: 0x%lx, *BaseAddress: 0x%lx, RegionSize: 0x%lx, MapType: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntunlockvirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(*BaseAddress: 0x%lx, RegionSize: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1], args[2]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntunmapviewofsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtUnmapViewOfSection(ProcessHandle: 0x%lx, BaseAddress: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntunmapviewofsection(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntvdmcontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtVdmControl(Service: 0x%lx, ServiceData: 0x%lx)\n", pid, tid, proc, args[0], args[1]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntvdmcontrol(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(ServiceData: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwaitfordebugevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWaitForDebugEvent()\n", pid, tid, proc);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwaitfordebugevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-	char *bool_1 = args[1] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(DebugObjectHandle: 0x%lx, Alertable: %s, Timeout: 0x%lx, WaitStateChange: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[0], bool_1, args[2], args[3]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwaitforkeyedevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_2 = args[2] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWaitForKeyedEvent(KeyedEventHandle: 0x%lx, KeyValue: 0x%lx, Alertable: %s, Timeout: 0x%lx)\n", pid, tid, proc, args[0], args[1], bool_2, args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwaitforkeyedevent(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwaitformultipleobjects32(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_3 = args[3] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWaitForMultipleObjects32(Count: 0x%lx, WaitType: 0x%lx, Alertable: %s, Timeout: 0x%lx)\n", pid, tid, proc, args[0], args[2], bool_3, args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwaitformultipleobjects32(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwaitformultipleobjects(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_3 = args[3] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWaitForMultipleObjects(Count: 0x%lx, WaitType: 0x%lx, Alertable: %s, Timeout: 0x%lx)\n", pid, tid, proc, args[0], args[2], bool_3, args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwaitformultipleobjects(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwaitforsingleobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	char *bool_1 = args[1] ? "TRUE" : "FALSE";
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWaitForSingleObject(Handle: 0x%lx, Alertable: %s, Timeout: 0x%lx)\n", pid, tid, proc, args[0], bool_1, args[2]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwaitforsingleobject(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwaitforworkviaworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWaitForWorkViaWorkerFactory(WorkerFactoryHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwaitforworkviaworkerfactory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(MiniPacket: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[1]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwaithigheventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWaitHighEventPair(EventPairHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwaithigheventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwaitloweventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWaitLowEventPair(EventPairHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwaitloweventpair(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntworkerfactoryworkerready(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWorkerFactoryWorkerReady(WorkerFactoryHandle: 0x%lx)\n", pid, tid, proc, args[0]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntworkerfactoryworkerready(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwritefilegather(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWriteFileGather(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, SegmentArray: 0x%lx, Length: 0x%lx, ByteOffset: 0x%lx, Key: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[5], args[6], args[7], pulong_8);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwritefilegather(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwritefile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-	uint64_t pulong_8 = 0;
-	vmi_read_64_va(vmi, args[8], pid, &pulong_8);
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWriteFile(FileHandle: 0x%lx, Event: 0x%lx, ApcRoutine: 0x%lx, ApcContext: 0x%lx, Length: 0x%lx, ByteOffset: 0x%lx, Key: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[3], args[6], args[7], pulong_8);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwritefile(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(IoStatusBlock: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwriterequestdata(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWriteRequestData(PortHandle: 0x%lx, Message: 0x%lx, DataEntryIndex: 0x%lx, BufferSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[2], args[4]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwriterequestdata(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NumberOfBytesWritten: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[5]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntwritevirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtWriteVirtualMemory(ProcessHandle: 0x%lx, BaseAddress: 0x%lx, BufferSize: 0x%lx)\n", pid, tid, proc, args[0], args[1], args[3]);
-	return args;
-}
-
-void gt_windows_print_sysret_ntwritevirtualmemory(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT(NumberOfBytesWritten: 0x%lx)\n", pid, tid, proc, event->x86_regs->rax, args[4]);
-	free(args);
-}
-
-void *gt_windows_print_syscall_ntyieldexecution(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	char *proc = get_process_name(vmi, pid);
-	uint64_t *args = vf_get_args(vmi, event, pid);
-
-	fprintf(stderr, "pid: %u/0x%lx (%s) syscall: NtYieldExecution()\n", pid, tid, proc);
-	return args;
-}
+static const gt_syscall_arg WINDOWS_SYSCALL_ARGS[] = {
+	{ "PortHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "PortContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "ConnectionRequest", GT_ARG_HEX, GT_ARG_IN },
+	{ "AcceptConnection", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "ServerView", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "ClientView", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "HandleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectTypeName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ObjectName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "GenericMapping", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectCreation", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "GrantedAccess", GT_ARG_HEX, GT_ARG_OUT },
+	{ "AccessStatus", GT_ARG_HEX, GT_ARG_OUT },
+	{ "GenerateOnClose", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "HandleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectTypeName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ObjectName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrincipalSelfSid", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "AuditType", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectTypeList", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ObjectTypeListLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "GenericMapping", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectCreation", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "GrantedAccess", GT_ARG_HEX, GT_ARG_OUT },
+	{ "AccessStatus", GT_ARG_HEX, GT_ARG_OUT },
+	{ "GenerateOnClose", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrincipalSelfSid", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientToken", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectTypeList", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ObjectTypeListLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "GenericMapping", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrivilegeSet", GT_ARG_HEX, GT_ARG_NONE },
+	{ "PrivilegeSetLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "GrantedAccess", GT_ARG_HEX, GT_ARG_OUT },
+	{ "AccessStatus", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "HandleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientToken", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectTypeName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ObjectName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrincipalSelfSid", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "AuditType", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectTypeList", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ObjectTypeListLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "GenericMapping", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectCreation", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "GrantedAccess", GT_ARG_HEX, GT_ARG_NONE },
+	{ "AccessStatus", GT_ARG_HEX, GT_ARG_NONE },
+	{ "GenerateOnClose", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "HandleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectTypeName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ObjectName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrincipalSelfSid", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "AuditType", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectTypeList", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ObjectTypeListLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "GenericMapping", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectCreation", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "GrantedAccess", GT_ARG_HEX, GT_ARG_NONE },
+	{ "AccessStatus", GT_ARG_HEX, GT_ARG_NONE },
+	{ "GenerateOnClose", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrincipalSelfSid", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientToken", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectTypeList", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ObjectTypeListLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "GenericMapping", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrivilegeSet", GT_ARG_HEX, GT_ARG_NONE },
+	{ "PrivilegeSetLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "GrantedAccess", GT_ARG_HEX, GT_ARG_NONE },
+	{ "AccessStatus", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientToken", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "GenericMapping", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrivilegeSet", GT_ARG_HEX, GT_ARG_NONE },
+	{ "PrivilegeSetLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "GrantedAccess", GT_ARG_HEX, GT_ARG_OUT },
+	{ "AccessStatus", GT_ARG_HEX, GT_ARG_OUT },
+	{ "AtomName", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "Atom", GT_ARG_HEX, GT_ARG_OUT },
+	{ "BootEntry", GT_ARG_HEX, GT_ARG_IN },
+	{ "Id", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "DriverEntry", GT_ARG_HEX, GT_ARG_IN },
+	{ "Id", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "TokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResetToDefault", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "NewState", GT_ARG_HEX, GT_ARG_IN },
+	{ "BufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousState", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "TokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DisableAllPrivileges", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "NewState", GT_ARG_HEX, GT_ARG_IN },
+	{ "BufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousState", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousSuspendCount", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Luid", GT_ARG_HEX, GT_ARG_OUT },
+	{ "MemoryReserveHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Type", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumberOfPages", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "UserPfnArray", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Time", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Range", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Sequence", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Seed", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "ZeroBits", GT_ARG_HEX, GT_ARG_IN },
+	{ "RegionSize", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "AllocationType", GT_ARG_HEX, GT_ARG_IN },
+	{ "Protect", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ConnectionPortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "PortAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "ConnectionRequest", GT_ARG_HEX, GT_ARG_IN },
+	{ "ConnectionMessageAttributes", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "AcceptConnection", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "MessageContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "PortName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "PortAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "RequiredServerSid", GT_ARG_HEX, GT_ARG_IN },
+	{ "ConnectionMessage", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "BufferLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "OutMessageAttributes", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "InMessageAttributes", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "PortAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "SectionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SectionSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "AlpcSectionHandle", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ActualSectionSize", GT_ARG_HEX, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "MessageSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceId", GT_ARG_HEX, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ViewAttributes", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SecurityAttribute", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SectionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ResourceId", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ViewBase", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ContextHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "Reserved", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ProcessHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "MessageInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "MessageInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ContextHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "SendMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "SendMessageAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReceiveMessage", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "BufferLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "ReceiveMessageAttributes", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "type", GT_ARG_HEX, GT_ARG_IN },
+	{ "buf", GT_ARG_HEX, GT_ARG_IN },
+	{ "File1MappedAsAnImage", GT_ARG_HEX, GT_ARG_IN },
+	{ "File2MappedAsFile", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutputBuffer", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutputLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "Status", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoRequestToCancel", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoRequestToCancel", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "TimerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "CurrentState", GT_ARG_HEX, GT_ARG_OUT },
+	{ "EventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Handle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "HandleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "GenerateOnClose", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Wait", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Count", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyArray[]", GT_ARG_HEX, GT_ARG_NONE },
+	{ "FirstTokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SecondTokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Equal", GT_ARG_HEX, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Key", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "PortName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SecurityQos", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientView", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "ServerView", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "MaxMessageLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ConnectionInformation", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "ConnectionInformationLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "ContextRecord", GT_ARG_HEX, GT_ARG_OUT },
+	{ "TestAlert", GT_ARG_BOOLEAN, GT_ARG_OUT },
+	{ "DebugObjectHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_OUT },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_OUT },
+	{ "Flags", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DirectoryHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ResourceManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "NotificationMask", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentKey", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "EventType", GT_ARG_HEX, GT_ARG_IN },
+	{ "InitialState", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "EventPairHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "AllocationSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "ShareAccess", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateDisposition", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "EaBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "EaLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Count", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "NumJob", GT_ARG_HEX, GT_ARG_IN },
+	{ "UserJobSet", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyedEventHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "TitleIndex", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Class", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "Disposition", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "KeyHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "TitleIndex", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Class", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Disposition", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "FileHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "MailslotQuota", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaximumMessageSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReadTimeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "MutantHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "InitialOwner", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ShareAccess", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateDisposition", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "NamedPipeType", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReadMode", GT_ARG_HEX, GT_ARG_IN },
+	{ "CompletionMode", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaximumInstances", GT_ARG_HEX, GT_ARG_IN },
+	{ "InboundQuota", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutboundQuota", GT_ARG_HEX, GT_ARG_IN },
+	{ "DefaultTimeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "PageFileName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "MinimumSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaximumSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "Priority", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "MaxConnectionInfoLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaxMessageLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaxPoolUsage", GT_ARG_HEX, GT_ARG_IN },
+	{ "NamespaceHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "BoundaryDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ParentProcess", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "SectionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DebugPort", GT_ARG_HEX, GT_ARG_IN },
+	{ "ExceptionPort", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobMemberLevel", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ParentProcess", GT_ARG_HEX, GT_ARG_IN },
+	{ "InheritObjectTable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "SectionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DebugPort", GT_ARG_HEX, GT_ARG_IN },
+	{ "ExceptionPort", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProfileHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "Process", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProfileBase", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProfileSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "BucketSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_PULONG, GT_ARG_IN },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProfileSource", GT_ARG_HEX, GT_ARG_IN },
+	{ "GroupAffinityCount", GT_ARG_HEX, GT_ARG_IN },
+	{ "GroupAffinity", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProfileHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "Process", GT_ARG_HEX, GT_ARG_IN },
+	{ "RangeBase", GT_ARG_HEX, GT_ARG_IN },
+	{ "RangeSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "BucketSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_PULONG, GT_ARG_IN },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProfileSource", GT_ARG_HEX, GT_ARG_IN },
+	{ "Affinity", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "TmHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "RmGuid", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "Description", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SectionHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "MaximumSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "SectionPageProtection", GT_ARG_HEX, GT_ARG_IN },
+	{ "AllocationAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SemaphoreHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "InitialCount", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaximumCount", GT_ARG_HEX, GT_ARG_IN },
+	{ "LinkHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "LinkTarget", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "StartRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "Argument", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateFlags", GT_ARG_HEX, GT_ARG_IN },
+	{ "ZeroBits", GT_ARG_HEX, GT_ARG_IN },
+	{ "StackSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaximumStackSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "AttributeList", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientId", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ThreadContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "InitialTeb", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateSuspended", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "TimerHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "TimerType", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "TokenType", GT_ARG_HEX, GT_ARG_IN },
+	{ "AuthenticationId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ExpirationTime", GT_ARG_HEX, GT_ARG_IN },
+	{ "User", GT_ARG_HEX, GT_ARG_IN },
+	{ "Groups", GT_ARG_HEX, GT_ARG_IN },
+	{ "Privileges", GT_ARG_HEX, GT_ARG_IN },
+	{ "Owner", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrimaryGroup", GT_ARG_HEX, GT_ARG_IN },
+	{ "DefaultDacl", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenSource", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "LogFileName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "CommitStrength", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Uow", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "IsolationLevel", GT_ARG_HEX, GT_ARG_IN },
+	{ "IsolationFlags", GT_ARG_HEX, GT_ARG_IN },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "Description", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ThreadHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ProcessDesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ThreadDesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ProcessObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ThreadObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ProcessFlags", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadFlags", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessParameters", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateInfo", GT_ARG_HEX, GT_ARG_IN },
+	{ "AttributeList", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "MaxConnectionInfoLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaxMessageLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaxPoolUsage", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryHandleReturn", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "CompletionPortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "StartRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "StartParameter", GT_ARG_HEX, GT_ARG_IN },
+	{ "MaxThreadCount", GT_ARG_HEX, GT_ARG_IN },
+	{ "StackReserve", GT_ARG_HEX, GT_ARG_IN },
+	{ "StackCommit", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DebugObjectHandle", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DebugObjectHandle", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ClientId", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ContinueStatus", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "DelayInterval", GT_ARG_HEX, GT_ARG_IN },
+	{ "Atom", GT_ARG_HEX, GT_ARG_IN },
+	{ "Id", GT_ARG_HEX, GT_ARG_IN },
+	{ "Id", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "HandleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "GenerateOnClose", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "NamespaceHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ValueName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "IoControlCode", GT_ARG_HEX, GT_ARG_IN },
+	{ "InputBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "InputBufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutputBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "OutputBufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "String", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "Text", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SourceProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SourceHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TargetProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TargetHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "HandleAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "Options", GT_ARG_HEX, GT_ARG_IN },
+	{ "ExistingTokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "EffectiveOnly", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "TokenType", GT_ARG_HEX, GT_ARG_IN },
+	{ "NewTokenHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Index", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResultLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "InformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_OUT },
+	{ "BufferLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "RootObjectHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "QueryType", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectCursor", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ObjectCursorLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Index", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyValueInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyValueInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResultLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "SectionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "NewSectionSize", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "ExistingTokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "SidsToDisable", GT_ARG_HEX, GT_ARG_IN },
+	{ "PrivilegesToDelete", GT_ARG_HEX, GT_ARG_IN },
+	{ "RestrictedSids", GT_ARG_HEX, GT_ARG_IN },
+	{ "NewTokenHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "AtomName", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "Atom", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "InstallUILanguage", GT_ARG_HEX, GT_ARG_IN },
+	{ "SetComittedFlag", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "BaseAddress", GT_ARG_HEX, GT_ARG_IN },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "RegionSize", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "IoStatus", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumberOfPages", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "UserPfnArray", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "RegionSize", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "FreeType", GT_ARG_HEX, GT_ARG_IN },
+	{ "TimeOutInSeconds", GT_ARG_HEX, GT_ARG_IN },
+	{ "FreezeTimeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThawTimeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "IoControlCode", GT_ARG_HEX, GT_ARG_IN },
+	{ "InputBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "InputBufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutputBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "OutputBufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadContext", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "Device", GT_ARG_HEX, GT_ARG_IN },
+	{ "*State", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "DataSize", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "Data", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "HandleAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "NewProcessHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "HandleAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "NewThreadHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "SectionType", GT_ARG_HEX, GT_ARG_IN },
+	{ "SectionData", GT_ARG_HEX, GT_ARG_IN },
+	{ "ContextData", GT_ARG_HEX, GT_ARG_IN },
+	{ "*SectionPointer", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SectionSize", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ResourceManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionNotification", GT_ARG_HEX, GT_ARG_OUT },
+	{ "NotificationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Asynchronous", GT_ARG_HEX, GT_ARG_IN },
+	{ "AsynchronousContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Context", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventBlock", GT_ARG_HEX, GT_ARG_NONE },
+	{ "EventBufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "BaseAddress", GT_ARG_HEX, GT_ARG_IN },
+	{ "RegionSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "*UserAddressArray", GT_ARG_HEX, GT_ARG_NONE },
+	{ "EntriesInUserAddressArray", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "Granularity", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Message", GT_ARG_HEX, GT_ARG_IN },
+	{ "ServerThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SecurityQos", GT_ARG_HEX, GT_ARG_IN },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DefaultLocaleId", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DefaultCasingTableSize", GT_ARG_HEX, GT_ARG_OUT },
+	{ "BootCondition", GT_ARG_HEX, GT_ARG_IN },
+	{ "SystemAction", GT_ARG_HEX, GT_ARG_IN },
+	{ "MinSystemState", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "Asynchronous", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ConnectionRequest", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DriverServiceName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "TargetKey", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "SourceFile", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "TargetKey", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "SourceFile", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "TrustClassKey", GT_ARG_HEX, GT_ARG_IN },
+	{ "TargetKey", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "SourceFile", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ByteOffset", GT_ARG_HEX, GT_ARG_IN },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "Key", GT_ARG_HEX, GT_ARG_IN },
+	{ "FailImmediately", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "ExclusiveLock", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "*pPrivateVer", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "*pSafeMode", GT_ARG_HEX, GT_ARG_OUT },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "RegionSize", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "MapType", GT_ARG_HEX, GT_ARG_IN },
+	{ "Handle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Handle", GT_ARG_HEX, GT_ARG_IN },
+	{ "What", GT_ARG_HEX, GT_ARG_IN },
+	{ "Index", GT_ARG_HEX, GT_ARG_IN },
+	{ "CacheIndexOut", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "CacheFlagsOut", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ViewSizeOut", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_OUT },
+	{ "VirtualAddress", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumberOfPages", GT_ARG_HEX, GT_ARG_IN },
+	{ "UserPfnArray", GT_ARG_HEX, GT_ARG_NONE },
+	{ "*VirtualAddresses", GT_ARG_HEX, GT_ARG_NONE },
+	{ "NumberOfPages", GT_ARG_HEX, GT_ARG_IN },
+	{ "UserPfnArray", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SectionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "ZeroBits", GT_ARG_HEX, GT_ARG_IN },
+	{ "CommitSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "SectionOffset", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "ViewSize", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "InheritDisposition", GT_ARG_HEX, GT_ARG_IN },
+	{ "AllocationType", GT_ARG_HEX, GT_ARG_IN },
+	{ "Win32Protect", GT_ARG_HEX, GT_ARG_IN },
+	{ "BootEntry", GT_ARG_HEX, GT_ARG_IN },
+	{ "DriverEntry", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "CompletionFilter", GT_ARG_HEX, GT_ARG_IN },
+	{ "WatchTree", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "CompletionFilter", GT_ARG_HEX, GT_ARG_IN },
+	{ "WatchTree", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "Asynchronous", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "MasterKeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Count", GT_ARG_HEX, GT_ARG_IN },
+	{ "SlaveObjects[]", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "CompletionFilter", GT_ARG_HEX, GT_ARG_IN },
+	{ "WatchTree", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "Asynchronous", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Session", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStateSequence", GT_ARG_HEX, GT_ARG_IN },
+	{ "Reserved", GT_ARG_HEX, GT_ARG_IN },
+	{ "Action", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoState", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoState2", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_IN },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "DirectoryHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ResourceManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentGuid", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "EventHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "EventPairHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ShareAccess", GT_ARG_HEX, GT_ARG_IN },
+	{ "OpenOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "JobHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "KeyedEventHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "OpenOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "OpenOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "MutantHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "HandleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectTypeName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ObjectName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientToken", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "GrantedAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "Privileges", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectCreation", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "AccessGranted", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "GenerateOnClose", GT_ARG_HEX, GT_ARG_OUT },
+	{ "NamespaceHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "BoundaryDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ClientId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "HandleAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "TokenHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ResourceManagerHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "TmHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerGuid", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "SectionHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "SemaphoreHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "SessionHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "LinkHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "ClientId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "OpenAsSelf", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "HandleAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "OpenAsSelf", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "TokenHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "TimerHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "TmHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "LogFileName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "TmIdentity", GT_ARG_HEX, GT_ARG_IN },
+	{ "OpenOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Uow", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PnPControlClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "PnPControlData", GT_ARG_HEX, GT_ARG_NONE },
+	{ "PnPControlDataLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "InformationLevel", GT_ARG_HEX, GT_ARG_IN },
+	{ "InputBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "InputBufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutputBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "OutputBufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientToken", GT_ARG_HEX, GT_ARG_IN },
+	{ "RequiredPrivileges", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "Result", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ServiceName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ClientToken", GT_ARG_HEX, GT_ARG_IN },
+	{ "Privileges", GT_ARG_HEX, GT_ARG_IN },
+	{ "AccessGranted", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "SubsystemName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "HandleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientToken", GT_ARG_HEX, GT_ARG_IN },
+	{ "DesiredAccess", GT_ARG_ACCESS_MASK, GT_ARG_IN },
+	{ "Privileges", GT_ARG_HEX, GT_ARG_IN },
+	{ "AccessGranted", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "ResourceManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "RequestCookie", GT_ARG_HEX, GT_ARG_IN },
+	{ "BufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "RequestCookie", GT_ARG_HEX, GT_ARG_IN },
+	{ "PropStatus", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "RegionSize", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "NewProtectWin32", GT_ARG_HEX, GT_ARG_IN },
+	{ "OldProtect", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "EventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousState", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "FileInformation", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Ids", GT_ARG_PULONG, GT_ARG_NONE },
+	{ "Count", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "BootOptions", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BootOptionsLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "ComponentId", GT_ARG_HEX, GT_ARG_IN },
+	{ "Level", GT_ARG_HEX, GT_ARG_IN },
+	{ "UserProfile", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "DefaultLocaleId", GT_ARG_HEX, GT_ARG_OUT },
+	{ "*DefaultUILanguageId", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FileInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnSingleEntry", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "FileName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "RestartScan", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "DirectoryHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnSingleEntry", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "RestartScan", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Context", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Ids", GT_ARG_PULONG, GT_ARG_NONE },
+	{ "Count", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnSingleEntry", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "EaList", GT_ARG_HEX, GT_ARG_NONE },
+	{ "EaListLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "EaIndex", GT_ARG_PULONG, GT_ARG_IN },
+	{ "RestartScan", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "EventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "EventInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ObjectAttributes", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "FileInformation", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Atom", GT_ARG_HEX, GT_ARG_IN },
+	{ "InformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "AtomInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "AtomInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "EnlistmentInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FileInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobObjectInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobObjectInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "JobObjectInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ProcessInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ResourceManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ResourceManagerInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ThreadInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "TokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "TokenInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "TransactionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "TransactionInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "TransactionManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionManagerInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionManagerInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "TransactionManagerInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "WorkerFactoryHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "WorkerFactoryInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "*InstallUILanguageId", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ProfileSource", GT_ARG_HEX, GT_ARG_IN },
+	{ "Interval", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "IoCompletionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "IoCompletionInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResultLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Name", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "Type", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnedLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ValueEntries", GT_ARG_HEX, GT_ARG_NONE },
+	{ "EntryCount", GT_ARG_HEX, GT_ARG_IN },
+	{ "ValueBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "RequiredBufferLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "MutantHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "MutantInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "MutantInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "MutantInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Handle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ObjectInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "TargetKey", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "BufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "RequiredSize", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "TargetKey", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "HandleCount", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "PerformanceCounter", GT_ARG_HEX, GT_ARG_OUT },
+	{ "PerformanceFrequency", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnSingleEntry", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "SidList", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SidListLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "StartSid", GT_ARG_PULONG, GT_ARG_IN },
+	{ "RestartScan", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "SectionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SectionInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "SectionInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SectionInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_HEX, GT_ARG_OUT },
+	{ "TokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Attributes", GT_ARG_UNICODE_STRING, GT_ARG_NONE },
+	{ "NumberOfAttributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Handle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SecurityInformation", GT_ARG_HEX, GT_ARG_IN },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "LengthNeeded", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "SemaphoreHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SemaphoreInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "SemaphoreInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SemaphoreInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "LinkHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "LinkTarget", GT_ARG_UNICODE_STRING, GT_ARG_INOUT },
+	{ "ReturnedLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "VariableName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "VendorGuid", GT_ARG_HEX, GT_ARG_IN },
+	{ "Value", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ValueLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "Attributes", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "VariableName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "VariableValue", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ValueLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SystemInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "QueryInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "QueryInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "SystemInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SystemInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "SystemInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "SystemInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SystemInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "SystemTime", GT_ARG_HEX, GT_ARG_OUT },
+	{ "TimerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TimerInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "TimerInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "TimerInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "MaximumTime", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "MinimumTime", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "CurrentTime", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ValueName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "KeyValueInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyValueInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResultLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "BaseAddress", GT_ARG_HEX, GT_ARG_IN },
+	{ "MemoryInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "MemoryInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "MemoryInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FsInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "FsInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "UserApcReserveHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcArgument1", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcArgument2", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcArgument3", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcArgument1", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcArgument2", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcArgument3", GT_ARG_HEX, GT_ARG_IN },
+	{ "ExceptionRecord", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ContextRecord", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FirstChance", GT_ARG_BOOLEAN, GT_ARG_OUT },
+	{ "ErrorStatus", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumberOfParameters", GT_ARG_HEX, GT_ARG_IN },
+	{ "UnicodeStringParameterMask", GT_ARG_HEX, GT_ARG_IN },
+	{ "Parameters", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ValidResponseOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "Response", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ByteOffset", GT_ARG_HEX, GT_ARG_IN },
+	{ "Key", GT_ARG_PULONG, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SegmentArray", GT_ARG_HEX, GT_ARG_IN },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ByteOffset", GT_ARG_HEX, GT_ARG_IN },
+	{ "Key", GT_ARG_PULONG, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Message", GT_ARG_HEX, GT_ARG_IN },
+	{ "DataEntryIndex", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumberOfBytesRead", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "BaseAddress", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumberOfBytesRead", GT_ARG_HEX, GT_ARG_OUT },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentKey", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManager", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProtocolId", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProtocolInformationSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProtocolInformation", GT_ARG_HEX, GT_ARG_IN },
+	{ "CreateOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyedEventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyValue", GT_ARG_HEX, GT_ARG_IN },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "MutantHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousCount", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SemaphoreHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReleaseCount", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousCount", GT_ARG_HEX, GT_ARG_OUT },
+	{ "WorkerFactoryHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Count", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumEntriesRemoved", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "IoCompletionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*KeyContext", GT_ARG_HEX, GT_ARG_OUT },
+	{ "*ApcContext", GT_ARG_HEX, GT_ARG_OUT },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DebugObjectHandle", GT_ARG_HEX, GT_ARG_OUT },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "NewName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "LogFileName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "ExistingTransactionManagerGuid", GT_ARG_HEX, GT_ARG_IN },
+	{ "NewFile", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "TargetHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "OldFile", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "TargetInstancePath", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SpareInstancePath", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReplyMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*PortContext", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ReplyMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReceiveMessage", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*PortContext", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ReplyMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReceiveMessage", GT_ARG_HEX, GT_ARG_OUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReplyMessage", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "RequestMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "RequestMessage", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReplyMessage", GT_ARG_HEX, GT_ARG_OUT },
+	{ "EventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousState", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "BaseAddress", GT_ARG_HEX, GT_ARG_IN },
+	{ "RegionSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousSuspendCount", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Wait", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "TransactionManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Format", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "HighPrecedenceKeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "LowPrecedenceKeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_PHANDLE, GT_ARG_OUT },
+	{ "PortName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SecurityQos", GT_ARG_HEX, GT_ARG_IN },
+	{ "ClientView", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "RequiredServerSid", GT_ARG_HEX, GT_ARG_IN },
+	{ "ServerView", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "MaxMessageLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "ConnectionInformation", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "ConnectionInformationLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "Ids", GT_ARG_PULONG, GT_ARG_NONE },
+	{ "Count", GT_ARG_HEX, GT_ARG_IN },
+	{ "BootOptions", GT_ARG_HEX, GT_ARG_IN },
+	{ "FieldsToChange", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "ComponentId", GT_ARG_HEX, GT_ARG_IN },
+	{ "Level", GT_ARG_HEX, GT_ARG_IN },
+	{ "State", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "DefaultHardErrorPort", GT_ARG_HEX, GT_ARG_IN },
+	{ "UserProfile", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "DefaultLocaleId", GT_ARG_HEX, GT_ARG_IN },
+	{ "DefaultUILanguageId", GT_ARG_HEX, GT_ARG_IN },
+	{ "Ids", GT_ARG_PULONG, GT_ARG_NONE },
+	{ "Count", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousState", GT_ARG_HEX, GT_ARG_OUT },
+	{ "EventPairHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventPairHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DebugObjectHandle", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DebugObjectInformationClass", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DebugInformation", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DebugInformationLength", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "EnlistmentInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FileInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobObjectInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "JobObjectInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "JobObjectInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeySetInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeySetInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "KeySetInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "Handle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ObjectInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ObjectInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ProcessInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ResourceManagerInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ResourceManagerInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ThreadInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "TokenInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "TokenInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "TransactionInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionManagerInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "TransactionManagerInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "TransactionManagerInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "WorkerFactoryInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "Interval", GT_ARG_HEX, GT_ARG_IN },
+	{ "Source", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionReserveHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatus", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusInformation", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoCompletionHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatus", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusInformation", GT_ARG_HEX, GT_ARG_IN },
+	{ "Selector0", GT_ARG_HEX, GT_ARG_IN },
+	{ "Entry0Low", GT_ARG_HEX, GT_ARG_IN },
+	{ "Entry0Hi", GT_ARG_HEX, GT_ARG_IN },
+	{ "Selector1", GT_ARG_HEX, GT_ARG_IN },
+	{ "Entry1Low", GT_ARG_HEX, GT_ARG_IN },
+	{ "Entry1Hi", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventPairHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventPairHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "Handle", GT_ARG_HEX, GT_ARG_IN },
+	{ "SecurityInformation", GT_ARG_HEX, GT_ARG_IN },
+	{ "SecurityDescriptor", GT_ARG_HEX, GT_ARG_IN },
+	{ "VariableName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "VendorGuid", GT_ARG_HEX, GT_ARG_IN },
+	{ "Value", GT_ARG_HEX, GT_ARG_NONE },
+	{ "ValueLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "Attributes", GT_ARG_HEX, GT_ARG_IN },
+	{ "VariableName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "VariableValue", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "SystemInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "SystemInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "SystemInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "SystemAction", GT_ARG_HEX, GT_ARG_IN },
+	{ "MinSystemState", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "SystemTime", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousTime", GT_ARG_HEX, GT_ARG_OUT },
+	{ "esFlags", GT_ARG_HEX, GT_ARG_IN },
+	{ "*PreviousFlags", GT_ARG_HEX, GT_ARG_OUT },
+	{ "TimerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TimerSetInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "TimerSetInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "TimerSetInformationLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "TimerHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "DueTime", GT_ARG_HEX, GT_ARG_IN },
+	{ "TimerApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "TimerContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "WakeTimer", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Period", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousState", GT_ARG_HEX, GT_ARG_OUT },
+	{ "DesiredTime", GT_ARG_HEX, GT_ARG_IN },
+	{ "SetResolution", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "ActualTime", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Seed", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ValueName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "TitleIndex", GT_ARG_HEX, GT_ARG_IN },
+	{ "Type", GT_ARG_HEX, GT_ARG_IN },
+	{ "Data", GT_ARG_HEX, GT_ARG_NONE },
+	{ "DataSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "FsInformation", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "FsInformationClass", GT_ARG_HEX, GT_ARG_IN },
+	{ "Action", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*PendingWorkerCount", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "SignalHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "WaitHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "EnlistmentHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "TmVirtualClock", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProfileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProfileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "PreviousSuspendCount", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "Command", GT_ARG_HEX, GT_ARG_IN },
+	{ "InputBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "InputBufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutputBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "OutputBufferLength", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "JobHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ExitStatus", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ExitStatus", GT_ARG_HEX, GT_ARG_IN },
+	{ "ThreadHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "ExitStatus", GT_ARG_HEX, GT_ARG_IN },
+	{ "FunctionCode", GT_ARG_HEX, GT_ARG_IN },
+	{ "InBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "InBufferLen", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutBuffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "OutBufferLen", GT_ARG_HEX, GT_ARG_IN },
+	{ "ReturnLength", GT_ARG_PULONG, GT_ARG_OUT },
+	{ "TraceHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "FieldSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "Fields", GT_ARG_HEX, GT_ARG_IN },
+	{ "InputFilePath", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutputType", GT_ARG_HEX, GT_ARG_IN },
+	{ "OutputFilePath", GT_ARG_HEX, GT_ARG_NONE },
+	{ "OutputFilePathLength", GT_ARG_PULONG, GT_ARG_INOUT },
+	{ "SchedulerParam", GT_ARG_HEX, GT_ARG_IN },
+	{ "DriverServiceName", GT_ARG_UNICODE_STRING, GT_ARG_IN },
+	{ "TargetKey", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Flags", GT_ARG_HEX, GT_ARG_IN },
+	{ "TargetKey", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "TargetKey", GT_ARG_OBJECT_ATTRIBUTES, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ByteOffset", GT_ARG_HEX, GT_ARG_IN },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "Key", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "*BaseAddress", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "RegionSize", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "MapType", GT_ARG_HEX, GT_ARG_IN },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "BaseAddress", GT_ARG_HEX, GT_ARG_IN },
+	{ "Service", GT_ARG_HEX, GT_ARG_IN },
+	{ "ServiceData", GT_ARG_HEX, GT_ARG_INOUT },
+	{ "DebugObjectHandle", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_OUT },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_OUT },
+	{ "WaitStateChange", GT_ARG_HEX, GT_ARG_OUT },
+	{ "KeyedEventHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "KeyValue", GT_ARG_HEX, GT_ARG_IN },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "Count", GT_ARG_HEX, GT_ARG_IN },
+	{ "Handles[]", GT_ARG_HEX, GT_ARG_NONE },
+	{ "WaitType", GT_ARG_HEX, GT_ARG_IN },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "Count", GT_ARG_HEX, GT_ARG_IN },
+	{ "Handles[]", GT_ARG_HEX, GT_ARG_NONE },
+	{ "WaitType", GT_ARG_HEX, GT_ARG_IN },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "Handle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Alertable", GT_ARG_BOOLEAN, GT_ARG_IN },
+	{ "Timeout", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "MiniPacket", GT_ARG_HEX, GT_ARG_OUT },
+	{ "EventPairHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "EventPairHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "WorkerFactoryHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "SegmentArray", GT_ARG_HEX, GT_ARG_IN },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ByteOffset", GT_ARG_HEX, GT_ARG_IN },
+	{ "Key", GT_ARG_PULONG, GT_ARG_IN },
+	{ "FileHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Event", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcRoutine", GT_ARG_HEX, GT_ARG_IN },
+	{ "ApcContext", GT_ARG_HEX, GT_ARG_IN },
+	{ "IoStatusBlock", GT_ARG_HEX, GT_ARG_OUT },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "Length", GT_ARG_HEX, GT_ARG_IN },
+	{ "ByteOffset", GT_ARG_HEX, GT_ARG_IN },
+	{ "Key", GT_ARG_PULONG, GT_ARG_IN },
+	{ "PortHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "Message", GT_ARG_HEX, GT_ARG_IN },
+	{ "DataEntryIndex", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumberOfBytesWritten", GT_ARG_HEX, GT_ARG_OUT },
+	{ "ProcessHandle", GT_ARG_HEX, GT_ARG_IN },
+	{ "BaseAddress", GT_ARG_HEX, GT_ARG_IN },
+	{ "Buffer", GT_ARG_HEX, GT_ARG_NONE },
+	{ "BufferSize", GT_ARG_HEX, GT_ARG_IN },
+	{ "NumberOfBytesWritten", GT_ARG_HEX, GT_ARG_OUT },
+};
 
-void gt_windows_print_sysret_ntyieldexecution(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, gt_tid_t tid, void *data)
-{
-	uint64_t *args = (uint64_t*)data;
-	char *proc = get_process_name(vmi, pid);
+static const gt_syscall_desc WINDOWS_SYSCALL_DESCS[] = {
+	{ "NtAcceptConnectPort", &WINDOWS_SYSCALL_ARGS[0], 6, 0 },
+	{ "NtAccessCheckAndAuditAlarm", &WINDOWS_SYSCALL_ARGS[6], 11, 0 },
+	{ "NtAccessCheckByTypeAndAuditAlarm", &WINDOWS_SYSCALL_ARGS[17], 16, 0 },
+	{ "NtAccessCheckByType", &WINDOWS_SYSCALL_ARGS[33], 11, 0 },
+	{ "NtAccessCheckByTypeResultListAndAuditAlarmByHandle", &WINDOWS_SYSCALL_ARGS[44], 17, 0 },
+	{ "NtAccessCheckByTypeResultListAndAuditAlarm", &WINDOWS_SYSCALL_ARGS[61], 16, 0 },
+	{ "NtAccessCheckByTypeResultList", &WINDOWS_SYSCALL_ARGS[77], 11, 0 },
+	{ "NtAccessCheck", &WINDOWS_SYSCALL_ARGS[88], 8, 0 },
+	{ "NtAddAtom", &WINDOWS_SYSCALL_ARGS[96], 3, 0 },
+	{ "NtAddBootEntry", &WINDOWS_SYSCALL_ARGS[99], 2, 0 },
+	{ "NtAddDriverEntry", &WINDOWS_SYSCALL_ARGS[101], 2, 0 },
+	{ "NtAdjustGroupsToken", &WINDOWS_SYSCALL_ARGS[103], 6, 0 },
+	{ "NtAdjustPrivilegesToken", &WINDOWS_SYSCALL_ARGS[109], 6, 0 },
+	{ "NtAlertResumeThread", &WINDOWS_SYSCALL_ARGS[115], 2, 0 },
+	{ "NtAlertThread", &WINDOWS_SYSCALL_ARGS[117], 1, 0 },
+	{ "NtAllocateLocallyUniqueId", &WINDOWS_SYSCALL_ARGS[118], 1, 0 },
+	{ "NtAllocateReserveObject", &WINDOWS_SYSCALL_ARGS[119], 3, 0 },
+	{ "NtAllocateUserPhysicalPages", &WINDOWS_SYSCALL_ARGS[122], 3, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "NtAllocateUuids", &WINDOWS_SYSCALL_ARGS[125], 4, 0 },
+	{ "NtAllocateVirtualMemory", &WINDOWS_SYSCALL_ARGS[129], 6, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "NtAlpcAcceptConnectPort", &WINDOWS_SYSCALL_ARGS[135], 9, 0 },
+	{ "NtAlpcCancelMessage", &WINDOWS_SYSCALL_ARGS[144], 3, 0 },
+	{ "NtAlpcConnectPort", &WINDOWS_SYSCALL_ARGS[147], 11, 0 },
+	{ "NtAlpcCreatePort", &WINDOWS_SYSCALL_ARGS[158], 3, 0 },
+	{ "NtAlpcCreatePortSection", &WINDOWS_SYSCALL_ARGS[161], 6, 0 },
+	{ "NtAlpcCreateResourceReserve", &WINDOWS_SYSCALL_ARGS[167], 4, 0 },
+	{ "NtAlpcCreateSectionView", &WINDOWS_SYSCALL_ARGS[171], 3, 0 },
+	{ "NtAlpcCreateSecurityContext", &WINDOWS_SYSCALL_ARGS[174], 3, 0 },
+	{ "NtAlpcDeletePortSection", &WINDOWS_SYSCALL_ARGS[177], 3, 0 },
+	{ "NtAlpcDeleteResourceReserve", &WINDOWS_SYSCALL_ARGS[180], 3, 0 },
+	{ "NtAlpcDeleteSectionView", &WINDOWS_SYSCALL_ARGS[183], 3, 0 },
+	{ "NtAlpcDeleteSecurityContext", &WINDOWS_SYSCALL_ARGS[186], 3, 0 },
+	{ "NtAlpcDisconnectPort", &WINDOWS_SYSCALL_ARGS[189], 2, 0 },
+	{ "NtAlpcImpersonateClientOfPort", &WINDOWS_SYSCALL_ARGS[191], 3, 0 },
+	{ "NtAlpcOpenSenderProcess", &WINDOWS_SYSCALL_ARGS[194], 6, 0 },
+	{ "NtAlpcOpenSenderThread", &WINDOWS_SYSCALL_ARGS[200], 6, 0 },
+	{ "NtAlpcQueryInformation", &WINDOWS_SYSCALL_ARGS[206], 5, 0 },
+	{ "NtAlpcQueryInformationMessage", &WINDOWS_SYSCALL_ARGS[211], 6, 0 },
+	{ "NtAlpcRevokeSecurityContext", &WINDOWS_SYSCALL_ARGS[217], 3, 0 },
+	{ "NtAlpcSendWaitReceivePort", &WINDOWS_SYSCALL_ARGS[220], 8, 0 },
+	{ "NtAlpcSetInformation", &WINDOWS_SYSCALL_ARGS[228], 4, 0 },
+	{ "NtApphelpCacheControl", &WINDOWS_SYSCALL_ARGS[232], 2, 0 },
+	{ "NtAreMappedFilesTheSame", &WINDOWS_SYSCALL_ARGS[234], 2, 0 },
+	{ "NtAssignProcessToJobObject", &WINDOWS_SYSCALL_ARGS[236], 2, 0 },
+	{ "NtCallbackReturn", &WINDOWS_SYSCALL_ARGS[238], 3, 0 },
+	{ "NtCancelIoFileEx", &WINDOWS_SYSCALL_ARGS[241], 3, 0 },
+	{ "NtCancelIoFile", &WINDOWS_SYSCALL_ARGS[244], 2, 0 },
+	{ "NtCancelSynchronousIoFile", &WINDOWS_SYSCALL_ARGS[246], 3, 0 },
+	{ "NtCancelTimer", &WINDOWS_SYSCALL_ARGS[249], 2, 0 },
+	{ "NtClearEvent", &WINDOWS_SYSCALL_ARGS[251], 1, 0 },
+	{ "NtClose", &WINDOWS_SYSCALL_ARGS[252], 1, 0 },
+	{ "NtCloseObjectAuditAlarm", &WINDOWS_SYSCALL_ARGS[253], 3, 0 },
+	{ "NtCommitComplete", &WINDOWS_SYSCALL_ARGS[256], 2, 0 },
+	{ "NtCommitEnlistment", &WINDOWS_SYSCALL_ARGS[258], 2, 0 },
+	{ "NtCommitTransaction", &WINDOWS_SYSCALL_ARGS[260], 2, 0 },
+	{ "NtCompactKeys", &WINDOWS_SYSCALL_ARGS[262], 2, 0 },
+	{ "NtCompareTokens", &WINDOWS_SYSCALL_ARGS[264], 3, 0 },
+	{ "NtCompleteConnectPort", &WINDOWS_SYSCALL_ARGS[267], 1, 0 },
+	{ "NtCompressKey", &WINDOWS_SYSCALL_ARGS[268], 1, 0 },
+	{ "NtConnectPort", &WINDOWS_SYSCALL_ARGS[269], 8, 0 },
+	{ "NtContinue", &WINDOWS_SYSCALL_ARGS[277], 2, 0 },
+	{ "NtCreateDebugObject", &WINDOWS_SYSCALL_ARGS[279], 4, 0 },
+	{ "NtCreateDirectoryObject", &WINDOWS_SYSCALL_ARGS[283], 3, 0 },
+	{ "NtCreateEnlistment", &WINDOWS_SYSCALL_ARGS[286], 8, 0 },
+	{ "NtCreateEvent", &WINDOWS_SYSCALL_ARGS[294], 5, 0 },
+	{ "NtCreateEventPair", &WINDOWS_SYSCALL_ARGS[299], 3, 0 },
+	{ "NtCreateFile", &WINDOWS_SYSCALL_ARGS[302], 11, 0 },
+	{ "NtCreateIoCompletion", &WINDOWS_SYSCALL_ARGS[313], 4, 0 },
+	{ "NtCreateJobObject", &WINDOWS_SYSCALL_ARGS[317], 3, 0 },
+	{ "NtCreateJobSet", &WINDOWS_SYSCALL_ARGS[320], 3, 0 },
+	{ "NtCreateKeyedEvent", &WINDOWS_SYSCALL_ARGS[323], 4, 0 },
+	{ "NtCreateKey", &WINDOWS_SYSCALL_ARGS[327], 7, 0 },
+	{ "NtCreateKeyTransacted", &WINDOWS_SYSCALL_ARGS[334], 8, 0 },
+	{ "NtCreateMailslotFile", &WINDOWS_SYSCALL_ARGS[342], 8, 0 },
+	{ "NtCreateMutant", &WINDOWS_SYSCALL_ARGS[350], 4, 0 },
+	{ "NtCreateNamedPipeFile", &WINDOWS_SYSCALL_ARGS[354], 14, 0 },
+	{ "NtCreatePagingFile", &WINDOWS_SYSCALL_ARGS[368], 4, 0 },
+	{ "NtCreatePort", &WINDOWS_SYSCALL_ARGS[372], 5, 0 },
+	{ "NtCreatePrivateNamespace", &WINDOWS_SYSCALL_ARGS[377], 4, 0 },
+	{ "NtCreateProcessEx", &WINDOWS_SYSCALL_ARGS[381], 9, 0 },
+	{ "NtCreateProcess", &WINDOWS_SYSCALL_ARGS[390], 8, 0 },
+	{ "NtCreateProfileEx", &WINDOWS_SYSCALL_ARGS[398], 10, 0 },
+	{ "NtCreateProfile", &WINDOWS_SYSCALL_ARGS[408], 9, 0 },
+	{ "NtCreateResourceManager", &WINDOWS_SYSCALL_ARGS[417], 7, 0 },
+	{ "NtCreateSection", &WINDOWS_SYSCALL_ARGS[424], 7, 0 },
+	{ "NtCreateSemaphore", &WINDOWS_SYSCALL_ARGS[431], 5, 0 },
+	{ "NtCreateSymbolicLinkObject", &WINDOWS_SYSCALL_ARGS[436], 4, 0 },
+	{ "NtCreateThreadEx", &WINDOWS_SYSCALL_ARGS[440], 11, 0 },
+	{ "NtCreateThread", &WINDOWS_SYSCALL_ARGS[451], 8, 0 },
+	{ "NtCreateTimer", &WINDOWS_SYSCALL_ARGS[459], 4, 0 },
+	{ "NtCreateToken", &WINDOWS_SYSCALL_ARGS[463], 13, 0 },
+	{ "NtCreateTransactionManager", &WINDOWS_SYSCALL_ARGS[476], 6, 0 },
+	{ "NtCreateTransaction", &WINDOWS_SYSCALL_ARGS[482], 10, 0 },
+	{ "NtCreateUserProcess", &WINDOWS_SYSCALL_ARGS[492], 11, 0 },
+	{ "NtCreateWaitablePort", &WINDOWS_SYSCALL_ARGS[503], 5, 0 },
+	{ "NtCreateWorkerFactory", &WINDOWS_SYSCALL_ARGS[508], 10, 0 },
+	{ "NtDebugActiveProcess", &WINDOWS_SYSCALL_ARGS[518], 2, 0 },
+	{ "NtDebugContinue", &WINDOWS_SYSCALL_ARGS[520], 3, 0 },
+	{ "NtDelayExecution", &WINDOWS_SYSCALL_ARGS[523], 2, 0 },
+	{ "NtDeleteAtom", &WINDOWS_SYSCALL_ARGS[525], 1, 0 },
+	{ "NtDeleteBootEntry", &WINDOWS_SYSCALL_ARGS[526], 1, 0 },
+	{ "NtDeleteDriverEntry", &WINDOWS_SYSCALL_ARGS[527], 1, 0 },
+	{ "NtDeleteFile", &WINDOWS_SYSCALL_ARGS[528], 1, 0 },
+	{ "NtDeleteKey", &WINDOWS_SYSCALL_ARGS[529], 1, 0 },
+	{ "NtDeleteObjectAuditAlarm", &WINDOWS_SYSCALL_ARGS[530], 3, 0 },
+	{ "NtDeletePrivateNamespace", &WINDOWS_SYSCALL_ARGS[533], 1, 0 },
+	{ "NtDeleteValueKey", &WINDOWS_SYSCALL_ARGS[534], 2, 0 },
+	{ "NtDeviceIoControlFile", &WINDOWS_SYSCALL_ARGS[536], 10, 0 },
+	{ "NtDisableLastKnownGood", NULL, 0, 0 },
+	{ "NtDisplayString", &WINDOWS_SYSCALL_ARGS[546], 1, 0 },
+	{ "NtDrawText", &WINDOWS_SYSCALL_ARGS[547], 1, 0 },
+	{ "NtDuplicateObject", &WINDOWS_SYSCALL_ARGS[548], 7, 0 },
+	{ "NtDuplicateToken", &WINDOWS_SYSCALL_ARGS[555], 6, 0 },
+	{ "NtEnableLastKnownGood", NULL, 0, 0 },
+	{ "NtEnumerateBootEntries", &WINDOWS_SYSCALL_ARGS[561], 2, 0 },
+	{ "NtEnumerateDriverEntries", &WINDOWS_SYSCALL_ARGS[563], 2, 0 },
+	{ "NtEnumerateKey", &WINDOWS_SYSCALL_ARGS[565], 6, 0 },
+	{ "NtEnumerateSystemEnvironmentValuesEx", &WINDOWS_SYSCALL_ARGS[571], 3, 0 },
+	{ "NtEnumerateTransactionObject", &WINDOWS_SYSCALL_ARGS[574], 5, 0 },
+	{ "NtEnumerateValueKey", &WINDOWS_SYSCALL_ARGS[579], 6, 0 },
+	{ "NtExtendSection", &WINDOWS_SYSCALL_ARGS[585], 2, 0 },
+	{ "NtFilterToken", &WINDOWS_SYSCALL_ARGS[587], 6, 0 },
+	{ "NtFindAtom", &WINDOWS_SYSCALL_ARGS[593], 3, 0 },
+	{ "NtFlushBuffersFile", &WINDOWS_SYSCALL_ARGS[596], 2, 0 },
+	{ "NtFlushInstallUILanguage", &WINDOWS_SYSCALL_ARGS[598], 2, 0 },
+	{ "NtFlushInstructionCache", &WINDOWS_SYSCALL_ARGS[600], 3, 0 },
+	{ "NtFlushKey", &WINDOWS_SYSCALL_ARGS[603], 1, 0 },
+	{ "NtFlushProcessWriteBuffers", NULL, 0, 0 },
+	{ "NtFlushVirtualMemory", &WINDOWS_SYSCALL_ARGS[604], 4, 0 },
+	{ "NtFlushWriteBuffer", NULL, 0, 0 },
+	{ "NtFreeUserPhysicalPages", &WINDOWS_SYSCALL_ARGS[608], 3, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "NtFreeVirtualMemory", &WINDOWS_SYSCALL_ARGS[611], 4, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "NtFreezeRegistry", &WINDOWS_SYSCALL_ARGS[615], 1, 0 },
+	{ "NtFreezeTransactions", &WINDOWS_SYSCALL_ARGS[616], 2, 0 },
+	{ "NtFsControlFile", &WINDOWS_SYSCALL_ARGS[618], 10, 0 },
+	{ "NtGetContextThread", &WINDOWS_SYSCALL_ARGS[628], 2, 0 },
+	{ "NtGetCurrentProcessorNumber", NULL, 0, 0 },
+	{ "NtGetDevicePowerState", &WINDOWS_SYSCALL_ARGS[630], 2, 0 },
+	{ "NtGetMUIRegistryInfo", &WINDOWS_SYSCALL_ARGS[632], 3, 0 },
+	{ "NtGetNextProcess", &WINDOWS_SYSCALL_ARGS[635], 5, 0 },
+	{ "NtGetNextThread", &WINDOWS_SYSCALL_ARGS[640], 6, 0 },
+	{ "NtGetNlsSectionPtr", &WINDOWS_SYSCALL_ARGS[646], 5, 0 },
+	{ "NtGetNotificationResourceManager", &WINDOWS_SYSCALL_ARGS[651], 7, 0 },
+	{ "NtGetPlugPlayEvent", &WINDOWS_SYSCALL_ARGS[658], 4, 0 },
+	{ "NtGetWriteWatch", &WINDOWS_SYSCALL_ARGS[662], 7, 0 },
+	{ "NtImpersonateAnonymousToken", &WINDOWS_SYSCALL_ARGS[669], 1, 0 },
+	{ "NtImpersonateClientOfPort", &WINDOWS_SYSCALL_ARGS[670], 2, 0 },
+	{ "NtImpersonateThread", &WINDOWS_SYSCALL_ARGS[672], 3, 0 },
+	{ "NtInitializeNlsFiles", &WINDOWS_SYSCALL_ARGS[675], 3, 0 },
+	{ "NtInitializeRegistry", &WINDOWS_SYSCALL_ARGS[678], 1, 0 },
+	{ "NtInitiatePowerAction", &WINDOWS_SYSCALL_ARGS[679], 4, 0 },
+	{ "NtIsProcessInJob", &WINDOWS_SYSCALL_ARGS[683], 2, 0 },
+	{ "NtIsSystemResumeAutomatic", NULL, 0, 0 },
+	{ "NtIsUILanguageComitted", NULL, 0, 0 },
+	{ "NtListenPort", &WINDOWS_SYSCALL_ARGS[685], 2, 0 },
+	{ "NtLoadDriver", &WINDOWS_SYSCALL_ARGS[687], 1, 0 },
+	{ "NtLoadKey2", &WINDOWS_SYSCALL_ARGS[688], 3, 0 },
+	{ "NtLoadKeyEx", &WINDOWS_SYSCALL_ARGS[691], 4, 0 },
+	{ "NtLoadKey", &WINDOWS_SYSCALL_ARGS[695], 2, 0 },
+	{ "NtLockFile", &WINDOWS_SYSCALL_ARGS[697], 10, 0 },
+	{ "NtLockProductActivationKeys", &WINDOWS_SYSCALL_ARGS[707], 2, 0 },
+	{ "NtLockRegistryKey", &WINDOWS_SYSCALL_ARGS[709], 1, 0 },
+	{ "NtLockVirtualMemory", &WINDOWS_SYSCALL_ARGS[710], 4, 0 },
+	{ "NtMakePermanentObject", &WINDOWS_SYSCALL_ARGS[714], 1, 0 },
+	{ "NtMakeTemporaryObject", &WINDOWS_SYSCALL_ARGS[715], 1, 0 },
+	{ "NtMapCMFModule", &WINDOWS_SYSCALL_ARGS[716], 6, 0 },
+	{ "NtMapUserPhysicalPages", &WINDOWS_SYSCALL_ARGS[722], 3, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "NtMapUserPhysicalPagesScatter", &WINDOWS_SYSCALL_ARGS[725], 3, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "NtMapViewOfSection", &WINDOWS_SYSCALL_ARGS[728], 10, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "NtModifyBootEntry", &WINDOWS_SYSCALL_ARGS[738], 1, 0 },
+	{ "NtModifyDriverEntry", &WINDOWS_SYSCALL_ARGS[739], 1, 0 },
+	{ "NtNotifyChangeDirectoryFile", &WINDOWS_SYSCALL_ARGS[740], 9, 0 },
+	{ "NtNotifyChangeKey", &WINDOWS_SYSCALL_ARGS[749], 10, 0 },
+	{ "NtNotifyChangeMultipleKeys", &WINDOWS_SYSCALL_ARGS[759], 12, 0 },
+	{ "NtNotifyChangeSession", &WINDOWS_SYSCALL_ARGS[771], 8, 0 },
+	{ "NtOpenDirectoryObject", &WINDOWS_SYSCALL_ARGS[779], 3, 0 },
+	{ "NtOpenEnlistment", &WINDOWS_SYSCALL_ARGS[782], 5, 0 },
+	{ "NtOpenEvent", &WINDOWS_SYSCALL_ARGS[787], 3, 0 },
+	{ "NtOpenEventPair", &WINDOWS_SYSCALL_ARGS[790], 3, 0 },
+	{ "NtOpenFile", &WINDOWS_SYSCALL_ARGS[793], 6, 0 },
+	{ "NtOpenIoCompletion", &WINDOWS_SYSCALL_ARGS[799], 3, 0 },
+	{ "NtOpenJobObject", &WINDOWS_SYSCALL_ARGS[802], 3, 0 },
+	{ "NtOpenKeyedEvent", &WINDOWS_SYSCALL_ARGS[805], 3, 0 },
+	{ "NtOpenKeyEx", &WINDOWS_SYSCALL_ARGS[808], 4, 0 },
+	{ "NtOpenKey", &WINDOWS_SYSCALL_ARGS[812], 3, 0 },
+	{ "NtOpenKeyTransactedEx", &WINDOWS_SYSCALL_ARGS[815], 5, 0 },
+	{ "NtOpenKeyTransacted", &WINDOWS_SYSCALL_ARGS[820], 4, 0 },
+	{ "NtOpenMutant", &WINDOWS_SYSCALL_ARGS[824], 3, 0 },
+	{ "NtOpenObjectAuditAlarm", &WINDOWS_SYSCALL_ARGS[827], 12, 0 },
+	{ "NtOpenPrivateNamespace", &WINDOWS_SYSCALL_ARGS[839], 4, 0 },
+	{ "NtOpenProcess", &WINDOWS_SYSCALL_ARGS[843], 4, 0 },
+	{ "NtOpenProcessTokenEx", &WINDOWS_SYSCALL_ARGS[847], 4, 0 },
+	{ "NtOpenProcessToken", &WINDOWS_SYSCALL_ARGS[851], 3, 0 },
+	{ "NtOpenResourceManager", &WINDOWS_SYSCALL_ARGS[854], 5, 0 },
+	{ "NtOpenSection", &WINDOWS_SYSCALL_ARGS[859], 3, 0 },
+	{ "NtOpenSemaphore", &WINDOWS_SYSCALL_ARGS[862], 3, 0 },
+	{ "NtOpenSession", &WINDOWS_SYSCALL_ARGS[865], 3, 0 },
+	{ "NtOpenSymbolicLinkObject", &WINDOWS_SYSCALL_ARGS[868], 3, 0 },
+	{ "NtOpenThread", &WINDOWS_SYSCALL_ARGS[871], 4, 0 },
+	{ "NtOpenThreadTokenEx", &WINDOWS_SYSCALL_ARGS[875], 5, 0 },
+	{ "NtOpenThreadToken", &WINDOWS_SYSCALL_ARGS[880], 4, 0 },
+	{ "NtOpenTimer", &WINDOWS_SYSCALL_ARGS[884], 3, 0 },
+	{ "NtOpenTransactionManager", &WINDOWS_SYSCALL_ARGS[887], 6, 0 },
+	{ "NtOpenTransaction", &WINDOWS_SYSCALL_ARGS[893], 5, 0 },
+	{ "NtPlugPlayControl", &WINDOWS_SYSCALL_ARGS[898], 3, 0 },
+	{ "NtPowerInformation", &WINDOWS_SYSCALL_ARGS[901], 5, 0 },
+	{ "NtPrepareComplete", &WINDOWS_SYSCALL_ARGS[906], 2, 0 },
+	{ "NtPrepareEnlistment", &WINDOWS_SYSCALL_ARGS[908], 2, 0 },
+	{ "NtPrePrepareComplete", &WINDOWS_SYSCALL_ARGS[910], 2, 0 },
+	{ "NtPrePrepareEnlistment", &WINDOWS_SYSCALL_ARGS[912], 2, 0 },
+	{ "NtPrivilegeCheck", &WINDOWS_SYSCALL_ARGS[914], 3, 0 },
+	{ "NtPrivilegedServiceAuditAlarm", &WINDOWS_SYSCALL_ARGS[917], 5, 0 },
+	{ "NtPrivilegeObjectAuditAlarm", &WINDOWS_SYSCALL_ARGS[922], 6, 0 },
+	{ "NtPropagationComplete", &WINDOWS_SYSCALL_ARGS[928], 4, 0 },
+	{ "NtPropagationFailed", &WINDOWS_SYSCALL_ARGS[932], 3, 0 },
+	{ "NtProtectVirtualMemory", &WINDOWS_SYSCALL_ARGS[935], 5, 0 },
+	{ "NtPulseEvent", &WINDOWS_SYSCALL_ARGS[940], 2, 0 },
+	{ "NtQueryAttributesFile", &WINDOWS_SYSCALL_ARGS[942], 2, 0 },
+	{ "NtQueryBootEntryOrder", &WINDOWS_SYSCALL_ARGS[944], 2, 0 },
+	{ "NtQueryBootOptions", &WINDOWS_SYSCALL_ARGS[946], 2, 0 },
+	{ "NtQueryDebugFilterState", &WINDOWS_SYSCALL_ARGS[948], 2, 0 },
+	{ "NtQueryDefaultLocale", &WINDOWS_SYSCALL_ARGS[950], 2, 0 },
+	{ "NtQueryDefaultUILanguage", &WINDOWS_SYSCALL_ARGS[952], 1, 0 },
+	{ "NtQueryDirectoryFile", &WINDOWS_SYSCALL_ARGS[953], 11, 0 },
+	{ "NtQueryDirectoryObject", &WINDOWS_SYSCALL_ARGS[964], 7, 0 },
+	{ "NtQueryDriverEntryOrder", &WINDOWS_SYSCALL_ARGS[971], 2, 0 },
+	{ "NtQueryEaFile", &WINDOWS_SYSCALL_ARGS[973], 9, 0 },
+	{ "NtQueryEvent", &WINDOWS_SYSCALL_ARGS[982], 5, 0 },
+	{ "NtQueryFullAttributesFile", &WINDOWS_SYSCALL_ARGS[987], 2, 0 },
+	{ "NtQueryInformationAtom", &WINDOWS_SYSCALL_ARGS[989], 5, 0 },
+	{ "NtQueryInformationEnlistment", &WINDOWS_SYSCALL_ARGS[994], 5, 0 },
+	{ "NtQueryInformationFile", &WINDOWS_SYSCALL_ARGS[999], 5, 0 },
+	{ "NtQueryInformationJobObject", &WINDOWS_SYSCALL_ARGS[1004], 5, 0 },
+	{ "NtQueryInformationPort", &WINDOWS_SYSCALL_ARGS[1009], 5, 0 },
+	{ "NtQueryInformationProcess", &WINDOWS_SYSCALL_ARGS[1014], 5, 0 },
+	{ "NtQueryInformationResourceManager", &WINDOWS_SYSCALL_ARGS[1019], 5, 0 },
+	{ "NtQueryInformationThread", &WINDOWS_SYSCALL_ARGS[1024], 5, 0 },
+	{ "NtQueryInformationToken", &WINDOWS_SYSCALL_ARGS[1029], 5, 0 },
+	{ "NtQueryInformationTransaction", &WINDOWS_SYSCALL_ARGS[1034], 5, 0 },
+	{ "NtQueryInformationTransactionManager", &WINDOWS_SYSCALL_ARGS[1039], 5, 0 },
+	{ "NtQueryInformationWorkerFactory", &WINDOWS_SYSCALL_ARGS[1044], 5, 0 },
+	{ "NtQueryInstallUILanguage", &WINDOWS_SYSCALL_ARGS[1049], 1, 0 },
+	{ "NtQueryIntervalProfile", &WINDOWS_SYSCALL_ARGS[1050], 2, 0 },
+	{ "NtQueryIoCompletion", &WINDOWS_SYSCALL_ARGS[1052], 5, 0 },
+	{ "NtQueryKey", &WINDOWS_SYSCALL_ARGS[1057], 5, 0 },
+	{ "NtQueryLicenseValue", &WINDOWS_SYSCALL_ARGS[1062], 5, 0 },
+	{ "NtQueryMultipleValueKey", &WINDOWS_SYSCALL_ARGS[1067], 6, 0 },
+	{ "NtQueryMutant", &WINDOWS_SYSCALL_ARGS[1073], 5, 0 },
+	{ "NtQueryObject", &WINDOWS_SYSCALL_ARGS[1078], 5, 0 },
+	{ "NtQueryOpenSubKeysEx", &WINDOWS_SYSCALL_ARGS[1083], 4, 0 },
+	{ "NtQueryOpenSubKeys", &WINDOWS_SYSCALL_ARGS[1087], 2, 0 },
+	{ "NtQueryPerformanceCounter", &WINDOWS_SYSCALL_ARGS[1089], 2, 0 },
+	{ "NtQueryPortInformationProcess", NULL, 0, 0 },
+	{ "NtQueryQuotaInformationFile", &WINDOWS_SYSCALL_ARGS[1091], 9, 0 },
+	{ "NtQuerySection", &WINDOWS_SYSCALL_ARGS[1100], 5, 0 },
+	{ "NtQuerySecurityAttributesToken", &WINDOWS_SYSCALL_ARGS[1105], 6, 0 },
+	{ "NtQuerySecurityObject", &WINDOWS_SYSCALL_ARGS[1111], 5, 0 },
+	{ "NtQuerySemaphore", &WINDOWS_SYSCALL_ARGS[1116], 5, 0 },
+	{ "NtQuerySymbolicLinkObject", &WINDOWS_SYSCALL_ARGS[1121], 3, 0 },
+	{ "NtQuerySystemEnvironmentValueEx", &WINDOWS_SYSCALL_ARGS[1124], 5, 0 },
+	{ "NtQuerySystemEnvironmentValue", &WINDOWS_SYSCALL_ARGS[1129], 4, 0 },
+	{ "NtQuerySystemInformationEx", &WINDOWS_SYSCALL_ARGS[1133], 6, 0 },
+	{ "NtQuerySystemInformation", &WINDOWS_SYSCALL_ARGS[1139], 4, 0 },
+	{ "NtQuerySystemTime", &WINDOWS_SYSCALL_ARGS[1143], 1, 0 },
+	{ "NtQueryTimer", &WINDOWS_SYSCALL_ARGS[1144], 5, 0 },
+	{ "NtQueryTimerResolution", &WINDOWS_SYSCALL_ARGS[1149], 3, 0 },
+	{ "NtQueryValueKey", &WINDOWS_SYSCALL_ARGS[1152], 6, 0 },
+	{ "NtQueryVirtualMemory", &WINDOWS_SYSCALL_ARGS[1158], 6, 0 },
+	{ "NtQueryVolumeInformationFile", &WINDOWS_SYSCALL_ARGS[1164], 5, 0 },
+	{ "NtQueueApcThreadEx", &WINDOWS_SYSCALL_ARGS[1169], 6, 0 },
+	{ "NtQueueApcThread", &WINDOWS_SYSCALL_ARGS[1175], 5, 0 },
+	{ "NtRaiseException", &WINDOWS_SYSCALL_ARGS[1180], 3, 0 },
+	{ "NtRaiseHardError", &WINDOWS_SYSCALL_ARGS[1183], 6, 0 },
+	{ "NtReadFile", &WINDOWS_SYSCALL_ARGS[1189], 9, 0 },
+	{ "NtReadFileScatter", &WINDOWS_SYSCALL_ARGS[1198], 9, 0 },
+	{ "NtReadOnlyEnlistment", &WINDOWS_SYSCALL_ARGS[1207], 2, 0 },
+	{ "NtReadRequestData", &WINDOWS_SYSCALL_ARGS[1209], 6, 0 },
+	{ "NtReadVirtualMemory", &WINDOWS_SYSCALL_ARGS[1215], 5, 0 },
+	{ "NtRecoverEnlistment", &WINDOWS_SYSCALL_ARGS[1220], 2, 0 },
+	{ "NtRecoverResourceManager", &WINDOWS_SYSCALL_ARGS[1222], 1, 0 },
+	{ "NtRecoverTransactionManager", &WINDOWS_SYSCALL_ARGS[1223], 1, 0 },
+	{ "NtRegisterProtocolAddressInformation", &WINDOWS_SYSCALL_ARGS[1224], 5, 0 },
+	{ "NtRegisterThreadTerminatePort", &WINDOWS_SYSCALL_ARGS[1229], 1, 0 },
+	{ "NtReleaseKeyedEvent", &WINDOWS_SYSCALL_ARGS[1230], 4, 0 },
+	{ "NtReleaseMutant", &WINDOWS_SYSCALL_ARGS[1234], 2, 0 },
+	{ "NtReleaseSemaphore", &WINDOWS_SYSCALL_ARGS[1236], 3, 0 },
+	{ "NtReleaseWorkerFactoryWorker", &WINDOWS_SYSCALL_ARGS[1239], 1, 0 },
+	{ "NtRemoveIoCompletionEx", &WINDOWS_SYSCALL_ARGS[1240], 6, 0 },
+	{ "NtRemoveIoCompletion", &WINDOWS_SYSCALL_ARGS[1246], 5, 0 },
+	{ "NtRemoveProcessDebug", &WINDOWS_SYSCALL_ARGS[1251], 2, 0 },
+	{ "NtRenameKey", &WINDOWS_SYSCALL_ARGS[1253], 2, 0 },
+	{ "NtRenameTransactionManager", &WINDOWS_SYSCALL_ARGS[1255], 2, 0 },
+	{ "NtReplaceKey", &WINDOWS_SYSCALL_ARGS[1257], 3, 0 },
+	{ "NtReplacePartitionUnit", &WINDOWS_SYSCALL_ARGS[1260], 3, 0 },
+	{ "NtReplyPort", &WINDOWS_SYSCALL_ARGS[1263], 2, 0 },
+	{ "NtReplyWaitReceivePortEx", &WINDOWS_SYSCALL_ARGS[1265], 5, 0 },
+	{ "NtReplyWaitReceivePort", &WINDOWS_SYSCALL_ARGS[1270], 4, 0 },
+	{ "NtReplyWaitReplyPort", &WINDOWS_SYSCALL_ARGS[1274], 2, 0 },
+	{ "NtRequestPort", &WINDOWS_SYSCALL_ARGS[1276], 2, 0 },
+	{ "NtRequestWaitReplyPort", &WINDOWS_SYSCALL_ARGS[1278], 3, 0 },
+	{ "NtResetEvent", &WINDOWS_SYSCALL_ARGS[1281], 2, 0 },
+	{ "NtResetWriteWatch", &WINDOWS_SYSCALL_ARGS[1283], 3, 0 },
+	{ "NtRestoreKey", &WINDOWS_SYSCALL_ARGS[1286], 3, 0 },
+	{ "NtResumeProcess", &WINDOWS_SYSCALL_ARGS[1289], 1, 0 },
+	{ "NtResumeThread", &WINDOWS_SYSCALL_ARGS[1290], 2, 0 },
+	{ "NtRollbackComplete", &WINDOWS_SYSCALL_ARGS[1292], 2, 0 },
+	{ "NtRollbackEnlistment", &WINDOWS_SYSCALL_ARGS[1294], 2, 0 },
+	{ "NtRollbackTransaction", &WINDOWS_SYSCALL_ARGS[1296], 2, 0 },
+	{ "NtRollforwardTransactionManager", &WINDOWS_SYSCALL_ARGS[1298], 2, 0 },
+	{ "NtSaveKeyEx", &WINDOWS_SYSCALL_ARGS[1300], 3, 0 },
+	{ "NtSaveKey", &WINDOWS_SYSCALL_ARGS[1303], 2, 0 },
+	{ "NtSaveMergedKeys", &WINDOWS_SYSCALL_ARGS[1305], 3, 0 },
+	{ "NtSecureConnectPort", &WINDOWS_SYSCALL_ARGS[1308], 9, 0 },
+	{ "NtSerializeBoot", NULL, 0, 0 },
+	{ "NtSetBootEntryOrder", &WINDOWS_SYSCALL_ARGS[1317], 2, 0 },
+	{ "NtSetBootOptions", &WINDOWS_SYSCALL_ARGS[1319], 2, 0 },
+	{ "NtSetContextThread", &WINDOWS_SYSCALL_ARGS[1321], 2, 0 },
+	{ "NtSetDebugFilterState", &WINDOWS_SYSCALL_ARGS[1323], 3, 0 },
+	{ "NtSetDefaultHardErrorPort", &WINDOWS_SYSCALL_ARGS[1326], 1, 0 },
+	{ "NtSetDefaultLocale", &WINDOWS_SYSCALL_ARGS[1327], 2, 0 },
+	{ "NtSetDefaultUILanguage", &WINDOWS_SYSCALL_ARGS[1329], 1, 0 },
+	{ "NtSetDriverEntryOrder", &WINDOWS_SYSCALL_ARGS[1330], 2, 0 },
+	{ "NtSetEaFile", &WINDOWS_SYSCALL_ARGS[1332], 4, 0 },
+	{ "NtSetEventBoostPriority", &WINDOWS_SYSCALL_ARGS[1336], 1, 0 },
+	{ "NtSetEvent", &WINDOWS_SYSCALL_ARGS[1337], 2, 0 },
+	{ "NtSetHighEventPair", &WINDOWS_SYSCALL_ARGS[1339], 1, 0 },
+	{ "NtSetHighWaitLowEventPair", &WINDOWS_SYSCALL_ARGS[1340], 1, 0 },
+	{ "NtSetInformationDebugObject", &WINDOWS_SYSCALL_ARGS[1341], 5, 0 },
+	{ "NtSetInformationEnlistment", &WINDOWS_SYSCALL_ARGS[1346], 4, 0 },
+	{ "NtSetInformationFile", &WINDOWS_SYSCALL_ARGS[1350], 5, 0 },
+	{ "NtSetInformationJobObject", &WINDOWS_SYSCALL_ARGS[1355], 4, 0 },
+	{ "NtSetInformationKey", &WINDOWS_SYSCALL_ARGS[1359], 4, 0 },
+	{ "NtSetInformationObject", &WINDOWS_SYSCALL_ARGS[1363], 4, 0 },
+	{ "NtSetInformationProcess", &WINDOWS_SYSCALL_ARGS[1367], 4, 0 },
+	{ "NtSetInformationResourceManager", &WINDOWS_SYSCALL_ARGS[1371], 4, 0 },
+	{ "NtSetInformationThread", &WINDOWS_SYSCALL_ARGS[1375], 4, 0 },
+	{ "NtSetInformationToken", &WINDOWS_SYSCALL_ARGS[1379], 4, 0 },
+	{ "NtSetInformationTransaction", &WINDOWS_SYSCALL_ARGS[1383], 4, 0 },
+	{ "NtSetInformationTransactionManager", &WINDOWS_SYSCALL_ARGS[1387], 4, 0 },
+	{ "NtSetInformationWorkerFactory", &WINDOWS_SYSCALL_ARGS[1391], 4, 0 },
+	{ "NtSetIntervalProfile", &WINDOWS_SYSCALL_ARGS[1395], 2, 0 },
+	{ "NtSetIoCompletionEx", &WINDOWS_SYSCALL_ARGS[1397], 6, 0 },
+	{ "NtSetIoCompletion", &WINDOWS_SYSCALL_ARGS[1403], 5, 0 },
+	{ "NtSetLdtEntries", &WINDOWS_SYSCALL_ARGS[1408], 6, 0 },
+	{ "NtSetLowEventPair", &WINDOWS_SYSCALL_ARGS[1414], 1, 0 },
+	{ "NtSetLowWaitHighEventPair", &WINDOWS_SYSCALL_ARGS[1415], 1, 0 },
+	{ "NtSetQuotaInformationFile", &WINDOWS_SYSCALL_ARGS[1416], 4, 0 },
+	{ "NtSetSecurityObject", &WINDOWS_SYSCALL_ARGS[1420], 3, 0 },
+	{ "NtSetSystemEnvironmentValueEx", &WINDOWS_SYSCALL_ARGS[1423], 5, 0 },
+	{ "NtSetSystemEnvironmentValue", &WINDOWS_SYSCALL_ARGS[1428], 2, 0 },
+	{ "NtSetSystemInformation", &WINDOWS_SYSCALL_ARGS[1430], 3, 0 },
+	{ "NtSetSystemPowerState", &WINDOWS_SYSCALL_ARGS[1433], 3, 0 },
+	{ "NtSetSystemTime", &WINDOWS_SYSCALL_ARGS[1436], 2, 0 },
+	{ "NtSetThreadExecutionState", &WINDOWS_SYSCALL_ARGS[1438], 2, 0 },
+	{ "NtSetTimerEx", &WINDOWS_SYSCALL_ARGS[1440], 4, 0 },
+	{ "NtSetTimer", &WINDOWS_SYSCALL_ARGS[1444], 7, 0 },
+	{ "NtSetTimerResolution", &WINDOWS_SYSCALL_ARGS[1451], 3, 0 },
+	{ "NtSetUuidSeed", &WINDOWS_SYSCALL_ARGS[1454], 1, 0 },
+	{ "NtSetValueKey", &WINDOWS_SYSCALL_ARGS[1455], 6, 0 },
+	{ "NtSetVolumeInformationFile", &WINDOWS_SYSCALL_ARGS[1461], 5, 0 },
+	{ "NtShutdownSystem", &WINDOWS_SYSCALL_ARGS[1466], 1, 0 },
+	{ "NtShutdownWorkerFactory", &WINDOWS_SYSCALL_ARGS[1467], 2, 0 },
+	{ "NtSignalAndWaitForSingleObject", &WINDOWS_SYSCALL_ARGS[1469], 4, 0 },
+	{ "NtSinglePhaseReject", &WINDOWS_SYSCALL_ARGS[1473], 2, 0 },
+	{ "NtStartProfile", &WINDOWS_SYSCALL_ARGS[1475], 1, 0 },
+	{ "NtStopProfile", &WINDOWS_SYSCALL_ARGS[1476], 1, 0 },
+	{ "NtSuspendProcess", &WINDOWS_SYSCALL_ARGS[1477], 1, 0 },
+	{ "NtSuspendThread", &WINDOWS_SYSCALL_ARGS[1478], 2, 0 },
+	{ "NtSystemDebugControl", &WINDOWS_SYSCALL_ARGS[1480], 6, 0 },
+	{ "NtTerminateJobObject", &WINDOWS_SYSCALL_ARGS[1486], 2, 0 },
+	{ "NtTerminateProcess", &WINDOWS_SYSCALL_ARGS[1488], 2, 0 },
+	{ "NtTerminateThread", &WINDOWS_SYSCALL_ARGS[1490], 2, 0 },
+	{ "NtTestAlert", NULL, 0, 0 },
+	{ "NtThawRegistry", NULL, 0, 0 },
+	{ "NtThawTransactions", NULL, 0, 0 },
+	{ "NtTraceControl", &WINDOWS_SYSCALL_ARGS[1492], 6, 0 },
+	{ "NtTraceEvent", &WINDOWS_SYSCALL_ARGS[1498], 4, 0 },
+	{ "NtTranslateFilePath", &WINDOWS_SYSCALL_ARGS[1502], 4, 0 },
+	{ "NtUmsThreadYield", &WINDOWS_SYSCALL_ARGS[1506], 1, 0 },
+	{ "NtUnloadDriver", &WINDOWS_SYSCALL_ARGS[1507], 1, 0 },
+	{ "NtUnloadKey2", &WINDOWS_SYSCALL_ARGS[1508], 2, 0 },
+	{ "NtUnloadKeyEx", &WINDOWS_SYSCALL_ARGS[1510], 2, 0 },
+	{ "NtUnloadKey", &WINDOWS_SYSCALL_ARGS[1512], 1, 0 },
+	{ "NtUnlockFile", &WINDOWS_SYSCALL_ARGS[1513], 5, 0 },
+	{ "NtUnlockVirtualMemory", &WINDOWS_SYSCALL_ARGS[1518], 4, 0 },
+	{ "NtUnmapViewOfSection", &WINDOWS_SYSCALL_ARGS[1522], 2, GT_SYSCALL_CHANGES_MAPPINGS },
+	{ "NtVdmControl", &WINDOWS_SYSCALL_ARGS[1524], 2, 0 },
+	{ "NtWaitForDebugEvent", &WINDOWS_SYSCALL_ARGS[1526], 4, 0 },
+	{ "NtWaitForKeyedEvent", &WINDOWS_SYSCALL_ARGS[1530], 4, 0 },
+	{ "NtWaitForMultipleObjects32", &WINDOWS_SYSCALL_ARGS[1534], 5, 0 },
+	{ "NtWaitForMultipleObjects", &WINDOWS_SYSCALL_ARGS[1539], 5, 0 },
+	{ "NtWaitForSingleObject", &WINDOWS_SYSCALL_ARGS[1544], 3, 0 },
+	{ "NtWaitForWorkViaWorkerFactory", &WINDOWS_SYSCALL_ARGS[1547], 2, 0 },
+	{ "NtWaitHighEventPair", &WINDOWS_SYSCALL_ARGS[1549], 1, 0 },
+	{ "NtWaitLowEventPair", &WINDOWS_SYSCALL_ARGS[1550], 1, 0 },
+	{ "NtWorkerFactoryWorkerReady", &WINDOWS_SYSCALL_ARGS[1551], 1, 0 },
+	{ "NtWriteFileGather", &WINDOWS_SYSCALL_ARGS[1552], 9, 0 },
+	{ "NtWriteFile", &WINDOWS_SYSCALL_ARGS[1561], 9, 0 },
+	{ "NtWriteRequestData", &WINDOWS_SYSCALL_ARGS[1570], 6, 0 },
+	{ "NtWriteVirtualMemory", &WINDOWS_SYSCALL_ARGS[1576], 5, 0 },
+	{ "NtYieldExecution", NULL, 0, 0 },
+};
 
-	fprintf(stderr, "pid: %u/0x%lx (%s) sysret: Status(0x%lx) OUT()\n", pid, tid, proc, event->x86_regs->rax);
-	free(args);
-}
+const gt_syscall_table WINDOWS_SYSCALL_TABLE = {
+	GT_OS_WINDOWS, WINDOWS_SYSCALL_DESCS, G_N_ELEMENTS(WINDOWS_SYSCALL_DESCS)
+};
 
-const GTSyscallCallback SYSCALLS[] = {
-	{ "NtAcceptConnectPort", gt_windows_print_syscall_ntacceptconnectport, gt_windows_print_sysret_ntacceptconnectport, NULL },
-	{ "NtAccessCheckAndAuditAlarm", gt_windows_print_syscall_ntaccesscheckandauditalarm, gt_windows_print_sysret_ntaccesscheckandauditalarm, NULL },
-	{ "NtAccessCheckByTypeAndAuditAlarm", gt_windows_print_syscall_ntaccesscheckbytypeandauditalarm, gt_windows_print_sysret_ntaccesscheckbytypeandauditalarm, NULL },
-	{ "NtAccessCheckByType", gt_windows_print_syscall_ntaccesscheckbytype, gt_windows_print_sysret_ntaccesscheckbytype, NULL },
-	{ "NtAccessCheckByTypeResultListAndAuditAlarmByHandle", gt_windows_print_syscall_ntaccesscheckbytyperesultlistandauditalarmbyhandle, gt_windows_print_sysret_ntaccesscheckbytyperesultlistandauditalarmbyhandle, NULL },
-	{ "NtAccessCheckByTypeResultListAndAuditAlarm", gt_windows_print_syscall_ntaccesscheckbytyperesultlistandauditalarm, gt_windows_print_sysret_ntaccesscheckbytyperesultlistandauditalarm, NULL },
-	{ "NtAccessCheckByTypeResultList", gt_windows_print_syscall_ntaccesscheckbytyperesultlist, gt_windows_print_sysret_ntaccesscheckbytyperesultlist, NULL },
-	{ "NtAccessCheck", gt_windows_print_syscall_ntaccesscheck, gt_windows_print_sysret_ntaccesscheck, NULL },
-	{ "NtAddAtom", gt_windows_print_syscall_ntaddatom, gt_windows_print_sysret_ntaddatom, NULL },
-	{ "NtAddBootEntry", gt_windows_print_syscall_ntaddbootentry, gt_windows_print_sysret_ntaddbootentry, NULL },
-	{ "NtAddDriverEntry", gt_windows_print_syscall_ntadddriverentry, gt_windows_print_sysret_ntadddriverentry, NULL },
-	{ "NtAdjustGroupsToken", gt_windows_print_syscall_ntadjustgroupstoken, gt_windows_print_sysret_ntadjustgroupstoken, NULL },
-	{ "NtAdjustPrivilegesToken", gt_windows_print_syscall_ntadjustprivilegestoken, gt_windows_print_sysret_ntadjustprivilegestoken, NULL },
-	{ "NtAlertResumeThread", gt_windows_print_syscall_ntalertresumethread, gt_windows_print_sysret_ntalertresumethread, NULL },
-	{ "NtAlertThread", gt_windows_print_syscall_ntalertthread, gt_windows_print_sysret_ntalertthread, NULL },
-	{ "NtAllocateLocallyUniqueId", gt_windows_print_syscall_ntallocatelocallyuniqueid, gt_windows_print_sysret_ntallocatelocallyuniqueid, NULL },
-	{ "NtAllocateReserveObject", gt_windows_print_syscall_ntallocatereserveobject, gt_windows_print_sysret_ntallocatereserveobject, NULL },
-	{ "NtAllocateUserPhysicalPages", gt_windows_print_syscall_ntallocateuserphysicalpages, gt_windows_print_sysret_ntallocateuserphysicalpages, NULL },
-	{ "NtAllocateUuids", gt_windows_print_syscall_ntallocateuuids, gt_windows_print_sysret_ntallocateuuids, NULL },
-	{ "NtAllocateVirtualMemory", gt_windows_print_syscall_ntallocatevirtualmemory, gt_windows_print_sysret_ntallocatevirtualmemory, NULL },
-	{ "NtAlpcAcceptConnectPort", gt_windows_print_syscall_ntalpcacceptconnectport, gt_windows_print_sysret_ntalpcacceptconnectport, NULL },
-	{ "NtAlpcCancelMessage", gt_windows_print_syscall_ntalpccancelmessage, gt_windows_print_sysret_ntalpccancelmessage, NULL },
-	{ "NtAlpcConnectPort", gt_windows_print_syscall_ntalpcconnectport, gt_windows_print_sysret_ntalpcconnectport, NULL },
-	{ "NtAlpcCreatePort", gt_windows_print_syscall_ntalpccreateport, gt_windows_print_sysret_ntalpccreateport, NULL },
-	{ "NtAlpcCreatePortSection", gt_windows_print_syscall_ntalpccreateportsection, gt_windows_print_sysret_ntalpccreateportsection, NULL },
-	{ "NtAlpcCreateResourceReserve", gt_windows_print_syscall_ntalpccreateresourcereserve, gt_windows_print_sysret_ntalpccreateresourcereserve, NULL },
-	{ "NtAlpcCreateSectionView", gt_windows_print_syscall_ntalpccreatesectionview, gt_windows_print_sysret_ntalpccreatesectionview, NULL },
-	{ "NtAlpcCreateSecurityContext", gt_windows_print_syscall_ntalpccreatesecuritycontext, gt_windows_print_sysret_ntalpccreatesecuritycontext, NULL },
-	{ "NtAlpcDeletePortSection", gt_windows_print_syscall_ntalpcdeleteportsection, gt_windows_print_sysret_ntalpcdeleteportsection, NULL },
-	{ "NtAlpcDeleteResourceReserve", gt_windows_print_syscall_ntalpcdeleteresourcereserve, gt_windows_print_sysret_ntalpcdeleteresourcereserve, NULL },
-	{ "NtAlpcDeleteSectionView", gt_windows_print_syscall_ntalpcdeletesectionview, gt_windows_print_sysret_ntalpcdeletesectionview, NULL },
-	{ "NtAlpcDeleteSecurityContext", gt_windows_print_syscall_ntalpcdeletesecuritycontext, gt_windows_print_sysret_ntalpcdeletesecuritycontext, NULL },
-	{ "NtAlpcDisconnectPort", gt_windows_print_syscall_ntalpcdisconnectport, gt_windows_print_sysret_ntalpcdisconnectport, NULL },
-	{ "NtAlpcImpersonateClientOfPort", gt_windows_print_syscall_ntalpcimpersonateclientofport, gt_windows_print_sysret_ntalpcimpersonateclientofport, NULL },
-	{ "NtAlpcOpenSenderProcess", gt_windows_print_syscall_ntalpcopensenderprocess, gt_windows_print_sysret_ntalpcopensenderprocess, NULL },
-	{ "NtAlpcOpenSenderThread", gt_windows_print_syscall_ntalpcopensenderthread, gt_windows_print_sysret_ntalpcopensenderthread, NULL },
-	{ "NtAlpcQueryInformation", gt_windows_print_syscall_ntalpcqueryinformation, gt_windows_print_sysret_ntalpcqueryinformation, NULL },
-	{ "NtAlpcQueryInformationMessage", gt_windows_print_syscall_ntalpcqueryinformationmessage, gt_windows_print_sysret_ntalpcqueryinformationmessage, NULL },
-	{ "NtAlpcRevokeSecurityContext", gt_windows_print_syscall_ntalpcrevokesecuritycontext, gt_windows_print_sysret_ntalpcrevokesecuritycontext, NULL },
-	{ "NtAlpcSendWaitReceivePort", gt_windows_print_syscall_ntalpcsendwaitreceiveport, gt_windows_print_sysret_ntalpcsendwaitreceiveport, NULL },
-	{ "NtAlpcSetInformation", gt_windows_print_syscall_ntalpcsetinformation, gt_windows_print_sysret_ntalpcsetinformation, NULL },
-	{ "NtApphelpCacheControl", gt_windows_print_syscall_ntapphelpcachecontrol, gt_windows_print_sysret_ntapphelpcachecontrol, NULL },
-	{ "NtAreMappedFilesTheSame", gt_windows_print_syscall_ntaremappedfilesthesame, gt_windows_print_sysret_ntaremappedfilesthesame, NULL },
-	{ "NtAssignProcessToJobObject", gt_windows_print_syscall_ntassignprocesstojobobject, gt_windows_print_sysret_ntassignprocesstojobobject, NULL },
-	{ "NtCallbackReturn", gt_windows_print_syscall_ntcallbackreturn, gt_windows_print_sysret_ntcallbackreturn, NULL },
-	{ "NtCancelIoFileEx", gt_windows_print_syscall_ntcanceliofileex, gt_windows_print_sysret_ntcanceliofileex, NULL },
-	{ "NtCancelIoFile", gt_windows_print_syscall_ntcanceliofile, gt_windows_print_sysret_ntcanceliofile, NULL },
-	{ "NtCancelSynchronousIoFile", gt_windows_print_syscall_ntcancelsynchronousiofile, gt_windows_print_sysret_ntcancelsynchronousiofile, NULL },
-	{ "NtCancelTimer", gt_windows_print_syscall_ntcanceltimer, gt_windows_print_sysret_ntcanceltimer, NULL },
-	{ "NtClearEvent", gt_windows_print_syscall_ntclearevent, gt_windows_print_sysret_ntclearevent, NULL },
-	{ "NtClose", gt_windows_print_syscall_ntclose, gt_windows_print_sysret_ntclose, NULL },
-	{ "NtCloseObjectAuditAlarm", gt_windows_print_syscall_ntcloseobjectauditalarm, gt_windows_print_sysret_ntcloseobjectauditalarm, NULL },
-	{ "NtCommitComplete", gt_windows_print_syscall_ntcommitcomplete, gt_windows_print_sysret_ntcommitcomplete, NULL },
-	{ "NtCommitEnlistment", gt_windows_print_syscall_ntcommitenlistment, gt_windows_print_sysret_ntcommitenlistment, NULL },
-	{ "NtCommitTransaction", gt_windows_print_syscall_ntcommittransaction, gt_windows_print_sysret_ntcommittransaction, NULL },
-	{ "NtCompactKeys", gt_windows_print_syscall_ntcompactkeys, gt_windows_print_sysret_ntcompactkeys, NULL },
-	{ "NtCompareTokens", gt_windows_print_syscall_ntcomparetokens, gt_windows_print_sysret_ntcomparetokens, NULL },
-	{ "NtCompleteConnectPort", gt_windows_print_syscall_ntcompleteconnectport, gt_windows_print_sysret_ntcompleteconnectport, NULL },
-	{ "NtCompressKey", gt_windows_print_syscall_ntcompresskey, gt_windows_print_sysret_ntcompresskey, NULL },
-	{ "NtConnectPort", gt_windows_print_syscall_ntconnectport, gt_windows_print_sysret_ntconnectport, NULL },
-	{ "NtContinue", gt_windows_print_syscall_ntcontinue, gt_windows_print_sysret_ntcontinue, NULL },
-	{ "NtCreateDebugObject", gt_windows_print_syscall_ntcreatedebugobject, gt_windows_print_sysret_ntcreatedebugobject, NULL },
-	{ "NtCreateDirectoryObject", gt_windows_print_syscall_ntcreatedirectoryobject, gt_windows_print_sysret_ntcreatedirectoryobject, NULL },
-	{ "NtCreateEnlistment", gt_windows_print_syscall_ntcreateenlistment, gt_windows_print_sysret_ntcreateenlistment, NULL },
-	{ "NtCreateEvent", gt_windows_print_syscall_ntcreateevent, gt_windows_print_sysret_ntcreateevent, NULL },
-	{ "NtCreateEventPair", gt_windows_print_syscall_ntcreateeventpair, gt_windows_print_sysret_ntcreateeventpair, NULL },
-	{ "NtCreateFile", gt_windows_print_syscall_ntcreatefile, gt_windows_print_sysret_ntcreatefile, NULL },
-	{ "NtCreateIoCompletion", gt_windows_print_syscall_ntcreateiocompletion, gt_windows_print_sysret_ntcreateiocompletion, NULL },
-	{ "NtCreateJobObject", gt_windows_print_syscall_ntcreatejobobject, gt_windows_print_sysret_ntcreatejobobject, NULL },
-	{ "NtCreateJobSet", gt_windows_print_syscall_ntcreatejobset, gt_windows_print_sysret_ntcreatejobset, NULL },
-	{ "NtCreateKeyedEvent", gt_windows_print_syscall_ntcreatekeyedevent, gt_windows_print_sysret_ntcreatekeyedevent, NULL },
-	{ "NtCreateKey", gt_windows_print_syscall_ntcreatekey, gt_windows_print_sysret_ntcreatekey, NULL },
-	{ "NtCreateKeyTransacted", gt_windows_print_syscall_ntcreatekeytransacted, gt_windows_print_sysret_ntcreatekeytransacted, NULL },
-	{ "NtCreateMailslotFile", gt_windows_print_syscall_ntcreatemailslotfile, gt_windows_print_sysret_ntcreatemailslotfile, NULL },
-	{ "NtCreateMutant", gt_windows_print_syscall_ntcreatemutant, gt_windows_print_sysret_ntcreatemutant, NULL },
-	{ "NtCreateNamedPipeFile", gt_windows_print_syscall_ntcreatenamedpipefile, gt_windows_print_sysret_ntcreatenamedpipefile, NULL },
-	{ "NtCreatePagingFile", gt_windows_print_syscall_ntcreatepagingfile, gt_windows_print_sysret_ntcreatepagingfile, NULL },
-	{ "NtCreatePort", gt_windows_print_syscall_ntcreateport, gt_windows_print_sysret_ntcreateport, NULL },
-	{ "NtCreatePrivateNamespace", gt_windows_print_syscall_ntcreateprivatenamespace, gt_windows_print_sysret_ntcreateprivatenamespace, NULL },
-	{ "NtCreateProcessEx", gt_windows_print_syscall_ntcreateprocessex, gt_windows_print_sysret_ntcreateprocessex, NULL },
-	{ "NtCreateProcess", gt_windows_print_syscall_ntcreateprocess, gt_windows_print_sysret_ntcreateprocess, NULL },
-	{ "NtCreateProfileEx", gt_windows_print_syscall_ntcreateprofileex, gt_windows_print_sysret_ntcreateprofileex, NULL },
-	{ "NtCreateProfile", gt_windows_print_syscall_ntcreateprofile, gt_windows_print_sysret_ntcreateprofile, NULL },
-	{ "NtCreateResourceManager", gt_windows_print_syscall_ntcreateresourcemanager, gt_windows_print_sysret_ntcreateresourcemanager, NULL },
-	{ "NtCreateSection", gt_windows_print_syscall_ntcreatesection, gt_windows_print_sysret_ntcreatesection, NULL },
-	{ "NtCreateSemaphore", gt_windows_print_syscall_ntcreatesemaphore, gt_windows_print_sysret_ntcreatesemaphore, NULL },
-	{ "NtCreateSymbolicLinkObject", gt_windows_print_syscall_ntcreatesymboliclinkobject, gt_windows_print_sysret_ntcreatesymboliclinkobject, NULL },
-	{ "NtCreateThreadEx", gt_windows_print_syscall_ntcreatethreadex, gt_windows_print_sysret_ntcreatethreadex, NULL },
-	{ "NtCreateThread", gt_windows_print_syscall_ntcreatethread, gt_windows_print_sysret_ntcreatethread, NULL },
-	{ "NtCreateTimer", gt_windows_print_syscall_ntcreatetimer, gt_windows_print_sysret_ntcreatetimer, NULL },
-	{ "NtCreateToken", gt_windows_print_syscall_ntcreatetoken, gt_windows_print_sysret_ntcreatetoken, NULL },
-	{ "NtCreateTransactionManager", gt_windows_print_syscall_ntcreatetransactionmanager, gt_windows_print_sysret_ntcreatetransactionmanager, NULL },
-	{ "NtCreateTransaction", gt_windows_print_syscall_ntcreatetransaction, gt_windows_print_sysret_ntcreatetransaction, NULL },
-	{ "NtCreateUserProcess", gt_windows_print_syscall_ntcreateuserprocess, gt_windows_print_sysret_ntcreateuserprocess, NULL },
-	{ "NtCreateWaitablePort", gt_windows_print_syscall_ntcreatewaitableport, gt_windows_print_sysret_ntcreatewaitableport, NULL },
-	{ "NtCreateWorkerFactory", gt_windows_print_syscall_ntcreateworkerfactory, gt_windows_print_sysret_ntcreateworkerfactory, NULL },
-	{ "NtDebugActiveProcess", gt_windows_print_syscall_ntdebugactiveprocess, gt_windows_print_sysret_ntdebugactiveprocess, NULL },
-	{ "NtDebugContinue", gt_windows_print_syscall_ntdebugcontinue, gt_windows_print_sysret_ntdebugcontinue, NULL },
-	{ "NtDelayExecution", gt_windows_print_syscall_ntdelayexecution, gt_windows_print_sysret_ntdelayexecution, NULL },
-	{ "NtDeleteAtom", gt_windows_print_syscall_ntdeleteatom, gt_windows_print_sysret_ntdeleteatom, NULL },
-	{ "NtDeleteBootEntry", gt_windows_print_syscall_ntdeletebootentry, gt_windows_print_sysret_ntdeletebootentry, NULL },
-	{ "NtDeleteDriverEntry", gt_windows_print_syscall_ntdeletedriverentry, gt_windows_print_sysret_ntdeletedriverentry, NULL },
-	{ "NtDeleteFile", gt_windows_print_syscall_ntdeletefile, gt_windows_print_sysret_ntdeletefile, NULL },
-	{ "NtDeleteKey", gt_windows_print_syscall_ntdeletekey, gt_windows_print_sysret_ntdeletekey, NULL },
-	{ "NtDeleteObjectAuditAlarm", gt_windows_print_syscall_ntdeleteobjectauditalarm, gt_windows_print_sysret_ntdeleteobjectauditalarm, NULL },
-	{ "NtDeletePrivateNamespace", gt_windows_print_syscall_ntdeleteprivatenamespace, gt_windows_print_sysret_ntdeleteprivatenamespace, NULL },
-	{ "NtDeleteValueKey", gt_windows_print_syscall_ntdeletevaluekey, gt_windows_print_sysret_ntdeletevaluekey, NULL },
-	{ "NtDeviceIoControlFile", gt_windows_print_syscall_ntdeviceiocontrolfile, gt_windows_print_sysret_ntdeviceiocontrolfile, NULL },
-	{ "NtDisableLastKnownGood", gt_windows_print_syscall_ntdisablelastknowngood, gt_windows_print_sysret_ntdisablelastknowngood, NULL },
-	{ "NtDisplayString", gt_windows_print_syscall_ntdisplaystring, gt_windows_print_sysret_ntdisplaystring, NULL },
-	{ "NtDrawText", gt_windows_print_syscall_ntdrawtext, gt_windows_print_sysret_ntdrawtext, NULL },
-	{ "NtDuplicateObject", gt_windows_print_syscall_ntduplicateobject, gt_windows_print_sysret_ntduplicateobject, NULL },
-	{ "NtDuplicateToken", gt_windows_print_syscall_ntduplicatetoken, gt_windows_print_sysret_ntduplicatetoken, NULL },
-	{ "NtEnableLastKnownGood", gt_windows_print_syscall_ntenablelastknowngood, gt_windows_print_sysret_ntenablelastknowngood, NULL },
-	{ "NtEnumerateBootEntries", gt_windows_print_syscall_ntenumeratebootentries, gt_windows_print_sysret_ntenumeratebootentries, NULL },
-	{ "NtEnumerateDriverEntries", gt_windows_print_syscall_ntenumeratedriverentries, gt_windows_print_sysret_ntenumeratedriverentries, NULL },
-	{ "NtEnumerateKey", gt_windows_print_syscall_ntenumeratekey, gt_windows_print_sysret_ntenumeratekey, NULL },
-	{ "NtEnumerateSystemEnvironmentValuesEx", gt_windows_print_syscall_ntenumeratesystemenvironmentvaluesex, gt_windows_print_sysret_ntenumeratesystemenvironmentvaluesex, NULL },
-	{ "NtEnumerateTransactionObject", gt_windows_print_syscall_ntenumeratetransactionobject, gt_windows_print_sysret_ntenumeratetransactionobject, NULL },
-	{ "NtEnumerateValueKey", gt_windows_print_syscall_ntenumeratevaluekey, gt_windows_print_sysret_ntenumeratevaluekey, NULL },
-	{ "NtExtendSection", gt_windows_print_syscall_ntextendsection, gt_windows_print_sysret_ntextendsection, NULL },
-	{ "NtFilterToken", gt_windows_print_syscall_ntfiltertoken, gt_windows_print_sysret_ntfiltertoken, NULL },
-	{ "NtFindAtom", gt_windows_print_syscall_ntfindatom, gt_windows_print_sysret_ntfindatom, NULL },
-	{ "NtFlushBuffersFile", gt_windows_print_syscall_ntflushbuffersfile, gt_windows_print_sysret_ntflushbuffersfile, NULL },
-	{ "NtFlushInstallUILanguage", gt_windows_print_syscall_ntflushinstalluilanguage, gt_windows_print_sysret_ntflushinstalluilanguage, NULL },
-	{ "NtFlushInstructionCache", gt_windows_print_syscall_ntflushinstructioncache, gt_windows_print_sysret_ntflushinstructioncache, NULL },
-	{ "NtFlushKey", gt_windows_print_syscall_ntflushkey, gt_windows_print_sysret_ntflushkey, NULL },
-	{ "NtFlushProcessWriteBuffers", gt_windows_print_syscall_ntflushprocesswritebuffers, gt_windows_print_sysret_ntflushprocesswritebuffers, NULL },
-	{ "NtFlushVirtualMemory", gt_windows_print_syscall_ntflushvirtualmemory, gt_windows_print_sysret_ntflushvirtualmemory, NULL },
-	{ "NtFlushWriteBuffer", gt_windows_print_syscall_ntflushwritebuffer, gt_windows_print_sysret_ntflushwritebuffer, NULL },
-	{ "NtFreeUserPhysicalPages", gt_windows_print_syscall_ntfreeuserphysicalpages, gt_windows_print_sysret_ntfreeuserphysicalpages, NULL },
-	{ "NtFreeVirtualMemory", gt_windows_print_syscall_ntfreevirtualmemory, gt_windows_print_sysret_ntfreevirtualmemory, NULL },
-	{ "NtFreezeRegistry", gt_windows_print_syscall_ntfreezeregistry, gt_windows_print_sysret_ntfreezeregistry, NULL },
-	{ "NtFreezeTransactions", gt_windows_print_syscall_ntfreezetransactions, gt_windows_print_sysret_ntfreezetransactions, NULL },
-	{ "NtFsControlFile", gt_windows_print_syscall_ntfscontrolfile, gt_windows_print_sysret_ntfscontrolfile, NULL },
-	{ "NtGetContextThread", gt_windows_print_syscall_ntgetcontextthread, gt_windows_print_sysret_ntgetcontextthread, NULL },
-	{ "NtGetCurrentProcessorNumber", gt_windows_print_syscall_ntgetcurrentprocessornumber, gt_windows_print_sysret_ntgetcurrentprocessornumber, NULL },
-	{ "NtGetDevicePowerState", gt_windows_print_syscall_ntgetdevicepowerstate, gt_windows_print_sysret_ntgetdevicepowerstate, NULL },
-	{ "NtGetMUIRegistryInfo", gt_windows_print_syscall_ntgetmuiregistryinfo, gt_windows_print_sysret_ntgetmuiregistryinfo, NULL },
-	{ "NtGetNextProcess", gt_windows_print_syscall_ntgetnextprocess, gt_windows_print_sysret_ntgetnextprocess, NULL },
-	{ "NtGetNextThread", gt_windows_print_syscall_ntgetnextthread, gt_windows_print_sysret_ntgetnextthread, NULL },
-	{ "NtGetNlsSectionPtr", gt_windows_print_syscall_ntgetnlssectionptr, gt_windows_print_sysret_ntgetnlssectionptr, NULL },
-	{ "NtGetNotificationResourceManager", gt_windows_print_syscall_ntgetnotificationresourcemanager, gt_windows_print_sysret_ntgetnotificationresourcemanager, NULL },
-	{ "NtGetPlugPlayEvent", gt_windows_print_syscall_ntgetplugplayevent, gt_windows_print_sysret_ntgetplugplayevent, NULL },
-	{ "NtGetWriteWatch", gt_windows_print_syscall_ntgetwritewatch, gt_windows_print_sysret_ntgetwritewatch, NULL },
-	{ "NtImpersonateAnonymousToken", gt_windows_print_syscall_ntimpersonateanonymoustoken, gt_windows_print_sysret_ntimpersonateanonymoustoken, NULL },
-	{ "NtImpersonateClientOfPort", gt_windows_print_syscall_ntimpersonateclientofport, gt_windows_print_sysret_ntimpersonateclientofport, NULL },
-	{ "NtImpersonateThread", gt_windows_print_syscall_ntimpersonatethread, gt_windows_print_sysret_ntimpersonatethread, NULL },
-	{ "NtInitializeNlsFiles", gt_windows_print_syscall_ntinitializenlsfiles, gt_windows_print_sysret_ntinitializenlsfiles, NULL },
-	{ "NtInitializeRegistry", gt_windows_print_syscall_ntinitializeregistry, gt_windows_print_sysret_ntinitializeregistry, NULL },
-	{ "NtInitiatePowerAction", gt_windows_print_syscall_ntinitiatepoweraction, gt_windows_print_sysret_ntinitiatepoweraction, NULL },
-	{ "NtIsProcessInJob", gt_windows_print_syscall_ntisprocessinjob, gt_windows_print_sysret_ntisprocessinjob, NULL },
-	{ "NtIsSystemResumeAutomatic", gt_windows_print_syscall_ntissystemresumeautomatic, gt_windows_print_sysret_ntissystemresumeautomatic, NULL },
-	{ "NtIsUILanguageComitted", gt_windows_print_syscall_ntisuilanguagecomitted, gt_windows_print_sysret_ntisuilanguagecomitted, NULL },
-	{ "NtListenPort", gt_windows_print_syscall_ntlistenport, gt_windows_print_sysret_ntlistenport, NULL },
-	{ "NtLoadDriver", gt_windows_print_syscall_ntloaddriver, gt_windows_print_sysret_ntloaddriver, NULL },
-	{ "NtLoadKey2", gt_windows_print_syscall_ntloadkey2, gt_windows_print_sysret_ntloadkey2, NULL },
-	{ "NtLoadKeyEx", gt_windows_print_syscall_ntloadkeyex, gt_windows_print_sysret_ntloadkeyex, NULL },
-	{ "NtLoadKey", gt_windows_print_syscall_ntloadkey, gt_windows_print_sysret_ntloadkey, NULL },
-	{ "NtLockFile", gt_windows_print_syscall_ntlockfile, gt_windows_print_sysret_ntlockfile, NULL },
-	{ "NtLockProductActivationKeys", gt_windows_print_syscall_ntlockproductactivationkeys, gt_windows_print_sysret_ntlockproductactivationkeys, NULL },
-	{ "NtLockRegistryKey", gt_windows_print_syscall_ntlockregistrykey, gt_windows_print_sysret_ntlockregistrykey, NULL },
-	{ "NtLockVirtualMemory", gt_windows_print_syscall_ntlockvirtualmemory, gt_windows_print_sysret_ntlockvirtualmemory, NULL },
-	{ "NtMakePermanentObject", gt_windows_print_syscall_ntmakepermanentobject, gt_windows_print_sysret_ntmakepermanentobject, NULL },
-	{ "NtMakeTemporaryObject", gt_windows_print_syscall_ntmaketemporaryobject, gt_windows_print_sysret_ntmaketemporaryobject, NULL },
-	{ "NtMapCMFModule", gt_windows_print_syscall_ntmapcmfmodule, gt_windows_print_sysret_ntmapcmfmodule, NULL },
-	{ "NtMapUserPhysicalPages", gt_windows_print_syscall_ntmapuserphysicalpages, gt_windows_print_sysret_ntmapuserphysicalpages, NULL },
-	{ "NtMapUserPhysicalPagesScatter", gt_windows_print_syscall_ntmapuserphysicalpagesscatter, gt_windows_print_sysret_ntmapuserphysicalpagesscatter, NULL },
-	{ "NtMapViewOfSection", gt_windows_print_syscall_ntmapviewofsection, gt_windows_print_sysret_ntmapviewofsection, NULL },
-	{ "NtModifyBootEntry", gt_windows_print_syscall_ntmodifybootentry, gt_windows_print_sysret_ntmodifybootentry, NULL },
-	{ "NtModifyDriverEntry", gt_windows_print_syscall_ntmodifydriverentry, gt_windows_print_sysret_ntmodifydriverentry, NULL },
-	{ "NtNotifyChangeDirectoryFile", gt_windows_print_syscall_ntnotifychangedirectoryfile, gt_windows_print_sysret_ntnotifychangedirectoryfile, NULL },
-	{ "NtNotifyChangeKey", gt_windows_print_syscall_ntnotifychangekey, gt_windows_print_sysret_ntnotifychangekey, NULL },
-	{ "NtNotifyChangeMultipleKeys", gt_windows_print_syscall_ntnotifychangemultiplekeys, gt_windows_print_sysret_ntnotifychangemultiplekeys, NULL },
-	{ "NtNotifyChangeSession", gt_windows_print_syscall_ntnotifychangesession, gt_windows_print_sysret_ntnotifychangesession, NULL },
-	{ "NtOpenDirectoryObject", gt_windows_print_syscall_ntopendirectoryobject, gt_windows_print_sysret_ntopendirectoryobject, NULL },
-	{ "NtOpenEnlistment", gt_windows_print_syscall_ntopenenlistment, gt_windows_print_sysret_ntopenenlistment, NULL },
-	{ "NtOpenEvent", gt_windows_print_syscall_ntopenevent, gt_windows_print_sysret_ntopenevent, NULL },
-	{ "NtOpenEventPair", gt_windows_print_syscall_ntopeneventpair, gt_windows_print_sysret_ntopeneventpair, NULL },
-	{ "NtOpenFile", gt_windows_print_syscall_ntopenfile, gt_windows_print_sysret_ntopenfile, NULL },
-	{ "NtOpenIoCompletion", gt_windows_print_syscall_ntopeniocompletion, gt_windows_print_sysret_ntopeniocompletion, NULL },
-	{ "NtOpenJobObject", gt_windows_print_syscall_ntopenjobobject, gt_windows_print_sysret_ntopenjobobject, NULL },
-	{ "NtOpenKeyedEvent", gt_windows_print_syscall_ntopenkeyedevent, gt_windows_print_sysret_ntopenkeyedevent, NULL },
-	{ "NtOpenKeyEx", gt_windows_print_syscall_ntopenkeyex, gt_windows_print_sysret_ntopenkeyex, NULL },
-	{ "NtOpenKey", gt_windows_print_syscall_ntopenkey, gt_windows_print_sysret_ntopenkey, NULL },
-	{ "NtOpenKeyTransactedEx", gt_windows_print_syscall_ntopenkeytransactedex, gt_windows_print_sysret_ntopenkeytransactedex, NULL },
-	{ "NtOpenKeyTransacted", gt_windows_print_syscall_ntopenkeytransacted, gt_windows_print_sysret_ntopenkeytransacted, NULL },
-	{ "NtOpenMutant", gt_windows_print_syscall_ntopenmutant, gt_windows_print_sysret_ntopenmutant, NULL },
-	{ "NtOpenObjectAuditAlarm", gt_windows_print_syscall_ntopenobjectauditalarm, gt_windows_print_sysret_ntopenobjectauditalarm, NULL },
-	{ "NtOpenPrivateNamespace", gt_windows_print_syscall_ntopenprivatenamespace, gt_windows_print_sysret_ntopenprivatenamespace, NULL },
-	{ "NtOpenProcess", gt_windows_print_syscall_ntopenprocess, gt_windows_print_sysret_ntopenprocess, NULL },
-	{ "NtOpenProcessTokenEx", gt_windows_print_syscall_ntopenprocesstokenex, gt_windows_print_sysret_ntopenprocesstokenex, NULL },
-	{ "NtOpenProcessToken", gt_windows_print_syscall_ntopenprocesstoken, gt_windows_print_sysret_ntopenprocesstoken, NULL },
-	{ "NtOpenResourceManager", gt_windows_print_syscall_ntopenresourcemanager, gt_windows_print_sysret_ntopenresourcemanager, NULL },
-	{ "NtOpenSection", gt_windows_print_syscall_ntopensection, gt_windows_print_sysret_ntopensection, NULL },
-	{ "NtOpenSemaphore", gt_windows_print_syscall_ntopensemaphore, gt_windows_print_sysret_ntopensemaphore, NULL },
-	{ "NtOpenSession", gt_windows_print_syscall_ntopensession, gt_windows_print_sysret_ntopensession, NULL },
-	{ "NtOpenSymbolicLinkObject", gt_windows_print_syscall_ntopensymboliclinkobject, gt_windows_print_sysret_ntopensymboliclinkobject, NULL },
-	{ "NtOpenThread", gt_windows_print_syscall_ntopenthread, gt_windows_print_sysret_ntopenthread, NULL },
-	{ "NtOpenThreadTokenEx", gt_windows_print_syscall_ntopenthreadtokenex, gt_windows_print_sysret_ntopenthreadtokenex, NULL },
-	{ "NtOpenThreadToken", gt_windows_print_syscall_ntopenthreadtoken, gt_windows_print_sysret_ntopenthreadtoken, NULL },
-	{ "NtOpenTimer", gt_windows_print_syscall_ntopentimer, gt_windows_print_sysret_ntopentimer, NULL },
-	{ "NtOpenTransactionManager", gt_windows_print_syscall_ntopentransactionmanager, gt_windows_print_sysret_ntopentransactionmanager, NULL },
-	{ "NtOpenTransaction", gt_windows_print_syscall_ntopentransaction, gt_windows_print_sysret_ntopentransaction, NULL },
-	{ "NtPlugPlayControl", gt_windows_print_syscall_ntplugplaycontrol, gt_windows_print_sysret_ntplugplaycontrol, NULL },
-	{ "NtPowerInformation", gt_windows_print_syscall_ntpowerinformation, gt_windows_print_sysret_ntpowerinformation, NULL },
-	{ "NtPrepareComplete", gt_windows_print_syscall_ntpreparecomplete, gt_windows_print_sysret_ntpreparecomplete, NULL },
-	{ "NtPrepareEnlistment", gt_windows_print_syscall_ntprepareenlistment, gt_windows_print_sysret_ntprepareenlistment, NULL },
-	{ "NtPrePrepareComplete", gt_windows_print_syscall_ntprepreparecomplete, gt_windows_print_sysret_ntprepreparecomplete, NULL },
-	{ "NtPrePrepareEnlistment", gt_windows_print_syscall_ntpreprepareenlistment, gt_windows_print_sysret_ntpreprepareenlistment, NULL },
-	{ "NtPrivilegeCheck", gt_windows_print_syscall_ntprivilegecheck, gt_windows_print_sysret_ntprivilegecheck, NULL },
-	{ "NtPrivilegedServiceAuditAlarm", gt_windows_print_syscall_ntprivilegedserviceauditalarm, gt_windows_print_sysret_ntprivilegedserviceauditalarm, NULL },
-	{ "NtPrivilegeObjectAuditAlarm", gt_windows_print_syscall_ntprivilegeobjectauditalarm, gt_windows_print_sysret_ntprivilegeobjectauditalarm, NULL },
-	{ "NtPropagationComplete", gt_windows_print_syscall_ntpropagationcomplete, gt_windows_print_sysret_ntpropagationcomplete, NULL },
-	{ "NtPropagationFailed", gt_windows_print_syscall_ntpropagationfailed, gt_windows_print_sysret_ntpropagationfailed, NULL },
-	{ "NtProtectVirtualMemory", gt_windows_print_syscall_ntprotectvirtualmemory, gt_windows_print_sysret_ntprotectvirtualmemory, NULL },
-	{ "NtPulseEvent", gt_windows_print_syscall_ntpulseevent, gt_windows_print_sysret_ntpulseevent, NULL },
-	{ "NtQueryAttributesFile", gt_windows_print_syscall_ntqueryattributesfile, gt_windows_print_sysret_ntqueryattributesfile, NULL },
-	{ "NtQueryBootEntryOrder", gt_windows_print_syscall_ntquerybootentryorder, gt_windows_print_sysret_ntquerybootentryorder, NULL },
-	{ "NtQueryBootOptions", gt_windows_print_syscall_ntquerybootoptions, gt_windows_print_sysret_ntquerybootoptions, NULL },
-	{ "NtQueryDebugFilterState", gt_windows_print_syscall_ntquerydebugfilterstate, gt_windows_print_sysret_ntquerydebugfilterstate, NULL },
-	{ "NtQueryDefaultLocale", gt_windows_print_syscall_ntquerydefaultlocale, gt_windows_print_sysret_ntquerydefaultlocale, NULL },
-	{ "NtQueryDefaultUILanguage", gt_windows_print_syscall_ntquerydefaultuilanguage, gt_windows_print_sysret_ntquerydefaultuilanguage, NULL },
-	{ "NtQueryDirectoryFile", gt_windows_print_syscall_ntquerydirectoryfile, gt_windows_print_sysret_ntquerydirectoryfile, NULL },
-	{ "NtQueryDirectoryObject", gt_windows_print_syscall_ntquerydirectoryobject, gt_windows_print_sysret_ntquerydirectoryobject, NULL },
-	{ "NtQueryDriverEntryOrder", gt_windows_print_syscall_ntquerydriverentryorder, gt_windows_print_sysret_ntquerydriverentryorder, NULL },
-	{ "NtQueryEaFile", gt_windows_print_syscall_ntqueryeafile, gt_windows_print_sysret_ntqueryeafile, NULL },
-	{ "NtQueryEvent", gt_windows_print_syscall_ntqueryevent, gt_windows_print_sysret_ntqueryevent, NULL },
-	{ "NtQueryFullAttributesFile", gt_windows_print_syscall_ntqueryfullattributesfile, gt_windows_print_sysret_ntqueryfullattributesfile, NULL },
-	{ "NtQueryInformationAtom", gt_windows_print_syscall_ntqueryinformationatom, gt_windows_print_sysret_ntqueryinformationatom, NULL },
-	{ "NtQueryInformationEnlistment", gt_windows_print_syscall_ntqueryinformationenlistment, gt_windows_print_sysret_ntqueryinformationenlistment, NULL },
-	{ "NtQueryInformationFile", gt_windows_print_syscall_ntqueryinformationfile, gt_windows_print_sysret_ntqueryinformationfile, NULL },
-	{ "NtQueryInformationJobObject", gt_windows_print_syscall_ntqueryinformationjobobject, gt_windows_print_sysret_ntqueryinformationjobobject, NULL },
-	{ "NtQueryInformationPort", gt_windows_print_syscall_ntqueryinformationport, gt_windows_print_sysret_ntqueryinformationport, NULL },
-	{ "NtQueryInformationProcess", gt_windows_print_syscall_ntqueryinformationprocess, gt_windows_print_sysret_ntqueryinformationprocess, NULL },
-	{ "NtQueryInformationResourceManager", gt_windows_print_syscall_ntqueryinformationresourcemanager, gt_windows_print_sysret_ntqueryinformationresourcemanager, NULL },
-	{ "NtQueryInformationThread", gt_windows_print_syscall_ntqueryinformationthread, gt_windows_print_sysret_ntqueryinformationthread, NULL },
-	{ "NtQueryInformationToken", gt_windows_print_syscall_ntqueryinformationtoken, gt_windows_print_sysret_ntqueryinformationtoken, NULL },
-	{ "NtQueryInformationTransaction", gt_windows_print_syscall_ntqueryinformationtransaction, gt_windows_print_sysret_ntqueryinformationtransaction, NULL },
-	{ "NtQueryInformationTransactionManager", gt_windows_print_syscall_ntqueryinformationtransactionmanager, gt_windows_print_sysret_ntqueryinformationtransactionmanager, NULL },
-	{ "NtQueryInformationWorkerFactory", gt_windows_print_syscall_ntqueryinformationworkerfactory, gt_windows_print_sysret_ntqueryinformationworkerfactory, NULL },
-	{ "NtQueryInstallUILanguage", gt_windows_print_syscall_ntqueryinstalluilanguage, gt_windows_print_sysret_ntqueryinstalluilanguage, NULL },
-	{ "NtQueryIntervalProfile", gt_windows_print_syscall_ntqueryintervalprofile, gt_windows_print_sysret_ntqueryintervalprofile, NULL },
-	{ "NtQueryIoCompletion", gt_windows_print_syscall_ntqueryiocompletion, gt_windows_print_sysret_ntqueryiocompletion, NULL },
-	{ "NtQueryKey", gt_windows_print_syscall_ntquerykey, gt_windows_print_sysret_ntquerykey, NULL },
-	{ "NtQueryLicenseValue", gt_windows_print_syscall_ntquerylicensevalue, gt_windows_print_sysret_ntquerylicensevalue, NULL },
-	{ "NtQueryMultipleValueKey", gt_windows_print_syscall_ntquerymultiplevaluekey, gt_windows_print_sysret_ntquerymultiplevaluekey, NULL },
-	{ "NtQueryMutant", gt_windows_print_syscall_ntquerymutant, gt_windows_print_sysret_ntquerymutant, NULL },
-	{ "NtQueryObject", gt_windows_print_syscall_ntqueryobject, gt_windows_print_sysret_ntqueryobject, NULL },
-	{ "NtQueryOpenSubKeysEx", gt_windows_print_syscall_ntqueryopensubkeysex, gt_windows_print_sysret_ntqueryopensubkeysex, NULL },
-	{ "NtQueryOpenSubKeys", gt_windows_print_syscall_ntqueryopensubkeys, gt_windows_print_sysret_ntqueryopensubkeys, NULL },
-	{ "NtQueryPerformanceCounter", gt_windows_print_syscall_ntqueryperformancecounter, gt_windows_print_sysret_ntqueryperformancecounter, NULL },
-	{ "NtQueryPortInformationProcess", gt_windows_print_syscall_ntqueryportinformationprocess, gt_windows_print_sysret_ntqueryportinformationprocess, NULL },
-	{ "NtQueryQuotaInformationFile", gt_windows_print_syscall_ntqueryquotainformationfile, gt_windows_print_sysret_ntqueryquotainformationfile, NULL },
-	{ "NtQuerySection", gt_windows_print_syscall_ntquerysection, gt_windows_print_sysret_ntquerysection, NULL },
-	{ "NtQuerySecurityAttributesToken", gt_windows_print_syscall_ntquerysecurityattributestoken, gt_windows_print_sysret_ntquerysecurityattributestoken, NULL },
-	{ "NtQuerySecurityObject", gt_windows_print_syscall_ntquerysecurityobject, gt_windows_print_sysret_ntquerysecurityobject, NULL },
-	{ "NtQuerySemaphore", gt_windows_print_syscall_ntquerysemaphore, gt_windows_print_sysret_ntquerysemaphore, NULL },
-	{ "NtQuerySymbolicLinkObject", gt_windows_print_syscall_ntquerysymboliclinkobject, gt_windows_print_sysret_ntquerysymboliclinkobject, NULL },
-	{ "NtQuerySystemEnvironmentValueEx", gt_windows_print_syscall_ntquerysystemenvironmentvalueex, gt_windows_print_sysret_ntquerysystemenvironmentvalueex, NULL },
-	{ "NtQuerySystemEnvironmentValue", gt_windows_print_syscall_ntquerysystemenvironmentvalue, gt_windows_print_sysret_ntquerysystemenvironmentvalue, NULL },
-	{ "NtQuerySystemInformationEx", gt_windows_print_syscall_ntquerysysteminformationex, gt_windows_print_sysret_ntquerysysteminformationex, NULL },
-	{ "NtQuerySystemInformation", gt_windows_print_syscall_ntquerysysteminformation, gt_windows_print_sysret_ntquerysysteminformation, NULL },
-	{ "NtQuerySystemTime", gt_windows_print_syscall_ntquerysystemtime, gt_windows_print_sysret_ntquerysystemtime, NULL },
-	{ "NtQueryTimer", gt_windows_print_syscall_ntquerytimer, gt_windows_print_sysret_ntquerytimer, NULL },
-	{ "NtQueryTimerResolution", gt_windows_print_syscall_ntquerytimerresolution, gt_windows_print_sysret_ntquerytimerresolution, NULL },
-	{ "NtQueryValueKey", gt_windows_print_syscall_ntqueryvaluekey, gt_windows_print_sysret_ntqueryvaluekey, NULL },
-	{ "NtQueryVirtualMemory", gt_windows_print_syscall_ntqueryvirtualmemory, gt_windows_print_sysret_ntqueryvirtualmemory, NULL },
-	{ "NtQueryVolumeInformationFile", gt_windows_print_syscall_ntqueryvolumeinformationfile, gt_windows_print_sysret_ntqueryvolumeinformationfile, NULL },
-	{ "NtQueueApcThreadEx", gt_windows_print_syscall_ntqueueapcthreadex, gt_windows_print_sysret_ntqueueapcthreadex, NULL },
-	{ "NtQueueApcThread", gt_windows_print_syscall_ntqueueapcthread, gt_windows_print_sysret_ntqueueapcthread, NULL },
-	{ "NtRaiseException", gt_windows_print_syscall_ntraiseexception, gt_windows_print_sysret_ntraiseexception, NULL },
-	{ "NtRaiseHardError", gt_windows_print_syscall_ntraiseharderror, gt_windows_print_sysret_ntraiseharderror, NULL },
-	{ "NtReadFile", gt_windows_print_syscall_ntreadfile, gt_windows_print_sysret_ntreadfile, NULL },
-	{ "NtReadFileScatter", gt_windows_print_syscall_ntreadfilescatter, gt_windows_print_sysret_ntreadfilescatter, NULL },
-	{ "NtReadOnlyEnlistment", gt_windows_print_syscall_ntreadonlyenlistment, gt_windows_print_sysret_ntreadonlyenlistment, NULL },
-	{ "NtReadRequestData", gt_windows_print_syscall_ntreadrequestdata, gt_windows_print_sysret_ntreadrequestdata, NULL },
-	{ "NtReadVirtualMemory", gt_windows_print_syscall_ntreadvirtualmemory, gt_windows_print_sysret_ntreadvirtualmemory, NULL },
-	{ "NtRecoverEnlistment", gt_windows_print_syscall_ntrecoverenlistment, gt_windows_print_sysret_ntrecoverenlistment, NULL },
-	{ "NtRecoverResourceManager", gt_windows_print_syscall_ntrecoverresourcemanager, gt_windows_print_sysret_ntrecoverresourcemanager, NULL },
-	{ "NtRecoverTransactionManager", gt_windows_print_syscall_ntrecovertransactionmanager, gt_windows_print_sysret_ntrecovertransactionmanager, NULL },
-	{ "NtRegisterProtocolAddressInformation", gt_windows_print_syscall_ntregisterprotocoladdressinformation, gt_windows_print_sysret_ntregisterprotocoladdressinformation, NULL },
-	{ "NtRegisterThreadTerminatePort", gt_windows_print_syscall_ntregisterthreadterminateport, gt_windows_print_sysret_ntregisterthreadterminateport, NULL },
-	{ "NtReleaseKeyedEvent", gt_windows_print_syscall_ntreleasekeyedevent, gt_windows_print_sysret_ntreleasekeyedevent, NULL },
-	{ "NtReleaseMutant", gt_windows_print_syscall_ntreleasemutant, gt_windows_print_sysret_ntreleasemutant, NULL },
-	{ "NtReleaseSemaphore", gt_windows_print_syscall_ntreleasesemaphore, gt_windows_print_sysret_ntreleasesemaphore, NULL },
-	{ "NtReleaseWorkerFactoryWorker", gt_windows_print_syscall_ntreleaseworkerfactoryworker, gt_windows_print_sysret_ntreleaseworkerfactoryworker, NULL },
-	{ "NtRemoveIoCompletionEx", gt_windows_print_syscall_ntremoveiocompletionex, gt_windows_print_sysret_ntremoveiocompletionex, NULL },
-	{ "NtRemoveIoCompletion", gt_windows_print_syscall_ntremoveiocompletion, gt_windows_print_sysret_ntremoveiocompletion, NULL },
-	{ "NtRemoveProcessDebug", gt_windows_print_syscall_ntremoveprocessdebug, gt_windows_print_sysret_ntremoveprocessdebug, NULL },
-	{ "NtRenameKey", gt_windows_print_syscall_ntrenamekey, gt_windows_print_sysret_ntrenamekey, NULL },
-	{ "NtRenameTransactionManager", gt_windows_print_syscall_ntrenametransactionmanager, gt_windows_print_sysret_ntrenametransactionmanager, NULL },
-	{ "NtReplaceKey", gt_windows_print_syscall_ntreplacekey, gt_windows_print_sysret_ntreplacekey, NULL },
-	{ "NtReplacePartitionUnit", gt_windows_print_syscall_ntreplacepartitionunit, gt_windows_print_sysret_ntreplacepartitionunit, NULL },
-	{ "NtReplyPort", gt_windows_print_syscall_ntreplyport, gt_windows_print_sysret_ntreplyport, NULL },
-	{ "NtReplyWaitReceivePortEx", gt_windows_print_syscall_ntreplywaitreceiveportex, gt_windows_print_sysret_ntreplywaitreceiveportex, NULL },
-	{ "NtReplyWaitReceivePort", gt_windows_print_syscall_ntreplywaitreceiveport, gt_windows_print_sysret_ntreplywaitreceiveport, NULL },
-	{ "NtReplyWaitReplyPort", gt_windows_print_syscall_ntreplywaitreplyport, gt_windows_print_sysret_ntreplywaitreplyport, NULL },
-	{ "NtRequestPort", gt_windows_print_syscall_ntrequestport, gt_windows_print_sysret_ntrequestport, NULL },
-	{ "NtRequestWaitReplyPort", gt_windows_print_syscall_ntrequestwaitreplyport, gt_windows_print_sysret_ntrequestwaitreplyport, NULL },
-	{ "NtResetEvent", gt_windows_print_syscall_ntresetevent, gt_windows_print_sysret_ntresetevent, NULL },
-	{ "NtResetWriteWatch", gt_windows_print_syscall_ntresetwritewatch, gt_windows_print_sysret_ntresetwritewatch, NULL },
-	{ "NtRestoreKey", gt_windows_print_syscall_ntrestorekey, gt_windows_print_sysret_ntrestorekey, NULL },
-	{ "NtResumeProcess", gt_windows_print_syscall_ntresumeprocess, gt_windows_print_sysret_ntresumeprocess, NULL },
-	{ "NtResumeThread", gt_windows_print_syscall_ntresumethread, gt_windows_print_sysret_ntresumethread, NULL },
-	{ "NtRollbackComplete", gt_windows_print_syscall_ntrollbackcomplete, gt_windows_print_sysret_ntrollbackcomplete, NULL },
-	{ "NtRollbackEnlistment", gt_windows_print_syscall_ntrollbackenlistment, gt_windows_print_sysret_ntrollbackenlistment, NULL },
-	{ "NtRollbackTransaction", gt_windows_print_syscall_ntrollbacktransaction, gt_windows_print_sysret_ntrollbacktransaction, NULL },
-	{ "NtRollforwardTransactionManager", gt_windows_print_syscall_ntrollforwardtransactionmanager, gt_windows_print_sysret_ntrollforwardtransactionmanager, NULL },
-	{ "NtSaveKeyEx", gt_windows_print_syscall_ntsavekeyex, gt_windows_print_sysret_ntsavekeyex, NULL },
-	{ "NtSaveKey", gt_windows_print_syscall_ntsavekey, gt_windows_print_sysret_ntsavekey, NULL },
-	{ "NtSaveMergedKeys", gt_windows_print_syscall_ntsavemergedkeys, gt_windows_print_sysret_ntsavemergedkeys, NULL },
-	{ "NtSecureConnectPort", gt_windows_print_syscall_ntsecureconnectport, gt_windows_print_sysret_ntsecureconnectport, NULL },
-	{ "NtSerializeBoot", gt_windows_print_syscall_ntserializeboot, gt_windows_print_sysret_ntserializeboot, NULL },
-	{ "NtSetBootEntryOrder", gt_windows_print_syscall_ntsetbootentryorder, gt_windows_print_sysret_ntsetbootentryorder, NULL },
-	{ "NtSetBootOptions", gt_windows_print_syscall_ntsetbootoptions, gt_windows_print_sysret_ntsetbootoptions, NULL },
-	{ "NtSetContextThread", gt_windows_print_syscall_ntsetcontextthread, gt_windows_print_sysret_ntsetcontextthread, NULL },
-	{ "NtSetDebugFilterState", gt_windows_print_syscall_ntsetdebugfilterstate, gt_windows_print_sysret_ntsetdebugfilterstate, NULL },
-	{ "NtSetDefaultHardErrorPort", gt_windows_print_syscall_ntsetdefaultharderrorport, gt_windows_print_sysret_ntsetdefaultharderrorport, NULL },
-	{ "NtSetDefaultLocale", gt_windows_print_syscall_ntsetdefaultlocale, gt_windows_print_sysret_ntsetdefaultlocale, NULL },
-	{ "NtSetDefaultUILanguage", gt_windows_print_syscall_ntsetdefaultuilanguage, gt_windows_print_sysret_ntsetdefaultuilanguage, NULL },
-	{ "NtSetDriverEntryOrder", gt_windows_print_syscall_ntsetdriverentryorder, gt_windows_print_sysret_ntsetdriverentryorder, NULL },
-	{ "NtSetEaFile", gt_windows_print_syscall_ntseteafile, gt_windows_print_sysret_ntseteafile, NULL },
-	{ "NtSetEventBoostPriority", gt_windows_print_syscall_ntseteventboostpriority, gt_windows_print_sysret_ntseteventboostpriority, NULL },
-	{ "NtSetEvent", gt_windows_print_syscall_ntsetevent, gt_windows_print_sysret_ntsetevent, NULL },
-	{ "NtSetHighEventPair", gt_windows_print_syscall_ntsethigheventpair, gt_windows_print_sysret_ntsethigheventpair, NULL },
-	{ "NtSetHighWaitLowEventPair", gt_windows_print_syscall_ntsethighwaitloweventpair, gt_windows_print_sysret_ntsethighwaitloweventpair, NULL },
-	{ "NtSetInformationDebugObject", gt_windows_print_syscall_ntsetinformationdebugobject, gt_windows_print_sysret_ntsetinformationdebugobject, NULL },
-	{ "NtSetInformationEnlistment", gt_windows_print_syscall_ntsetinformationenlistment, gt_windows_print_sysret_ntsetinformationenlistment, NULL },
-	{ "NtSetInformationFile", gt_windows_print_syscall_ntsetinformationfile, gt_windows_print_sysret_ntsetinformationfile, NULL },
-	{ "NtSetInformationJobObject", gt_windows_print_syscall_ntsetinformationjobobject, gt_windows_print_sysret_ntsetinformationjobobject, NULL },
-	{ "NtSetInformationKey", gt_windows_print_syscall_ntsetinformationkey, gt_windows_print_sysret_ntsetinformationkey, NULL },
-	{ "NtSetInformationObject", gt_windows_print_syscall_ntsetinformationobject, gt_windows_print_sysret_ntsetinformationobject, NULL },
-	{ "NtSetInformationProcess", gt_windows_print_syscall_ntsetinformationprocess, gt_windows_print_sysret_ntsetinformationprocess, NULL },
-	{ "NtSetInformationResourceManager", gt_windows_print_syscall_ntsetinformationresourcemanager, gt_windows_print_sysret_ntsetinformationresourcemanager, NULL },
-	{ "NtSetInformationThread", gt_windows_print_syscall_ntsetinformationthread, gt_windows_print_sysret_ntsetinformationthread, NULL },
-	{ "NtSetInformationToken", gt_windows_print_syscall_ntsetinformationtoken, gt_windows_print_sysret_ntsetinformationtoken, NULL },
-	{ "NtSetInformationTransaction", gt_windows_print_syscall_ntsetinformationtransaction, gt_windows_print_sysret_ntsetinformationtransaction, NULL },
-	{ "NtSetInformationTransactionManager", gt_windows_print_syscall_ntsetinformationtransactionmanager, gt_windows_print_sysret_ntsetinformationtransactionmanager, NULL },
-	{ "NtSetInformationWorkerFactory", gt_windows_print_syscall_ntsetinformationworkerfactory, gt_windows_print_sysret_ntsetinformationworkerfactory, NULL },
-	{ "NtSetIntervalProfile", gt_windows_print_syscall_ntsetintervalprofile, gt_windows_print_sysret_ntsetintervalprofile, NULL },
-	{ "NtSetIoCompletionEx", gt_windows_print_syscall_ntsetiocompletionex, gt_windows_print_sysret_ntsetiocompletionex, NULL },
-	{ "NtSetIoCompletion", gt_windows_print_syscall_ntsetiocompletion, gt_windows_print_sysret_ntsetiocompletion, NULL },
-	{ "NtSetLdtEntries", gt_windows_print_syscall_ntsetldtentries, gt_windows_print_sysret_ntsetldtentries, NULL },
-	{ "NtSetLowEventPair", gt_windows_print_syscall_ntsetloweventpair, gt_windows_print_sysret_ntsetloweventpair, NULL },
-	{ "NtSetLowWaitHighEventPair", gt_windows_print_syscall_ntsetlowwaithigheventpair, gt_windows_print_sysret_ntsetlowwaithigheventpair, NULL },
-	{ "NtSetQuotaInformationFile", gt_windows_print_syscall_ntsetquotainformationfile, gt_windows_print_sysret_ntsetquotainformationfile, NULL },
-	{ "NtSetSecurityObject", gt_windows_print_syscall_ntsetsecurityobject, gt_windows_print_sysret_ntsetsecurityobject, NULL },
-	{ "NtSetSystemEnvironmentValueEx", gt_windows_print_syscall_ntsetsystemenvironmentvalueex, gt_windows_print_sysret_ntsetsystemenvironmentvalueex, NULL },
-	{ "NtSetSystemEnvironmentValue", gt_windows_print_syscall_ntsetsystemenvironmentvalue, gt_windows_print_sysret_ntsetsystemenvironmentvalue, NULL },
-	{ "NtSetSystemInformation", gt_windows_print_syscall_ntsetsysteminformation, gt_windows_print_sysret_ntsetsysteminformation, NULL },
-	{ "NtSetSystemPowerState", gt_windows_print_syscall_ntsetsystempowerstate, gt_windows_print_sysret_ntsetsystempowerstate, NULL },
-	{ "NtSetSystemTime", gt_windows_print_syscall_ntsetsystemtime, gt_windows_print_sysret_ntsetsystemtime, NULL },
-	{ "NtSetThreadExecutionState", gt_windows_print_syscall_ntsetthreadexecutionstate, gt_windows_print_sysret_ntsetthreadexecutionstate, NULL },
-	{ "NtSetTimerEx", gt_windows_print_syscall_ntsettimerex, gt_windows_print_sysret_ntsettimerex, NULL },
-	{ "NtSetTimer", gt_windows_print_syscall_ntsettimer, gt_windows_print_sysret_ntsettimer, NULL },
-	{ "NtSetTimerResolution", gt_windows_print_syscall_ntsettimerresolution, gt_windows_print_sysret_ntsettimerresolution, NULL },
-	{ "NtSetUuidSeed", gt_windows_print_syscall_ntsetuuidseed, gt_windows_print_sysret_ntsetuuidseed, NULL },
-	{ "NtSetValueKey", gt_windows_print_syscall_ntsetvaluekey, gt_windows_print_sysret_ntsetvaluekey, NULL },
-	{ "NtSetVolumeInformationFile", gt_windows_print_syscall_ntsetvolumeinformationfile, gt_windows_print_sysret_ntsetvolumeinformationfile, NULL },
-	{ "NtShutdownSystem", gt_windows_print_syscall_ntshutdownsystem, gt_windows_print_sysret_ntshutdownsystem, NULL },
-	{ "NtShutdownWorkerFactory", gt_windows_print_syscall_ntshutdownworkerfactory, gt_windows_print_sysret_ntshutdownworkerfactory, NULL },
-	{ "NtSignalAndWaitForSingleObject", gt_windows_print_syscall_ntsignalandwaitforsingleobject, gt_windows_print_sysret_ntsignalandwaitforsingleobject, NULL },
-	{ "NtSinglePhaseReject", gt_windows_print_syscall_ntsinglephasereject, gt_windows_print_sysret_ntsinglephasereject, NULL },
-	{ "NtStartProfile", gt_windows_print_syscall_ntstartprofile, gt_windows_print_sysret_ntstartprofile, NULL },
-	{ "NtStopProfile", gt_windows_print_syscall_ntstopprofile, gt_windows_print_sysret_ntstopprofile, NULL },
-	{ "NtSuspendProcess", gt_windows_print_syscall_ntsuspendprocess, gt_windows_print_sysret_ntsuspendprocess, NULL },
-	{ "NtSuspendThread", gt_windows_print_syscall_ntsuspendthread, gt_windows_print_sysret_ntsuspendthread, NULL },
-	{ "NtSystemDebugControl", gt_windows_print_syscall_ntsystemdebugcontrol, gt_windows_print_sysret_ntsystemdebugcontrol, NULL },
-	{ "NtTerminateJobObject", gt_windows_print_syscall_ntterminatejobobject, gt_windows_print_sysret_ntterminatejobobject, NULL },
-	{ "NtTerminateProcess", gt_windows_print_syscall_ntterminateprocess, gt_windows_print_sysret_ntterminateprocess, NULL },
-	{ "NtTerminateThread", gt_windows_print_syscall_ntterminatethread, gt_windows_print_sysret_ntterminatethread, NULL },
-	{ "NtTestAlert", gt_windows_print_syscall_nttestalert, gt_windows_print_sysret_nttestalert, NULL },
-	{ "NtThawRegistry", gt_windows_print_syscall_ntthawregistry, gt_windows_print_sysret_ntthawregistry, NULL },
-	{ "NtThawTransactions", gt_windows_print_syscall_ntthawtransactions, gt_windows_print_sysret_ntthawtransactions, NULL },
-	{ "NtTraceControl", gt_windows_print_syscall_nttracecontrol, gt_windows_print_sysret_nttracecontrol, NULL },
-	{ "NtTraceEvent", gt_windows_print_syscall_nttraceevent, gt_windows_print_sysret_nttraceevent, NULL },
-	{ "NtTranslateFilePath", gt_windows_print_syscall_nttranslatefilepath, gt_windows_print_sysret_nttranslatefilepath, NULL },
-	{ "NtUmsThreadYield", gt_windows_print_syscall_ntumsthreadyield, gt_windows_print_sysret_ntumsthreadyield, NULL },
-	{ "NtUnloadDriver", gt_windows_print_syscall_ntunloaddriver, gt_windows_print_sysret_ntunloaddriver, NULL },
-	{ "NtUnloadKey2", gt_windows_print_syscall_ntunloadkey2, gt_windows_print_sysret_ntunloadkey2, NULL },
-	{ "NtUnloadKeyEx", gt_windows_print_syscall_ntunloadkeyex, gt_windows_print_sysret_ntunloadkeyex, NULL },
-	{ "NtUnloadKey", gt_windows_print_syscall_ntunloadkey, gt_windows_print_sysret_ntunloadkey, NULL },
-	{ "NtUnlockFile", gt_windows_print_syscall_ntunlockfile, gt_windows_print_sysret_ntunlockfile, NULL },
-	{ "NtUnlockVirtualMemory", gt_windows_print_syscall_ntunlockvirtualmemory, gt_windows_print_sysret_ntunlockvirtualmemory, NULL },
-	{ "NtUnmapViewOfSection", gt_windows_print_syscall_ntunmapviewofsection, gt_windows_print_sysret_ntunmapviewofsection, NULL },
-	{ "NtVdmControl", gt_windows_print_syscall_ntvdmcontrol, gt_windows_print_sysret_ntvdmcontrol, NULL },
-	{ "NtWaitForDebugEvent", gt_windows_print_syscall_ntwaitfordebugevent, gt_windows_print_sysret_ntwaitfordebugevent, NULL },
-	{ "NtWaitForKeyedEvent", gt_windows_print_syscall_ntwaitforkeyedevent, gt_windows_print_sysret_ntwaitforkeyedevent, NULL },
-	{ "NtWaitForMultipleObjects32", gt_windows_print_syscall_ntwaitformultipleobjects32, gt_windows_print_sysret_ntwaitformultipleobjects32, NULL },
-	{ "NtWaitForMultipleObjects", gt_windows_print_syscall_ntwaitformultipleobjects, gt_windows_print_sysret_ntwaitformultipleobjects, NULL },
-	{ "NtWaitForSingleObject", gt_windows_print_syscall_ntwaitforsingleobject, gt_windows_print_sysret_ntwaitforsingleobject, NULL },
-	{ "NtWaitForWorkViaWorkerFactory", gt_windows_print_syscall_ntwaitforworkviaworkerfactory, gt_windows_print_sysret_ntwaitforworkviaworkerfactory, NULL },
-	{ "NtWaitHighEventPair", gt_windows_print_syscall_ntwaithigheventpair, gt_windows_print_sysret_ntwaithigheventpair, NULL },
-	{ "NtWaitLowEventPair", gt_windows_print_syscall_ntwaitloweventpair, gt_windows_print_sysret_ntwaitloweventpair, NULL },
-	{ "NtWorkerFactoryWorkerReady", gt_windows_print_syscall_ntworkerfactoryworkerready, gt_windows_print_sysret_ntworkerfactoryworkerready, NULL },
-	{ "NtWriteFileGather", gt_windows_print_syscall_ntwritefilegather, gt_windows_print_sysret_ntwritefilegather, NULL },
-	{ "NtWriteFile", gt_windows_print_syscall_ntwritefile, gt_windows_print_sysret_ntwritefile, NULL },
-	{ "NtWriteRequestData", gt_windows_print_syscall_ntwriterequestdata, gt_windows_print_sysret_ntwriterequestdata, NULL },
-	{ "NtWriteVirtualMemory", gt_windows_print_syscall_ntwritevirtualmemory, gt_windows_print_sysret_ntwritevirtualmemory, NULL },
-	{ "NtYieldExecution", gt_windows_print_syscall_ntyieldexecution, gt_windows_print_sysret_ntyieldexecution, NULL },
+const GTSyscallCallback VM_WINDOWS_SYSCALLS[] = {
+	{ "NtAcceptConnectPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[0] },
+	{ "NtAccessCheckAndAuditAlarm", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[1] },
+	{ "NtAccessCheckByTypeAndAuditAlarm", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[2] },
+	{ "NtAccessCheckByType", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[3] },
+	{ "NtAccessCheckByTypeResultListAndAuditAlarmByHandle", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[4] },
+	{ "NtAccessCheckByTypeResultListAndAuditAlarm", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[5] },
+	{ "NtAccessCheckByTypeResultList", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[6] },
+	{ "NtAccessCheck", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[7] },
+	{ "NtAddAtom", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[8] },
+	{ "NtAddBootEntry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[9] },
+	{ "NtAddDriverEntry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[10] },
+	{ "NtAdjustGroupsToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[11] },
+	{ "NtAdjustPrivilegesToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[12] },
+	{ "NtAlertResumeThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[13] },
+	{ "NtAlertThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[14] },
+	{ "NtAllocateLocallyUniqueId", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[15] },
+	{ "NtAllocateReserveObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[16] },
+	{ "NtAllocateUserPhysicalPages", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[17] },
+	{ "NtAllocateUuids", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[18] },
+	{ "NtAllocateVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[19] },
+	{ "NtAlpcAcceptConnectPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[20] },
+	{ "NtAlpcCancelMessage", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[21] },
+	{ "NtAlpcConnectPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[22] },
+	{ "NtAlpcCreatePort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[23] },
+	{ "NtAlpcCreatePortSection", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[24] },
+	{ "NtAlpcCreateResourceReserve", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[25] },
+	{ "NtAlpcCreateSectionView", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[26] },
+	{ "NtAlpcCreateSecurityContext", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[27] },
+	{ "NtAlpcDeletePortSection", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[28] },
+	{ "NtAlpcDeleteResourceReserve", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[29] },
+	{ "NtAlpcDeleteSectionView", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[30] },
+	{ "NtAlpcDeleteSecurityContext", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[31] },
+	{ "NtAlpcDisconnectPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[32] },
+	{ "NtAlpcImpersonateClientOfPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[33] },
+	{ "NtAlpcOpenSenderProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[34] },
+	{ "NtAlpcOpenSenderThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[35] },
+	{ "NtAlpcQueryInformation", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[36] },
+	{ "NtAlpcQueryInformationMessage", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[37] },
+	{ "NtAlpcRevokeSecurityContext", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[38] },
+	{ "NtAlpcSendWaitReceivePort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[39] },
+	{ "NtAlpcSetInformation", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[40] },
+	{ "NtApphelpCacheControl", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[41] },
+	{ "NtAreMappedFilesTheSame", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[42] },
+	{ "NtAssignProcessToJobObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[43] },
+	{ "NtCallbackReturn", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[44] },
+	{ "NtCancelIoFileEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[45] },
+	{ "NtCancelIoFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[46] },
+	{ "NtCancelSynchronousIoFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[47] },
+	{ "NtCancelTimer", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[48] },
+	{ "NtClearEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[49] },
+	{ "NtClose", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[50] },
+	{ "NtCloseObjectAuditAlarm", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[51] },
+	{ "NtCommitComplete", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[52] },
+	{ "NtCommitEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[53] },
+	{ "NtCommitTransaction", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[54] },
+	{ "NtCompactKeys", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[55] },
+	{ "NtCompareTokens", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[56] },
+	{ "NtCompleteConnectPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[57] },
+	{ "NtCompressKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[58] },
+	{ "NtConnectPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[59] },
+	{ "NtContinue", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[60] },
+	{ "NtCreateDebugObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[61] },
+	{ "NtCreateDirectoryObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[62] },
+	{ "NtCreateEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[63] },
+	{ "NtCreateEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[64] },
+	{ "NtCreateEventPair", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[65] },
+	{ "NtCreateFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[66] },
+	{ "NtCreateIoCompletion", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[67] },
+	{ "NtCreateJobObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[68] },
+	{ "NtCreateJobSet", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[69] },
+	{ "NtCreateKeyedEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[70] },
+	{ "NtCreateKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[71] },
+	{ "NtCreateKeyTransacted", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[72] },
+	{ "NtCreateMailslotFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[73] },
+	{ "NtCreateMutant", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[74] },
+	{ "NtCreateNamedPipeFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[75] },
+	{ "NtCreatePagingFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[76] },
+	{ "NtCreatePort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[77] },
+	{ "NtCreatePrivateNamespace", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[78] },
+	{ "NtCreateProcessEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[79] },
+	{ "NtCreateProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[80] },
+	{ "NtCreateProfileEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[81] },
+	{ "NtCreateProfile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[82] },
+	{ "NtCreateResourceManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[83] },
+	{ "NtCreateSection", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[84] },
+	{ "NtCreateSemaphore", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[85] },
+	{ "NtCreateSymbolicLinkObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[86] },
+	{ "NtCreateThreadEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[87] },
+	{ "NtCreateThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[88] },
+	{ "NtCreateTimer", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[89] },
+	{ "NtCreateToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[90] },
+	{ "NtCreateTransactionManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[91] },
+	{ "NtCreateTransaction", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[92] },
+	{ "NtCreateUserProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[93] },
+	{ "NtCreateWaitablePort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[94] },
+	{ "NtCreateWorkerFactory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[95] },
+	{ "NtDebugActiveProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[96] },
+	{ "NtDebugContinue", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[97] },
+	{ "NtDelayExecution", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[98] },
+	{ "NtDeleteAtom", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[99] },
+	{ "NtDeleteBootEntry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[100] },
+	{ "NtDeleteDriverEntry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[101] },
+	{ "NtDeleteFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[102] },
+	{ "NtDeleteKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[103] },
+	{ "NtDeleteObjectAuditAlarm", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[104] },
+	{ "NtDeletePrivateNamespace", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[105] },
+	{ "NtDeleteValueKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[106] },
+	{ "NtDeviceIoControlFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[107] },
+	{ "NtDisableLastKnownGood", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[108] },
+	{ "NtDisplayString", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[109] },
+	{ "NtDrawText", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[110] },
+	{ "NtDuplicateObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[111] },
+	{ "NtDuplicateToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[112] },
+	{ "NtEnableLastKnownGood", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[113] },
+	{ "NtEnumerateBootEntries", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[114] },
+	{ "NtEnumerateDriverEntries", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[115] },
+	{ "NtEnumerateKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[116] },
+	{ "NtEnumerateSystemEnvironmentValuesEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[117] },
+	{ "NtEnumerateTransactionObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[118] },
+	{ "NtEnumerateValueKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[119] },
+	{ "NtExtendSection", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[120] },
+	{ "NtFilterToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[121] },
+	{ "NtFindAtom", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[122] },
+	{ "NtFlushBuffersFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[123] },
+	{ "NtFlushInstallUILanguage", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[124] },
+	{ "NtFlushInstructionCache", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[125] },
+	{ "NtFlushKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[126] },
+	{ "NtFlushProcessWriteBuffers", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[127] },
+	{ "NtFlushVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[128] },
+	{ "NtFlushWriteBuffer", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[129] },
+	{ "NtFreeUserPhysicalPages", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[130] },
+	{ "NtFreeVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[131] },
+	{ "NtFreezeRegistry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[132] },
+	{ "NtFreezeTransactions", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[133] },
+	{ "NtFsControlFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[134] },
+	{ "NtGetContextThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[135] },
+	{ "NtGetCurrentProcessorNumber", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[136] },
+	{ "NtGetDevicePowerState", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[137] },
+	{ "NtGetMUIRegistryInfo", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[138] },
+	{ "NtGetNextProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[139] },
+	{ "NtGetNextThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[140] },
+	{ "NtGetNlsSectionPtr", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[141] },
+	{ "NtGetNotificationResourceManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[142] },
+	{ "NtGetPlugPlayEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[143] },
+	{ "NtGetWriteWatch", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[144] },
+	{ "NtImpersonateAnonymousToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[145] },
+	{ "NtImpersonateClientOfPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[146] },
+	{ "NtImpersonateThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[147] },
+	{ "NtInitializeNlsFiles", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[148] },
+	{ "NtInitializeRegistry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[149] },
+	{ "NtInitiatePowerAction", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[150] },
+	{ "NtIsProcessInJob", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[151] },
+	{ "NtIsSystemResumeAutomatic", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[152] },
+	{ "NtIsUILanguageComitted", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[153] },
+	{ "NtListenPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[154] },
+	{ "NtLoadDriver", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[155] },
+	{ "NtLoadKey2", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[156] },
+	{ "NtLoadKeyEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[157] },
+	{ "NtLoadKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[158] },
+	{ "NtLockFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[159] },
+	{ "NtLockProductActivationKeys", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[160] },
+	{ "NtLockRegistryKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[161] },
+	{ "NtLockVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[162] },
+	{ "NtMakePermanentObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[163] },
+	{ "NtMakeTemporaryObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[164] },
+	{ "NtMapCMFModule", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[165] },
+	{ "NtMapUserPhysicalPages", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[166] },
+	{ "NtMapUserPhysicalPagesScatter", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[167] },
+	{ "NtMapViewOfSection", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[168] },
+	{ "NtModifyBootEntry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[169] },
+	{ "NtModifyDriverEntry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[170] },
+	{ "NtNotifyChangeDirectoryFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[171] },
+	{ "NtNotifyChangeKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[172] },
+	{ "NtNotifyChangeMultipleKeys", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[173] },
+	{ "NtNotifyChangeSession", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[174] },
+	{ "NtOpenDirectoryObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[175] },
+	{ "NtOpenEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[176] },
+	{ "NtOpenEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[177] },
+	{ "NtOpenEventPair", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[178] },
+	{ "NtOpenFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[179] },
+	{ "NtOpenIoCompletion", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[180] },
+	{ "NtOpenJobObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[181] },
+	{ "NtOpenKeyedEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[182] },
+	{ "NtOpenKeyEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[183] },
+	{ "NtOpenKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[184] },
+	{ "NtOpenKeyTransactedEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[185] },
+	{ "NtOpenKeyTransacted", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[186] },
+	{ "NtOpenMutant", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[187] },
+	{ "NtOpenObjectAuditAlarm", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[188] },
+	{ "NtOpenPrivateNamespace", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[189] },
+	{ "NtOpenProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[190] },
+	{ "NtOpenProcessTokenEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[191] },
+	{ "NtOpenProcessToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[192] },
+	{ "NtOpenResourceManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[193] },
+	{ "NtOpenSection", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[194] },
+	{ "NtOpenSemaphore", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[195] },
+	{ "NtOpenSession", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[196] },
+	{ "NtOpenSymbolicLinkObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[197] },
+	{ "NtOpenThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[198] },
+	{ "NtOpenThreadTokenEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[199] },
+	{ "NtOpenThreadToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[200] },
+	{ "NtOpenTimer", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[201] },
+	{ "NtOpenTransactionManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[202] },
+	{ "NtOpenTransaction", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[203] },
+	{ "NtPlugPlayControl", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[204] },
+	{ "NtPowerInformation", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[205] },
+	{ "NtPrepareComplete", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[206] },
+	{ "NtPrepareEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[207] },
+	{ "NtPrePrepareComplete", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[208] },
+	{ "NtPrePrepareEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[209] },
+	{ "NtPrivilegeCheck", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[210] },
+	{ "NtPrivilegedServiceAuditAlarm", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[211] },
+	{ "NtPrivilegeObjectAuditAlarm", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[212] },
+	{ "NtPropagationComplete", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[213] },
+	{ "NtPropagationFailed", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[214] },
+	{ "NtProtectVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[215] },
+	{ "NtPulseEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[216] },
+	{ "NtQueryAttributesFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[217] },
+	{ "NtQueryBootEntryOrder", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[218] },
+	{ "NtQueryBootOptions", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[219] },
+	{ "NtQueryDebugFilterState", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[220] },
+	{ "NtQueryDefaultLocale", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[221] },
+	{ "NtQueryDefaultUILanguage", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[222] },
+	{ "NtQueryDirectoryFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[223] },
+	{ "NtQueryDirectoryObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[224] },
+	{ "NtQueryDriverEntryOrder", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[225] },
+	{ "NtQueryEaFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[226] },
+	{ "NtQueryEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[227] },
+	{ "NtQueryFullAttributesFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[228] },
+	{ "NtQueryInformationAtom", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[229] },
+	{ "NtQueryInformationEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[230] },
+	{ "NtQueryInformationFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[231] },
+	{ "NtQueryInformationJobObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[232] },
+	{ "NtQueryInformationPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[233] },
+	{ "NtQueryInformationProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[234] },
+	{ "NtQueryInformationResourceManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[235] },
+	{ "NtQueryInformationThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[236] },
+	{ "NtQueryInformationToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[237] },
+	{ "NtQueryInformationTransaction", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[238] },
+	{ "NtQueryInformationTransactionManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[239] },
+	{ "NtQueryInformationWorkerFactory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[240] },
+	{ "NtQueryInstallUILanguage", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[241] },
+	{ "NtQueryIntervalProfile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[242] },
+	{ "NtQueryIoCompletion", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[243] },
+	{ "NtQueryKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[244] },
+	{ "NtQueryLicenseValue", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[245] },
+	{ "NtQueryMultipleValueKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[246] },
+	{ "NtQueryMutant", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[247] },
+	{ "NtQueryObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[248] },
+	{ "NtQueryOpenSubKeysEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[249] },
+	{ "NtQueryOpenSubKeys", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[250] },
+	{ "NtQueryPerformanceCounter", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[251] },
+	{ "NtQueryPortInformationProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[252] },
+	{ "NtQueryQuotaInformationFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[253] },
+	{ "NtQuerySection", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[254] },
+	{ "NtQuerySecurityAttributesToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[255] },
+	{ "NtQuerySecurityObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[256] },
+	{ "NtQuerySemaphore", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[257] },
+	{ "NtQuerySymbolicLinkObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[258] },
+	{ "NtQuerySystemEnvironmentValueEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[259] },
+	{ "NtQuerySystemEnvironmentValue", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[260] },
+	{ "NtQuerySystemInformationEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[261] },
+	{ "NtQuerySystemInformation", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[262] },
+	{ "NtQuerySystemTime", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[263] },
+	{ "NtQueryTimer", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[264] },
+	{ "NtQueryTimerResolution", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[265] },
+	{ "NtQueryValueKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[266] },
+	{ "NtQueryVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[267] },
+	{ "NtQueryVolumeInformationFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[268] },
+	{ "NtQueueApcThreadEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[269] },
+	{ "NtQueueApcThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[270] },
+	{ "NtRaiseException", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[271] },
+	{ "NtRaiseHardError", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[272] },
+	{ "NtReadFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[273] },
+	{ "NtReadFileScatter", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[274] },
+	{ "NtReadOnlyEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[275] },
+	{ "NtReadRequestData", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[276] },
+	{ "NtReadVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[277] },
+	{ "NtRecoverEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[278] },
+	{ "NtRecoverResourceManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[279] },
+	{ "NtRecoverTransactionManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[280] },
+	{ "NtRegisterProtocolAddressInformation", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[281] },
+	{ "NtRegisterThreadTerminatePort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[282] },
+	{ "NtReleaseKeyedEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[283] },
+	{ "NtReleaseMutant", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[284] },
+	{ "NtReleaseSemaphore", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[285] },
+	{ "NtReleaseWorkerFactoryWorker", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[286] },
+	{ "NtRemoveIoCompletionEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[287] },
+	{ "NtRemoveIoCompletion", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[288] },
+	{ "NtRemoveProcessDebug", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[289] },
+	{ "NtRenameKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[290] },
+	{ "NtRenameTransactionManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[291] },
+	{ "NtReplaceKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[292] },
+	{ "NtReplacePartitionUnit", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[293] },
+	{ "NtReplyPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[294] },
+	{ "NtReplyWaitReceivePortEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[295] },
+	{ "NtReplyWaitReceivePort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[296] },
+	{ "NtReplyWaitReplyPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[297] },
+	{ "NtRequestPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[298] },
+	{ "NtRequestWaitReplyPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[299] },
+	{ "NtResetEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[300] },
+	{ "NtResetWriteWatch", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[301] },
+	{ "NtRestoreKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[302] },
+	{ "NtResumeProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[303] },
+	{ "NtResumeThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[304] },
+	{ "NtRollbackComplete", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[305] },
+	{ "NtRollbackEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[306] },
+	{ "NtRollbackTransaction", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[307] },
+	{ "NtRollforwardTransactionManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[308] },
+	{ "NtSaveKeyEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[309] },
+	{ "NtSaveKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[310] },
+	{ "NtSaveMergedKeys", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[311] },
+	{ "NtSecureConnectPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[312] },
+	{ "NtSerializeBoot", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[313] },
+	{ "NtSetBootEntryOrder", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[314] },
+	{ "NtSetBootOptions", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[315] },
+	{ "NtSetContextThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[316] },
+	{ "NtSetDebugFilterState", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[317] },
+	{ "NtSetDefaultHardErrorPort", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[318] },
+	{ "NtSetDefaultLocale", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[319] },
+	{ "NtSetDefaultUILanguage", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[320] },
+	{ "NtSetDriverEntryOrder", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[321] },
+	{ "NtSetEaFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[322] },
+	{ "NtSetEventBoostPriority", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[323] },
+	{ "NtSetEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[324] },
+	{ "NtSetHighEventPair", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[325] },
+	{ "NtSetHighWaitLowEventPair", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[326] },
+	{ "NtSetInformationDebugObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[327] },
+	{ "NtSetInformationEnlistment", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[328] },
+	{ "NtSetInformationFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[329] },
+	{ "NtSetInformationJobObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[330] },
+	{ "NtSetInformationKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[331] },
+	{ "NtSetInformationObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[332] },
+	{ "NtSetInformationProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[333] },
+	{ "NtSetInformationResourceManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[334] },
+	{ "NtSetInformationThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[335] },
+	{ "NtSetInformationToken", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[336] },
+	{ "NtSetInformationTransaction", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[337] },
+	{ "NtSetInformationTransactionManager", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[338] },
+	{ "NtSetInformationWorkerFactory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[339] },
+	{ "NtSetIntervalProfile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[340] },
+	{ "NtSetIoCompletionEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[341] },
+	{ "NtSetIoCompletion", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[342] },
+	{ "NtSetLdtEntries", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[343] },
+	{ "NtSetLowEventPair", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[344] },
+	{ "NtSetLowWaitHighEventPair", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[345] },
+	{ "NtSetQuotaInformationFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[346] },
+	{ "NtSetSecurityObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[347] },
+	{ "NtSetSystemEnvironmentValueEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[348] },
+	{ "NtSetSystemEnvironmentValue", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[349] },
+	{ "NtSetSystemInformation", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[350] },
+	{ "NtSetSystemPowerState", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[351] },
+	{ "NtSetSystemTime", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[352] },
+	{ "NtSetThreadExecutionState", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[353] },
+	{ "NtSetTimerEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[354] },
+	{ "NtSetTimer", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[355] },
+	{ "NtSetTimerResolution", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[356] },
+	{ "NtSetUuidSeed", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[357] },
+	{ "NtSetValueKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[358] },
+	{ "NtSetVolumeInformationFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[359] },
+	{ "NtShutdownSystem", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[360] },
+	{ "NtShutdownWorkerFactory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[361] },
+	{ "NtSignalAndWaitForSingleObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[362] },
+	{ "NtSinglePhaseReject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[363] },
+	{ "NtStartProfile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[364] },
+	{ "NtStopProfile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[365] },
+	{ "NtSuspendProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[366] },
+	{ "NtSuspendThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[367] },
+	{ "NtSystemDebugControl", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[368] },
+	{ "NtTerminateJobObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[369] },
+	{ "NtTerminateProcess", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[370] },
+	{ "NtTerminateThread", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[371] },
+	{ "NtTestAlert", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[372] },
+	{ "NtThawRegistry", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[373] },
+	{ "NtThawTransactions", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[374] },
+	{ "NtTraceControl", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[375] },
+	{ "NtTraceEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[376] },
+	{ "NtTranslateFilePath", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[377] },
+	{ "NtUmsThreadYield", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[378] },
+	{ "NtUnloadDriver", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[379] },
+	{ "NtUnloadKey2", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[380] },
+	{ "NtUnloadKeyEx", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[381] },
+	{ "NtUnloadKey", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[382] },
+	{ "NtUnlockFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[383] },
+	{ "NtUnlockVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[384] },
+	{ "NtUnmapViewOfSection", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[385] },
+	{ "NtVdmControl", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[386] },
+	{ "NtWaitForDebugEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[387] },
+	{ "NtWaitForKeyedEvent", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[388] },
+	{ "NtWaitForMultipleObjects32", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[389] },
+	{ "NtWaitForMultipleObjects", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[390] },
+	{ "NtWaitForSingleObject", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[391] },
+	{ "NtWaitForWorkViaWorkerFactory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[392] },
+	{ "NtWaitHighEventPair", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[393] },
+	{ "NtWaitLowEventPair", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[394] },
+	{ "NtWorkerFactoryWorkerReady", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[395] },
+	{ "NtWriteFileGather", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[396] },
+	{ "NtWriteFile", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[397] },
+	{ "NtWriteRequestData", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[398] },
+	{ "NtWriteVirtualMemory", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[399] },
+	{ "NtYieldExecution", gt_windows_decode_syscall, gt_windows_decode_sysret, (void *) &WINDOWS_SYSCALL_DESCS[400] },
 	{ NULL, NULL, NULL },
 };
 /*
@@ -8988,9 +2417,16 @@ _gt_windows_find_syscalls_and_setup_mem_traps(GTLoop *loop)
         int count = 0;
 
 	/*
-	 * Delete everything but the line below if you want to release
-	 * hell on your processor...
-	 *     gt_loop_set_cbs(loop, SYSCALLS);
+	 * In lazy mode, guestrace instruments a system call only once the
+	 * guest makes it, so tracing every system call is affordable.
+	 */
+	if (gt_loop_get_lazy(loop)) {
+		return gt_loop_set_cbs(loop, VM_WINDOWS_SYSCALLS);
+	}
+
+	/*
+	 * Otherwise, installing every handler up front would release hell
+	 * on your processor, so trace only the following.
 	 */
 	char *TRACED_SYSCALLS[] = {
 		"NtOpenFile",
@@ -9003,12 +2439,12 @@ _gt_windows_find_syscalls_and_setup_mem_traps(GTLoop *loop)
 	};
 
 	for (int i = 0; TRACED_SYSCALLS[i]; i++) {
-		for (int j = 0; SYSCALLS[j].name; j++) {
-			if (strcmp(TRACED_SYSCALLS[i], SYSCALLS[j].name)) {
+		for (int j = 0; VM_WINDOWS_SYSCALLS[j].name; j++) {
+			if (strcmp(TRACED_SYSCALLS[i], VM_WINDOWS_SYSCALLS[j].name)) {
 				continue;
 			}
 
-			if (gt_loop_set_cb(loop, SYSCALLS[j].name, SYSCALLS[j].syscall_cb, SYSCALLS[j].sysret_cb, SYSCALLS[j].user_data)) {
+			if (gt_loop_set_cb(loop, VM_WINDOWS_SYSCALLS[j].name, VM_WINDOWS_SYSCALLS[j].syscall_cb, VM_WINDOWS_SYSCALLS[j].sysret_cb, VM_WINDOWS_SYSCALLS[j].user_data)) {
                             count++;
                         }
 		}
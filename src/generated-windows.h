@@ -4,11 +4,13 @@
 #define GENERATED_WINDOWS_H
 
 #include "guestrace.h"
+#include "syscall-decoder.h"
 #include "trace-syscalls.h"
 
 int _gt_windows_find_syscalls_and_setup_mem_traps(GTLoop *loop);
 
 extern const char *VM_LINUX_TRACED_SYSCALLS[];
 extern const GTSyscallCallback VM_WINDOWS_SYSCALLS[];
+extern const gt_syscall_table WINDOWS_SYSCALL_TABLE;
 
 #endif
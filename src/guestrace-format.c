@@ -0,0 +1,462 @@
+#include <glib.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace-chunk.h"
+#include "trace-filter.h"
+#include "trace-format.h"
+#include "trace-index.h"
+
+/*
+ * Print a binary trace, compressed or not, as the lines which guestrace
+ * would have printed while it traced, going by the trace's schema rather
+ * than by guestrace's own tables. Worker threads format batches of
+ * records, each a chunk of a compressed trace or a run of records of an
+ * uncompressed one, and the main thread prints the batches in order.
+ */
+
+/* Bytes of records in each batch of an uncompressed trace. */
+#define GT_FORMAT_BATCH_SIZE (1 << 20)
+
+/* Batches which the workers may format ahead of the printer, per worker. */
+#define GT_FORMAT_WINDOW 4
+
+static gint     threads = 0;
+static gchar   *output = NULL;
+static gint     pid = -1;
+static gchar   *syscall_name = NULL;
+static gchar   *comm = NULL;
+static gint64   from = 0;
+static gint64   to = G_MAXINT64;
+static gboolean timestamps = FALSE;
+
+static GOptionEntry entries[] = {
+	{ "output", 'o', 0, G_OPTION_ARG_FILENAME, &output,
+	  "Write the text to FILE rather than stdout", "FILE" },
+	{ "threads", 'j', 0, G_OPTION_ARG_INT, &threads,
+	  "Format with N threads, rather than one per processor", "N" },
+	{ "pid", 'p', 0, G_OPTION_ARG_INT, &pid,
+	  "Print the records of the process PID", "PID" },
+	{ "syscall", 'c', 0, G_OPTION_ARG_STRING, &syscall_name,
+	  "Print the records of the system call NAME", "NAME" },
+	{ "comm", 0, 0, G_OPTION_ARG_STRING, &comm,
+	  "Print the records of the processes named NAME", "NAME" },
+	{ "from", 0, 0, G_OPTION_ARG_INT64, &from,
+	  "Print the records at or after NS nanoseconds", "NS" },
+	{ "to", 0, 0, G_OPTION_ARG_INT64, &to,
+	  "Print the records at or before NS nanoseconds", "NS" },
+	{ "timestamps", 'T', 0, G_OPTION_ARG_NONE, &timestamps,
+	  "Begin each line with the time of its record, and print clock records", NULL },
+	{ NULL }
+};
+
+typedef struct gt_batch {
+	unsigned int   chunk;    /* Of a compressed trace, */
+	const uint8_t *records;  /* or the records of an uncompressed one. */
+	size_t         len;
+
+	char          *text;     /* Set by the worker. */
+	size_t         text_len;
+	bool           failed;
+	bool           done;     /* Under the formatter's lock. */
+} gt_batch;
+
+typedef struct gt_formatter {
+	gt_chunk_reader        *reader;    /* NULL for an uncompressed trace. */
+	const gt_syscall_table *table;
+	const gt_filter        *filter;
+	bool                    timestamps;
+	GArray                 *batches;   /* Of gt_batch. */
+	guint                   window;
+
+	GMutex                  lock;
+	GCond                   cond;
+	guint                   next;      /* The next batch for a worker. */
+	guint                   printed;   /* Batches which the printer is done with. */
+} gt_formatter;
+
+/* Format the records of batch which the filter matches into batch->text. */
+static void
+gt_formatter_format(gt_formatter *formatter, gt_batch *batch)
+{
+	const uint8_t *records = batch->records;
+	size_t len = batch->len, pos = 0;
+	void *decompressed = NULL;
+	const gt_record *record;
+	gt_line line = { 0 };
+	FILE *stream;
+
+	if (NULL != formatter->reader) {
+		decompressed = gt_chunk_reader_read(formatter->reader, batch->chunk, &len);
+		if (NULL == decompressed) {
+			batch->failed = true;
+			return;
+		}
+
+		records = decompressed;
+	}
+
+	stream = open_memstream(&batch->text, &batch->text_len);
+	if (NULL == stream) {
+		perror("open_memstream");
+		batch->failed = true;
+		goto done;
+	}
+
+	line.stream     = stream;
+	line.timestamps = formatter->timestamps;
+
+	while (NULL != (record = gt_record_check(records + pos, len - pos))) {
+		pos += record->size;
+
+		/*
+		 * Skip the schema, clock records unless printing times, and
+		 * records of types newer than this program.
+		 */
+		if (!gt_format_prints(&line, record)) {
+			continue;
+		}
+
+		if (gt_filter_matches(formatter->filter, record)
+		 && !gt_format_record(&line, formatter->table, record)) {
+			fprintf(stderr, "malformed record at offset %zu of batch\n", pos - record->size);
+			batch->failed = true;
+			break;
+		}
+	}
+
+	fclose(stream);
+
+done:
+	g_free(decompressed);
+}
+
+/* A worker, which formats batches until none remain. */
+static gpointer
+gt_formatter_run(gpointer data)
+{
+	gt_formatter *formatter = data;
+
+	for (;;) {
+		gt_batch *batch;
+
+		g_mutex_lock(&formatter->lock);
+		while (formatter->next < formatter->batches->len
+		    && formatter->next >= formatter->printed + formatter->window) {
+			g_cond_wait(&formatter->cond, &formatter->lock);
+		}
+
+		if (formatter->next >= formatter->batches->len) {
+			g_mutex_unlock(&formatter->lock);
+			break;
+		}
+
+		batch = &g_array_index(formatter->batches, gt_batch, formatter->next++);
+		g_mutex_unlock(&formatter->lock);
+
+		gt_formatter_format(formatter, batch);
+
+		g_mutex_lock(&formatter->lock);
+		batch->done = true;
+		g_cond_broadcast(&formatter->cond);
+		g_mutex_unlock(&formatter->lock);
+	}
+
+	return NULL;
+}
+
+/*
+ * Format the batches with workers, and print them to stream in order.
+ * Returns false on failure.
+ */
+static bool
+gt_formatter_print(gt_formatter *formatter, guint workers, FILE *stream)
+{
+	GThread **thread = g_new0(GThread *, workers);
+	bool ok = true;
+
+	formatter->window = workers * GT_FORMAT_WINDOW;
+	g_mutex_init(&formatter->lock);
+	g_cond_init(&formatter->cond);
+
+	for (guint i = 0; i < workers; i++) {
+		thread[i] = g_thread_new("gt-format", gt_formatter_run, formatter);
+	}
+
+	for (guint i = 0; i < formatter->batches->len; i++) {
+		gt_batch *batch = &g_array_index(formatter->batches, gt_batch, i);
+
+		g_mutex_lock(&formatter->lock);
+		while (!batch->done) {
+			g_cond_wait(&formatter->cond, &formatter->lock);
+		}
+		g_mutex_unlock(&formatter->lock);
+
+		if (batch->failed) {
+			ok = false;
+		} else if (batch->text_len > 0 && 1 != fwrite(batch->text, batch->text_len, 1, stream)) {
+			perror("fwrite");
+			ok = false;
+		}
+
+		g_free(batch->text);
+		batch->text = NULL;
+
+		g_mutex_lock(&formatter->lock);
+		formatter->printed++;
+		if (!ok) {
+			/* Let the workers finish what they have begun, and no more. */
+			formatter->next = formatter->batches->len;
+		}
+		g_cond_broadcast(&formatter->cond);
+		g_mutex_unlock(&formatter->lock);
+
+		if (!ok) {
+			break;
+		}
+	}
+
+	for (guint i = 0; i < workers; i++) {
+		g_thread_join(thread[i]);
+	}
+
+	/* Free what the workers finished after a failure. */
+	for (guint i = 0; i < formatter->batches->len; i++) {
+		g_free(g_array_index(formatter->batches, gt_batch, i).text);
+	}
+
+	g_mutex_clear(&formatter->lock);
+	g_cond_clear(&formatter->cond);
+	g_free(thread);
+
+	return ok;
+}
+
+/* Batch the chunks of a compressed trace which the filter may match. */
+static void
+gt_batch_chunks(gt_formatter *formatter, gt_index *index)
+{
+	for (unsigned int i = 0; i < gt_chunk_reader_count(formatter->reader); i++) {
+		const gt_chunk_index_entry *chunk = gt_chunk_reader_get_entry(formatter->reader, i);
+		const gt_index_entry *entry = NULL;
+		gt_batch batch = { i };
+
+		if (NULL != index) {
+			entry = gt_index_find(index, chunk->offset);
+		}
+
+		if (gt_filter_may_match_chunk(formatter->filter, &chunk->header, index, entry)) {
+			g_array_append_val(formatter->batches, batch);
+		}
+	}
+}
+
+/*
+ * Batch the records of an uncompressed trace, which are the len bytes at
+ * records, into runs of about GT_FORMAT_BATCH_SIZE bytes.
+ */
+static void
+gt_batch_records(gt_formatter *formatter, const uint8_t *records, size_t len)
+{
+	const gt_record *record;
+	gt_batch batch = { 0 };
+	size_t pos = 0;
+
+	batch.records = records;
+
+	while (NULL != (record = gt_record_check(records + pos, len - pos))) {
+		pos       += record->size;
+		batch.len += record->size;
+
+		if (batch.len >= GT_FORMAT_BATCH_SIZE) {
+			g_array_append_val(formatter->batches, batch);
+			batch.records += batch.len;
+			batch.len      = 0;
+		}
+	}
+
+	if (batch.len > 0) {
+		g_array_append_val(formatter->batches, batch);
+	}
+
+	if (pos != len) {
+		fprintf(stderr, "trace ends in a partial record\n");
+	}
+}
+
+int
+main (int argc, char **argv) {
+	int status = EXIT_FAILURE;
+	GError *error = NULL;
+	GOptionContext *context;
+	GMappedFile *file = NULL;
+	gt_chunk_reader *reader = NULL;
+	gt_index *index = NULL;
+	gt_syscall_table *table = NULL;
+	const gt_record *schema;
+	gt_formatter formatter = { 0 };
+	gt_filter filter;
+	FILE *stream = stdout;
+	gchar *index_path = NULL;
+	const uint8_t *records = NULL;
+	size_t records_len = 0;
+	char magic[8];
+	FILE *trace;
+
+	context = g_option_context_new("<trace>");
+	g_option_context_add_main_entries(context, entries, NULL);
+	if (!g_option_context_parse(context, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		goto done;
+	}
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: guestrace-format [OPTION...] <trace>\n");
+		goto done;
+	}
+
+	trace = fopen(argv[1], "r");
+	if (NULL == trace) {
+		perror(argv[1]);
+		goto done;
+	}
+
+	if (sizeof magic != fread(magic, 1, sizeof magic, trace)) {
+		fprintf(stderr, "%s is not a binary trace\n", argv[1]);
+		fclose(trace);
+		goto done;
+	}
+
+	fclose(trace);
+
+	formatter.batches    = g_array_new(FALSE, FALSE, sizeof (gt_batch));
+	formatter.filter     = &filter;
+	formatter.timestamps = timestamps;
+
+	if (!memcmp(magic, GT_CHUNK_MAGIC, sizeof GT_CHUNK_MAGIC)) {
+		reader = gt_chunk_reader_open(argv[1]);
+		if (NULL == reader) {
+			goto done;
+		}
+
+		schema = gt_chunk_reader_get_schema(reader);
+	} else {
+		const gt_trace_header *header;
+		const uint8_t *data;
+		size_t len;
+
+		file = g_mapped_file_new(argv[1], FALSE, &error);
+		if (NULL == file) {
+			fprintf(stderr, "%s\n", error->message);
+			g_error_free(error);
+			goto done;
+		}
+
+		data   = (const uint8_t *) g_mapped_file_get_contents(file);
+		len    = g_mapped_file_get_length(file);
+		header = (const gt_trace_header *) data;
+		if (len < sizeof *header
+		 || memcmp(header->magic, GT_TRACE_MAGIC, sizeof GT_TRACE_MAGIC)
+		 || 0 == header->version
+		 || GT_TRACE_VERSION < header->version
+		 || header->header_size > len) {
+			fprintf(stderr, "%s is not a binary trace\n", argv[1]);
+			goto done;
+		}
+
+		data  += header->header_size;
+		len   -= header->header_size;
+		schema = gt_record_check(data, len);
+		if (NULL == schema || GT_RECORD_SCHEMA != schema->type) {
+			fprintf(stderr, "%s has no schema\n", argv[1]);
+			goto done;
+		}
+
+		records     = data + schema->size;
+		records_len = len - schema->size;
+	}
+
+	table = gt_record_parse_schema(schema);
+	if (NULL == table) {
+		fprintf(stderr, "%s has a malformed schema\n", argv[1]);
+		goto done;
+	}
+
+	gt_filter_init(&filter);
+	filter.by_pid = pid >= 0;
+	filter.pid    = pid;
+	filter.comm   = comm;
+	filter.from   = MAX(from, 0);
+	filter.to     = MAX(to, 0);
+
+	if (NULL != syscall_name && !gt_filter_set_syscall(&filter, table, syscall_name)) {
+		fprintf(stderr, "unknown system call: %s\n", syscall_name);
+		goto done;
+	}
+
+	/* A compressed trace's sidecar, if any, spares chunks which cannot match. */
+	if (NULL != reader) {
+		index_path = g_strconcat(argv[1], GT_INDEX_SUFFIX, NULL);
+		if (g_file_test(index_path, G_FILE_TEST_EXISTS)) {
+			index = gt_index_open(index_path);
+		}
+
+		formatter.reader = reader;
+		gt_batch_chunks(&formatter, index);
+	} else {
+		gt_batch_records(&formatter, records, records_len);
+	}
+
+	formatter.table = table;
+
+	if (NULL != output) {
+		stream = fopen(output, "w");
+		if (NULL == stream) {
+			perror(output);
+			stream = stdout;
+			goto done;
+		}
+	}
+
+	if (threads <= 0) {
+		threads = g_get_num_processors();
+	}
+
+	if (!gt_formatter_print(&formatter, threads, stream)) {
+		goto done;
+	}
+
+	if (0 != fflush(stream)) {
+		perror("fflush");
+		goto done;
+	}
+
+	status = EXIT_SUCCESS;
+
+done:
+	if (stdout != stream) {
+		fclose(stream);
+	}
+
+	if (NULL != formatter.batches) {
+		g_array_free(formatter.batches, TRUE);
+	}
+
+	if (NULL != file) {
+		g_mapped_file_unref(file);
+	}
+
+	gt_index_close(index);
+	gt_syscall_table_free(table);
+	gt_chunk_reader_close(reader);
+	g_free(index_path);
+	g_free(output);
+	g_free(syscall_name);
+	g_free(comm);
+	g_option_context_free(context);
+
+	exit(status);
+}
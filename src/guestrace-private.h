@@ -6,10 +6,85 @@
 #include <xenctrl.h>
 
 #include "guestrace.h"
+#include "frame-cache.h"
+#include "scratch.h"
+#include "string-table.h"
 
 /* Maximum number of VCPUs VisorFlow will support. */
 #define _GT_MAX_VCPUS 16
 
+/* Bound on the number of processes in each process cache. */
+#define GT_PROCESS_CACHE_MAX 8192
+
+/* Budget of the interned strings; see gt_guest_intern(). */
+#define GT_STRING_TABLE_MAX_BYTES (4 << 20)
+
+/* Size of each chunk of the per-event arena; see gt_guest_scratch_alloc(). */
+#define GT_SCRATCH_CHUNK_SIZE (64 << 10)
+
+/* Size of each chunk of the per-call arenas; see gt_guest_call_alloc(). */
+#define GT_CALL_SCRATCH_CHUNK_SIZE (1 << 10)
+
+/* Budget of the mapped guest frames; see gt_guest_read_va(). */
+#define GT_FRAME_CACHE_MAX_BYTES (16 << 20)
+
+/* Phases of instrumenting a guest; see gt_loop_print_startup_report(). */
+typedef enum gt_phase {
+	GT_PHASE_VMI_INIT,     /* vmi_init(). */
+	GT_PHASE_XEN_INIT,     /* Opening Xen interfaces, finding the domain. */
+	GT_PHASE_SHADOW_VIEW,  /* Creating or adopting the shadow view. */
+	GT_PHASE_SYMBOLS,      /* Resolving kernel symbols. */
+	GT_PHASE_SHADOW_ALLOC, /* Allocating shadow pages. */
+	GT_PHASE_PAGE_CLONE,   /* Mapping and copying pages. */
+	GT_PHASE_TRAPS,        /* Updating the shadow view, setting memory events. */
+	GT_PHASE_BREAKPOINTS,  /* Emplacing and scrubbing breakpoints. */
+	GT_PHASE_EVENTS,       /* Registering libvmi events. */
+	GT_PHASE_KERNEL_SCAN,  /* Finding the return point and trampoline. */
+	GT_PHASE_COUNT,
+} gt_phase;
+
+typedef struct gt_startup_stats {
+	gint64   begin;                /* Monotonic time at gt_loop_new(). */
+	gint64   end;                  /* Monotonic time once ready for events. */
+	gint64   usec[GT_PHASE_COUNT]; /* Time spent in each phase. */
+	uint64_t symbols;              /* Kernel symbols resolved. */
+	uint64_t symbols_missing;      /* Kernel symbols not found. */
+	uint64_t pages_cloned;
+	uint64_t pages_adopted;        /* See gt_loop_set_detach(). */
+	uint64_t breakpoints;
+	uint64_t deferred;             /* Callbacks deferred in lazy mode. */
+	uint64_t hypercalls;           /* Calls into Xen which succeeded. */
+} gt_startup_stats;
+
+typedef struct gt_cache_stats {
+	uint64_t hits;
+	uint64_t misses;
+	uint64_t invalidations; /* Entries dropped as stale or forgotten. */
+	uint64_t renames;       /* Hits which found a new name, as after exec. */
+} gt_cache_stats;
+
+/*
+ * Where to find the current task; see os_functions.find_current_task. On
+ * Linux, the task is a task_struct; on Windows, it is an ETHREAD, and name
+ * lies within the EPROCESS which process points to.
+ */
+typedef struct gt_task_layout {
+	addr_t current_task; /* Offset from the GS base, or 0 if unknown. */
+	addr_t pid;          /* Offsets within the task. */
+	addr_t tid;
+	addr_t process;
+	addr_t name;
+} gt_task_layout;
+
+/* The task last seen on a VCPU, valid until the VCPU switches tasks. */
+typedef struct gt_vcpu_task {
+	reg_t  cr3;
+	GTTask task; /* An addr of 0 marks the entry empty. */
+} gt_vcpu_task;
+
+/* The state of a pending system call, defined in trace-syscalls.c. */
+struct syscall_state;
+
 /* Includes collection of global state for callbacks.
  *
  * Guestrace maintains three collections:
@@ -31,6 +106,10 @@
  * mapping from physical address offsets to gt_paddr_record structures.
  * This serves as a record for each breakpoint that guestrace sets within a
  * page.
+ *
+ * In lazy mode, guestrace maintains a fourth collection
+ * (gt_lazy_pages), which maps frame numbers to the callbacks which guestrace
+ * will install once the guest first executes the frame.
  */
 struct _GTLoop {
 	/* <private> */
@@ -52,13 +131,84 @@ struct _GTLoop {
 	/* Contains the current mapping between a thread return ptr and gt_paddr_record */
 	GHashTable *gt_ret_addr_mapping;
 
+	/*
+	 * States of returned system calls, for reuse by the next, and the
+	 * state of the system call whose GTSyscallFunc is running.
+	 */
+	struct syscall_state *free_states;
+	struct syscall_state *event_state;
+
+	/* When the breakpoint of the event at hand hit; see gt_guest_get_event_time(). */
+	uint64_t event_time;
+
+	/* The frequency of the guest's TSC, once read; see gt_guest_get_tsc(). */
+	uint32_t guest_tsc_khz;
+
+	/* Defer instrumentation until the guest executes each page. */
+	gboolean lazy;
+	GHashTable *gt_lazy_pages;
+
+	/* Processes by ID; see gt_guest_get_process_name(). */
+	GHashTable *gt_process_cache;
+	gt_cache_stats process_cache;
+
+	/*
+	 * The task running on each VCPU; see gt_guest_get_task(). The
+	 * breakpoint callback sets event_task while it invokes a callback.
+	 */
+	gboolean task_lookup;
+	gt_task_layout task_layout;
+	gt_vcpu_task current_task[_GT_MAX_VCPUS];
+	gt_cache_stats task_cache;
+	GTTask *event_task;
+
+	/* Processes by the address of their EPROCESS, for Windows tasks. */
+	GHashTable *gt_task_processes;
+
+	/* Strings which recur across events; see gt_guest_intern(). */
+	gt_string_table *strings;
+
+	/* Memory for the callback at hand; see gt_guest_scratch_alloc(). */
+	gt_scratch *scratch;
+	gt_scratch_stats scratch_stats;
+
+	/* Counts of the arenas of each pending call; see gt_guest_call_alloc(). */
+	gt_scratch_stats call_scratch_stats;
+
+	/* Guest frames mapped for reading; see gt_guest_read_va(). */
+	gt_frame_cache *frames;
+
+	/* Time spent instrumenting the guest, and where to report it. */
+	gt_startup_stats startup;
+	FILE *startup_report;
+
+	/* Leave the shadow view in place upon quitting; see gt_loop_set_detach(). */
+	gboolean detach;
+	gboolean detached;
+
 	/* Fields used to interact directly with Xen driver. */
 	xc_interface *xch;
 	libxl_ctx *ctx;
 	uint32_t domid;
-	uint64_t init_mem_size;
-	uint64_t curr_mem_size;
 	uint16_t shadow_view;
+
+	/* Whether this guestrace turned altp2m on, so gt_close_ledger() turns it off. */
+	gboolean altp2m_owned;
+
+	/*
+	 * Accounting of the frames guestrace adds to the guest. The guest's
+	 * maximum memory is init_max_memkb plus a page for each frame in
+	 * shadow_frames, and the ledger in GT_STATE_DIR records each frame
+	 * so that a later guestrace can reclaim them should this one crash.
+	 * Orphans are the frames and view of an earlier guestrace, known only
+	 * during gt_loop_new().
+	 */
+	uint64_t init_max_memkb;
+	GHashTable *shadow_frames;
+	xen_pfn_t next_shadow_gfn;
+	int ledger_fd;
+	GHashTable *orphan_frames;
+	uint16_t orphan_view;
 	vmi_event_t breakpoint_event;
 	vmi_event_t memory_event;
 	vmi_event_t step_event[_GT_MAX_VCPUS];
@@ -0,0 +1,224 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace-chunk.h"
+#include "trace-filter.h"
+#include "trace-format.h"
+#include "trace-index.h"
+
+/*
+ * Print the records of a compressed trace which match a query, as
+ * guestrace would have printed them, reading only the chunks which the
+ * trace's indexes say may match; see trace-index.h. Reports on stderr how
+ * much of the trace the indexes let it skip.
+ */
+
+static gint     pid = -1;
+static gchar   *syscall_name = NULL;
+static gint64   from = 0;
+static gint64   to = G_MAXINT64;
+static gchar   *index_path = NULL;
+static gboolean timestamps = FALSE;
+
+static GOptionEntry entries[] = {
+	{ "pid", 'p', 0, G_OPTION_ARG_INT, &pid,
+	  "Print the records of the process PID", "PID" },
+	{ "syscall", 'c', 0, G_OPTION_ARG_STRING, &syscall_name,
+	  "Print the records of the system call NAME", "NAME" },
+	{ "from", 0, 0, G_OPTION_ARG_INT64, &from,
+	  "Print the records at or after NS nanoseconds", "NS" },
+	{ "to", 0, 0, G_OPTION_ARG_INT64, &to,
+	  "Print the records at or before NS nanoseconds", "NS" },
+	{ "index", 'i', 0, G_OPTION_ARG_FILENAME, &index_path,
+	  "Read the sidecar index FILE, rather than the trace's own", "FILE" },
+	{ "timestamps", 'T', 0, G_OPTION_ARG_NONE, &timestamps,
+	  "Begin each line with the time of its record, and print clock records", NULL },
+	{ NULL }
+};
+
+typedef struct gt_query_stats {
+	uint64_t chunks;
+	uint64_t chunks_read;
+	uint64_t bytes;
+	uint64_t bytes_read;
+	uint64_t records_read;
+	uint64_t records_matched;
+} gt_query_stats;
+
+/* Print the records of chunk which match filter. Returns false on failure. */
+static bool
+gt_query_chunk(const gt_filter *filter,
+               gt_query_stats *stats,
+               gt_chunk_reader *reader,
+               unsigned int chunk,
+               const gt_syscall_table *table,
+               gt_line *line)
+{
+	const gt_record *record;
+	size_t len, pos = 0;
+	uint8_t *records = gt_chunk_reader_read(reader, chunk, &len);
+	bool ok = true;
+
+	if (NULL == records) {
+		return false;
+	}
+
+	while (NULL != (record = gt_record_check(records + pos, len - pos))) {
+		stats->records_read++;
+
+		/* Skip clock records unless printing times, and records of types newer than this program. */
+		if (!gt_format_prints(line, record)) {
+			pos += record->size;
+			continue;
+		}
+
+		if (gt_filter_matches(filter, record)) {
+			stats->records_matched++;
+			if (!gt_format_record(line, table, record)) {
+				fprintf(stderr, "malformed record in chunk %u\n", chunk);
+				ok = false;
+				break;
+			}
+		}
+
+		pos += record->size;
+	}
+
+	g_free(records);
+	return ok;
+}
+
+static void
+gt_query_print_stats(const gt_query_stats *stats, unsigned int indexed, FILE *stream)
+{
+	fprintf(stream, "{\"chunks\": %" PRIu64 ", "
+	                "\"indexed\": %u, "
+	                "\"chunks_read\": %" PRIu64 ", "
+	                "\"bytes\": %" PRIu64 ", "
+	                "\"bytes_read\": %" PRIu64 ", "
+	                "\"bytes_skipped\": %" PRIu64 ", "
+	                "\"skipped\": %.4f, "
+	                "\"records_read\": %" PRIu64 ", "
+	                "\"records_matched\": %" PRIu64 "}\n",
+	        stats->chunks,
+	        indexed,
+	        stats->chunks_read,
+	        stats->bytes,
+	        stats->bytes_read,
+	        stats->bytes - stats->bytes_read,
+	        stats->bytes ? (double) (stats->bytes - stats->bytes_read) / stats->bytes : 0.0,
+	        stats->records_read,
+	        stats->records_matched);
+}
+
+int
+main (int argc, char **argv) {
+	int status = EXIT_FAILURE;
+	GError *error = NULL;
+	GOptionContext *context;
+	gt_chunk_reader *reader = NULL;
+	gt_syscall_table *table = NULL;
+	gt_index *index = NULL;
+	gt_filter filter;
+	gt_query_stats stats = { 0 };
+	gt_line line = { .stream = stdout };
+	unsigned int indexed = 0;
+
+	context = g_option_context_new("<trace>");
+	g_option_context_add_main_entries(context, entries, NULL);
+	if (!g_option_context_parse(context, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		goto done;
+	}
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: guestrace-query [OPTION...] <trace>\n");
+		goto done;
+	}
+
+	reader = gt_chunk_reader_open(argv[1]);
+	if (NULL == reader) {
+		goto done;
+	}
+
+	table = gt_record_parse_schema(gt_chunk_reader_get_schema(reader));
+	if (NULL == table) {
+		fprintf(stderr, "%s has a malformed schema\n", argv[1]);
+		goto done;
+	}
+
+	gt_filter_init(&filter);
+	filter.by_pid = pid >= 0;
+	filter.pid    = pid;
+	filter.from   = MAX(from, 0);
+	filter.to     = MAX(to, 0);
+
+	line.timestamps = timestamps;
+
+	if (NULL != syscall_name) {
+		if (!gt_filter_set_syscall(&filter, table, syscall_name)) {
+			fprintf(stderr, "unknown system call: %s\n", syscall_name);
+			goto done;
+		}
+	}
+
+	/* Without a sidecar, the trace's own index still bounds each chunk in time. */
+	if (NULL == index_path) {
+		index_path = g_strconcat(argv[1], GT_INDEX_SUFFIX, NULL);
+		if (g_file_test(index_path, G_FILE_TEST_EXISTS)) {
+			index = gt_index_open(index_path);
+		}
+	} else {
+		index = gt_index_open(index_path);
+		if (NULL == index) {
+			goto done;
+		}
+	}
+
+	if (NULL != index) {
+		indexed = gt_index_count(index);
+	}
+
+	for (unsigned int i = 0; i < gt_chunk_reader_count(reader); i++) {
+		const gt_chunk_index_entry *chunk = gt_chunk_reader_get_entry(reader, i);
+		const gt_index_entry *entry = NULL;
+		uint64_t size = sizeof chunk->header + chunk->header.compressed_size;
+
+		/* The sidecar may lack the last few chunks. */
+		if (NULL != index) {
+			entry = gt_index_find(index, chunk->offset);
+		}
+
+		stats.chunks++;
+		stats.bytes += size;
+
+		if (!gt_filter_may_match_chunk(&filter, &chunk->header, index, entry)) {
+			continue;
+		}
+
+		stats.chunks_read++;
+		stats.bytes_read += size;
+
+		if (!gt_query_chunk(&filter, &stats, reader, i, table, &line)) {
+			goto done;
+		}
+	}
+
+	gt_query_print_stats(&stats, indexed, stderr);
+	status = EXIT_SUCCESS;
+
+done:
+	gt_index_close(index);
+	gt_syscall_table_free(table);
+	gt_chunk_reader_close(reader);
+	g_free(syscall_name);
+	g_free(index_path);
+	g_option_context_free(context);
+
+	exit(status);
+}
@@ -1,13 +1,86 @@
 #include <stdio.h>
 #include <signal.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "guestrace.h"
 #include "generated-windows.h"
 #include "generated-linux.h"
+#include "trace-aggregate.h"
+#include "trace-index.h"
+#include "trace-writer.h"
 
 GTLoop *loop = NULL;
 
+static gboolean lazy = FALSE;
+static gboolean detach = FALSE;
+static gboolean startup_report = FALSE;
+static gboolean stats = FALSE;
+static gchar   *format = NULL;
+static gchar   *output = NULL;
+static gint64   ring_size = GT_TRACE_RING_SIZE;
+static gint64   write_size = GT_TRACE_WRITE_SIZE;
+static gint     flush_interval = GT_TRACE_FLUSH_INTERVAL;
+static gchar   *shm_name = NULL;
+static gint64   shm_size = GT_TRACE_SHM_SIZE;
+static gboolean compress = FALSE;
+static gint     compress_level = GT_TRACE_COMPRESS_LEVEL;
+static gint64   rotate_size = 0;
+static gint     rotate_interval = 0;
+static gint64   retain_size = 0;
+static gboolean aggregate = FALSE;
+static gint     aggregate_interval = GT_AGGREGATE_INTERVAL;
+static gboolean latency = FALSE;
+static gboolean timestamps = FALSE;
+static gboolean guest_tsc = FALSE;
+
+static GOptionEntry entries[] = {
+	{ "lazy", 'l', 0, G_OPTION_ARG_NONE, &lazy,
+	  "Instrument each system call upon its first use", NULL },
+	{ "detach", 'd', 0, G_OPTION_ARG_NONE, &detach,
+	  "Leave the instrumentation for the next guestrace upon exit", NULL },
+	{ "startup-report", 't', 0, G_OPTION_ARG_NONE, &startup_report,
+	  "Report the time spent instrumenting the guest on stderr", NULL },
+	{ "stats", 's', 0, G_OPTION_ARG_NONE, &stats,
+	  "Report cache statistics on stderr upon exit", NULL },
+	{ "format", 'f', 0, G_OPTION_ARG_STRING, &format,
+	  "Write the trace as text (the default), binary records, or not at all", "text|binary|none" },
+	{ "output", 'o', 0, G_OPTION_ARG_FILENAME, &output,
+	  "Write the trace to FILE rather than stderr", "FILE" },
+	{ "ring-size", 0, 0, G_OPTION_ARG_INT64, &ring_size,
+	  "Buffer up to BYTES of records for each VCPU", "BYTES" },
+	{ "write-size", 0, 0, G_OPTION_ARG_INT64, &write_size,
+	  "Write the trace BYTES at a time", "BYTES" },
+	{ "flush-interval", 0, 0, G_OPTION_ARG_INT, &flush_interval,
+	  "Flush the trace every MS milliseconds", "MS" },
+	{ "shm", 0, 0, G_OPTION_ARG_STRING, &shm_name,
+	  "Also publish the records in shared memory named NAME", "NAME" },
+	{ "shm-size", 0, 0, G_OPTION_ARG_INT64, &shm_size,
+	  "Keep up to BYTES of records in shared memory", "BYTES" },
+	{ "compress", 'z', 0, G_OPTION_ARG_NONE, &compress,
+	  "Compress a binary trace, in chunks which can be read by time", NULL },
+	{ "compress-level", 0, 0, G_OPTION_ARG_INT, &compress_level,
+	  "Compress at zstd's LEVEL", "LEVEL" },
+	{ "rotate-size", 0, 0, G_OPTION_ARG_INT64, &rotate_size,
+	  "Start a new file of the output after BYTES", "BYTES" },
+	{ "rotate-interval", 0, 0, G_OPTION_ARG_INT, &rotate_interval,
+	  "Start a new file of the output after SECONDS", "SECONDS" },
+	{ "retain-size", 0, 0, G_OPTION_ARG_INT64, &retain_size,
+	  "Delete the oldest files of the output beyond BYTES", "BYTES" },
+	{ "aggregate", 'a', 0, G_OPTION_ARG_NONE, &aggregate,
+	  "Count the system calls of each process rather than trace them", NULL },
+	{ "aggregate-interval", 0, 0, G_OPTION_ARG_INT, &aggregate_interval,
+	  "Print the counts every SECONDS, or only upon exit if 0", "SECONDS" },
+	{ "latency", 0, 0, G_OPTION_ARG_NONE, &latency,
+	  "Count the latency of each system call too, implying --aggregate", NULL },
+	{ "timestamps", 'T', 0, G_OPTION_ARG_NONE, &timestamps,
+	  "Begin each line of a text trace with the time of its record", NULL },
+	{ "guest-tsc", 0, 0, G_OPTION_ARG_NONE, &guest_tsc,
+	  "Record the guest's TSC with each event, at a hypercall apiece", NULL },
+	{ NULL }
+};
+
+/* Only flags the loop to stop; gt_loop_run() does the rest once it returns. */
 static void
 gt_close_handler (int sig)
 {
@@ -51,16 +124,141 @@ done:
 	return rc;
 }
 
+/*
+ * Send the decoders' records of the system calls of table to a new writer,
+ * or, with --aggregate, count them in a new aggregate instead. Returns
+ * FALSE on failure.
+ */
+static gboolean
+gt_set_up_output(FILE *stream,
+                 gt_trace_format trace_format,
+                 const gt_syscall_table *table,
+                 const gt_trace_writer_options *writer_options,
+                 gt_trace_writer **writer,
+                 gt_aggregate **aggregator)
+{
+	if (aggregate) {
+		*aggregator = gt_aggregate_new(stream, table, aggregate_interval, latency);
+		gt_decoder_set_aggregate(*aggregator);
+		return TRUE;
+	}
+
+	*writer = gt_trace_writer_new(stream, trace_format, table, writer_options);
+	if (NULL == *writer) {
+		return FALSE;
+	}
+
+	gt_decoder_set_writer(*writer);
+	gt_decoder_set_guest_tsc(guest_tsc);
+	return TRUE;
+}
+
 int
 main (int argc, char **argv) {
 	struct sigaction act;
 	status_t status = VMI_FAILURE;
+	GError *error = NULL;
+	GOptionContext *context;
+	gt_trace_format trace_format = GT_TRACE_TEXT;
+	gt_trace_writer_options writer_options;
+	gt_trace_writer *writer = NULL;
+	gt_aggregate *aggregator = NULL;
+	FILE *stream = stderr;
+	gchar *index_path = NULL;
+
+	context = g_option_context_new("<VM name>");
+	g_option_context_add_main_entries(context, entries, NULL);
+	if (!g_option_context_parse(context, &argc, &argv, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		goto done;
+	}
 
 	if (argc < 2) {
-		fprintf(stderr, "usage: guestrace <VM name>\n");
+		fprintf(stderr, "usage: guestrace [OPTION...] <VM name>\n");
+		goto done;
+	}
+
+	if (NULL != format && !strcmp(format, "binary")) {
+		trace_format = GT_TRACE_BINARY;
+	} else if (NULL != format && !strcmp(format, "none")) {
+		trace_format = GT_TRACE_NONE;
+	} else if (NULL != format && strcmp(format, "text")) {
+		fprintf(stderr, "unknown trace format: %s\n", format);
+		goto done;
+	}
+
+	if (compress && GT_TRACE_BINARY != trace_format) {
+		fprintf(stderr, "only a binary trace can be compressed\n");
+		goto done;
+	}
+
+	if (ring_size <= 0 || write_size <= 0 || flush_interval <= 0 || shm_size <= 0) {
+		fprintf(stderr, "buffer sizes and flush interval must be positive\n");
+		goto done;
+	}
+
+	if (rotate_size < 0 || rotate_interval < 0 || retain_size < 0) {
+		fprintf(stderr, "rotation sizes and interval must not be negative\n");
+		goto done;
+	}
+
+	if ((rotate_size > 0 || rotate_interval > 0) && NULL == output) {
+		fprintf(stderr, "only a trace written to a file can be rotated\n");
+		goto done;
+	}
+
+	if (retain_size > 0 && 0 == rotate_size && 0 == rotate_interval) {
+		fprintf(stderr, "only a rotated trace can be retained\n");
 		goto done;
 	}
 
+	aggregate = aggregate || latency;
+
+	if (aggregate && (NULL != format || NULL != shm_name || rotate_size > 0 || rotate_interval > 0
+	               || timestamps || guest_tsc)) {
+		fprintf(stderr, "an aggregate is written in place of a trace\n");
+		goto done;
+	}
+
+	if (aggregate_interval < 0) {
+		fprintf(stderr, "aggregate interval must not be negative\n");
+		goto done;
+	}
+
+	writer_options.ring_size       = ring_size;
+	writer_options.write_size      = write_size;
+	writer_options.flush_interval  = flush_interval;
+	writer_options.shm_name        = shm_name;
+	writer_options.shm_size        = shm_size;
+	writer_options.compress        = compress;
+	writer_options.compress_level  = compress_level;
+	writer_options.index_path      = NULL;
+	writer_options.timestamps      = timestamps;
+	writer_options.rotate_path     = NULL;
+	writer_options.rotate_size     = rotate_size;
+	writer_options.rotate_interval = rotate_interval;
+	writer_options.retain_size     = retain_size;
+
+	/* A compressed trace gets a sidecar index; see trace-index.h. */
+	if (NULL != output && compress) {
+		index_path = g_strconcat(output, GT_INDEX_SUFFIX, NULL);
+		writer_options.index_path = index_path;
+	}
+
+	/* A rotating writer creates the files, and the link at output, itself. */
+	if (rotate_size > 0 || rotate_interval > 0) {
+		writer_options.rotate_path = output;
+		stream = NULL;
+	} else if (NULL != output) {
+		stream = fopen(output, "w");
+		if (NULL == stream) {
+			perror(output);
+			stream = stderr;
+			goto done;
+		}
+	}
+
 	if (-1 == gt_set_up_signal_handler(act)) {
 		perror("failed to setup signal handler.\n");
 		goto done;
@@ -72,15 +270,32 @@ main (int argc, char **argv) {
 		goto done;
 	}
 
+	gt_loop_set_lazy(loop, lazy);
+	gt_loop_set_detach(loop, detach);
+
+	if (startup_report) {
+		gt_loop_set_startup_report(loop, stderr);
+	}
+
 	GTOSType os = gt_loop_get_ostype(loop);
 	switch (os) {
 	case GT_OS_LINUX:
+		if (!gt_set_up_output(stream, trace_format, &LINUX_SYSCALL_TABLE, &writer_options,
+		                      &writer, &aggregator)) {
+			goto done;
+		}
+
 		if (0 == _gt_linux_find_syscalls_and_setup_mem_traps(loop)) {
 			fprintf(stderr, "unable to instrument any system calls\n");
 			goto done;
 		}
 		break;
 	case GT_OS_WINDOWS:
+		if (!gt_set_up_output(stream, trace_format, &WINDOWS_SYSCALL_TABLE, &writer_options,
+		                      &writer, &aggregator)) {
+			goto done;
+		}
+
 		if (0 == _gt_windows_find_syscalls_and_setup_mem_traps(loop)) {
 			fprintf(stderr, "unable to instrument any system calls\n");
 			goto done;
@@ -95,11 +310,36 @@ main (int argc, char **argv) {
 
 	status = VMI_SUCCESS;
 	gt_loop_run(loop);
+	gt_trace_writer_stop(writer);
+	gt_aggregate_stop(aggregator);
+
+	if (stats) {
+		gt_loop_print_stats(loop, stderr);
+		if (NULL != writer) {
+			gt_trace_writer_print_stats(writer, stderr);
+		} else {
+			gt_aggregate_print_stats(aggregator, stderr);
+		}
+	}
 
 done:
 	printf("Shutting down guestrace.\n");
 
 	gt_loop_free(loop);
 
+	gt_decoder_set_writer(NULL);
+	gt_decoder_set_aggregate(NULL);
+	gt_trace_writer_free(writer);
+	gt_aggregate_free(aggregator);
+	if (NULL != stream && stderr != stream) {
+		fclose(stream);
+	}
+
+	g_free(format);
+	g_free(output);
+	g_free(shm_name);
+	g_free(index_path);
+	g_option_context_free(context);
+
 	exit(VMI_SUCCESS == status ? EXIT_SUCCESS : EXIT_FAILURE);
 }
@@ -4,6 +4,7 @@
 #include <libvmi/libvmi.h>
 #include <libvmi/events.h>
 #include <glib.h>
+#include <stdio.h>
 #include <libxl.h>
 #include <xenctrl.h>
 
@@ -17,13 +18,48 @@ typedef struct _GTLoop GTLoop;
 
 typedef addr_t gt_tid_t;
 
+/* Most arguments any system call takes; see gt_guest_get_args(). */
+#define GT_SYSCALL_ARGS_MAX 18
+
+/* The ID of an interned string; see gt_guest_intern(). */
+typedef uint32_t gt_str_id;
+
+#define GT_STR_NONE 0
+
+/* Long enough for a Linux comm or a Windows ImageFileName. */
+#define GT_TASK_NAME_MAX 16
+
+/**
+ * GTTask:
+ * @addr: the virtual address of the thread's task_struct on Linux or
+ * ETHREAD on Windows.
+ * @process: the virtual address of the process's EPROCESS on Windows. On
+ * Linux, this is @addr if the thread leads its thread group and 0 if not.
+ * @pid: the ID of the thread's process; Linux calls this the tgid.
+ * @tid: the ID of the thread itself; Linux calls this the pid.
+ * @name: the name of the thread's comm on Linux, or the image name of the
+ * thread's process on Windows.
+ *
+ * Describes the thread which caused an event; see gt_guest_get_task().
+ */
+typedef struct GTTask {
+	addr_t    addr;
+	addr_t    process;
+	vmi_pid_t pid;
+	vmi_pid_t tid;
+	char      name[GT_TASK_NAME_MAX];
+} GTTask;
+
 /**
  * GTSyscallFunc:
  * @vmi: the libvmi instance which abstracts the guest.
  * @event: the event which abstracts the system call which caused the guestrace
  * event loop to invoke this function.
  * @pid: the ID of the process running when the event occurred.
- * @tid: the unique ID of the thread running within the current process.
+ * @tid: the unique ID of the thread running within the current process: the
+ * guest's own thread ID if guestrace can find the current thread (see
+ * gt_guest_get_task()), and otherwise an address unique to the thread's
+ * pending system call.
  * @user_data: optional data which might have been passed to the
  * corresponding gt_loop_set_cb(); if set, the guestrace event loop will pass it
  * here.
@@ -45,14 +81,18 @@ typedef void *(*GTSyscallFunc) (vmi_instance_t vmi,
  * @vmi: the libvmi instance which abstracts the guest.
  * @event: the event which abstracts the system return which caused the guestrace event loop to invoke this function.
  * @pid: the ID of the process running when the event occurred.
- * @tid: the unique ID of the thread running within the current process.
+ * @tid: the unique ID of the thread running within the current process: the
+ * guest's own thread ID if guestrace can find the current thread (see
+ * gt_guest_get_task()), and otherwise an address unique to the thread's
+ * pending system call.
  * @user_data: the return value from #GTSyscallFunc which the guestrace event loop passes to #GTSysretFunc.
  * 
  * Specifies one of the two types of functions passed to gt_loop_set_cb().
  * The guestrace event loop invokes this callback each time a system call on
  * the guest returns control to a program. It is the responsibility of each
  * #GTSysretFunc implementation to free @user_data if the corresponding
- * #GTSyscallFunc returned a pointer to a dynamically-allocated object.
+ * #GTSyscallFunc returned a pointer to a dynamically-allocated object,
+ * unless it allocated the object with gt_guest_call_alloc().
  */
 typedef void (*GTSysretFunc) (vmi_instance_t vmi,
                               vmi_event_t *event,
@@ -94,6 +134,12 @@ typedef enum GTOSType {
 
 GTLoop  *gt_loop_new(const char *guest_name);
 GTOSType gt_loop_get_ostype(GTLoop *loop);
+void     gt_loop_set_lazy(GTLoop *loop, gboolean lazy);
+gboolean gt_loop_get_lazy(GTLoop *loop);
+void     gt_loop_set_detach(GTLoop *loop, gboolean detach);
+void     gt_loop_set_startup_report(GTLoop *loop, FILE *stream);
+void     gt_loop_print_startup_report(GTLoop *loop, FILE *stream);
+void     gt_loop_print_stats(GTLoop *loop, FILE *stream);
 gboolean gt_loop_set_cb(GTLoop *loop,
                         const char *kernel_func,
                         GTSyscallFunc syscall_cb,
@@ -104,4 +150,65 @@ void     gt_loop_run(GTLoop *loop);
 void     gt_loop_quit(GTLoop *loop);
 void     gt_loop_free(GTLoop *loop);
 
+const char *gt_guest_get_process_name(vmi_instance_t vmi,
+                                      vmi_event_t *event,
+                                      vmi_pid_t pid);
+addr_t      gt_guest_get_process_addr(vmi_instance_t vmi,
+                                      vmi_event_t *event,
+                                      vmi_pid_t pid);
+void        gt_guest_forget_process(vmi_instance_t vmi,
+                                    vmi_event_t *event,
+                                    vmi_pid_t pid);
+const GTTask *gt_guest_get_task(vmi_instance_t vmi, vmi_event_t *event);
+uint64_t     *gt_guest_get_args(vmi_instance_t vmi,
+                                vmi_event_t *event,
+                                vmi_pid_t pid,
+                                int count);
+uint64_t      gt_guest_get_event_time(vmi_instance_t vmi, vmi_event_t *event);
+uint64_t      gt_guest_get_call_time(vmi_instance_t vmi, vmi_event_t *event);
+gboolean      gt_guest_get_tsc(vmi_instance_t vmi,
+                               vmi_event_t *event,
+                               uint64_t *tsc,
+                               uint32_t *khz);
+uint64_t      gt_clock_now(void);
+
+const char *gt_guest_intern(vmi_instance_t vmi,
+                            vmi_event_t *event,
+                            const char *str,
+                            gt_str_id *id);
+const char *gt_guest_get_string(vmi_instance_t vmi,
+                                vmi_event_t *event,
+                                gt_str_id id);
+const char *gt_guest_read_string(vmi_instance_t vmi,
+                                 vmi_event_t *event,
+                                 addr_t vaddr,
+                                 vmi_pid_t pid);
+gt_str_id   gt_guest_get_process_name_id(vmi_instance_t vmi,
+                                         vmi_event_t *event,
+                                         vmi_pid_t pid);
+
+void       *gt_guest_scratch_alloc(vmi_instance_t vmi,
+                                   vmi_event_t *event,
+                                   size_t size);
+void       *gt_guest_call_alloc(vmi_instance_t vmi,
+                                vmi_event_t *event,
+                                size_t size);
+void       *gt_guest_read_bytes(vmi_instance_t vmi,
+                                vmi_event_t *event,
+                                addr_t vaddr,
+                                vmi_pid_t pid,
+                                size_t size);
+
+size_t      gt_guest_read_va(vmi_instance_t vmi,
+                             vmi_event_t *event,
+                             addr_t vaddr,
+                             vmi_pid_t pid,
+                             void *buf,
+                             size_t count);
+void        gt_guest_invalidate_frames(vmi_instance_t vmi, vmi_event_t *event);
+const char *gt_guest_read_unicode_string(vmi_instance_t vmi,
+                                         vmi_event_t *event,
+                                         addr_t vaddr,
+                                         vmi_pid_t pid);
+
 #endif
@@ -0,0 +1,138 @@
+#include <cpuid.h>
+#include <glib.h>
+#include <inttypes.h>
+#include <time.h>
+#include <x86intrin.h>
+
+#include "host-clock.h"
+
+/* Fractional bits of the ratio of nanoseconds to ticks. */
+#define GT_HOST_CLOCK_SHIFT   32
+
+/* Reads of each clock from which gt_host_clock_sample() keeps the closest. */
+#define GT_HOST_CLOCK_SAMPLES 8
+
+static struct {
+	gboolean tsc;       /* Whether to read the TSC, rather than CLOCK_MONOTONIC. */
+	uint64_t base_tsc;  /* A count of ticks... */
+	uint64_t base_ns;   /* ...and the time of CLOCK_MONOTONIC at that count. */
+	uint64_t mult;      /* Nanoseconds per tick, times 2^GT_HOST_CLOCK_SHIFT. */
+	uint32_t tsc_khz;
+} gt_host_clock;
+
+static gsize gt_host_clock_ready = 0;
+
+static uint64_t
+gt_host_clock_read(clockid_t clock)
+{
+	struct timespec ts;
+
+	clock_gettime(clock, &ts);
+
+	return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Whether the TSC ticks at a constant rate, whatever the CPU's power state. */
+static gboolean
+gt_host_clock_tsc_invariant(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+
+	if (__get_cpuid_max(0x80000000, NULL) < 0x80000007
+	 || !__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+		return FALSE;
+	}
+
+	return 0 != (edx & (1 << 8));
+}
+
+/*
+ * Read the TSC and CLOCK_MONOTONIC at about the same moment: the TSC as
+ * the midpoint of reads on either side of CLOCK_MONOTONIC, from the tries
+ * whose reads lie the closest together.
+ */
+static void
+gt_host_clock_sample(uint64_t *tsc, uint64_t *ns)
+{
+	uint64_t best = UINT64_MAX;
+
+	for (int i = 0; i < GT_HOST_CLOCK_SAMPLES; i++) {
+		uint64_t before = __rdtsc();
+		uint64_t now    = gt_host_clock_read(CLOCK_MONOTONIC);
+		uint64_t after  = __rdtsc();
+
+		if (after - before < best) {
+			best = after - before;
+			*tsc = before + best / 2;
+			*ns  = now;
+		}
+	}
+}
+
+/*
+ * Count the ticks of an invariant TSC over GT_HOST_CLOCK_CALIBRATION_USEC
+ * of CLOCK_MONOTONIC, once; the first reading of the clock does so if
+ * nothing did before. Over a span this short, the ratio is good to a few
+ * parts per million, so that the clock drifts from CLOCK_MONOTONIC by a
+ * few microseconds a second; the correlation records of a trace pair the
+ * two, for readers which care.
+ */
+void
+gt_host_clock_calibrate(void)
+{
+	uint64_t tsc0, ns0, tsc1, ns1;
+
+	if (!g_once_init_enter(&gt_host_clock_ready)) {
+		return;
+	}
+
+	if (!gt_host_clock_tsc_invariant()) {
+		goto done;
+	}
+
+	gt_host_clock_sample(&tsc0, &ns0);
+	g_usleep(GT_HOST_CLOCK_CALIBRATION_USEC);
+	gt_host_clock_sample(&tsc1, &ns1);
+
+	if (tsc1 <= tsc0 || ns1 <= ns0) {
+		goto done;
+	}
+
+	gt_host_clock.tsc      = TRUE;
+	gt_host_clock.base_tsc = tsc1;
+	gt_host_clock.base_ns  = ns1;
+	gt_host_clock.mult     = ((unsigned __int128) (ns1 - ns0) << GT_HOST_CLOCK_SHIFT) / (tsc1 - tsc0);
+	gt_host_clock.tsc_khz  = (unsigned __int128) (tsc1 - tsc0) * 1000000 / (ns1 - ns0);
+
+done:
+	g_once_init_leave(&gt_host_clock_ready, 1);
+}
+
+/* The time, in nanoseconds on the host's monotonic clock. */
+uint64_t
+gt_host_clock_now(void)
+{
+	int64_t ticks;
+
+	gt_host_clock_calibrate();
+
+	if (!gt_host_clock.tsc) {
+		return gt_host_clock_read(CLOCK_MONOTONIC);
+	}
+
+	/* Signed, as another CPU's TSC may lag the calibrating CPU's a little. */
+	ticks = __rdtsc() - gt_host_clock.base_tsc;
+
+	return gt_host_clock.base_ns + (int64_t) (((__int128) ticks * gt_host_clock.mult) >> GT_HOST_CLOCK_SHIFT);
+}
+
+void
+gt_host_clock_print_stats(FILE *stream)
+{
+	gt_host_clock_calibrate();
+
+	fprintf(stream, "{\"source\": \"%s\", "
+	                "\"tsc_khz\": %" PRIu32 "}",
+	        gt_host_clock.tsc ? "tsc" : "clock_gettime",
+	        gt_host_clock.tsc_khz);
+}
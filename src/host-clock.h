@@ -0,0 +1,23 @@
+#ifndef HOST_CLOCK_H
+#define HOST_CLOCK_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * The clock by which guestrace times events, in nanoseconds on the host's
+ * monotonic clock. Where the host's time stamp counter is invariant, the
+ * clock reads it with rdtsc, sparing each event a call to clock_gettime(),
+ * and converts its ticks to nanoseconds by a ratio calibrated against
+ * CLOCK_MONOTONIC; otherwise it reads CLOCK_MONOTONIC itself. See
+ * gt_clock_now().
+ */
+
+/* Microseconds over which gt_host_clock_calibrate() counts ticks. */
+#define GT_HOST_CLOCK_CALIBRATION_USEC 20000
+
+void     gt_host_clock_calibrate(void);
+uint64_t gt_host_clock_now(void);
+void     gt_host_clock_print_stats(FILE *stream);
+
+#endif
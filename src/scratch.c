@@ -0,0 +1,210 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <stdint.h>
+
+#include "guestrace.h"
+#include "guestrace-private.h"
+#include "scratch.h"
+
+/* Alignment of each allocation, as with malloc(). */
+#define GT_SCRATCH_ALIGN 16
+
+typedef struct gt_scratch_chunk {
+	struct gt_scratch_chunk *next;
+	size_t                   size;
+	size_t                   used;
+	uint8_t                  data[] __attribute__((aligned(GT_SCRATCH_ALIGN)));
+} gt_scratch_chunk;
+
+struct gt_scratch {
+	gt_scratch_chunk *first;
+	gt_scratch_chunk *current;
+	size_t            chunk_size;
+	size_t            used;  /* Allocated since the last reset. */
+	gt_scratch_stats *stats;
+};
+
+static gt_scratch_chunk *
+gt_scratch_chunk_new(size_t size)
+{
+	gt_scratch_chunk *chunk = g_malloc(sizeof *chunk + size);
+
+	chunk->next = NULL;
+	chunk->size = size;
+	chunk->used = 0;
+
+	return chunk;
+}
+
+/* Count the use of the arena in stats, which may count other arenas too. */
+gt_scratch *
+gt_scratch_new(size_t chunk_size, gt_scratch_stats *stats)
+{
+	gt_scratch *scratch = g_new0(gt_scratch, 1);
+
+	scratch->chunk_size = chunk_size;
+	scratch->first      = gt_scratch_chunk_new(chunk_size);
+	scratch->current    = scratch->first;
+	scratch->stats      = stats;
+
+	stats->chunks++;
+
+	return scratch;
+}
+
+void
+gt_scratch_free(gt_scratch *scratch)
+{
+	if (NULL == scratch) {
+		return;
+	}
+
+	for (gt_scratch_chunk *chunk = scratch->first, *next; NULL != chunk; chunk = next) {
+		next = chunk->next;
+		g_free(chunk);
+	}
+
+	g_free(scratch);
+}
+
+/*
+ * Allocate size bytes which remain valid until the next
+ * gt_scratch_reset(). Once the current chunk fills, continue in the next
+ * one, which an earlier event may have left behind.
+ */
+void *
+gt_scratch_alloc(gt_scratch *scratch, size_t size)
+{
+	gt_scratch_chunk *chunk = scratch->current;
+	void *p;
+
+	size = (size + GT_SCRATCH_ALIGN - 1) & ~(size_t) (GT_SCRATCH_ALIGN - 1);
+
+	scratch->stats->allocations++;
+	scratch->stats->bytes += size;
+	scratch->used         += size;
+
+	while (size > chunk->size - chunk->used) {
+		if (NULL == chunk->next) {
+			chunk->next = gt_scratch_chunk_new(MAX(size, scratch->chunk_size));
+			scratch->stats->chunks++;
+			if (size > scratch->chunk_size) {
+				scratch->stats->oversized++;
+			}
+		}
+
+		chunk       = chunk->next;
+		chunk->used = 0;
+	}
+
+	p                = chunk->data + chunk->used;
+	chunk->used     += size;
+	scratch->current = chunk;
+
+	return p;
+}
+
+/*
+ * Release every allocation at once. Keep the chunks of the usual size for
+ * the next event, but free any oversized chunk which a single large
+ * allocation required.
+ */
+void
+gt_scratch_reset(gt_scratch *scratch)
+{
+	gt_scratch_chunk **link = &scratch->first->next;
+
+	if (0 == scratch->used) {
+		return;
+	}
+
+	scratch->stats->resets++;
+	if (scratch->used > scratch->stats->peak_bytes) {
+		scratch->stats->peak_bytes = scratch->used;
+	}
+
+	while (NULL != *link) {
+		gt_scratch_chunk *chunk = *link;
+
+		if (chunk->size > scratch->chunk_size) {
+			*link = chunk->next;
+			g_free(chunk);
+		} else {
+			link = &chunk->next;
+		}
+	}
+
+	scratch->first->used = 0;
+	scratch->current     = scratch->first;
+	scratch->used        = 0;
+}
+
+/* Write stats to stream as a JSON object. */
+void
+gt_scratch_print_stats(const gt_scratch_stats *stats, FILE *stream)
+{
+	fprintf(stream, "{\"allocations\": %" PRIu64 ", "
+	                "\"bytes\": %" PRIu64 ", "
+	                "\"resets\": %" PRIu64 ", "
+	                "\"chunks\": %" PRIu64 ", "
+	                "\"oversized\": %" PRIu64 ", "
+	                "\"peak_bytes\": %zu}",
+	        stats->allocations,
+	        stats->bytes,
+	        stats->resets,
+	        stats->chunks,
+	        stats->oversized,
+	        stats->peak_bytes);
+}
+
+/**
+ * gt_guest_scratch_alloc:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @size: the number of bytes to allocate.
+ *
+ * Allocates memory which guestrace reclaims once the callback returns, such
+ * as for a buffer into which to read from the guest. The caller need not,
+ * and must not, free it. Allocating from this per-event arena costs little
+ * more than bumping a pointer.
+ *
+ * Returns: @size bytes, aligned as by malloc(), which remain valid until
+ * the callback returns.
+ */
+void *
+gt_guest_scratch_alloc(vmi_instance_t vmi, vmi_event_t *event, size_t size)
+{
+	GTLoop *loop = event->data;
+
+	return gt_scratch_alloc(loop->scratch, size);
+}
+
+/**
+ * gt_guest_read_bytes:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @vaddr: the virtual address of the bytes in the guest.
+ * @pid: the ID of the process whose address space contains @vaddr.
+ * @size: the number of bytes to read.
+ *
+ * Reads bytes from the guest into memory allocated as by
+ * gt_guest_scratch_alloc(), so that the caller need not free them.
+ *
+ * Returns: the bytes, or %NULL if guestrace cannot read all of them.
+ */
+void *
+gt_guest_read_bytes(vmi_instance_t vmi,
+                    vmi_event_t *event,
+                    addr_t vaddr,
+                    vmi_pid_t pid,
+                    size_t size)
+{
+	GTLoop *loop = event->data;
+	void *buf = gt_scratch_alloc(loop->scratch, size);
+
+	if (0 != size && size != gt_guest_read_va(vmi, event, vaddr, pid, buf, size)) {
+		buf = NULL;
+	}
+
+	return buf;
+}
@@ -0,0 +1,37 @@
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * An arena for memory which a callback needs only until it returns, such
+ * as strings read from the guest. Allocation bumps a pointer, and the event
+ * loop resets the arena in bulk after each callback, so that in the long
+ * run handling an event calls malloc() not at all. See
+ * gt_guest_scratch_alloc(), and gt_guest_call_alloc() for the arenas which
+ * last from a system call to its return.
+ */
+typedef struct gt_scratch gt_scratch;
+
+/*
+ * Counts of the use of one or more arenas. Arenas which serve the same
+ * purpose share their counts.
+ */
+typedef struct gt_scratch_stats {
+	uint64_t allocations;
+	uint64_t bytes;       /* Allocated, in all. */
+	uint64_t resets;
+	uint64_t chunks;      /* Calls to malloc() for chunks. */
+	uint64_t oversized;   /* Allocations larger than a chunk. */
+	size_t   peak_bytes;  /* Most allocated between two resets. */
+} gt_scratch_stats;
+
+gt_scratch *gt_scratch_new(size_t chunk_size, gt_scratch_stats *stats);
+void        gt_scratch_free(gt_scratch *scratch);
+void       *gt_scratch_alloc(gt_scratch *scratch, size_t size);
+void        gt_scratch_reset(gt_scratch *scratch);
+void        gt_scratch_print_stats(const gt_scratch_stats *stats, FILE *stream);
+
+#endif
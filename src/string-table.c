@@ -0,0 +1,159 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "guestrace.h"
+#include "string-table.h"
+
+/*
+ * An interned string. The table's LRU queue links the strings through
+ * their lru members, so that moving a string to the front of the queue
+ * allocates nothing.
+ */
+typedef struct gt_string {
+	GList     lru;  /* lru.data points back to this gt_string. */
+	gt_str_id id;
+	size_t    len;
+	char      str[];
+} gt_string;
+
+struct gt_string_table {
+	GHashTable *by_str; /* Of gt_string by str; owns the strings. */
+	GHashTable *by_id;  /* Of gt_string by id. */
+	GQueue      lru;    /* Most recently used at the head. */
+	gt_str_id   next_id;
+	size_t      bytes;
+	size_t      max_bytes;
+
+	uint64_t    hits;
+	uint64_t    misses;
+	uint64_t    evictions;
+};
+
+/* Bytes charged against the table's budget for a string of length len. */
+static size_t
+gt_string_size(size_t len)
+{
+	return sizeof(gt_string) + len + 1;
+}
+
+gt_string_table *
+gt_string_table_new(size_t max_bytes)
+{
+	gt_string_table *table = g_new0(gt_string_table, 1);
+
+	table->by_str    = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, g_free);
+	table->by_id     = g_hash_table_new(NULL, NULL);
+	table->next_id   = GT_STR_NONE + 1;
+	table->max_bytes = max_bytes;
+	g_queue_init(&table->lru);
+
+	return table;
+}
+
+void
+gt_string_table_free(gt_string_table *table)
+{
+	if (NULL == table) {
+		return;
+	}
+
+	g_hash_table_destroy(table->by_id);
+	g_hash_table_destroy(table->by_str);
+	g_free(table);
+}
+
+/*
+ * Return the interned copy of str, interning str if the table lacks it,
+ * and set *id to the copy's ID unless id is NULL. The copy remains valid
+ * until gt_string_table_trim() evicts it.
+ */
+const char *
+gt_string_table_intern(gt_string_table *table, const char *str, gt_str_id *id)
+{
+	size_t len;
+	gt_string *string = g_hash_table_lookup(table->by_str, str);
+
+	if (NULL != string) {
+		table->hits++;
+		g_queue_unlink(&table->lru, &string->lru);
+		goto done;
+	}
+
+	table->misses++;
+
+	len              = strlen(str);
+	string           = g_malloc(gt_string_size(len));
+	string->len      = len;
+	string->id       = table->next_id++;
+	string->lru.data = string;
+	memcpy(string->str, str, len + 1);
+
+	/* IDs identify a string for as long as the table has it. */
+	if (GT_STR_NONE == table->next_id) {
+		table->next_id++;
+	}
+
+	g_hash_table_insert(table->by_str, string->str, string);
+	g_hash_table_insert(table->by_id, GUINT_TO_POINTER(string->id), string);
+	table->bytes += gt_string_size(string->len);
+
+done:
+	g_queue_push_head_link(&table->lru, &string->lru);
+
+	if (NULL != id) {
+		*id = string->id;
+	}
+
+	return string->str;
+}
+
+/* Return the string with the given ID, or NULL if the table has evicted it. */
+const char *
+gt_string_table_lookup(gt_string_table *table, gt_str_id id)
+{
+	gt_string *string = g_hash_table_lookup(table->by_id, GUINT_TO_POINTER(id));
+
+	return NULL == string ? NULL : string->str;
+}
+
+/*
+ * Evict the least recently used strings until the table fits its budget.
+ * The event loop calls this between events, so that strings interned while
+ * handling an event remain valid until the callbacks return.
+ */
+void
+gt_string_table_trim(gt_string_table *table)
+{
+	while (table->bytes > table->max_bytes && NULL != table->lru.tail) {
+		gt_string *string = table->lru.tail->data;
+
+		g_queue_unlink(&table->lru, &string->lru);
+		g_hash_table_remove(table->by_id, GUINT_TO_POINTER(string->id));
+		table->bytes -= gt_string_size(string->len);
+		table->evictions++;
+
+		/* Frees string. */
+		g_hash_table_remove(table->by_str, string->str);
+	}
+}
+
+/* Write the table's statistics to stream as a JSON object. */
+void
+gt_string_table_print_stats(gt_string_table *table, FILE *stream)
+{
+	uint64_t lookups = table->hits + table->misses;
+
+	fprintf(stream, "{\"entries\": %u, "
+	                "\"bytes\": %zu, "
+	                "\"hits\": %" PRIu64 ", "
+	                "\"misses\": %" PRIu64 ", "
+	                "\"evictions\": %" PRIu64 ", "
+	                "\"hit_rate\": %.4f}",
+	        g_hash_table_size(table->by_str),
+	        table->bytes,
+	        table->hits,
+	        table->misses,
+	        table->evictions,
+	        lookups ? (double) table->hits / lookups : 0.0);
+}
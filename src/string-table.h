@@ -0,0 +1,25 @@
+#ifndef STRING_TABLE_H
+#define STRING_TABLE_H
+
+#include <stdio.h>
+
+#include "guestrace.h"
+
+/*
+ * A table of interned strings, such as process names, which recur from
+ * one system call to the next. Each distinct string has one
+ * copy and an ID, and the table evicts the least recently used strings once
+ * they exceed the table's budget. See gt_guest_intern().
+ */
+typedef struct gt_string_table gt_string_table;
+
+gt_string_table *gt_string_table_new(size_t max_bytes);
+void             gt_string_table_free(gt_string_table *table);
+const char      *gt_string_table_intern(gt_string_table *table,
+                                        const char *str,
+                                        gt_str_id *id);
+const char      *gt_string_table_lookup(gt_string_table *table, gt_str_id id);
+void             gt_string_table_trim(gt_string_table *table);
+void             gt_string_table_print_stats(gt_string_table *table, FILE *stream);
+
+#endif
@@ -0,0 +1,446 @@
+#include <libvmi/libvmi.h>
+#include <libvmi/events.h>
+#include <glib.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "generated-linux.h"
+#include "generated-windows.h"
+#include "syscall-decoder.h"
+#include "trace-aggregate.h"
+#include "trace-format.h"
+#include "trace-writer.h"
+
+/* Initial size of the buffer in which the decoders compose each record. */
+#define GT_RECORD_INITIAL_SIZE 1024
+
+/* Nanoseconds between the clock records of each VCPU; see gt_record_clock(). */
+#define GT_CLOCK_RECORD_INTERVAL 1000000000
+
+struct win64_obj_attr {
+	uint32_t length; // sizeof given struct
+	uint64_t root_directory; // if not null, object_name is relative to this directory
+	uint64_t object_name; // pointer to unicode string
+	uint32_t attributes; // see microsoft documentation
+	uint64_t security_descriptor; // see microsoft documentation
+	uint64_t security_quality_of_service; // see microsoft documentation
+};
+
+/*
+ * A record under construction, in the per-event arena. The buffer grows
+ * as the decoders append payloads, so pointers into it last only until
+ * the next append.
+ */
+typedef struct gt_capture {
+	vmi_instance_t vmi;
+	vmi_event_t   *event;
+	vmi_pid_t      pid;
+	uint8_t       *buf;
+	size_t         len;
+	size_t         size;
+} gt_capture;
+
+/* Where the decoders send their records; NULL prints them on stderr. */
+static gt_trace_writer *gt_writer = NULL;
+
+/* Where the decoders count their events, if anywhere. */
+static gt_aggregate *gt_aggregator = NULL;
+
+/* Whether each record holds the guest's TSC; see gt_decoder_set_guest_tsc(). */
+static gboolean gt_guest_tsc = FALSE;
+
+/* When each VCPU last sent a clock record to the writer. */
+static uint64_t gt_clock_sent[GT_TRACE_MAX_VCPUS];
+
+/*
+ * Get ObjectAttributes struct from virtual address
+ */
+static bool
+obj_attr_from_va(vmi_instance_t vmi, vmi_event_t *event, addr_t vaddr, vmi_pid_t pid, struct win64_obj_attr *obj_attr) {
+	uint32_t struct_size = 0;
+
+	memset(obj_attr, 0, sizeof *obj_attr);
+
+	if (sizeof struct_size != gt_guest_read_va(vmi, event, vaddr, pid, &struct_size, sizeof struct_size)) {
+		return false;
+	}
+
+	struct_size = struct_size <= sizeof(struct win64_obj_attr) ? struct_size : sizeof(struct win64_obj_attr); // don't wanna read too much data
+
+	if (struct_size != gt_guest_read_va(vmi, event, vaddr, pid, obj_attr, struct_size)) {
+		memset(obj_attr, 0, sizeof *obj_attr);
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * Send the records of the decoders to writer, rather than printing them
+ * on stderr. The caller keeps writer until the decoders are done.
+ */
+void
+gt_decoder_set_writer(gt_trace_writer *writer)
+{
+	gt_writer = writer;
+}
+
+/*
+ * Count each event in aggregate. Without a writer as well, the decoders
+ * then compose no records at all. The caller keeps aggregate until the
+ * decoders are done.
+ */
+void
+gt_decoder_set_aggregate(gt_aggregate *aggregate)
+{
+	gt_aggregator = aggregate;
+}
+
+/*
+ * Record the guest's TSC with each system call and return, as well as in
+ * the clock records. This costs a hypercall an event; see
+ * gt_guest_get_tsc().
+ */
+void
+gt_decoder_set_guest_tsc(gboolean guest_tsc)
+{
+	gt_guest_tsc = guest_tsc;
+}
+
+static gt_record *
+gt_capture_record(gt_capture *capture)
+{
+	return (gt_record *) capture->buf;
+}
+
+/* Append len bytes, and the padding which follows them, to the record. */
+static void *
+gt_capture_append(gt_capture *capture, size_t len)
+{
+	size_t padded = GT_RECORD_ALIGN(len);
+	uint8_t *data;
+
+	if (capture->len + padded > capture->size) {
+		size_t size = MAX(capture->size * 2, capture->len + padded);
+		uint8_t *buf = gt_guest_scratch_alloc(capture->vmi, capture->event, size);
+
+		memcpy(buf, capture->buf, capture->len);
+		capture->buf  = buf;
+		capture->size = size;
+	}
+
+	data = capture->buf + capture->len;
+	memset(data + len, 0, padded - len);
+	capture->len += padded;
+
+	return data;
+}
+
+/* Append a payload of length bytes for argument index, and return its data. */
+static void *
+gt_capture_payload(gt_capture *capture, int index, gt_payload_kind kind, size_t length)
+{
+	gt_payload *payload = gt_capture_append(capture, sizeof *payload + length);
+
+	payload->arg    = index;
+	payload->kind   = kind;
+	payload->length = length;
+	gt_capture_record(capture)->payload_count++;
+
+	return payload + 1;
+}
+
+static void
+gt_capture_string(gt_capture *capture, int index, const char *str)
+{
+	size_t len;
+
+	if (NULL == str) {
+		return;
+	}
+
+	len = strlen(str);
+	memcpy(gt_capture_payload(capture, index, GT_PAYLOAD_STRING, len), str, len);
+}
+
+/*
+ * Capturers of each gt_arg_type which points into the guest. Each reads
+ * from the guest whatever the argument points to, and appends it to the
+ * record as a payload. The other types need nothing but the argument.
+ */
+typedef void (*gt_arg_capturer) (gt_capture *capture, int index, uint64_t arg);
+
+static void
+gt_capture_guest_string(gt_capture *capture, int index, uint64_t arg)
+{
+	gt_capture_string(capture, index,
+	                  gt_guest_read_string(capture->vmi, capture->event, arg, capture->pid));
+}
+
+static void
+gt_capture_unicode_string(gt_capture *capture, int index, uint64_t arg)
+{
+	gt_capture_string(capture, index,
+	                  gt_guest_read_unicode_string(capture->vmi, capture->event, arg, capture->pid));
+}
+
+static void
+gt_capture_object_attributes(gt_capture *capture, int index, uint64_t arg)
+{
+	const char *name;
+	struct win64_obj_attr obj_attr;
+	gt_payload_obj_attr *payload;
+	size_t len;
+
+	if (!obj_attr_from_va(capture->vmi, capture->event, arg, capture->pid, &obj_attr)) {
+		return;
+	}
+
+	name = gt_guest_read_unicode_string(capture->vmi, capture->event, obj_attr.object_name, capture->pid);
+	len  = NULL == name ? 0 : strlen(name);
+
+	payload = gt_capture_payload(capture, index, GT_PAYLOAD_OBJECT_ATTRIBUTES, sizeof *payload + len);
+	payload->root_directory = obj_attr.root_directory;
+	payload->attributes     = obj_attr.attributes;
+	payload->name_length    = NULL == name ? GT_PAYLOAD_NO_NAME : len;
+	memcpy(payload + 1, name, len);
+}
+
+/* PULONG and PHANDLE alike. */
+static void
+gt_capture_p64(gt_capture *capture, int index, uint64_t arg)
+{
+	uint64_t value = 0;
+
+	gt_guest_read_va(capture->vmi, capture->event, arg, capture->pid, &value, sizeof value);
+	memcpy(gt_capture_payload(capture, index, GT_PAYLOAD_U64, sizeof value), &value, sizeof value);
+}
+
+static const gt_arg_capturer ARG_CAPTURERS[GT_ARG_TYPE_COUNT] = {
+	[GT_ARG_STRING]            = gt_capture_guest_string,
+	[GT_ARG_UNICODE_STRING]    = gt_capture_unicode_string,
+	[GT_ARG_OBJECT_ATTRIBUTES] = gt_capture_object_attributes,
+	[GT_ARG_PULONG]            = gt_capture_p64,
+	[GT_ARG_PHANDLE]           = gt_capture_p64,
+};
+
+static uint64_t
+gt_read_clock(clockid_t clock)
+{
+	struct timespec ts;
+
+	clock_gettime(clock, &ts);
+
+	return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/*
+ * Send the writer a clock record for the VCPU of event, which pairs the
+ * host's clock with the guest's TSC, read between two readings of the
+ * host's clock, and with CLOCK_MONOTONIC and CLOCK_REALTIME; see
+ * gt_payload_clock. The record follows the event's own, whose time it
+ * must not precede in the ring of the VCPU.
+ */
+static void
+gt_record_clock(vmi_instance_t vmi, vmi_event_t *event)
+{
+	struct {
+		gt_record        record;
+		gt_payload       payload;
+		gt_payload_clock clock;
+	} buf = { { 0 } };
+	uint64_t before, after;
+
+	before = gt_clock_now();
+	if (!gt_guest_get_tsc(vmi, event, &buf.clock.guest_tsc, &buf.clock.guest_tsc_khz)) {
+		buf.clock.guest_tsc     = 0;
+		buf.clock.guest_tsc_khz = 0;
+	}
+	after = gt_clock_now();
+
+	buf.clock.monotonic = gt_read_clock(CLOCK_MONOTONIC);
+	buf.clock.realtime  = gt_read_clock(CLOCK_REALTIME);
+
+	buf.payload.kind   = GT_PAYLOAD_CLOCK;
+	buf.payload.length = sizeof buf.clock;
+
+	buf.record.size          = sizeof buf;
+	buf.record.type          = GT_RECORD_CLOCK;
+	buf.record.vcpu          = event->vcpu_id;
+	buf.record.timestamp     = before + (after - before) / 2;
+	buf.record.payload_count = 1;
+
+	gt_trace_writer_write(gt_writer, &buf.record);
+
+	gt_clock_sent[event->vcpu_id % GT_TRACE_MAX_VCPUS] = after;
+}
+
+/*
+ * Record a system call or its return, along with the arguments of desc
+ * which travel in direction dir, and send the record to the writer. A
+ * return which travels in no direction records no arguments at all.
+ */
+static void
+gt_record_event(vmi_instance_t vmi,
+                vmi_event_t *event,
+                vmi_pid_t pid,
+                gt_tid_t tid,
+                const gt_syscall_table *table,
+                const gt_syscall_desc *desc,
+                gt_record_type type,
+                gt_arg_dir dir)
+{
+	gt_capture capture = { vmi, event, pid };
+	const char *proc = gt_guest_get_process_name(vmi, event, pid);
+	uint64_t *args = NULL;
+	gt_record *record;
+
+	if (NULL != gt_aggregator) {
+		uint64_t latency = 0;
+
+		if (GT_RECORD_SYSRET == type) {
+			latency = gt_guest_get_event_time(vmi, event) - gt_guest_get_call_time(vmi, event);
+		}
+
+		gt_aggregate_count(gt_aggregator, event->vcpu_id, pid, proc, desc - table->descs,
+		                   type, event->x86_regs->rax, latency);
+
+		if (NULL == gt_writer) {
+			return;
+		}
+	}
+
+	capture.size = GT_RECORD_INITIAL_SIZE;
+	capture.buf  = gt_guest_scratch_alloc(vmi, event, capture.size);
+
+	record = gt_capture_append(&capture, sizeof *record);
+	memset(record, 0, sizeof *record);
+	record->type      = type;
+	record->syscall   = desc - table->descs;
+	record->vcpu      = event->vcpu_id;
+	record->timestamp = gt_guest_get_event_time(vmi, event);
+	record->tid       = tid;
+	record->sp        = event->x86_regs->rsp;
+	record->ret       = GT_RECORD_SYSRET == type ? event->x86_regs->rax : 0;
+	record->pid       = pid;
+
+	if (NULL == proc) {
+		record->flags |= GT_RECORD_NO_NAME;
+	} else {
+		strncpy(record->comm, proc, sizeof record->comm);
+	}
+
+	if (GT_ARG_NONE != dir) {
+		args = gt_guest_get_args(vmi, event, pid, desc->arity);
+	}
+
+	if (NULL != args) {
+		memcpy(gt_capture_append(&capture, desc->arity * sizeof *args), args, desc->arity * sizeof *args);
+		gt_capture_record(&capture)->arg_count = desc->arity;
+	}
+
+	for (int i = 0; GT_ARG_NONE != dir && i < desc->arity; i++) {
+		gt_arg_capturer capture_arg = ARG_CAPTURERS[desc->args[i].type];
+
+		if ((desc->args[i].dir & dir) && NULL != capture_arg) {
+			capture_arg(&capture, i, NULL == args ? 0 : args[i]);
+		}
+	}
+
+	if (gt_guest_tsc) {
+		uint64_t tsc;
+		uint32_t khz;
+
+		if (gt_guest_get_tsc(vmi, event, &tsc, &khz)) {
+			memcpy(gt_capture_payload(&capture, GT_PAYLOAD_RECORD, GT_PAYLOAD_GUEST_TSC, sizeof tsc),
+			       &tsc, sizeof tsc);
+		}
+	}
+
+	record       = gt_capture_record(&capture);
+	record->size = capture.len;
+
+	if (NULL != gt_writer) {
+		gt_trace_writer_write(gt_writer, record);
+
+		if (record->timestamp - gt_clock_sent[event->vcpu_id % GT_TRACE_MAX_VCPUS]
+		    >= GT_CLOCK_RECORD_INTERVAL) {
+			gt_record_clock(vmi, event);
+		}
+	} else {
+		gt_line line = { .stream = stderr };
+
+		gt_format_record(&line, table, record);
+	}
+}
+
+void *
+gt_linux_decode_syscall(vmi_instance_t vmi,
+                        vmi_event_t *event,
+                        vmi_pid_t pid,
+                        gt_tid_t tid,
+                        void *user_data)
+{
+	const gt_syscall_desc *desc = user_data;
+
+	gt_record_event(vmi, event, pid, tid, &LINUX_SYSCALL_TABLE, desc,
+	                GT_RECORD_SYSCALL, GT_ARG_INOUT);
+
+	if (desc->flags & GT_SYSCALL_ENDS_PROCESS) {
+		gt_guest_forget_process(vmi, event, pid);
+	}
+
+	/* The sysret decoder consults desc's flags. */
+	return user_data;
+}
+
+void
+gt_linux_decode_sysret(vmi_instance_t vmi,
+                       vmi_event_t *event,
+                       vmi_pid_t pid,
+                       gt_tid_t tid,
+                       void *user_data)
+{
+	const gt_syscall_desc *desc = user_data;
+
+	gt_record_event(vmi, event, pid, tid, &LINUX_SYSCALL_TABLE, desc,
+	                GT_RECORD_SYSRET, GT_ARG_NONE);
+
+	if (desc->flags & GT_SYSCALL_CHANGES_MAPPINGS) {
+		gt_guest_invalidate_frames(vmi, event);
+	}
+}
+
+void *
+gt_windows_decode_syscall(vmi_instance_t vmi,
+                          vmi_event_t *event,
+                          vmi_pid_t pid,
+                          gt_tid_t tid,
+                          void *user_data)
+{
+	gt_record_event(vmi, event, pid, tid, &WINDOWS_SYSCALL_TABLE, user_data,
+	                GT_RECORD_SYSCALL, GT_ARG_IN);
+
+	/* The sysret decoder rereads the arguments through desc. */
+	return user_data;
+}
+
+void
+gt_windows_decode_sysret(vmi_instance_t vmi,
+                         vmi_event_t *event,
+                         vmi_pid_t pid,
+                         gt_tid_t tid,
+                         void *user_data)
+{
+	const gt_syscall_desc *desc = user_data;
+
+	gt_record_event(vmi, event, pid, tid, &WINDOWS_SYSCALL_TABLE, desc,
+	                GT_RECORD_SYSRET, GT_ARG_OUT);
+
+	if (desc->flags & GT_SYSCALL_CHANGES_MAPPINGS) {
+		gt_guest_invalidate_frames(vmi, event);
+	}
+}
@@ -0,0 +1,104 @@
+#ifndef SYSCALL_DECODER_H
+#define SYSCALL_DECODER_H
+
+#include <stdint.h>
+
+#include "guestrace.h"
+
+/*
+ * Descriptions of system calls, which the generators emit as tables, and
+ * the decoders which record system calls and their returns by interpreting
+ * those tables. Each entry in VM_LINUX_SYSCALLS and VM_WINDOWS_SYSCALLS
+ * passes its gt_syscall_desc as user_data, so that one pair of decoders
+ * serves every system call. The decoders print their records on stderr,
+ * unless given a writer, or an aggregate in which to count them instead;
+ * see gt_decoder_set_writer() and gt_decoder_set_aggregate(). A writer
+ * also gets a clock record from each VCPU every second or so, which
+ * relates the host's time to the guest's; see trace-record.h.
+ */
+
+/* How to print an argument; see trace-format.c. */
+typedef enum gt_arg_type {
+	GT_ARG_HEX,                /* 0x%lx */
+	GT_ARG_INT,                /* %i, as an int. */
+	GT_ARG_UINT,               /* %lu */
+	GT_ARG_LONG,               /* %li */
+	GT_ARG_STRING,             /* A quoted, NUL-terminated string. */
+	GT_ARG_UNICODE_STRING,     /* Windows UNICODE_STRING *. */
+	GT_ARG_OBJECT_ATTRIBUTES,  /* Windows OBJECT_ATTRIBUTES *. */
+	GT_ARG_PULONG,             /* Windows ULONG *, read as 64 bits. */
+	GT_ARG_PHANDLE,            /* Windows HANDLE *. */
+	GT_ARG_ACCESS_MASK,        /* Windows ACCESS_MASK. */
+	GT_ARG_BOOLEAN,            /* Windows BOOLEAN. */
+	GT_ARG_OPEN_FLAGS,         /* Linux O_* flags. */
+	GT_ARG_PROT,               /* Linux PROT_* flags. */
+	GT_ARG_TYPE_COUNT,
+} gt_arg_type;
+
+/*
+ * Whether the system-call line prints an argument, the return line, or
+ * both. The Windows decoders print by direction; the Linux decoders print
+ * every argument upon the call.
+ */
+typedef enum gt_arg_dir {
+	GT_ARG_NONE  = 0,
+	GT_ARG_IN    = 1 << 0,
+	GT_ARG_OUT   = 1 << 1,
+	GT_ARG_INOUT = GT_ARG_IN | GT_ARG_OUT,
+} gt_arg_dir;
+
+typedef struct gt_syscall_arg {
+	const char *name; /* NULL if the prototype names no argument. */
+	uint8_t     type; /* A gt_arg_type. */
+	uint8_t     dir;  /* A gt_arg_dir. */
+} gt_syscall_arg;
+
+/* Flags of a gt_syscall_desc. */
+#define GT_SYSCALL_ENDS_PROCESS     (1 << 0) /* The caller's name becomes stale. */
+#define GT_SYSCALL_CHANGES_MAPPINGS (1 << 1) /* Guest translations become stale. */
+
+typedef struct gt_syscall_desc {
+	const char           *name;
+	const gt_syscall_arg *args;
+	uint8_t               arity;
+	uint8_t               flags;
+} gt_syscall_desc;
+
+/*
+ * All of the descriptions for one operating system. Records name each
+ * system call by the index of its description in the table.
+ */
+typedef struct gt_syscall_table {
+	GTOSType               os;
+	const gt_syscall_desc *descs;
+	uint32_t               count;
+} gt_syscall_table;
+
+struct gt_trace_writer;
+struct gt_aggregate;
+
+void  gt_decoder_set_writer(struct gt_trace_writer *writer);
+void  gt_decoder_set_aggregate(struct gt_aggregate *aggregate);
+void  gt_decoder_set_guest_tsc(gboolean guest_tsc);
+void *gt_linux_decode_syscall(vmi_instance_t vmi,
+                              vmi_event_t *event,
+                              vmi_pid_t pid,
+                              gt_tid_t tid,
+                              void *user_data);
+void  gt_linux_decode_sysret(vmi_instance_t vmi,
+                             vmi_event_t *event,
+                             vmi_pid_t pid,
+                             gt_tid_t tid,
+                             void *user_data);
+void *gt_windows_decode_syscall(vmi_instance_t vmi,
+                                vmi_event_t *event,
+                                vmi_pid_t pid,
+                                gt_tid_t tid,
+                                void *user_data);
+void  gt_windows_decode_sysret(vmi_instance_t vmi,
+                               vmi_event_t *event,
+                               vmi_pid_t pid,
+                               gt_tid_t tid,
+                               void *user_data);
+
+#endif
@@ -0,0 +1,585 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+
+#include "trace-aggregate.h"
+#include "trace-histogram.h"
+
+static const char *GT_RET_CLASS_NAMES[] = {
+	[GT_RET_SUCCESS] = "success",
+	[GT_RET_WARNING] = "warning",
+	[GT_RET_ERROR]   = "error",
+};
+
+/* The counts of one system call of one process. */
+typedef struct gt_count {
+	uint64_t key;      /* The pid, then the system call; first, for g_int64_hash(). */
+	char     comm[16]; /* The process's name when first counted, NUL-padded. */
+	uint64_t calls;
+	uint64_t returns[GT_RET_CLASS_COUNT];
+} gt_count;
+
+/* The latencies of the system calls of one process. */
+typedef struct gt_process_latency {
+	uint64_t     key;      /* The pid, for g_int64_hash(). */
+	char         comm[16];
+	gt_histogram histogram;
+} gt_process_latency;
+
+/* The counts of one VCPU since the last snapshot. */
+typedef struct gt_count_table {
+	GHashTable   *counts;    /* Of gt_count, by key. */
+	gt_histogram **syscalls; /* Of each system call, or NULL; with latency. */
+	GHashTable   *processes; /* Of gt_process_latency, by pid; likewise. */
+} gt_count_table;
+
+struct gt_aggregate {
+	FILE                   *stream;
+	const gt_syscall_table *table;
+	guint                   interval;  /* Seconds between snapshots, or 0. */
+	gboolean                latency;
+
+	/*
+	 * Two sets of tables, one for each VCPU: the event thread counts into
+	 * the active set alone, while the aggregate thread merges the other;
+	 * see gt_aggregate_swap().
+	 */
+	gt_count_table          tables[2][GT_AGGREGATE_MAX_VCPUS];
+	gint                    active;    /* Atomic. */
+	gint                    writing;   /* The set being counted into, or -1; atomic. */
+
+	GThread                *thread;
+	GMutex                  lock;
+	GCond                   cond;
+	gboolean                stopping;  /* Under lock. */
+
+	/* The aggregate thread's own; the totals of every snapshot so far. */
+	GHashTable             *merged;    /* Of gt_count, by key. */
+	GPtrArray              *sorted;    /* Into merged. */
+	gt_histogram          **merged_syscalls;
+	GHashTable             *merged_processes;
+	GPtrArray              *sorted_processes;
+
+	uint64_t                events;    /* The event thread's own. */
+	uint64_t                snapshots;
+	uint64_t                merge_usec;
+	uint64_t                merge_max_usec;
+};
+
+static GHashTable *
+gt_count_table_new(void)
+{
+	return g_hash_table_new_full(g_int64_hash, g_int64_equal, g_free, NULL);
+}
+
+/* The class of the value ret, which a system call of table returned. */
+static gt_ret_class
+gt_aggregate_classify(const gt_syscall_table *table, uint64_t ret)
+{
+	if (GT_OS_WINDOWS == table->os) {
+		/* The top two bits of an NTSTATUS hold its severity. */
+		switch ((uint32_t) ret >> 30) {
+		case 2:
+			return GT_RET_WARNING;
+		case 3:
+			return GT_RET_ERROR;
+		default:
+			return GT_RET_SUCCESS;
+		}
+	}
+
+	return (int64_t) ret < 0 && (int64_t) ret >= -4095 ? GT_RET_ERROR : GT_RET_SUCCESS;
+}
+
+/* Order gt_counts, or gt_process_latencies, by the keys with which they begin. */
+static gint
+gt_aggregate_compare_keys(gconstpointer a, gconstpointer b)
+{
+	uint64_t x = **(const uint64_t **) a, y = **(const uint64_t **) b;
+
+	return x < y ? -1 : x > y;
+}
+
+/* Print str, of at most len bytes, as a JSON string. */
+static void
+gt_aggregate_print_string(FILE *stream, const char *str, size_t len)
+{
+	fputc('"', stream);
+
+	for (size_t i = 0; i < len && '\0' != str[i]; i++) {
+		unsigned char c = str[i];
+
+		if ('"' == c || '\\' == c) {
+			fprintf(stream, "\\%c", c);
+		} else if (c < 0x20) {
+			fprintf(stream, "\\u%04x", c);
+		} else {
+			fputc(c, stream);
+		}
+	}
+
+	fputc('"', stream);
+}
+
+/* The name of the system call syscall, or "" if the schema has none. */
+static const char *
+gt_aggregate_syscall_name(gt_aggregate *aggregate, uint32_t syscall)
+{
+	const char *name = NULL;
+
+	if (syscall < aggregate->table->count) {
+		name = aggregate->table->descs[syscall].name;
+	}
+
+	return NULL == name ? "" : name;
+}
+
+/* Add the latencies of table to those of the snapshot. */
+static void
+gt_aggregate_merge_latency(gt_aggregate *aggregate, gt_count_table *table)
+{
+	GHashTableIter iter;
+	gt_process_latency *process, *merged;
+
+	for (uint32_t i = 0; i < aggregate->table->count; i++) {
+		if (NULL == table->syscalls[i]) {
+			continue;
+		}
+
+		if (NULL == aggregate->merged_syscalls[i]) {
+			aggregate->merged_syscalls[i] = g_new(gt_histogram, 1);
+			gt_histogram_init(aggregate->merged_syscalls[i]);
+		}
+
+		gt_histogram_merge(aggregate->merged_syscalls[i], table->syscalls[i]);
+	}
+
+	g_hash_table_iter_init(&iter, table->processes);
+	while (g_hash_table_iter_next(&iter, (gpointer *) &process, NULL)) {
+		merged = g_hash_table_lookup(aggregate->merged_processes, &process->key);
+		if (NULL == merged) {
+			merged  = g_new(gt_process_latency, 1);
+			*merged = *process;
+			g_hash_table_add(aggregate->merged_processes, merged);
+			continue;
+		}
+
+		gt_histogram_merge(&merged->histogram, &process->histogram);
+	}
+}
+
+/* Print the latencies of the snapshot, of each system call and then of each process. */
+static void
+gt_aggregate_print_latency(gt_aggregate *aggregate)
+{
+	const char *separator = "";
+	GHashTableIter iter;
+	gt_process_latency *process;
+
+	fprintf(aggregate->stream, ", \"latency\": {\"syscalls\": [");
+	for (uint32_t i = 0; i < aggregate->table->count; i++) {
+		gt_histogram *histogram = aggregate->merged_syscalls[i];
+
+		if (NULL == histogram || 0 == histogram->count) {
+			continue;
+		}
+
+		fprintf(aggregate->stream, "%s{\"syscall\": ", separator);
+		gt_aggregate_print_string(aggregate->stream, gt_aggregate_syscall_name(aggregate, i), SIZE_MAX);
+		fprintf(aggregate->stream, ", \"latency\": ");
+		gt_histogram_print(histogram, aggregate->stream);
+		fprintf(aggregate->stream, "}");
+		separator = ", ";
+	}
+
+	g_ptr_array_set_size(aggregate->sorted_processes, 0);
+	g_hash_table_iter_init(&iter, aggregate->merged_processes);
+	while (g_hash_table_iter_next(&iter, (gpointer *) &process, NULL)) {
+		g_ptr_array_add(aggregate->sorted_processes, process);
+	}
+	g_ptr_array_sort(aggregate->sorted_processes, gt_aggregate_compare_keys);
+
+	fprintf(aggregate->stream, "], \"processes\": [");
+	for (guint i = 0; i < aggregate->sorted_processes->len; i++) {
+		process = g_ptr_array_index(aggregate->sorted_processes, i);
+
+		fprintf(aggregate->stream, "%s{\"pid\": %" PRIu64 ", \"comm\": ",
+		        0 == i ? "" : ", ",
+		        process->key);
+		gt_aggregate_print_string(aggregate->stream, process->comm, sizeof process->comm);
+		fprintf(aggregate->stream, ", \"latency\": ");
+		gt_histogram_print(&process->histogram, aggregate->stream);
+		fprintf(aggregate->stream, "}");
+	}
+	fprintf(aggregate->stream, "]}");
+}
+
+/* Empty table, which the aggregate thread has merged, for the event thread to count into again. */
+static void
+gt_count_table_clear(gt_aggregate *aggregate, gt_count_table *table)
+{
+	g_hash_table_remove_all(table->counts);
+
+	if (aggregate->latency) {
+		g_hash_table_remove_all(table->processes);
+		for (uint32_t i = 0; i < aggregate->table->count; i++) {
+			if (NULL != table->syscalls[i]) {
+				gt_histogram_init(table->syscalls[i]);
+			}
+		}
+	}
+}
+
+/*
+ * Make the event thread count into the other set of tables, and wait for
+ * it to finish any count into the set it leaves, which is a matter of
+ * instructions; the aggregate thread then has that set to itself. Returns
+ * the set. The event thread takes no lock, but announces the set it counts
+ * into before checking that it is still active; see gt_aggregate_count().
+ */
+static gint
+gt_aggregate_swap(gt_aggregate *aggregate)
+{
+	gint retired = g_atomic_int_get(&aggregate->active);
+
+	g_atomic_int_set(&aggregate->active, !retired);
+
+	while (retired == g_atomic_int_get(&aggregate->writing)) {
+		g_thread_yield();
+	}
+
+	return retired;
+}
+
+/*
+ * Swap the sets of tables, add the retired tables of every VCPU to the
+ * totals, and print the totals, each process's system calls in turn. The
+ * event thread never waits on this.
+ */
+static void
+gt_aggregate_snapshot(gt_aggregate *aggregate)
+{
+	gint64 start = g_get_monotonic_time();
+	GHashTableIter iter;
+	gt_count *count, *merged;
+	uint64_t elapsed;
+	gint retired = gt_aggregate_swap(aggregate);
+
+	for (int i = 0; i < GT_AGGREGATE_MAX_VCPUS; i++) {
+		gt_count_table *table = &aggregate->tables[retired][i];
+
+		if (aggregate->latency) {
+			gt_aggregate_merge_latency(aggregate, table);
+		}
+
+		g_hash_table_iter_init(&iter, table->counts);
+		while (g_hash_table_iter_next(&iter, (gpointer *) &count, NULL)) {
+			merged = g_hash_table_lookup(aggregate->merged, &count->key);
+			if (NULL == merged) {
+				merged  = g_new(gt_count, 1);
+				*merged = *count;
+				g_hash_table_add(aggregate->merged, merged);
+				continue;
+			}
+
+			merged->calls += count->calls;
+			for (int j = 0; j < GT_RET_CLASS_COUNT; j++) {
+				merged->returns[j] += count->returns[j];
+			}
+		}
+
+		gt_count_table_clear(aggregate, table);
+	}
+
+	g_ptr_array_set_size(aggregate->sorted, 0);
+	g_hash_table_iter_init(&iter, aggregate->merged);
+	while (g_hash_table_iter_next(&iter, (gpointer *) &count, NULL)) {
+		g_ptr_array_add(aggregate->sorted, count);
+	}
+	g_ptr_array_sort(aggregate->sorted, gt_aggregate_compare_keys);
+
+	elapsed = g_get_monotonic_time() - start;
+	aggregate->snapshots++;
+	aggregate->merge_usec    += elapsed;
+	aggregate->merge_max_usec = MAX(aggregate->merge_max_usec, elapsed);
+
+	fprintf(aggregate->stream, "{\"aggregate\": {"
+	                           "\"snapshot\": %" PRIu64 ", "
+	                           "\"timestamp\": %" PRIu64 ", "
+	                           "\"counts\": [",
+	        aggregate->snapshots,
+	        gt_trace_clock());
+
+	for (guint i = 0; i < aggregate->sorted->len; i++) {
+		count = g_ptr_array_index(aggregate->sorted, i);
+
+		fprintf(aggregate->stream, "%s{\"pid\": %" PRIu32 ", \"comm\": ",
+		        0 == i ? "" : ", ",
+		        (uint32_t) (count->key >> 32));
+		gt_aggregate_print_string(aggregate->stream, count->comm, sizeof count->comm);
+		fprintf(aggregate->stream, ", \"syscall\": ");
+		gt_aggregate_print_string(aggregate->stream,
+		                          gt_aggregate_syscall_name(aggregate, (uint32_t) count->key),
+		                          SIZE_MAX);
+		fprintf(aggregate->stream, ", \"calls\": %" PRIu64, count->calls);
+		for (int j = 0; j < GT_RET_CLASS_COUNT; j++) {
+			fprintf(aggregate->stream, ", \"%s\": %" PRIu64, GT_RET_CLASS_NAMES[j], count->returns[j]);
+		}
+		fprintf(aggregate->stream, "}");
+	}
+
+	fprintf(aggregate->stream, "]");
+
+	if (aggregate->latency) {
+		gt_aggregate_print_latency(aggregate);
+	}
+
+	fprintf(aggregate->stream, "}}\n");
+	fflush(aggregate->stream);
+}
+
+/* The aggregate thread. It takes a snapshot each interval, and once more when stopped. */
+static gpointer
+gt_aggregate_run(gpointer data)
+{
+	gt_aggregate *aggregate = data;
+	gint64 interval = aggregate->interval * G_TIME_SPAN_SECOND;
+	gint64 next = g_get_monotonic_time() + interval;
+	gboolean stopping = FALSE;
+
+	while (!stopping) {
+		g_mutex_lock(&aggregate->lock);
+		while (!aggregate->stopping) {
+			if (0 == interval) {
+				g_cond_wait(&aggregate->cond, &aggregate->lock);
+			} else if (!g_cond_wait_until(&aggregate->cond, &aggregate->lock, next)) {
+				break;
+			}
+		}
+
+		stopping = aggregate->stopping;
+		g_mutex_unlock(&aggregate->lock);
+
+		gt_aggregate_snapshot(aggregate);
+		next = g_get_monotonic_time() + interval;
+	}
+
+	return NULL;
+}
+
+/*
+ * Create an aggregate of the system calls of table, which prints a
+ * snapshot to stream every interval seconds, or, if interval is 0, only
+ * when stopped. With latency, the aggregate also keeps histograms of how
+ * long each system call, and the system calls of each process, took to
+ * return. Stream remains the caller's to close after gt_aggregate_free().
+ */
+gt_aggregate *
+gt_aggregate_new(FILE *stream, const gt_syscall_table *table, guint interval, gboolean latency)
+{
+	gt_aggregate *aggregate = g_new0(gt_aggregate, 1);
+	sigset_t all, old;
+
+	aggregate->stream   = stream;
+	aggregate->table    = table;
+	aggregate->interval = interval;
+	aggregate->latency  = latency;
+	aggregate->merged   = gt_count_table_new();
+	aggregate->sorted   = g_ptr_array_new();
+	aggregate->writing  = -1;
+
+	for (int set = 0; set < 2; set++) {
+		for (int i = 0; i < GT_AGGREGATE_MAX_VCPUS; i++) {
+			aggregate->tables[set][i].counts = gt_count_table_new();
+		}
+	}
+
+	if (latency) {
+		aggregate->merged_syscalls  = g_new0(gt_histogram *, table->count);
+		aggregate->merged_processes = gt_count_table_new();
+		aggregate->sorted_processes = g_ptr_array_new();
+
+		for (int set = 0; set < 2; set++) {
+			for (int i = 0; i < GT_AGGREGATE_MAX_VCPUS; i++) {
+				aggregate->tables[set][i].syscalls  = g_new0(gt_histogram *, table->count);
+				aggregate->tables[set][i].processes = gt_count_table_new();
+			}
+		}
+	}
+
+	g_mutex_init(&aggregate->lock);
+	g_cond_init(&aggregate->cond);
+
+	/* Leave guestrace's signals to the thread which runs the loop. */
+	sigfillset(&all);
+	pthread_sigmask(SIG_SETMASK, &all, &old);
+	aggregate->thread = g_thread_new("gt-aggregate", gt_aggregate_run, aggregate);
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+	return aggregate;
+}
+
+/* Take a last snapshot, and stop the aggregate thread. The event loop must no longer be running. */
+void
+gt_aggregate_stop(gt_aggregate *aggregate)
+{
+	if (NULL == aggregate || NULL == aggregate->thread) {
+		return;
+	}
+
+	g_mutex_lock(&aggregate->lock);
+	aggregate->stopping = TRUE;
+	g_cond_signal(&aggregate->cond);
+	g_mutex_unlock(&aggregate->lock);
+
+	g_thread_join(aggregate->thread);
+	aggregate->thread = NULL;
+}
+
+void
+gt_aggregate_free(gt_aggregate *aggregate)
+{
+	if (NULL == aggregate) {
+		return;
+	}
+
+	gt_aggregate_stop(aggregate);
+
+	for (int set = 0; set < 2; set++) {
+		for (int i = 0; i < GT_AGGREGATE_MAX_VCPUS; i++) {
+			g_hash_table_destroy(aggregate->tables[set][i].counts);
+		}
+	}
+
+	if (aggregate->latency) {
+		for (uint32_t i = 0; i < aggregate->table->count; i++) {
+			g_free(aggregate->merged_syscalls[i]);
+		}
+
+		for (int set = 0; set < 2; set++) {
+			for (int i = 0; i < GT_AGGREGATE_MAX_VCPUS; i++) {
+				gt_count_table *table = &aggregate->tables[set][i];
+
+				for (uint32_t j = 0; j < aggregate->table->count; j++) {
+					g_free(table->syscalls[j]);
+				}
+				g_free(table->syscalls);
+				g_hash_table_destroy(table->processes);
+			}
+		}
+
+		g_free(aggregate->merged_syscalls);
+		g_hash_table_destroy(aggregate->merged_processes);
+		g_ptr_array_free(aggregate->sorted_processes, TRUE);
+	}
+
+	g_ptr_array_free(aggregate->sorted, TRUE);
+	g_hash_table_destroy(aggregate->merged);
+	g_mutex_clear(&aggregate->lock);
+	g_cond_clear(&aggregate->cond);
+	g_free(aggregate);
+}
+
+/* The latencies of the process pid in table, which the event thread creates. */
+static gt_process_latency *
+gt_count_table_get_process(gt_count_table *table, uint32_t pid, const char *comm)
+{
+	uint64_t key = pid;
+	gt_process_latency *process = g_hash_table_lookup(table->processes, &key);
+
+	if (NULL == process) {
+		process      = g_new0(gt_process_latency, 1);
+		process->key = key;
+		if (NULL != comm) {
+			strncpy(process->comm, comm, sizeof process->comm);
+		}
+		gt_histogram_init(&process->histogram);
+		g_hash_table_add(table->processes, process);
+	}
+
+	return process;
+}
+
+/*
+ * Count a call of the system call syscall by the process pid, named comm,
+ * or NULL if unnamed, or its return of ret, by the type of the event. An
+ * aggregate with latency also records how many nanoseconds the return
+ * came after the call. Called by the event thread alone, which counts
+ * without a lock; see gt_aggregate_swap().
+ */
+void
+gt_aggregate_count(gt_aggregate *aggregate,
+                   uint16_t vcpu,
+                   uint32_t pid,
+                   const char *comm,
+                   uint32_t syscall,
+                   gt_record_type type,
+                   uint64_t ret,
+                   uint64_t latency)
+{
+	uint64_t key = (uint64_t) pid << 32 | syscall;
+	gt_count_table *table;
+	gt_count *count;
+	gint set;
+
+	/* Claim the active set, unless the aggregate thread swaps it meanwhile. */
+	do {
+		set = g_atomic_int_get(&aggregate->active);
+		g_atomic_int_set(&aggregate->writing, set);
+	} while (set != g_atomic_int_get(&aggregate->active));
+
+	table = &aggregate->tables[set][vcpu % GT_AGGREGATE_MAX_VCPUS];
+
+	count = g_hash_table_lookup(table->counts, &key);
+	if (NULL == count) {
+		count      = g_new0(gt_count, 1);
+		count->key = key;
+		if (NULL != comm) {
+			strncpy(count->comm, comm, sizeof count->comm);
+		}
+		g_hash_table_add(table->counts, count);
+	}
+
+	if (GT_RECORD_SYSRET == type) {
+		count->returns[gt_aggregate_classify(aggregate->table, ret)]++;
+	} else {
+		count->calls++;
+	}
+
+	if (GT_RECORD_SYSRET == type && aggregate->latency && syscall < aggregate->table->count) {
+		if (NULL == table->syscalls[syscall]) {
+			table->syscalls[syscall] = g_new(gt_histogram, 1);
+			gt_histogram_init(table->syscalls[syscall]);
+		}
+
+		gt_histogram_record(table->syscalls[syscall], latency);
+		gt_histogram_record(&gt_count_table_get_process(table, pid, comm)->histogram, latency);
+	}
+
+	g_atomic_int_set(&aggregate->writing, -1);
+
+	aggregate->events++;
+}
+
+/*
+ * Write the aggregate's statistics to stream as a line of JSON: how many
+ * events it counted, into how many counts, and how long it took to merge
+ * the tables of the VCPUs. Call this once the aggregate is stopped.
+ */
+void
+gt_aggregate_print_stats(gt_aggregate *aggregate, FILE *stream)
+{
+	fprintf(stream, "{\"aggregator\": {"
+	                "\"events\": %" PRIu64 ", "
+	                "\"counts\": %u, "
+	                "\"snapshots\": %" PRIu64 ", "
+	                "\"mean_merge_usec\": %.0f, "
+	                "\"max_merge_usec\": %" PRIu64 "}}\n",
+	        aggregate->events,
+	        g_hash_table_size(aggregate->merged),
+	        aggregate->snapshots,
+	        aggregate->snapshots ? (double) aggregate->merge_usec / aggregate->snapshots : 0.0,
+	        aggregate->merge_max_usec);
+}
@@ -0,0 +1,50 @@
+#ifndef TRACE_AGGREGATE_H
+#define TRACE_AGGREGATE_H
+
+#include <glib.h>
+#include <stdio.h>
+
+#include "trace-record.h"
+
+/*
+ * Counts of system calls, in the manner of strace -c, in place of a
+ * trace. The decoders count each call and return of a process in a table
+ * of the event's VCPU, without composing a record, and a thread of the
+ * aggregate's own periodically merges the tables and prints the counts
+ * so far to a stream, as a line of JSON, and once more when stopped.
+ * The aggregate can also keep histograms of the system calls' latencies;
+ * see trace-histogram.h.
+ */
+typedef struct gt_aggregate gt_aggregate;
+
+/* How a system call returned; see gt_aggregate_count(). */
+typedef enum gt_ret_class {
+	GT_RET_SUCCESS,
+	GT_RET_WARNING,  /* A Windows NTSTATUS of warning severity. */
+	GT_RET_ERROR,    /* A Linux -errno, or a Windows NTSTATUS of error severity. */
+	GT_RET_CLASS_COUNT,
+} gt_ret_class;
+
+/* Default seconds between snapshots; see gt_aggregate_new(). */
+#define GT_AGGREGATE_INTERVAL 10
+
+/* The most VCPUs with tables of their own; others share them. */
+#define GT_AGGREGATE_MAX_VCPUS 64
+
+gt_aggregate *gt_aggregate_new(FILE *stream,
+                               const gt_syscall_table *table,
+                               guint interval,
+                               gboolean latency);
+void          gt_aggregate_stop(gt_aggregate *aggregate);
+void          gt_aggregate_free(gt_aggregate *aggregate);
+void          gt_aggregate_count(gt_aggregate *aggregate,
+                                 uint16_t vcpu,
+                                 uint32_t pid,
+                                 const char *comm,
+                                 uint32_t syscall,
+                                 gt_record_type type,
+                                 uint64_t ret,
+                                 uint64_t latency);
+void          gt_aggregate_print_stats(gt_aggregate *aggregate, FILE *stream);
+
+#endif
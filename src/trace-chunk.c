@@ -0,0 +1,415 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <glib.h>
+#include <inttypes.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zstd.h>
+
+#include "trace-chunk.h"
+
+struct gt_chunker {
+	int        level;
+	ZSTD_CCtx *cctx;
+	uint8_t   *out;          /* The bytes which the last call produced. */
+	size_t     out_size;
+	uint64_t   offset;       /* Of the next bytes, from the start of the file. */
+	GArray    *index;        /* Of gt_chunk_index_entry. */
+
+	uint64_t   chunks;
+	uint64_t   bytes_in;
+	uint64_t   bytes_out;
+	uint64_t   compress_usec;
+};
+
+struct gt_chunk_reader {
+	int        fd;
+	gt_record *schema;
+	GArray    *index;        /* Of gt_chunk_index_entry. */
+	uint64_t  *max_seen;     /* The greatest max_timestamp up to each chunk. */
+};
+
+/* Make room for len bytes of output. */
+static uint8_t *
+gt_chunker_reserve(gt_chunker *chunker, size_t len)
+{
+	if (len > chunker->out_size) {
+		chunker->out_size = len;
+		chunker->out      = g_realloc(chunker->out, len);
+	}
+
+	return chunker->out;
+}
+
+/* Create a chunker which compresses at zstd's level. */
+gt_chunker *
+gt_chunker_new(int level)
+{
+	gt_chunker *chunker = g_new0(gt_chunker, 1);
+
+	chunker->level = level;
+	chunker->cctx  = ZSTD_createCCtx();
+	chunker->index = g_array_new(FALSE, FALSE, sizeof (gt_chunk_index_entry));
+
+	return chunker;
+}
+
+void
+gt_chunker_free(gt_chunker *chunker)
+{
+	if (NULL == chunker) {
+		return;
+	}
+
+	ZSTD_freeCCtx(chunker->cctx);
+	g_array_free(chunker->index, TRUE);
+	g_free(chunker->out);
+	g_free(chunker);
+}
+
+/*
+ * Set *out to the start of a file: its header, and schema. The chunker
+ * begins a new index, but keeps its statistics across files.
+ */
+size_t
+gt_chunker_begin(gt_chunker *chunker, const gt_record *schema, const void **out)
+{
+	gt_chunk_file_header header = { GT_CHUNK_MAGIC, GT_CHUNK_VERSION, sizeof header };
+	size_t len = sizeof header + schema->size;
+	uint8_t *buf = gt_chunker_reserve(chunker, len);
+
+	chunker->offset = 0;
+	g_array_set_size(chunker->index, 0);
+
+	header.compression = GT_CHUNK_ZSTD;
+	header.schema_size = schema->size;
+	memcpy(buf, &header, sizeof header);
+	memcpy(buf + sizeof header, schema, schema->size);
+
+	chunker->offset += len;
+	*out = buf;
+	return len;
+}
+
+/*
+ * Set *out to a chunk which holds the len bytes of whole records at
+ * records, and add the chunk to the index. Returns the chunk's size, or
+ * zero on failure.
+ */
+size_t
+gt_chunker_compress(gt_chunker *chunker, const void *records, size_t len, const void **out)
+{
+	gt_chunk_index_entry entry = { chunker->offset };
+	gt_chunk_header *header = &entry.header;
+	const uint8_t *pos = records, *end = pos + len;
+	gint64 start = g_get_monotonic_time();
+	uint8_t *buf;
+	size_t n;
+
+	header->magic         = GT_CHUNK_HEADER_MAGIC;
+	header->size          = len;
+	header->min_timestamp = UINT64_MAX;
+
+	while (pos < end) {
+		const gt_record *record = gt_record_check(pos, end - pos);
+
+		if (NULL == record) {
+			break;
+		}
+
+		header->records++;
+		header->min_timestamp = MIN(header->min_timestamp, record->timestamp);
+		header->max_timestamp = MAX(header->max_timestamp, record->timestamp);
+		pos += record->size;
+	}
+
+	if (0 == header->records) {
+		header->min_timestamp = 0;
+	}
+
+	buf = gt_chunker_reserve(chunker, sizeof *header + ZSTD_compressBound(len));
+	n   = ZSTD_compressCCtx(chunker->cctx,
+	                        buf + sizeof *header,
+	                        chunker->out_size - sizeof *header,
+	                        records,
+	                        len,
+	                        chunker->level);
+	if (ZSTD_isError(n)) {
+		fprintf(stderr, "could not compress trace: %s\n", ZSTD_getErrorName(n));
+		return 0;
+	}
+
+	header->compressed_size = n;
+	memcpy(buf, header, sizeof *header);
+	g_array_append_val(chunker->index, entry);
+
+	chunker->offset        += sizeof *header + n;
+	chunker->chunks++;
+	chunker->bytes_in      += len;
+	chunker->bytes_out     += sizeof *header + n;
+	chunker->compress_usec += g_get_monotonic_time() - start;
+
+	*out = buf;
+	return sizeof *header + n;
+}
+
+/* Set *out to the end of the file: the index of its chunks, and the footer. */
+size_t
+gt_chunker_finish(gt_chunker *chunker, const void **out)
+{
+	gt_chunk_footer footer = { chunker->offset, chunker->index->len };
+	size_t index_len = chunker->index->len * sizeof (gt_chunk_index_entry);
+	uint8_t *buf = gt_chunker_reserve(chunker, index_len + sizeof footer);
+
+	memcpy(footer.magic, GT_CHUNK_FOOTER_MAGIC, sizeof GT_CHUNK_FOOTER_MAGIC);
+	memcpy(buf, chunker->index->data, index_len);
+	memcpy(buf + index_len, &footer, sizeof footer);
+
+	chunker->offset += index_len + sizeof footer;
+	*out = buf;
+	return index_len + sizeof footer;
+}
+
+/* The entry of the chunk which gt_chunker_compress() last produced. */
+const gt_chunk_index_entry *
+gt_chunker_get_last_entry(gt_chunker *chunker)
+{
+	return &g_array_index(chunker->index, gt_chunk_index_entry, chunker->index->len - 1);
+}
+
+void
+gt_chunker_print_stats(gt_chunker *chunker, FILE *stream)
+{
+	fprintf(stream, "{\"level\": %d, "
+	                "\"chunks\": %" PRIu64 ", "
+	                "\"bytes_in\": %" PRIu64 ", "
+	                "\"bytes_out\": %" PRIu64 ", "
+	                "\"ratio\": %.2f, "
+	                "\"compress_usec\": %" PRIu64 "}",
+	        chunker->level,
+	        chunker->chunks,
+	        chunker->bytes_in,
+	        chunker->bytes_out,
+	        chunker->bytes_out ? (double) chunker->bytes_in / chunker->bytes_out : 0.0,
+	        chunker->compress_usec);
+}
+
+/* Read len bytes at offset, or fail. */
+static bool
+gt_chunk_pread(int fd, void *buf, size_t len, uint64_t offset)
+{
+	size_t done = 0;
+
+	while (done < len) {
+		ssize_t n = pread(fd, (uint8_t *) buf + done, len - done, offset + done);
+
+		if (n < 0 && EINTR == errno) {
+			continue;
+		}
+
+		if (n <= 0) {
+			return false;
+		}
+
+		done += n;
+	}
+
+	return true;
+}
+
+/* Read the index from the footer, if the trace was finished. */
+static bool
+gt_chunk_reader_read_index(gt_chunk_reader *reader, uint64_t file_size)
+{
+	gt_chunk_footer footer;
+	uint64_t index_len;
+
+	if (file_size < sizeof footer
+	 || !gt_chunk_pread(reader->fd, &footer, sizeof footer, file_size - sizeof footer)
+	 || memcmp(footer.magic, GT_CHUNK_FOOTER_MAGIC, sizeof GT_CHUNK_FOOTER_MAGIC)) {
+		return false;
+	}
+
+	index_len = (uint64_t) footer.chunk_count * sizeof (gt_chunk_index_entry);
+	if (footer.index_offset + index_len + sizeof footer != file_size) {
+		return false;
+	}
+
+	g_array_set_size(reader->index, footer.chunk_count);
+	if (!gt_chunk_pread(reader->fd, reader->index->data, index_len, footer.index_offset)) {
+		g_array_set_size(reader->index, 0);
+		return false;
+	}
+
+	return true;
+}
+
+/* Otherwise, find the chunks by walking their headers from offset. */
+static void
+gt_chunk_reader_scan(gt_chunk_reader *reader, uint64_t offset, uint64_t file_size)
+{
+	gt_chunk_index_entry entry;
+
+	while (offset + sizeof entry.header <= file_size
+	    && gt_chunk_pread(reader->fd, &entry.header, sizeof entry.header, offset)
+	    && GT_CHUNK_HEADER_MAGIC == entry.header.magic
+	    && offset + sizeof entry.header + entry.header.compressed_size <= file_size) {
+		entry.offset = offset;
+		g_array_append_val(reader->index, entry);
+		offset += sizeof entry.header + entry.header.compressed_size;
+	}
+}
+
+/* Open the compressed trace at path, and read its index. Returns NULL on failure. */
+gt_chunk_reader *
+gt_chunk_reader_open(const char *path)
+{
+	gt_chunk_reader *reader = g_new0(gt_chunk_reader, 1);
+	gt_chunk_file_header header;
+	uint64_t max_seen = 0;
+	struct stat st;
+
+	reader->index = g_array_new(FALSE, FALSE, sizeof (gt_chunk_index_entry));
+
+	reader->fd = open(path, O_RDONLY);
+	if (-1 == reader->fd || -1 == fstat(reader->fd, &st)) {
+		fprintf(stderr, "could not open %s: %s\n", path, strerror(errno));
+		goto fail;
+	}
+
+	if (!gt_chunk_pread(reader->fd, &header, sizeof header, 0)
+	 || memcmp(header.magic, GT_CHUNK_MAGIC, sizeof GT_CHUNK_MAGIC)
+	 || 0 == header.version
+	 || GT_CHUNK_VERSION < header.version
+	 || GT_CHUNK_ZSTD != header.compression) {
+		fprintf(stderr, "%s is not a compressed trace\n", path);
+		goto fail;
+	}
+
+	reader->schema = g_malloc(MAX(header.schema_size, sizeof (gt_record)));
+	if (!gt_chunk_pread(reader->fd, reader->schema, header.schema_size, header.header_size)
+	 || NULL == gt_record_check(reader->schema, header.schema_size)
+	 || GT_RECORD_SCHEMA != reader->schema->type) {
+		fprintf(stderr, "%s has no schema\n", path);
+		goto fail;
+	}
+
+	if (!gt_chunk_reader_read_index(reader, st.st_size)) {
+		gt_chunk_reader_scan(reader, header.header_size + header.schema_size, st.st_size);
+	}
+
+	/* The chunks are nearly in order of time; see gt_chunk_reader_find(). */
+	reader->max_seen = g_new(uint64_t, MAX(reader->index->len, 1));
+	for (guint i = 0; i < reader->index->len; i++) {
+		const gt_chunk_index_entry *entry = gt_chunk_reader_get_entry(reader, i);
+
+		max_seen            = MAX(max_seen, entry->header.max_timestamp);
+		reader->max_seen[i] = max_seen;
+	}
+
+	return reader;
+
+fail:
+	gt_chunk_reader_close(reader);
+	return NULL;
+}
+
+void
+gt_chunk_reader_close(gt_chunk_reader *reader)
+{
+	if (NULL == reader) {
+		return;
+	}
+
+	if (-1 != reader->fd) {
+		close(reader->fd);
+	}
+
+	g_array_free(reader->index, TRUE);
+	g_free(reader->max_seen);
+	g_free(reader->schema);
+	g_free(reader);
+}
+
+const gt_record *
+gt_chunk_reader_get_schema(gt_chunk_reader *reader)
+{
+	return reader->schema;
+}
+
+unsigned int
+gt_chunk_reader_count(gt_chunk_reader *reader)
+{
+	return reader->index->len;
+}
+
+const gt_chunk_index_entry *
+gt_chunk_reader_get_entry(gt_chunk_reader *reader, unsigned int chunk)
+{
+	return &g_array_index(reader->index, gt_chunk_index_entry, chunk);
+}
+
+/*
+ * Return the first chunk which may hold records at or after timestamp, or
+ * the number of chunks if none does. The writer writes records in order
+ * of time across the rings it holds, but a VCPU's record can reach its
+ * ring after a later one of another VCPU was written, so the chunks may
+ * overlap slightly; searching by the greatest timestamp so far allows
+ * for that.
+ */
+unsigned int
+gt_chunk_reader_find(gt_chunk_reader *reader, uint64_t timestamp)
+{
+	unsigned int low = 0, high = reader->index->len;
+
+	while (low < high) {
+		unsigned int mid = low + (high - low) / 2;
+
+		if (reader->max_seen[mid] < timestamp) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+/*
+ * Decompress chunk, and return its records for the caller to free with
+ * g_free(), storing their size in *len. Returns NULL on failure.
+ */
+void *
+gt_chunk_reader_read(gt_chunk_reader *reader, unsigned int chunk, size_t *len)
+{
+	const gt_chunk_index_entry *entry = gt_chunk_reader_get_entry(reader, chunk);
+	void *compressed = g_malloc(entry->header.compressed_size);
+	void *records = g_malloc(MAX(entry->header.size, 1));
+	size_t n;
+
+	if (!gt_chunk_pread(reader->fd,
+	                    compressed,
+	                    entry->header.compressed_size,
+	                    entry->offset + sizeof entry->header)) {
+		fprintf(stderr, "could not read chunk %u: %s\n", chunk, strerror(errno));
+		goto fail;
+	}
+
+	n = ZSTD_decompress(records, entry->header.size, compressed, entry->header.compressed_size);
+	if (ZSTD_isError(n) || n != entry->header.size) {
+		fprintf(stderr, "could not decompress chunk %u\n", chunk);
+		goto fail;
+	}
+
+	*len = n;
+	goto done;
+
+fail:
+	g_free(records);
+	records = NULL;
+
+done:
+	g_free(compressed);
+	return records;
+}
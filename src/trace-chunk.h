@@ -0,0 +1,97 @@
+#ifndef TRACE_CHUNK_H
+#define TRACE_CHUNK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "trace-record.h"
+
+/*
+ * The compressed trace format: the records of a binary trace, in chunks
+ * which zstd compresses independently of each other, so that a reader can
+ * decompress any one chunk without those before it. A compressed trace
+ * is laid out as:
+ *
+ *	gt_chunk_file_header
+ *	the schema, a GT_RECORD_SCHEMA, uncompressed
+ *	chunks, each a gt_chunk_header followed by compressed_size bytes
+ *	the index, a gt_chunk_index_entry for each chunk
+ *	gt_chunk_footer, in the last bytes of the file
+ *
+ * Each chunk decompresses to whole records, whose timestamps its header
+ * bounds. The index repeats the chunk headers along with each chunk's
+ * offset, so that a reader can find the chunks of a window of time from
+ * the end of the file alone. A trace which lacks its footer, because
+ * guestrace did not exit cleanly, remains readable up to its last whole
+ * chunk; readers then find the chunks by walking their headers.
+ *
+ * All fields are little-endian, as in trace-record.h. The version follows
+ * GT_TRACE_VERSION, that of the records within.
+ */
+
+#define GT_CHUNK_MAGIC         "GTCHUNK"
+#define GT_CHUNK_VERSION       2
+#define GT_CHUNK_HEADER_MAGIC  0x4b4e4843 /* "CHNK" */
+#define GT_CHUNK_FOOTER_MAGIC  "GTINDEX"
+
+typedef enum gt_chunk_compression {
+	GT_CHUNK_ZSTD = 1,
+} gt_chunk_compression;
+
+typedef struct gt_chunk_file_header {
+	char     magic[8];        /* GT_CHUNK_MAGIC, NUL-terminated. */
+	uint32_t version;         /* GT_CHUNK_VERSION. */
+	uint32_t header_size;     /* Bytes from the start of the file to the schema. */
+	uint32_t compression;     /* A gt_chunk_compression. */
+	uint32_t schema_size;     /* The first chunk follows the schema. */
+} gt_chunk_file_header;
+
+typedef struct gt_chunk_header {
+	uint32_t magic;           /* GT_CHUNK_HEADER_MAGIC. */
+	uint32_t compressed_size; /* Bytes which follow this header. */
+	uint32_t size;            /* Of the records, once decompressed. */
+	uint32_t records;
+	uint64_t min_timestamp;
+	uint64_t max_timestamp;
+} gt_chunk_header;
+
+typedef struct gt_chunk_index_entry {
+	uint64_t        offset;   /* Of the chunk's header, from the start of the file. */
+	gt_chunk_header header;
+} gt_chunk_index_entry;
+
+typedef struct gt_chunk_footer {
+	uint64_t index_offset;
+	uint32_t chunk_count;
+	uint32_t reserved;
+	char     magic[8];        /* GT_CHUNK_FOOTER_MAGIC, NUL-terminated. */
+} gt_chunk_footer;
+
+/*
+ * The writing side, which the writer thread alone uses. It produces the
+ * bytes of the file, which the caller writes in order.
+ */
+typedef struct gt_chunker gt_chunker;
+
+gt_chunker                 *gt_chunker_new(int level);
+void                        gt_chunker_free(gt_chunker *chunker);
+size_t                      gt_chunker_begin(gt_chunker *chunker, const gt_record *schema, const void **out);
+size_t                      gt_chunker_compress(gt_chunker *chunker, const void *records, size_t len, const void **out);
+size_t                      gt_chunker_finish(gt_chunker *chunker, const void **out);
+const gt_chunk_index_entry *gt_chunker_get_last_entry(gt_chunker *chunker);
+void                        gt_chunker_print_stats(gt_chunker *chunker, FILE *stream);
+
+/* The reading side. Chunks may be read from several threads at once. */
+typedef struct gt_chunk_reader gt_chunk_reader;
+
+gt_chunk_reader            *gt_chunk_reader_open(const char *path);
+void                        gt_chunk_reader_close(gt_chunk_reader *reader);
+const gt_record            *gt_chunk_reader_get_schema(gt_chunk_reader *reader);
+unsigned int                gt_chunk_reader_count(gt_chunk_reader *reader);
+const gt_chunk_index_entry *gt_chunk_reader_get_entry(gt_chunk_reader *reader, unsigned int chunk);
+unsigned int                gt_chunk_reader_find(gt_chunk_reader *reader, uint64_t timestamp);
+void                       *gt_chunk_reader_read(gt_chunk_reader *reader, unsigned int chunk, size_t *len);
+
+#endif
@@ -0,0 +1,85 @@
+#include <string.h>
+
+#include "trace-filter.h"
+
+/* Make filter match every record. */
+void
+gt_filter_init(gt_filter *filter)
+{
+	memset(filter, 0, sizeof *filter);
+	filter->to = UINT64_MAX;
+}
+
+/* Make filter match only the system call name of table. Returns false if table has none. */
+bool
+gt_filter_set_syscall(gt_filter *filter, const gt_syscall_table *table, const char *name)
+{
+	for (uint32_t i = 0; i < table->count; i++) {
+		if (NULL != table->descs[i].name && !strcmp(table->descs[i].name, name)) {
+			filter->by_syscall = true;
+			filter->syscall    = i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool
+gt_filter_matches(const gt_filter *filter, const gt_record *record)
+{
+	if (record->timestamp < filter->from || record->timestamp > filter->to) {
+		return false;
+	}
+
+	/* Clock records belong to no process, and keep a filtered trace's times. */
+	if (GT_RECORD_CLOCK == record->type) {
+		return true;
+	}
+
+	if (filter->by_syscall && record->syscall != filter->syscall) {
+		return false;
+	}
+
+	if (filter->by_pid && record->pid != filter->pid) {
+		return false;
+	}
+
+	if (NULL != filter->comm
+	 && ((record->flags & GT_RECORD_NO_NAME)
+	  || strncmp(record->comm, filter->comm, sizeof record->comm))) {
+		return false;
+	}
+
+	return true;
+}
+
+/*
+ * Whether the chunk of header may hold a record which filter matches,
+ * going by entry, the chunk's entry in the sidecar index, if it has one.
+ * The sidecar does not record processes' names.
+ */
+bool
+gt_filter_may_match_chunk(const gt_filter *filter,
+                          const gt_chunk_header *header,
+                          gt_index *index,
+                          const gt_index_entry *entry)
+{
+	if (header->max_timestamp < filter->from || header->min_timestamp > filter->to) {
+		return false;
+	}
+
+	if (NULL == entry) {
+		return true;
+	}
+
+	if (filter->by_syscall && !gt_index_has_syscall(index, entry, filter->syscall)) {
+		return false;
+	}
+
+	if (filter->by_pid && !gt_index_has_pid(index, entry, filter->pid)) {
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,33 @@
+#ifndef TRACE_FILTER_H
+#define TRACE_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "trace-chunk.h"
+#include "trace-index.h"
+
+/*
+ * The records which a reader of a trace asks for, by the options of
+ * guestrace-format and guestrace-query, and whether a chunk of a
+ * compressed trace may hold any of them.
+ */
+typedef struct gt_filter {
+	bool        by_pid;
+	uint32_t    pid;
+	bool        by_syscall;
+	uint32_t    syscall;    /* Index of the system call in the schema. */
+	const char *comm;       /* The process's name, or NULL for any. */
+	uint64_t    from;
+	uint64_t    to;
+} gt_filter;
+
+void gt_filter_init(gt_filter *filter);
+bool gt_filter_set_syscall(gt_filter *filter, const gt_syscall_table *table, const char *name);
+bool gt_filter_matches(const gt_filter *filter, const gt_record *record);
+bool gt_filter_may_match_chunk(const gt_filter *filter,
+                               const gt_chunk_header *header,
+                               gt_index *index,
+                               const gt_index_entry *entry);
+
+#endif
@@ -0,0 +1,384 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "trace-format.h"
+
+void
+gt_line_flush(gt_line *line)
+{
+	if (line->len > 0) {
+		fwrite(line->buf, 1, line->len, line->stream);
+		line->written += line->len;
+		line->len      = 0;
+	}
+}
+
+void
+gt_line_printf(gt_line *line, const char *format, ...)
+{
+	va_list ap;
+	int len;
+
+	va_start(ap, format);
+	len = vsnprintf(line->buf + line->len, sizeof line->buf - line->len, format, ap);
+	va_end(ap);
+
+	if (len < 0) {
+		goto done;
+	}
+
+	if (line->len + len < sizeof line->buf) {
+		line->len += len;
+		goto done;
+	}
+
+	/* Out of room: write what came before, and then try again. */
+	gt_line_flush(line);
+
+	va_start(ap, format);
+	if (len < sizeof line->buf) {
+		line->len = vsnprintf(line->buf, sizeof line->buf, format, ap);
+	} else {
+		vfprintf(line->stream, format, ap);
+	}
+	va_end(ap);
+
+done:
+	return;
+}
+
+/* Append value as the names of its bits, as gt_flags_format() prints them. */
+void
+gt_line_append_flags(gt_line *line, const gt_flag_table *table, uint64_t value)
+{
+	size_t room = sizeof line->buf - line->len;
+	size_t len  = gt_flags_format(table, value, line->buf + line->len, room);
+
+	if (len < room) {
+		line->len += len;
+		return;
+	}
+
+	/* Out of room: write what came before, and then try again. */
+	gt_line_flush(line);
+
+	len       = gt_flags_format(table, value, line->buf, sizeof line->buf);
+	line->len = len < sizeof line->buf ? len : sizeof line->buf - 1;
+}
+
+/* Append the string of payload, or "(null)" if there is none. */
+static void
+gt_line_append_string(gt_line *line, const gt_payload *payload, const char *quote)
+{
+	if (NULL == payload || GT_PAYLOAD_STRING != payload->kind) {
+		gt_line_printf(line, "%s(null)%s", quote, quote);
+		return;
+	}
+
+	gt_line_printf(line, "%s%.*s%s", quote, (int) payload->length,
+	               (const char *) gt_payload_data(payload), quote);
+}
+
+/*
+ * Formatters of each gt_arg_type. Each appends the value of an argument to
+ * line, along with whatever the decoder read from the guest through it.
+ */
+typedef void (*gt_arg_formatter) (gt_line *line, uint64_t arg, const gt_payload *payload);
+
+static void
+gt_format_hex(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_line_printf(line, "0x%"PRIx64, arg);
+}
+
+static void
+gt_format_int(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_line_printf(line, "%i", (int) arg);
+}
+
+static void
+gt_format_uint(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_line_printf(line, "%lu", (unsigned long) arg);
+}
+
+static void
+gt_format_long(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_line_printf(line, "%li", (long int) arg);
+}
+
+static void
+gt_format_string(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_line_append_string(line, payload, "\"");
+}
+
+static void
+gt_format_unicode_string(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_line_append_string(line, payload, "");
+}
+
+static void
+gt_format_object_attributes(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_payload_obj_attr obj_attr = { 0, 0, GT_PAYLOAD_NO_NAME };
+	const char *name = NULL;
+
+	if (NULL != payload
+	 && GT_PAYLOAD_OBJECT_ATTRIBUTES == payload->kind
+	 && payload->length >= sizeof obj_attr) {
+		memcpy(&obj_attr, gt_payload_data(payload), sizeof obj_attr);
+		name = (const char *) gt_payload_data(payload) + sizeof obj_attr;
+	}
+
+	if (NULL == name || GT_PAYLOAD_NO_NAME == obj_attr.name_length
+	 || obj_attr.name_length > payload->length - sizeof obj_attr) {
+		gt_line_printf(line, "RootDirectory = 0x%lx | ObjectName = (null) | Attributes = 0x%lx",
+		               obj_attr.root_directory,
+		               (uint64_t) obj_attr.attributes);
+		return;
+	}
+
+	gt_line_printf(line, "RootDirectory = 0x%lx | ObjectName = %.*s | Attributes = 0x%lx",
+	               obj_attr.root_directory,
+	               (int) obj_attr.name_length,
+	               name,
+	               (uint64_t) obj_attr.attributes);
+}
+
+/* PULONG and PHANDLE alike. */
+static void
+gt_format_p64(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	uint64_t value = 0;
+
+	if (NULL != payload && GT_PAYLOAD_U64 == payload->kind && payload->length == sizeof value) {
+		memcpy(&value, gt_payload_data(payload), sizeof value);
+	}
+
+	gt_line_printf(line, "0x%lx", value);
+}
+
+static void
+gt_format_access_mask(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	/* ACCESS_MASK is 32 bits wide. */
+	gt_line_append_flags(line, &GT_FLAGS_ACCESS_MASK, (uint32_t) arg);
+	gt_line_printf(line, " [0x%lx]", arg);
+}
+
+static void
+gt_format_boolean(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_line_printf(line, "%s", arg ? "TRUE" : "FALSE");
+}
+
+static void
+gt_format_open_flags(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	/* The flags of open() are an int. */
+	gt_line_append_flags(line, &GT_FLAGS_LINUX_OPEN, (uint32_t) arg);
+}
+
+static void
+gt_format_prot(gt_line *line, uint64_t arg, const gt_payload *payload)
+{
+	gt_line_append_flags(line, &GT_FLAGS_LINUX_PROT, arg);
+}
+
+static const gt_arg_formatter ARG_FORMATTERS[GT_ARG_TYPE_COUNT] = {
+	[GT_ARG_HEX]               = gt_format_hex,
+	[GT_ARG_INT]               = gt_format_int,
+	[GT_ARG_UINT]              = gt_format_uint,
+	[GT_ARG_LONG]              = gt_format_long,
+	[GT_ARG_STRING]            = gt_format_string,
+	[GT_ARG_UNICODE_STRING]    = gt_format_unicode_string,
+	[GT_ARG_OBJECT_ATTRIBUTES] = gt_format_object_attributes,
+	[GT_ARG_PULONG]            = gt_format_p64,
+	[GT_ARG_PHANDLE]           = gt_format_p64,
+	[GT_ARG_ACCESS_MASK]       = gt_format_access_mask,
+	[GT_ARG_BOOLEAN]           = gt_format_boolean,
+	[GT_ARG_OPEN_FLAGS]        = gt_format_open_flags,
+	[GT_ARG_PROT]              = gt_format_prot,
+};
+
+/*
+ * Append the arguments of desc which travel in direction dir, separated by
+ * commas and, if named is set, each preceded by its name.
+ */
+static void
+gt_format_args(gt_line *line,
+               const gt_syscall_desc *desc,
+               const gt_record *record,
+               const gt_payload *payloads[GT_SYSCALL_ARGS_MAX],
+               gt_arg_dir dir,
+               gboolean named)
+{
+	const uint64_t *args = gt_record_args(record);
+	const char *separator = "";
+
+	for (int i = 0; i < desc->arity; i++) {
+		const gt_syscall_arg *arg = &desc->args[i];
+
+		if (!(arg->dir & dir)) {
+			continue;
+		}
+
+		if (named) {
+			gt_line_printf(line, "%s%s: ", separator, arg->name);
+		} else {
+			gt_line_printf(line, "%s", separator);
+		}
+
+		ARG_FORMATTERS[arg->type](line, i < record->arg_count ? args[i] : 0, payloads[i]);
+		separator = ", ";
+	}
+}
+
+/* Append a time in nanoseconds as seconds, to the nanosecond. */
+static void
+gt_format_time(gt_line *line, uint64_t ns)
+{
+	gt_line_printf(line, "%" PRIu64 ".%09" PRIu64, ns / 1000000000, ns % 1000000000);
+}
+
+/*
+ * Append a clock record as the times which it pairs with its timestamp,
+ * and flush the line. Returns false, appending nothing, if it is
+ * malformed.
+ */
+static bool
+gt_format_clock(gt_line *line, const gt_record *record)
+{
+	const gt_payload *payloads[GT_SYSCALL_ARGS_MAX] = { NULL };
+	gt_payload_clock clock;
+
+	if (!gt_record_get_payloads(record, payloads)
+	 || NULL == payloads[0]
+	 || GT_PAYLOAD_CLOCK != payloads[0]->kind
+	 || payloads[0]->length < sizeof clock) {
+		return false;
+	}
+
+	memcpy(&clock, gt_payload_data(payloads[0]), sizeof clock);
+
+	gt_format_time(line, record->timestamp);
+	gt_line_printf(line, " clock: vcpu: %u monotonic: ", record->vcpu);
+	gt_format_time(line, clock.monotonic);
+	gt_line_printf(line, " realtime: ");
+	gt_format_time(line, clock.realtime);
+	gt_line_printf(line, " guest_tsc: 0x%" PRIx64 " guest_tsc_khz: %" PRIu32 "\n",
+	               clock.guest_tsc, clock.guest_tsc_khz);
+	gt_line_flush(line);
+
+	return true;
+}
+
+/* Begin the line of record with its time, if line prints timestamps. */
+static void
+gt_format_timestamp(gt_line *line, const gt_record *record)
+{
+	uint64_t tsc;
+
+	if (!line->timestamps) {
+		return;
+	}
+
+	gt_format_time(line, record->timestamp);
+	gt_line_printf(line, " ");
+	if (gt_record_get_guest_tsc(record, &tsc)) {
+		gt_line_printf(line, "tsc: 0x%" PRIx64 " ", tsc);
+	}
+}
+
+/*
+ * Whether gt_format_record() prints record: one of a system call or
+ * return, or a clock record if line prints timestamps.
+ */
+bool
+gt_format_prints(const gt_line *line, const gt_record *record)
+{
+	return GT_RECORD_SYSCALL == record->type
+	    || GT_RECORD_SYSRET == record->type
+	    || (GT_RECORD_CLOCK == record->type && line->timestamps);
+}
+
+/*
+ * Append record to line as guestrace prints it, in the style of the
+ * operating system which table describes, and flush the line. If line
+ * prints timestamps, each line begins with its record's, in seconds, and
+ * the guest's TSC if the record holds it. A process whose name guestrace
+ * could not read appears as "unknown" on Linux and, as Windows decoders
+ * always printed it, as "(null)" on Windows. Returns false, appending
+ * nothing, if record is malformed or is not one which line prints; see
+ * gt_format_prints().
+ */
+bool
+gt_format_record(gt_line *line, const gt_syscall_table *table, const gt_record *record)
+{
+	const gt_payload *payloads[GT_SYSCALL_ARGS_MAX] = { NULL };
+	const gt_syscall_desc *desc;
+	const char *proc = GT_OS_WINDOWS == table->os ? "(null)" : "unknown";
+	int proc_len = strlen(proc);
+	bool ok = false;
+
+	if (GT_RECORD_CLOCK == record->type && line->timestamps) {
+		ok = gt_format_clock(line, record);
+		goto done;
+	}
+
+	if ((GT_RECORD_SYSCALL != record->type && GT_RECORD_SYSRET != record->type)
+	 || record->syscall >= table->count
+	 || !gt_record_get_payloads(record, payloads)) {
+		goto done;
+	}
+
+	desc = &table->descs[record->syscall];
+
+	if (!(record->flags & GT_RECORD_NO_NAME)) {
+		proc     = record->comm;
+		proc_len = strnlen(record->comm, sizeof record->comm);
+	}
+
+	switch (table->os) {
+	case GT_OS_LINUX:
+		gt_format_timestamp(line, record);
+		if (GT_RECORD_SYSCALL == record->type) {
+			gt_line_printf(line, "pid: %u/0x%"PRIx64" (%.*s) syscall: %s(",
+			               record->pid, record->sp, proc_len, proc, desc->name);
+			gt_format_args(line, desc, record, payloads, GT_ARG_INOUT, FALSE);
+			gt_line_printf(line, ")\n");
+		} else {
+			gt_line_printf(line, "pid: %u/0x%"PRIx64" (%.*s) return: 0x%"PRIx64"\n",
+			               record->pid, record->tid, proc_len, proc, record->ret);
+		}
+		break;
+	case GT_OS_WINDOWS:
+		gt_format_timestamp(line, record);
+		if (GT_RECORD_SYSCALL == record->type) {
+			gt_line_printf(line, "pid: %u/0x%lx (%.*s) syscall: %s(",
+			               record->pid, record->tid, proc_len, proc, desc->name);
+			gt_format_args(line, desc, record, payloads, GT_ARG_IN, TRUE);
+		} else {
+			gt_line_printf(line, "pid: %u/0x%lx (%.*s) sysret: Status(0x%lx) OUT(",
+			               record->pid, record->tid, proc_len, proc, record->ret);
+			gt_format_args(line, desc, record, payloads, GT_ARG_OUT, TRUE);
+		}
+		gt_line_printf(line, ")\n");
+		break;
+	default:
+		goto done;
+	}
+
+	gt_line_flush(line);
+	ok = true;
+
+done:
+	return ok;
+}
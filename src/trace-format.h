@@ -0,0 +1,37 @@
+#ifndef TRACE_FORMAT_H
+#define TRACE_FORMAT_H
+
+#include <glib.h>
+#include <stdio.h>
+
+#include "flags.h"
+#include "trace-record.h"
+
+/*
+ * The text rendering of records: the lines which guestrace prints on
+ * stderr, and which guestrace-format prints from a binary trace.
+ */
+
+/* Size of the buffer in which the formatter composes each line. */
+#define GT_LINE_MAX 4096
+
+/*
+ * A line of output. The formatter composes each line here and writes it
+ * with one call; a line which outgrows the buffer goes out in pieces.
+ */
+typedef struct gt_line {
+	FILE     *stream;
+	bool      timestamps; /* Prefix lines with the times of their records. */
+	size_t    len;
+	uint64_t  written;    /* Bytes flushed to stream. */
+	char      buf[GT_LINE_MAX];
+} gt_line;
+
+void gt_line_flush(gt_line *line);
+void gt_line_printf(gt_line *line, const char *format, ...) G_GNUC_PRINTF(2, 3);
+void gt_line_append_flags(gt_line *line, const gt_flag_table *table, uint64_t value);
+
+bool gt_format_prints(const gt_line *line, const gt_record *record);
+bool gt_format_record(gt_line *line, const gt_syscall_table *table, const gt_record *record);
+
+#endif
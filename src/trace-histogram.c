@@ -0,0 +1,134 @@
+#include <inttypes.h>
+#include <string.h>
+
+#include "trace-histogram.h"
+
+/* The percentiles which gt_histogram_print() reports. */
+static const struct {
+	const char *name;
+	double      percentile;
+} GT_HISTOGRAM_PERCENTILES[] = {
+	{ "p50_ns",  50.0 },
+	{ "p90_ns",  90.0 },
+	{ "p99_ns",  99.0 },
+	{ "p999_ns", 99.9 },
+};
+
+void
+gt_histogram_init(gt_histogram *histogram)
+{
+	memset(histogram, 0, sizeof *histogram);
+	histogram->min = UINT64_MAX;
+}
+
+/* Add the counts of other to histogram. */
+void
+gt_histogram_merge(gt_histogram *histogram, const gt_histogram *other)
+{
+	if (0 == other->count) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < GT_HISTOGRAM_BUCKETS; i++) {
+		histogram->buckets[i] += other->buckets[i];
+	}
+
+	histogram->count += other->count;
+	histogram->sum   += other->sum;
+	histogram->min    = other->min < histogram->min ? other->min : histogram->min;
+	histogram->max    = other->max > histogram->max ? other->max : histogram->max;
+}
+
+/* The least value which bucket counts. */
+uint64_t
+gt_histogram_bucket_lowest(unsigned int bucket)
+{
+	unsigned int octave = bucket >> GT_HISTOGRAM_SUB_BITS;
+
+	if (0 == octave) {
+		return bucket;
+	}
+
+	return (uint64_t) (GT_HISTOGRAM_SUB_BUCKETS + bucket % GT_HISTOGRAM_SUB_BUCKETS) << (octave - 1);
+}
+
+/* The greatest value which bucket counts. */
+uint64_t
+gt_histogram_bucket_highest(unsigned int bucket)
+{
+	unsigned int octave = bucket >> GT_HISTOGRAM_SUB_BITS;
+
+	if (0 == octave) {
+		return bucket;
+	}
+
+	return gt_histogram_bucket_lowest(bucket) + (UINT64_C(1) << (octave - 1)) - 1;
+}
+
+/*
+ * The value below which percentile percent of the values fall, give or
+ * take the width of its bucket, or 0 if the histogram is empty. Like
+ * HdrHistogram, this reports the greatest value of the bucket, though
+ * never more than the greatest value recorded.
+ */
+uint64_t
+gt_histogram_percentile(const gt_histogram *histogram, double percentile)
+{
+	uint64_t rank, seen = 0;
+
+	if (0 == histogram->count) {
+		return 0;
+	}
+
+	rank = (uint64_t) (percentile / 100.0 * histogram->count + 0.5);
+	rank = rank < 1 ? 1 : rank > histogram->count ? histogram->count : rank;
+
+	for (unsigned int i = 0; i < GT_HISTOGRAM_BUCKETS; i++) {
+		seen += histogram->buckets[i];
+		if (seen >= rank) {
+			uint64_t highest = gt_histogram_bucket_highest(i);
+
+			return highest < histogram->max ? highest : histogram->max;
+		}
+	}
+
+	return histogram->max;
+}
+
+/*
+ * Write histogram to stream as JSON: its count, extremes, mean and a few
+ * percentiles, and, so that readers can merge histograms in turn, the
+ * least value and count of each bucket which counted any.
+ */
+void
+gt_histogram_print(const gt_histogram *histogram, FILE *stream)
+{
+	const char *separator = "";
+
+	fprintf(stream, "{\"count\": %" PRIu64 ", "
+	                "\"min_ns\": %" PRIu64 ", "
+	                "\"max_ns\": %" PRIu64 ", "
+	                "\"mean_ns\": %.0f",
+	        histogram->count,
+	        histogram->count ? histogram->min : 0,
+	        histogram->max,
+	        histogram->count ? (double) histogram->sum / histogram->count : 0.0);
+
+	for (size_t i = 0; i < sizeof GT_HISTOGRAM_PERCENTILES / sizeof *GT_HISTOGRAM_PERCENTILES; i++) {
+		fprintf(stream, ", \"%s\": %" PRIu64,
+		        GT_HISTOGRAM_PERCENTILES[i].name,
+		        gt_histogram_percentile(histogram, GT_HISTOGRAM_PERCENTILES[i].percentile));
+	}
+
+	fprintf(stream, ", \"buckets\": [");
+	for (unsigned int i = 0; i < GT_HISTOGRAM_BUCKETS; i++) {
+		if (0 != histogram->buckets[i]) {
+			fprintf(stream, "%s[%" PRIu64 ", %" PRIu64 "]",
+			        separator,
+			        gt_histogram_bucket_lowest(i),
+			        histogram->buckets[i]);
+			separator = ", ";
+		}
+	}
+	fprintf(stream, "]}");
+}
@@ -0,0 +1,70 @@
+#ifndef TRACE_HISTOGRAM_H
+#define TRACE_HISTOGRAM_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * A histogram of latencies, in nanoseconds, after HdrHistogram: each
+ * power of two splits into GT_HISTOGRAM_SUB_BUCKETS buckets of equal
+ * width, so that a bucket bounds the values it counts to within 1/16 of
+ * their size, however large. Recording a value costs a few instructions,
+ * and histograms merge by adding their buckets.
+ */
+
+#define GT_HISTOGRAM_SUB_BITS    4
+#define GT_HISTOGRAM_SUB_BUCKETS (1 << GT_HISTOGRAM_SUB_BITS)
+
+/* Larger values count as the largest, about 18 minutes. */
+#define GT_HISTOGRAM_MAX_BITS    40
+#define GT_HISTOGRAM_MAX         ((UINT64_C(1) << GT_HISTOGRAM_MAX_BITS) - 1)
+
+#define GT_HISTOGRAM_BUCKETS \
+	((GT_HISTOGRAM_MAX_BITS - GT_HISTOGRAM_SUB_BITS + 1) << GT_HISTOGRAM_SUB_BITS)
+
+typedef struct gt_histogram {
+	uint64_t count;
+	uint64_t sum;
+	uint64_t min;
+	uint64_t max;
+	uint64_t buckets[GT_HISTOGRAM_BUCKETS];
+} gt_histogram;
+
+/* The bucket of value, which must be at most GT_HISTOGRAM_MAX. */
+static inline unsigned int
+gt_histogram_bucket(uint64_t value)
+{
+	unsigned int bits;
+
+	if (value < GT_HISTOGRAM_SUB_BUCKETS) {
+		return value;
+	}
+
+	bits = 63 - __builtin_clzll(value);
+
+	return ((bits - GT_HISTOGRAM_SUB_BITS + 1) << GT_HISTOGRAM_SUB_BITS)
+	     + (value >> (bits - GT_HISTOGRAM_SUB_BITS)) - GT_HISTOGRAM_SUB_BUCKETS;
+}
+
+static inline void
+gt_histogram_record(gt_histogram *histogram, uint64_t value)
+{
+	if (value > GT_HISTOGRAM_MAX) {
+		value = GT_HISTOGRAM_MAX;
+	}
+
+	histogram->buckets[gt_histogram_bucket(value)]++;
+	histogram->count++;
+	histogram->sum += value;
+	histogram->min  = value < histogram->min ? value : histogram->min;
+	histogram->max  = value > histogram->max ? value : histogram->max;
+}
+
+void     gt_histogram_init(gt_histogram *histogram);
+void     gt_histogram_merge(gt_histogram *histogram, const gt_histogram *other);
+uint64_t gt_histogram_bucket_lowest(unsigned int bucket);
+uint64_t gt_histogram_bucket_highest(unsigned int bucket);
+uint64_t gt_histogram_percentile(const gt_histogram *histogram, double percentile);
+void     gt_histogram_print(const gt_histogram *histogram, FILE *stream);
+
+#endif
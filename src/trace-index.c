@@ -0,0 +1,287 @@
+#include <errno.h>
+#include <glib.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace-index.h"
+
+struct gt_index_writer {
+	FILE     *stream;
+	char     *path;
+	uint32_t  syscall_count;
+	uint64_t *syscalls;       /* The bitmap of the chunk being indexed. */
+	GArray   *pids;           /* Of uint32_t, likewise. */
+	gboolean  failed;
+};
+
+struct gt_index {
+	gchar     *data;
+	gsize      len;
+	uint32_t   syscall_count;
+	GPtrArray *entries;       /* Into data. */
+};
+
+/* The pids which follow the bitmap of entry. */
+static const uint32_t *
+gt_index_entry_pids(const gt_index_entry *entry, uint32_t syscall_count)
+{
+	return (const uint32_t *) ((const uint64_t *) (entry + 1) + GT_INDEX_WORDS(syscall_count));
+}
+
+static gint
+gt_index_compare_pids(gconstpointer a, gconstpointer b)
+{
+	uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+
+	return x < y ? -1 : x > y;
+}
+
+static void
+gt_index_writer_write(gt_index_writer *writer, const void *data, size_t len)
+{
+	if (!writer->failed && 1 != fwrite(data, len, 1, writer->stream)) {
+		fprintf(stderr, "failed to write %s: %s\n", writer->path, strerror(errno));
+		writer->failed = TRUE;
+	}
+}
+
+/*
+ * Create the sidecar at path, for a trace whose schema holds syscall_count
+ * system calls. Returns NULL on failure.
+ */
+gt_index_writer *
+gt_index_writer_new(const char *path, uint32_t syscall_count)
+{
+	gt_index_writer *writer;
+	gt_index_header header = { GT_INDEX_MAGIC, GT_INDEX_VERSION, sizeof header };
+	FILE *stream = fopen(path, "w");
+
+	if (NULL == stream) {
+		fprintf(stderr, "could not create %s: %s\n", path, strerror(errno));
+		return NULL;
+	}
+
+	writer                = g_new0(gt_index_writer, 1);
+	writer->stream        = stream;
+	writer->path          = g_strdup(path);
+	writer->syscall_count = syscall_count;
+	writer->syscalls      = g_new0(uint64_t, MAX(GT_INDEX_WORDS(syscall_count), 1));
+	writer->pids          = g_array_new(FALSE, FALSE, sizeof (uint32_t));
+
+	header.syscall_count = syscall_count;
+	gt_index_writer_write(writer, &header, sizeof header);
+
+	return writer;
+}
+
+void
+gt_index_writer_free(gt_index_writer *writer)
+{
+	if (NULL == writer) {
+		return;
+	}
+
+	fclose(writer->stream);
+	g_array_free(writer->pids, TRUE);
+	g_free(writer->syscalls);
+	g_free(writer->path);
+	g_free(writer);
+}
+
+/* Index chunk, which holds the len bytes of records at records. */
+void
+gt_index_writer_add(gt_index_writer *writer,
+                    const gt_chunk_index_entry *chunk,
+                    const void *records,
+                    size_t len)
+{
+	size_t words = GT_INDEX_WORDS(writer->syscall_count);
+	const uint8_t *pos = records, *end = pos + len;
+	static const uint8_t padding[8] = { 0 };
+	gt_index_entry entry = { 0 };
+	size_t pids_len;
+	guint unique = 0;
+
+	memset(writer->syscalls, 0, words * sizeof *writer->syscalls);
+	g_array_set_size(writer->pids, 0);
+
+	while (pos < end) {
+		const gt_record *record = gt_record_check(pos, end - pos);
+
+		if (NULL == record) {
+			break;
+		}
+
+		pos += record->size;
+
+		/* Clock records name no system call or process. */
+		if (GT_RECORD_SYSCALL != record->type && GT_RECORD_SYSRET != record->type) {
+			continue;
+		}
+
+		if (record->syscall < writer->syscall_count) {
+			writer->syscalls[record->syscall / 64] |= UINT64_C(1) << (record->syscall % 64);
+		}
+
+		g_array_append_val(writer->pids, record->pid);
+	}
+
+	g_array_sort(writer->pids, gt_index_compare_pids);
+	for (guint i = 0; i < writer->pids->len; i++) {
+		uint32_t pid = g_array_index(writer->pids, uint32_t, i);
+
+		if (0 == unique || pid != g_array_index(writer->pids, uint32_t, unique - 1)) {
+			g_array_index(writer->pids, uint32_t, unique++) = pid;
+		}
+	}
+
+	pids_len = unique * sizeof (uint32_t);
+
+	entry.size          = sizeof entry + words * sizeof (uint64_t) + GT_RECORD_ALIGN(pids_len);
+	entry.pid_count     = unique;
+	entry.chunk_offset  = chunk->offset;
+	entry.chunk_size    = sizeof chunk->header + chunk->header.compressed_size;
+	entry.min_timestamp = chunk->header.min_timestamp;
+	entry.max_timestamp = chunk->header.max_timestamp;
+	entry.records       = chunk->header.records;
+
+	gt_index_writer_write(writer, &entry, sizeof entry);
+	gt_index_writer_write(writer, writer->syscalls, words * sizeof (uint64_t));
+	if (unique > 0) {
+		gt_index_writer_write(writer, writer->pids->data, pids_len);
+	}
+	if (pids_len % 8) {
+		gt_index_writer_write(writer, padding, GT_RECORD_ALIGN(pids_len) - pids_len);
+	}
+}
+
+/* Flush the entries written so far, for readers to find. */
+void
+gt_index_writer_flush(gt_index_writer *writer)
+{
+	if (!writer->failed && 0 != fflush(writer->stream)) {
+		fprintf(stderr, "failed to write %s: %s\n", writer->path, strerror(errno));
+		writer->failed = TRUE;
+	}
+}
+
+/* Read the sidecar at path. Returns NULL on failure. */
+gt_index *
+gt_index_open(const char *path)
+{
+	gt_index *index = g_new0(gt_index, 1);
+	const gt_index_header *header;
+	GError *error = NULL;
+	gsize pos;
+
+	index->entries = g_ptr_array_new();
+
+	if (!g_file_get_contents(path, &index->data, &index->len, &error)) {
+		fprintf(stderr, "%s\n", error->message);
+		g_error_free(error);
+		goto fail;
+	}
+
+	header = (const gt_index_header *) index->data;
+	if (index->len < sizeof *header
+	 || memcmp(header->magic, GT_INDEX_MAGIC, sizeof GT_INDEX_MAGIC)
+	 || GT_INDEX_VERSION != header->version
+	 || header->header_size > index->len) {
+		fprintf(stderr, "%s is not an index\n", path);
+		goto fail;
+	}
+
+	index->syscall_count = header->syscall_count;
+
+	/* Stop at an entry which the writer had yet to finish. */
+	pos = header->header_size;
+	while (index->len - pos >= sizeof (gt_index_entry)) {
+		const gt_index_entry *entry = (const gt_index_entry *) (index->data + pos);
+		size_t words = GT_INDEX_WORDS(index->syscall_count);
+
+		if (entry->size > index->len - pos
+		 || entry->size < sizeof *entry + words * sizeof (uint64_t) + entry->pid_count * sizeof (uint32_t)) {
+			break;
+		}
+
+		g_ptr_array_add(index->entries, (gpointer) entry);
+		pos += entry->size;
+	}
+
+	return index;
+
+fail:
+	gt_index_close(index);
+	return NULL;
+}
+
+void
+gt_index_close(gt_index *index)
+{
+	if (NULL == index) {
+		return;
+	}
+
+	g_ptr_array_free(index->entries, TRUE);
+	g_free(index->data);
+	g_free(index);
+}
+
+unsigned int
+gt_index_count(gt_index *index)
+{
+	return index->entries->len;
+}
+
+const gt_index_entry *
+gt_index_get_entry(gt_index *index, unsigned int entry)
+{
+	return g_ptr_array_index(index->entries, entry);
+}
+
+/*
+ * Return the entry of the chunk at chunk_offset in the trace, or NULL if
+ * the sidecar lacks it.
+ */
+const gt_index_entry *
+gt_index_find(gt_index *index, uint64_t chunk_offset)
+{
+	unsigned int low = 0, high = index->entries->len;
+
+	while (low < high) {
+		unsigned int mid = low + (high - low) / 2;
+		const gt_index_entry *entry = gt_index_get_entry(index, mid);
+
+		if (entry->chunk_offset == chunk_offset) {
+			return entry;
+		} else if (entry->chunk_offset < chunk_offset) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return NULL;
+}
+
+/* Whether the chunk of entry holds a record of syscall. */
+bool
+gt_index_has_syscall(gt_index *index, const gt_index_entry *entry, uint32_t syscall)
+{
+	const uint64_t *syscalls = (const uint64_t *) (entry + 1);
+
+	if (syscall >= index->syscall_count) {
+		return false;
+	}
+
+	return syscalls[syscall / 64] & (UINT64_C(1) << (syscall % 64));
+}
+
+/* Whether the chunk of entry holds a record of the process pid. */
+bool
+gt_index_has_pid(gt_index *index, const gt_index_entry *entry, uint32_t pid)
+{
+	const uint32_t *pids = gt_index_entry_pids(entry, index->syscall_count);
+
+	return NULL != bsearch(&pid, pids, entry->pid_count, sizeof *pids, gt_index_compare_pids);
+}
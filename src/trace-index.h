@@ -0,0 +1,80 @@
+#ifndef TRACE_INDEX_H
+#define TRACE_INDEX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "trace-chunk.h"
+
+/*
+ * The sidecar index of a compressed trace, which guestrace writes to the
+ * trace's path with GT_INDEX_SUFFIX appended. Where the trace's own index
+ * bounds each chunk in time alone, the sidecar also says which system
+ * calls and which processes each chunk holds, so that a query for either
+ * can skip the chunks which cannot match without decompressing them; see
+ * guestrace-query.c. The sidecar is laid out as:
+ *
+ *	gt_index_header
+ *	an entry for each chunk, in the order of the trace
+ *
+ * Each entry is a gt_index_entry, followed by a bitmap of the system
+ * calls in the chunk, a bit for each system call of the trace's schema in
+ * uint64_t words, and then by the sorted pids of the processes in the
+ * chunk, as uint32_t, padded to eight bytes. The writer appends an entry
+ * after it writes each chunk, so a sidecar may lag the trace by the last
+ * few chunks, which readers must read to query.
+ *
+ * All fields are little-endian, as in trace-record.h.
+ */
+
+#define GT_INDEX_MAGIC   "GTSIDX"
+#define GT_INDEX_VERSION 1
+#define GT_INDEX_SUFFIX  ".idx"
+
+typedef struct gt_index_header {
+	char     magic[8];        /* GT_INDEX_MAGIC, NUL-terminated. */
+	uint32_t version;         /* GT_INDEX_VERSION. */
+	uint32_t header_size;     /* Bytes from the start of the file to the first entry. */
+	uint32_t syscall_count;   /* Bits in each entry's bitmap. */
+	uint32_t reserved;
+} gt_index_header;
+
+typedef struct gt_index_entry {
+	uint32_t size;            /* Of the entry, bitmap and pids included. */
+	uint32_t pid_count;
+	uint64_t chunk_offset;    /* Of the chunk's header in the trace. */
+	uint64_t chunk_size;      /* Of the chunk, header included. */
+	uint64_t min_timestamp;
+	uint64_t max_timestamp;
+	uint32_t records;
+	uint32_t reserved;
+	/* uint64_t syscalls[(syscall_count + 63) / 64]; */
+	/* uint32_t pids[pid_count]; */
+} gt_index_entry;
+
+#define GT_INDEX_WORDS(syscall_count) (((syscall_count) + 63) / 64)
+
+/* The writing side, which the writer thread alone uses. */
+typedef struct gt_index_writer gt_index_writer;
+
+gt_index_writer *gt_index_writer_new(const char *path, uint32_t syscall_count);
+void             gt_index_writer_free(gt_index_writer *writer);
+void             gt_index_writer_add(gt_index_writer *writer,
+                                     const gt_chunk_index_entry *chunk,
+                                     const void *records,
+                                     size_t len);
+void             gt_index_writer_flush(gt_index_writer *writer);
+
+/* The reading side. */
+typedef struct gt_index gt_index;
+
+gt_index             *gt_index_open(const char *path);
+void                  gt_index_close(gt_index *index);
+unsigned int          gt_index_count(gt_index *index);
+const gt_index_entry *gt_index_get_entry(gt_index *index, unsigned int entry);
+const gt_index_entry *gt_index_find(gt_index *index, uint64_t chunk_offset);
+bool                  gt_index_has_syscall(gt_index *index, const gt_index_entry *entry, uint32_t syscall);
+bool                  gt_index_has_pid(gt_index *index, const gt_index_entry *entry, uint32_t pid);
+
+#endif
@@ -0,0 +1,316 @@
+#include <glib.h>
+#include <string.h>
+
+#include "trace-record.h"
+
+/* The name_length of an argument which the prototype does not name. */
+#define GT_SCHEMA_NO_NAME UINT16_MAX
+
+static void
+gt_schema_append_name(GByteArray *data, const char *name)
+{
+	uint16_t len = NULL == name ? GT_SCHEMA_NO_NAME : strlen(name);
+
+	g_byte_array_append(data, (const guint8 *) &len, sizeof len);
+	if (NULL != name) {
+		g_byte_array_append(data, (const guint8 *) name, len);
+	}
+}
+
+/*
+ * Return a GT_RECORD_SCHEMA which describes table, for the caller to free
+ * with g_free(). Its payload holds the operating system and the number of
+ * system calls, each a uint32_t, followed by the system calls in the order
+ * of the table. Each system call is its arity and flags, a uint8_t each,
+ * and its name; each of its arguments then follows as its gt_arg_type and
+ * gt_arg_dir, a uint8_t each, and its name. A name is a uint16_t length
+ * followed by that many bytes, and GT_SCHEMA_NO_NAME stands for none.
+ */
+gt_record *
+gt_record_new_schema(const gt_syscall_table *table)
+{
+	GByteArray *data = g_byte_array_new();
+	gt_record record = { 0 };
+	gt_payload payload = { 0 };
+	uint32_t os = table->os;
+	static const uint8_t padding[8] = { 0 };
+
+	g_byte_array_append(data, (const guint8 *) &record, sizeof record);
+	g_byte_array_append(data, (const guint8 *) &payload, sizeof payload);
+	g_byte_array_append(data, (const guint8 *) &os, sizeof os);
+	g_byte_array_append(data, (const guint8 *) &table->count, sizeof table->count);
+
+	for (uint32_t i = 0; i < table->count; i++) {
+		const gt_syscall_desc *desc = &table->descs[i];
+
+		g_byte_array_append(data, &desc->arity, sizeof desc->arity);
+		g_byte_array_append(data, &desc->flags, sizeof desc->flags);
+		gt_schema_append_name(data, desc->name);
+
+		for (int j = 0; j < desc->arity; j++) {
+			g_byte_array_append(data, &desc->args[j].type, sizeof desc->args[j].type);
+			g_byte_array_append(data, &desc->args[j].dir, sizeof desc->args[j].dir);
+			gt_schema_append_name(data, desc->args[j].name);
+		}
+	}
+
+	payload.kind   = GT_PAYLOAD_SCHEMA;
+	payload.length = data->len - sizeof record - sizeof payload;
+	g_byte_array_append(data, padding, GT_RECORD_ALIGN(data->len) - data->len);
+
+	record.size          = data->len;
+	record.type          = GT_RECORD_SCHEMA;
+	record.syscall       = table->count;
+	record.payload_count = 1;
+	memcpy(data->data, &record, sizeof record);
+	memcpy(data->data + sizeof record, &payload, sizeof payload);
+
+	return (gt_record *) g_byte_array_free(data, FALSE);
+}
+
+/* A cursor over the payload of a schema, which fails once it runs out. */
+typedef struct gt_schema_reader {
+	const uint8_t *pos;
+	const uint8_t *end;
+	bool           failed;
+} gt_schema_reader;
+
+static const void *
+gt_schema_read(gt_schema_reader *reader, size_t len)
+{
+	const uint8_t *data = reader->pos;
+
+	if (reader->failed || len > reader->end - reader->pos) {
+		reader->failed = true;
+		return NULL;
+	}
+
+	reader->pos += len;
+
+	return data;
+}
+
+static uint8_t
+gt_schema_read_u8(gt_schema_reader *reader)
+{
+	const uint8_t *value = gt_schema_read(reader, sizeof *value);
+
+	return NULL == value ? 0 : *value;
+}
+
+static char *
+gt_schema_read_name(gt_schema_reader *reader)
+{
+	uint16_t len;
+	const void *value = gt_schema_read(reader, sizeof len);
+	const char *name;
+
+	if (NULL == value) {
+		return NULL;
+	}
+
+	memcpy(&len, value, sizeof len);
+	if (GT_SCHEMA_NO_NAME == len) {
+		return NULL;
+	}
+
+	name = gt_schema_read(reader, len);
+
+	return NULL == name ? NULL : g_strndup(name, len);
+}
+
+/*
+ * Rebuild the table which record describes; see gt_record_new_schema().
+ * Returns NULL if record is not a well-formed schema. Free the table with
+ * gt_syscall_table_free().
+ */
+gt_syscall_table *
+gt_record_parse_schema(const gt_record *record)
+{
+	const gt_payload *payloads[GT_SYSCALL_ARGS_MAX] = { NULL };
+	gt_schema_reader reader;
+	gt_syscall_table *table = NULL;
+	gt_syscall_desc *descs;
+	const void *value;
+	uint32_t os, count;
+
+	if (GT_RECORD_SCHEMA != record->type
+	 || !gt_record_get_payloads(record, payloads)
+	 || NULL == payloads[0]
+	 || GT_PAYLOAD_SCHEMA != payloads[0]->kind) {
+		goto done;
+	}
+
+	reader.pos    = gt_payload_data(payloads[0]);
+	reader.end    = reader.pos + payloads[0]->length;
+	reader.failed = false;
+
+	value = gt_schema_read(&reader, sizeof os + sizeof count);
+	if (NULL == value) {
+		goto done;
+	}
+
+	memcpy(&os, value, sizeof os);
+	memcpy(&count, (const uint8_t *) value + sizeof os, sizeof count);
+
+	/* Each system call takes at least four bytes. */
+	if (count > (reader.end - reader.pos) / 4) {
+		goto done;
+	}
+
+	table        = g_new0(gt_syscall_table, 1);
+	descs        = g_new0(gt_syscall_desc, count);
+	table->os    = os;
+	table->descs = descs;
+	table->count = count;
+
+	for (uint32_t i = 0; i < count && !reader.failed; i++) {
+		gt_syscall_arg *args;
+
+		descs[i].arity = gt_schema_read_u8(&reader);
+		descs[i].flags = gt_schema_read_u8(&reader);
+		descs[i].name  = gt_schema_read_name(&reader);
+
+		if (descs[i].arity > GT_SYSCALL_ARGS_MAX) {
+			reader.failed = true;
+			break;
+		}
+
+		args = g_new0(gt_syscall_arg, descs[i].arity);
+		descs[i].args = args;
+
+		for (int j = 0; j < descs[i].arity; j++) {
+			args[j].type = gt_schema_read_u8(&reader);
+			args[j].dir  = gt_schema_read_u8(&reader);
+			args[j].name = gt_schema_read_name(&reader);
+
+			if (args[j].type >= GT_ARG_TYPE_COUNT) {
+				reader.failed = true;
+			}
+		}
+
+		if (NULL == descs[i].name) {
+			reader.failed = true;
+		}
+	}
+
+	if (reader.failed) {
+		gt_syscall_table_free(table);
+		table = NULL;
+	}
+
+done:
+	return table;
+}
+
+/* Free a table which gt_record_parse_schema() returned. */
+void
+gt_syscall_table_free(gt_syscall_table *table)
+{
+	if (NULL == table) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < table->count; i++) {
+		const gt_syscall_desc *desc = &table->descs[i];
+
+		for (int j = 0; NULL != desc->args && j < desc->arity; j++) {
+			g_free((char *) desc->args[j].name);
+		}
+
+		g_free((gt_syscall_arg *) desc->args);
+		g_free((char *) desc->name);
+	}
+
+	g_free((gt_syscall_desc *) table->descs);
+	g_free(table);
+}
+
+/*
+ * Return the record at the start of buf, which holds len bytes, or NULL if
+ * buf does not hold a whole record. The caller advances by the record's
+ * size to the next.
+ */
+const gt_record *
+gt_record_check(const void *buf, size_t len)
+{
+	const gt_record *record = buf;
+
+	if (len < sizeof *record
+	 || record->size < sizeof *record
+	 || record->size > len
+	 || record->size != GT_RECORD_ALIGN(record->size)) {
+		return NULL;
+	}
+
+	return record;
+}
+
+/*
+ * Find the payloads of record, and store each in payloads at the index of
+ * its argument; the schema's and the clock's payloads are at index zero,
+ * and the payloads of the record as a whole are skipped. The caller
+ * clears payloads. Returns false if the payloads overrun the record.
+ */
+bool
+gt_record_get_payloads(const gt_record *record, const gt_payload *payloads[GT_SYSCALL_ARGS_MAX])
+{
+	const uint8_t *end = (const uint8_t *) record + record->size;
+	const uint8_t *pos = (const uint8_t *) (gt_record_args(record) + record->arg_count);
+
+	if (record->arg_count * sizeof (uint64_t) > record->size - sizeof *record) {
+		return false;
+	}
+
+	for (int i = 0; i < record->payload_count; i++) {
+		const gt_payload *payload = (const gt_payload *) pos;
+
+		if (end - pos < sizeof *payload
+		 || GT_RECORD_ALIGN(payload->length) > end - pos - sizeof *payload
+		 || (payload->arg >= GT_SYSCALL_ARGS_MAX && GT_PAYLOAD_RECORD != payload->arg)) {
+			return false;
+		}
+
+		if (GT_PAYLOAD_RECORD != payload->arg) {
+			payloads[payload->arg] = payload;
+		}
+		pos += sizeof *payload + GT_RECORD_ALIGN(payload->length);
+	}
+
+	return pos <= end;
+}
+
+/*
+ * Find the guest's TSC among the payloads of record, and store it in tsc.
+ * Returns false if record has none, or its payloads overrun it.
+ */
+bool
+gt_record_get_guest_tsc(const gt_record *record, uint64_t *tsc)
+{
+	const uint8_t *end = (const uint8_t *) record + record->size;
+	const uint8_t *pos = (const uint8_t *) (gt_record_args(record) + record->arg_count);
+
+	if (record->arg_count * sizeof (uint64_t) > record->size - sizeof *record) {
+		return false;
+	}
+
+	for (int i = 0; i < record->payload_count; i++) {
+		const gt_payload *payload = (const gt_payload *) pos;
+
+		if (end - pos < sizeof *payload
+		 || GT_RECORD_ALIGN(payload->length) > end - pos - sizeof *payload) {
+			return false;
+		}
+
+		if (GT_PAYLOAD_RECORD == payload->arg
+		 && GT_PAYLOAD_GUEST_TSC == payload->kind
+		 && sizeof *tsc == payload->length) {
+			memcpy(tsc, gt_payload_data(payload), sizeof *tsc);
+			return true;
+		}
+
+		pos += sizeof *payload + GT_RECORD_ALIGN(payload->length);
+	}
+
+	return false;
+}
@@ -0,0 +1,156 @@
+#ifndef TRACE_RECORD_H
+#define TRACE_RECORD_H
+
+#include <glib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "syscall-decoder.h"
+
+/*
+ * The binary trace format. A trace is a gt_trace_header followed by
+ * records, each of which begins with a gt_record. The first record of a
+ * trace is a schema, which describes the system calls by which the other
+ * records name them, so that a reader needs no copy of the tables with
+ * which guestrace was built.
+ *
+ * A record of a system call or its return holds the raw arguments of the
+ * call, followed by payloads: the data which the decoders read from the
+ * guest through those arguments which point into it. The text which
+ * guestrace prints is a rendering of these records; see trace-format.h.
+ *
+ * Every so often, a clock record pairs the host's clock, by which the
+ * records are stamped, with the host's time of day and the guest's time
+ * stamp counter, so that readers can place the records in the guest's
+ * time, or merge the traces of several guests or hosts.
+ *
+ * All fields are little-endian, as on the x86-64 hosts on which guestrace
+ * runs, and every record and payload begins eight-byte aligned. Readers
+ * must skip records of types they do not know, using their size.
+ */
+
+#define GT_TRACE_MAGIC   "GTTRACE"
+
+/*
+ * Version 2 adds clock records and payloads of a record as a whole, which
+ * version 1 lacks; readers of version 2 read either.
+ */
+#define GT_TRACE_VERSION 2
+
+typedef struct gt_trace_header {
+	char     magic[8];      /* GT_TRACE_MAGIC, NUL-terminated. */
+	uint32_t version;       /* GT_TRACE_VERSION. */
+	uint32_t header_size;   /* Bytes from the start of the file to the first record. */
+} gt_trace_header;
+
+typedef enum gt_record_type {
+	GT_RECORD_SCHEMA = 1,   /* One GT_PAYLOAD_SCHEMA. */
+	GT_RECORD_SYSCALL,
+	GT_RECORD_SYSRET,
+	GT_RECORD_CLOCK,        /* One GT_PAYLOAD_CLOCK. */
+} gt_record_type;
+
+/* Flags of a gt_record. */
+#define GT_RECORD_NO_NAME (1 << 0) /* guestrace could not name the process. */
+
+#define GT_RECORD_ALIGN(size) (((size) + 7) & ~(size_t) 7)
+
+typedef struct gt_record {
+	uint32_t size;          /* Of the whole record, padding included. */
+	uint16_t type;          /* A gt_record_type. */
+	uint16_t flags;
+	uint32_t syscall;       /* Index of the system call in the schema. */
+	uint16_t vcpu;
+	uint8_t  arg_count;     /* Arguments which follow this header. */
+	uint8_t  payload_count; /* Payloads which follow the arguments. */
+	uint64_t timestamp;     /* Nanoseconds, on the host's monotonic clock. */
+	uint64_t tid;
+	uint64_t sp;            /* The guest's stack pointer. */
+	uint64_t ret;           /* The return value, in a GT_RECORD_SYSRET. */
+	uint32_t pid;
+	uint32_t reserved;
+	char     comm[16];      /* The process's name, NUL-padded. */
+	/* uint64_t args[arg_count]; */
+	/* Payloads. */
+} gt_record;
+
+typedef enum gt_payload_kind {
+	GT_PAYLOAD_STRING = 1,         /* UTF-8, without terminator. */
+	GT_PAYLOAD_U64,                /* The value to which the argument points. */
+	GT_PAYLOAD_OBJECT_ATTRIBUTES,  /* A gt_payload_obj_attr, then the name. */
+	GT_PAYLOAD_SCHEMA,             /* See gt_record_new_schema(). */
+	GT_PAYLOAD_CLOCK,              /* A gt_payload_clock. */
+	GT_PAYLOAD_GUEST_TSC,          /* The guest's TSC at the event, a uint64_t. */
+} gt_payload_kind;
+
+/*
+ * A payload, followed by length bytes of data and then padding. The
+ * decoders omit the payload of an argument which points to nothing
+ * readable, which prints as it always has: "(null)" for strings, and zero
+ * for everything else.
+ */
+typedef struct gt_payload {
+	uint16_t arg;           /* Index of the argument, or GT_PAYLOAD_RECORD. */
+	uint16_t kind;          /* A gt_payload_kind. */
+	uint32_t length;
+} gt_payload;
+
+/* The arg of a payload of the record as a whole, such as the guest's TSC. */
+#define GT_PAYLOAD_RECORD UINT16_MAX
+
+/* The name_length of an OBJECT_ATTRIBUTES whose name was unreadable. */
+#define GT_PAYLOAD_NO_NAME UINT32_MAX
+
+typedef struct gt_payload_obj_attr {
+	uint64_t root_directory;
+	uint32_t attributes;
+	uint32_t name_length;   /* The UTF-8 name follows. */
+} gt_payload_obj_attr;
+
+/*
+ * The times of a clock record, read together with its timestamp on the
+ * VCPU of the record. The host's clock may tick off the TSC, by a ratio
+ * which drifts slightly from CLOCK_MONOTONIC; monotonic pairs the two.
+ */
+typedef struct gt_payload_clock {
+	uint64_t monotonic;     /* CLOCK_MONOTONIC, in nanoseconds. */
+	uint64_t realtime;      /* CLOCK_REALTIME, in nanoseconds since the epoch. */
+	uint64_t guest_tsc;     /* The guest's TSC, or 0 if unreadable. */
+	uint32_t guest_tsc_khz; /* Its frequency, or 0 if unknown. */
+	uint32_t reserved;
+} gt_payload_clock;
+
+/*
+ * The clock of the records' timestamps, in nanoseconds: the host's
+ * monotonic clock, which also times events; see gt_clock_now().
+ */
+static inline uint64_t
+gt_trace_clock(void)
+{
+	return gt_clock_now();
+}
+
+/* The arguments which follow record's header. */
+static inline const uint64_t *
+gt_record_args(const gt_record *record)
+{
+	return (const uint64_t *) (record + 1);
+}
+
+/* The data which follows payload's header. */
+static inline const void *
+gt_payload_data(const gt_payload *payload)
+{
+	return payload + 1;
+}
+
+gt_record        *gt_record_new_schema(const gt_syscall_table *table);
+gt_syscall_table *gt_record_parse_schema(const gt_record *record);
+void              gt_syscall_table_free(gt_syscall_table *table);
+const gt_record  *gt_record_check(const void *buf, size_t len);
+bool              gt_record_get_payloads(const gt_record *record,
+                                         const gt_payload *payloads[GT_SYSCALL_ARGS_MAX]);
+bool              gt_record_get_guest_tsc(const gt_record *record, uint64_t *tsc);
+
+#endif
@@ -0,0 +1,173 @@
+#include <glib.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "trace-ring.h"
+
+#define GT_CACHE_LINE 64
+
+/*
+ * The producer advances head and the consumer advances tail; each reads
+ * the other's with acquire semantics, so that the bytes behind a position
+ * are visible before the position itself. Both only ever grow, and the
+ * ring finds their offsets by masking them with its size, a power of two.
+ * Padding keeps the two positions out of each other's cache lines.
+ */
+struct gt_ring {
+	atomic_size_t head;
+	char          head_pad[GT_CACHE_LINE - sizeof (atomic_size_t)];
+	atomic_size_t tail;
+	char          tail_pad[GT_CACHE_LINE - sizeof (atomic_size_t)];
+
+	/* The producer's counts, which others read only as statistics. */
+	atomic_uint_fast64_t records;
+	atomic_uint_fast64_t bytes;
+	atomic_uint_fast64_t dropped;
+	atomic_size_t        peak_used;
+
+	size_t   size;
+	uint8_t *data;
+};
+
+gt_ring *
+gt_ring_new(size_t size)
+{
+	gt_ring *ring = g_new0(gt_ring, 1);
+
+	ring->size = 1;
+	while (ring->size < size) {
+		ring->size <<= 1;
+	}
+
+	ring->data = g_malloc(ring->size);
+	atomic_init(&ring->head, 0);
+	atomic_init(&ring->tail, 0);
+
+	return ring;
+}
+
+void
+gt_ring_free(gt_ring *ring)
+{
+	if (NULL == ring) {
+		return;
+	}
+
+	g_free(ring->data);
+	g_free(ring);
+}
+
+/* Copy len bytes between data and the ring at position pos, wrapping. */
+static void
+gt_ring_copy_in(gt_ring *ring, size_t pos, const void *data, size_t len)
+{
+	size_t offset = pos & (ring->size - 1);
+	size_t first  = MIN(len, ring->size - offset);
+
+	memcpy(ring->data + offset, data, first);
+	memcpy(ring->data, (const uint8_t *) data + first, len - first);
+}
+
+static void
+gt_ring_copy_out(gt_ring *ring, size_t pos, void *data, size_t len)
+{
+	size_t offset = pos & (ring->size - 1);
+	size_t first  = MIN(len, ring->size - offset);
+
+	memcpy(data, ring->data + offset, first);
+	memcpy((uint8_t *) data + first, ring->data, len - first);
+}
+
+/*
+ * Append len bytes to the ring. Called by the producer alone. Returns false,
+ * dropping the bytes, if the ring lacks room for all of them.
+ */
+bool
+gt_ring_push(gt_ring *ring, const void *data, size_t len)
+{
+	size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+	size_t used = head - tail;
+
+	if (len > ring->size - used) {
+		atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+		return false;
+	}
+
+	gt_ring_copy_in(ring, head, data, len);
+	atomic_store_explicit(&ring->head, head + len, memory_order_release);
+
+	atomic_fetch_add_explicit(&ring->records, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&ring->bytes, len, memory_order_relaxed);
+	if (used + len > atomic_load_explicit(&ring->peak_used, memory_order_relaxed)) {
+		atomic_store_explicit(&ring->peak_used, used + len, memory_order_relaxed);
+	}
+
+	return true;
+}
+
+/*
+ * Copy the first len bytes in the ring to buf, leaving them in the ring.
+ * Called by the consumer alone. Returns the number of bytes copied, which
+ * is zero if the ring holds fewer than len.
+ */
+size_t
+gt_ring_peek(gt_ring *ring, void *buf, size_t len)
+{
+	size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+	if (head - tail < len) {
+		return 0;
+	}
+
+	gt_ring_copy_out(ring, tail, buf, len);
+
+	return len;
+}
+
+/* Discard the first len bytes in the ring. Called by the consumer alone. */
+void
+gt_ring_consume(gt_ring *ring, size_t len)
+{
+	size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+	atomic_store_explicit(&ring->tail, tail + len, memory_order_release);
+}
+
+/* The number of bytes in the ring, as either side last left it. */
+size_t
+gt_ring_used(gt_ring *ring)
+{
+	return atomic_load_explicit(&ring->head, memory_order_acquire)
+	     - atomic_load_explicit(&ring->tail, memory_order_acquire);
+}
+
+size_t
+gt_ring_size(gt_ring *ring)
+{
+	return ring->size;
+}
+
+/* Write the ring's statistics to stream as a JSON object. */
+void
+gt_ring_print_stats(gt_ring *ring, FILE *stream)
+{
+	size_t peak_used = atomic_load_explicit(&ring->peak_used, memory_order_relaxed);
+
+	fprintf(stream, "{\"size\": %zu, "
+	                "\"used\": %zu, "
+	                "\"peak_used\": %zu, "
+	                "\"peak_occupancy\": %.4f, "
+	                "\"records\": %" PRIu64 ", "
+	                "\"bytes\": %" PRIu64 ", "
+	                "\"dropped\": %" PRIu64 "}",
+	        ring->size,
+	        gt_ring_used(ring),
+	        peak_used,
+	        (double) peak_used / ring->size,
+	        (uint64_t) atomic_load_explicit(&ring->records, memory_order_relaxed),
+	        (uint64_t) atomic_load_explicit(&ring->bytes, memory_order_relaxed),
+	        (uint64_t) atomic_load_explicit(&ring->dropped, memory_order_relaxed));
+}
@@ -0,0 +1,28 @@
+#ifndef TRACE_RING_H
+#define TRACE_RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * A ring of bytes with a single producer and a single consumer, which
+ * share it without locks. Guestrace gives each VCPU a ring, into which
+ * the event thread copies the records of that VCPU and out of which the
+ * writer thread takes them; see trace-writer.c. A producer which finds
+ * the ring full drops what it would have pushed, rather than stall the
+ * guest until the consumer catches up.
+ */
+typedef struct gt_ring gt_ring;
+
+gt_ring *gt_ring_new(size_t size);
+void     gt_ring_free(gt_ring *ring);
+bool     gt_ring_push(gt_ring *ring, const void *data, size_t len);
+size_t   gt_ring_peek(gt_ring *ring, void *buf, size_t len);
+void     gt_ring_consume(gt_ring *ring, size_t len);
+size_t   gt_ring_used(gt_ring *ring);
+size_t   gt_ring_size(gt_ring *ring);
+void     gt_ring_print_stats(gt_ring *ring, FILE *stream);
+
+#endif
@@ -0,0 +1,446 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <glib.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "trace-shm.h"
+
+/* Entries begin 16-byte aligned, so padding always has room for its header. */
+#define GT_SHM_ENTRY_ALIGN(size) (((size) + 15) & ~(size_t) 15)
+
+#define GT_SHM_MIN_DATA_SIZE (64 << 10)
+
+struct gt_shm {
+	char          *name;
+	int            fd;
+	gt_shm_header *header;
+	size_t         map_size;
+	uint8_t       *data;
+	size_t         data_size;
+
+	uint64_t       records;
+	uint64_t       bytes;
+	uint64_t       dropped;      /* Records too large for the ring. */
+	uint64_t       overwritten;  /* Records overwritten, read or not. */
+	uint64_t       overruns;     /* Times guestrace overtook a reader. */
+	uint64_t       reaped;       /* Slots of readers which exited. */
+	uint64_t       lapped_pos[GT_SHM_MAX_READERS];
+};
+
+struct gt_shm_reader {
+	int                 fd;
+	gt_shm_header      *header;
+	size_t              map_size;
+	const uint8_t      *data;
+	size_t              data_size;
+	gt_shm_reader_slot *slot;     /* NULL if every slot was taken. */
+	uint64_t            pos;      /* Of the next entry. */
+	uint64_t            seq;      /* Of the next record. */
+	uint64_t            current;  /* Position of the entry last returned. */
+};
+
+/*
+ * Create the ring name, replacing any ring of the same name, with room
+ * for data_size bytes of entries, and publish schema in it. Returns NULL
+ * on failure.
+ */
+gt_shm *
+gt_shm_new(const char *name, size_t data_size, const gt_record *schema)
+{
+	gt_shm *shm = g_new0(gt_shm, 1);
+	gt_shm_header *header;
+	size_t schema_offset, data_offset;
+	void *map;
+
+	shm->fd        = -1;
+	shm->name      = g_strdup(name);
+	shm->data_size = GT_SHM_MIN_DATA_SIZE;
+	while (shm->data_size < data_size) {
+		shm->data_size <<= 1;
+	}
+
+	schema_offset = GT_SHM_ENTRY_ALIGN(sizeof *header);
+	data_offset   = (schema_offset + schema->size + 4095) & ~(size_t) 4095;
+	shm->map_size = data_offset + shm->data_size;
+
+	shm->fd = shm_open(name, O_RDWR | O_CREAT | O_TRUNC, 0600);
+	if (-1 == shm->fd) {
+		goto fail;
+	}
+
+	if (-1 == ftruncate(shm->fd, shm->map_size)) {
+		goto fail;
+	}
+
+	map = mmap(NULL, shm->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, shm->fd, 0);
+	if (MAP_FAILED == map) {
+		goto fail;
+	}
+
+	header      = map;
+	shm->header = header;
+	shm->data   = (uint8_t *) map + data_offset;
+
+	header->version       = GT_SHM_VERSION;
+	header->header_size   = sizeof *header;
+	header->schema_offset = schema_offset;
+	header->schema_size   = schema->size;
+	header->data_offset   = data_offset;
+	header->data_size     = shm->data_size;
+	memcpy((uint8_t *) map + schema_offset, schema, schema->size);
+
+	/* Readers wait for the magic, which completes the header. */
+	atomic_thread_fence(memory_order_release);
+	memcpy(header->magic, GT_SHM_MAGIC, sizeof GT_SHM_MAGIC);
+
+	return shm;
+
+fail:
+	fprintf(stderr, "could not create shared memory %s: %s\n", name, strerror(errno));
+	if (-1 != shm->fd) {
+		close(shm->fd);
+		shm_unlink(name);
+	}
+	g_free(shm->name);
+	g_free(shm);
+	return NULL;
+}
+
+/*
+ * Unmap and unlink the ring. Readers which have it mapped keep what it
+ * holds, but new readers cannot find it.
+ */
+void
+gt_shm_free(gt_shm *shm)
+{
+	if (NULL == shm) {
+		return;
+	}
+
+	munmap(shm->header, shm->map_size);
+	close(shm->fd);
+	shm_unlink(shm->name);
+	g_free(shm->name);
+	g_free(shm);
+}
+
+/*
+ * Advance the tail past the oldest entries until size bytes from pos are
+ * free, and publish the new tail before they are overwritten.
+ */
+static void
+gt_shm_reserve(gt_shm *shm, uint64_t pos, size_t size)
+{
+	gt_shm_header *header = shm->header;
+	uint64_t tail = atomic_load_explicit(&header->tail_pos, memory_order_relaxed);
+	uint64_t tail_seq = atomic_load_explicit(&header->tail_seq, memory_order_relaxed);
+
+	if (pos + size - tail <= shm->data_size) {
+		return;
+	}
+
+	while (pos + size - tail > shm->data_size) {
+		gt_shm_entry entry;
+
+		memcpy(&entry, shm->data + (tail & (shm->data_size - 1)), sizeof entry);
+		tail += entry.size;
+
+		if (GT_SHM_ENTRY_RECORD == entry.kind) {
+			tail_seq++;
+			shm->overwritten++;
+		}
+	}
+
+	atomic_store_explicit(&header->tail_seq, tail_seq, memory_order_relaxed);
+	atomic_store_explicit(&header->tail_pos, tail, memory_order_relaxed);
+
+	/* As in a seqlock: readers must see the tail before the new data. */
+	atomic_thread_fence(memory_order_release);
+}
+
+/* Publish record as the next entry of the ring. */
+void
+gt_shm_publish(gt_shm *shm, const gt_record *record)
+{
+	gt_shm_header *header = shm->header;
+	uint64_t pos = atomic_load_explicit(&header->write_pos, memory_order_relaxed);
+	uint64_t seq = atomic_load_explicit(&header->write_seq, memory_order_relaxed);
+	size_t size = GT_SHM_ENTRY_ALIGN(sizeof (gt_shm_entry) + record->size);
+	size_t offset = pos & (shm->data_size - 1);
+	gt_shm_entry entry;
+
+	if (size > shm->data_size / 2) {
+		shm->dropped++;
+		return;
+	}
+
+	if (shm->data_size - offset < size) {
+		entry.seq  = seq;
+		entry.size = shm->data_size - offset;
+		entry.kind = GT_SHM_ENTRY_PADDING;
+
+		gt_shm_reserve(shm, pos, entry.size);
+		memcpy(shm->data + offset, &entry, sizeof entry);
+		pos   += entry.size;
+		offset = 0;
+	}
+
+	entry.seq  = seq;
+	entry.size = size;
+	entry.kind = GT_SHM_ENTRY_RECORD;
+
+	gt_shm_reserve(shm, pos, size);
+	memcpy(shm->data + offset, &entry, sizeof entry);
+	memcpy(shm->data + offset + sizeof entry, record, record->size);
+
+	atomic_store_explicit(&header->write_seq, seq + 1, memory_order_release);
+	atomic_store_explicit(&header->write_pos, pos + size, memory_order_release);
+
+	shm->records++;
+	shm->bytes += record->size;
+}
+
+/*
+ * Look over the readers' slots: free those of readers which have exited,
+ * and count each reader which guestrace has overtaken since it last read.
+ */
+void
+gt_shm_check_readers(gt_shm *shm)
+{
+	gt_shm_header *header = shm->header;
+	uint64_t tail = atomic_load_explicit(&header->tail_pos, memory_order_relaxed);
+
+	for (int i = 0; i < GT_SHM_MAX_READERS; i++) {
+		gt_shm_reader_slot *slot = &header->readers[i];
+		uint32_t pid = atomic_load_explicit(&slot->pid, memory_order_acquire);
+		uint64_t next_pos;
+
+		if (0 == pid) {
+			continue;
+		}
+
+		if (-1 == kill(pid, 0) && ESRCH == errno) {
+			atomic_compare_exchange_strong(&slot->pid, &pid, 0);
+			shm->lapped_pos[i] = 0;
+			shm->reaped++;
+			continue;
+		}
+
+		next_pos = atomic_load_explicit(&slot->next_pos, memory_order_relaxed);
+		if (next_pos < tail && next_pos != shm->lapped_pos[i]) {
+			shm->lapped_pos[i] = next_pos;
+			shm->overruns++;
+			atomic_fetch_add_explicit(&slot->overruns, 1, memory_order_relaxed);
+		}
+	}
+}
+
+/* Write the ring's statistics, and the lag of each reader, to stream as JSON. */
+void
+gt_shm_print_stats(gt_shm *shm, FILE *stream)
+{
+	gt_shm_header *header = shm->header;
+	uint64_t write_seq = atomic_load(&header->write_seq);
+	const char *separator = "";
+
+	fprintf(stream, "{\"name\": \"%s\", "
+	                "\"size\": %zu, "
+	                "\"records\": %" PRIu64 ", "
+	                "\"bytes\": %" PRIu64 ", "
+	                "\"dropped\": %" PRIu64 ", "
+	                "\"overwritten\": %" PRIu64 ", "
+	                "\"overruns\": %" PRIu64 ", "
+	                "\"reaped\": %" PRIu64 ", "
+	                "\"readers\": [",
+	        shm->name,
+	        shm->data_size,
+	        shm->records,
+	        shm->bytes,
+	        shm->dropped,
+	        shm->overwritten,
+	        shm->overruns,
+	        shm->reaped);
+
+	for (int i = 0; i < GT_SHM_MAX_READERS; i++) {
+		gt_shm_reader_slot *slot = &header->readers[i];
+		uint32_t pid = atomic_load(&slot->pid);
+
+		if (0 == pid) {
+			continue;
+		}
+
+		fprintf(stream, "%s{\"pid\": %u, \"lag\": %" PRIu64 ", \"overruns\": %" PRIu64 "}",
+		        separator,
+		        pid,
+		        write_seq - atomic_load(&slot->next_seq),
+		        (uint64_t) atomic_load(&slot->overruns));
+		separator = ", ";
+	}
+
+	fprintf(stream, "]}");
+}
+
+/*
+ * Map the ring name for reading, and claim a slot in it. The reader
+ * begins at the oldest record which the ring still holds. Returns NULL on
+ * failure.
+ */
+gt_shm_reader *
+gt_shm_reader_open(const char *name)
+{
+	gt_shm_reader *reader = g_new0(gt_shm_reader, 1);
+	gt_shm_header *header;
+	struct stat st;
+	void *map;
+
+	reader->fd = shm_open(name, O_RDWR, 0);
+	if (-1 == reader->fd || -1 == fstat(reader->fd, &st)) {
+		goto fail;
+	}
+
+	if (st.st_size < sizeof *header) {
+		errno = EINVAL;
+		goto fail;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, reader->fd, 0);
+	if (MAP_FAILED == map) {
+		goto fail;
+	}
+
+	header           = map;
+	reader->header   = header;
+	reader->map_size = st.st_size;
+
+	if (memcmp(header->magic, GT_SHM_MAGIC, sizeof GT_SHM_MAGIC)
+	 || GT_SHM_VERSION != header->version
+	 || header->data_offset + header->data_size > st.st_size) {
+		errno = EINVAL;
+		goto fail;
+	}
+
+	atomic_thread_fence(memory_order_acquire);
+	reader->data      = (const uint8_t *) map + header->data_offset;
+	reader->data_size = header->data_size;
+	reader->pos       = atomic_load_explicit(&header->tail_pos, memory_order_acquire);
+	reader->seq       = atomic_load_explicit(&header->tail_seq, memory_order_acquire);
+
+	for (int i = 0; i < GT_SHM_MAX_READERS; i++) {
+		uint32_t free_pid = 0;
+
+		if (atomic_compare_exchange_strong(&header->readers[i].pid, &free_pid, getpid())) {
+			reader->slot = &header->readers[i];
+			atomic_store(&reader->slot->overruns, 0);
+			atomic_store(&reader->slot->next_seq, reader->seq);
+			atomic_store(&reader->slot->next_pos, reader->pos);
+			break;
+		}
+	}
+
+	return reader;
+
+fail:
+	fprintf(stderr, "could not open shared memory %s: %s\n", name, strerror(errno));
+	gt_shm_reader_close(reader);
+	return NULL;
+}
+
+void
+gt_shm_reader_close(gt_shm_reader *reader)
+{
+	if (NULL == reader) {
+		return;
+	}
+
+	if (NULL != reader->slot) {
+		atomic_store_explicit(&reader->slot->pid, 0, memory_order_release);
+	}
+
+	if (NULL != reader->header) {
+		munmap(reader->header, reader->map_size);
+	}
+
+	if (-1 != reader->fd) {
+		close(reader->fd);
+	}
+
+	g_free(reader);
+}
+
+/* The schema which describes the ring's records. */
+const gt_record *
+gt_shm_reader_get_schema(gt_shm_reader *reader)
+{
+	return (const gt_record *) ((const uint8_t *) reader->header + reader->header->schema_offset);
+}
+
+/*
+ * Return the next record, in place, or NULL if the reader has caught up.
+ * Adds to *missed the number of records which guestrace overwrote before
+ * the reader could read them. The record remains valid only as long as
+ * gt_shm_reader_valid() says so, which the caller checks once done with
+ * it.
+ */
+const gt_record *
+gt_shm_reader_next(gt_shm_reader *reader, uint64_t *missed)
+{
+	gt_shm_header *header = reader->header;
+
+	for (;;) {
+		uint64_t write_pos = atomic_load_explicit(&header->write_pos, memory_order_acquire);
+		uint64_t offset = reader->pos & (reader->data_size - 1);
+		gt_shm_entry entry;
+
+		if (reader->pos == write_pos) {
+			return NULL;
+		}
+
+		memcpy(&entry, reader->data + offset, sizeof entry);
+
+		atomic_thread_fence(memory_order_acquire);
+		if (atomic_load_explicit(&header->tail_pos, memory_order_relaxed) > reader->pos) {
+			/* Overtaken: resume at the oldest entry. */
+			reader->pos = atomic_load_explicit(&header->tail_pos, memory_order_relaxed);
+			continue;
+		}
+
+		if (GT_SHM_ENTRY_PADDING == entry.kind) {
+			reader->pos += entry.size;
+			continue;
+		}
+
+		if (entry.seq != reader->seq) {
+			*missed    += entry.seq - reader->seq;
+			reader->seq = entry.seq;
+		}
+
+		reader->current = reader->pos;
+		reader->pos    += entry.size;
+		reader->seq++;
+
+		if (NULL != reader->slot) {
+			atomic_store_explicit(&reader->slot->next_seq, reader->seq, memory_order_relaxed);
+			atomic_store_explicit(&reader->slot->next_pos, reader->pos, memory_order_release);
+		}
+
+		return (const gt_record *) (reader->data + offset + sizeof entry);
+	}
+}
+
+/*
+ * Whether guestrace has yet to overwrite the record which
+ * gt_shm_reader_next() last returned. A reader which finds the record
+ * overwritten discards what it made of it.
+ */
+bool
+gt_shm_reader_valid(gt_shm_reader *reader)
+{
+	atomic_thread_fence(memory_order_acquire);
+
+	return atomic_load_explicit(&reader->header->tail_pos, memory_order_relaxed) <= reader->current;
+}
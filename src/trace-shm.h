@@ -0,0 +1,100 @@
+#ifndef TRACE_SHM_H
+#define TRACE_SHM_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "trace-record.h"
+
+/*
+ * A ring of records in shared memory, which guestrace publishes for other
+ * processes to read as it traces. Guestrace creates the ring with
+ * shm_open(), under the name which --shm gives it, and readers map it
+ * with the same name. The ring is laid out as:
+ *
+ *	gt_shm_header, at offset 0
+ *	the schema, a GT_RECORD_SCHEMA, at header.schema_offset
+ *	the data, header.data_size bytes, at header.data_offset
+ *
+ * The data holds entries, each a gt_shm_entry followed by a record, at
+ * positions which only ever grow; an entry at position pos lies at offset
+ * pos % data_size of the data. No entry wraps around the end of the data:
+ * a padding entry fills what remains instead. Entries and their sequence
+ * numbers are consecutive, so readers can tell how many records they
+ * missed.
+ *
+ * Guestrace never waits for readers. Once the data is full it overwrites
+ * the oldest entries, after first advancing tail_pos past them, so that a
+ * reader finds out that it fell behind by checking, after it reads an
+ * entry, that tail_pos has not passed the entry's position. Thus readers
+ * consume records in place, each at its own pace, and need write access
+ * only to a slot of their own. A reader claims a free slot by setting its
+ * pid from zero to the reader's own, and stores there the sequence number
+ * and position of the next entry it will read; guestrace reports, from the
+ * slots, how far each reader lags, and counts the readers which it
+ * overtook. Guestrace frees the slots of readers which have exited.
+ *
+ * Every field is little-endian, and the positions are published with
+ * release semantics: a reader which loads write_pos with acquire semantics
+ * sees every entry before it.
+ */
+
+#define GT_SHM_MAGIC       "GTSHM"
+#define GT_SHM_VERSION     1
+#define GT_SHM_MAX_READERS 16
+
+typedef struct gt_shm_reader_slot {
+	_Atomic uint32_t pid;        /* Of the reader, or zero if free. */
+	uint32_t         reserved;
+	_Atomic uint64_t next_seq;   /* Set by the reader. */
+	_Atomic uint64_t next_pos;   /* Set by the reader. */
+	_Atomic uint64_t overruns;   /* Set by guestrace. */
+} gt_shm_reader_slot;
+
+typedef struct gt_shm_header {
+	char               magic[8];      /* GT_SHM_MAGIC, NUL-terminated. */
+	uint32_t           version;       /* GT_SHM_VERSION. */
+	uint32_t           header_size;
+	uint64_t           schema_offset;
+	uint64_t           schema_size;
+	uint64_t           data_offset;
+	uint64_t           data_size;     /* A power of two. */
+	_Atomic uint64_t   write_seq;     /* Sequence number of the next entry. */
+	_Atomic uint64_t   write_pos;     /* Position of the next entry. */
+	_Atomic uint64_t   tail_seq;      /* Sequence number of the oldest entry. */
+	_Atomic uint64_t   tail_pos;      /* Position of the oldest entry. */
+	gt_shm_reader_slot readers[GT_SHM_MAX_READERS];
+} gt_shm_header;
+
+typedef enum gt_shm_entry_kind {
+	GT_SHM_ENTRY_RECORD = 1,
+	GT_SHM_ENTRY_PADDING,           /* Skip to the start of the data. */
+} gt_shm_entry_kind;
+
+typedef struct gt_shm_entry {
+	uint64_t seq;                     /* Padding shares the next entry's. */
+	uint32_t size;                    /* Of the entry, record included. */
+	uint32_t kind;                    /* A gt_shm_entry_kind. */
+} gt_shm_entry;
+
+/* The publishing side, which the writer thread alone uses. */
+typedef struct gt_shm gt_shm;
+
+gt_shm *gt_shm_new(const char *name, size_t data_size, const gt_record *schema);
+void    gt_shm_free(gt_shm *shm);
+void    gt_shm_publish(gt_shm *shm, const gt_record *record);
+void    gt_shm_check_readers(gt_shm *shm);
+void    gt_shm_print_stats(gt_shm *shm, FILE *stream);
+
+/* The reading side, for other processes. */
+typedef struct gt_shm_reader gt_shm_reader;
+
+gt_shm_reader   *gt_shm_reader_open(const char *name);
+void             gt_shm_reader_close(gt_shm_reader *reader);
+const gt_record *gt_shm_reader_get_schema(gt_shm_reader *reader);
+const gt_record *gt_shm_reader_next(gt_shm_reader *reader, uint64_t *missed);
+bool             gt_shm_reader_valid(gt_shm_reader *reader);
+
+#endif
@@ -6,12 +6,19 @@
 #include <libxl_utils.h>
 #include <signal.h>
 #include <stdio.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <xen/hvm/save.h>
 
 #include "guestrace.h"
 #include "guestrace-private.h"
 #include "functions-linux.h"
 #include "functions-windows.h"
+#include "host-clock.h"
 #include "trace-syscalls.h"
 
 /* This code relies on Xen's interface to Second Level Address Translation,
@@ -46,6 +53,23 @@
 /* Default page size on our domain. */
 #define VF_PAGE_SIZE (1 << VF_PAGE_OFFSET_BITS)
 
+/* Longest guest string gt_guest_read_string() will read, as with PATH_MAX. */
+#define GT_STRING_MAX 4096
+
+/* Names of the phases in gt_startup_stats, as printed in the startup report. */
+static const char *GT_PHASE_NAMES[GT_PHASE_COUNT] = {
+	[GT_PHASE_VMI_INIT]     = "vmi_init",
+	[GT_PHASE_XEN_INIT]     = "xen_init",
+	[GT_PHASE_SHADOW_VIEW]  = "shadow_view",
+	[GT_PHASE_SYMBOLS]      = "symbols",
+	[GT_PHASE_SHADOW_ALLOC] = "shadow_alloc",
+	[GT_PHASE_PAGE_CLONE]   = "page_clone",
+	[GT_PHASE_TRAPS]        = "traps",
+	[GT_PHASE_BREAKPOINTS]  = "breakpoints",
+	[GT_PHASE_EVENTS]       = "events",
+	[GT_PHASE_KERNEL_SCAN]  = "kernel_scan",
+};
+
 /* Intel breakpoint interrupt (INT 3) instruction. */
 static uint8_t VF_BREAKPOINT_INST = 0xCC;
 
@@ -53,15 +77,77 @@ static uint8_t VF_BREAKPOINT_INST = 0xCC;
  * Handle terminating signals by setting interrupted flag. This allows
  * a graceful exit.
  */
-static gboolean gt_interrupted = FALSE;
+static volatile sig_atomic_t gt_interrupted = FALSE;
+
+/*
+ * The foreign mappings which gt_map_page_records() makes for a batch of page
+ * records: one of their frames, read-only, and one of their shadow pages.
+ * Each record of the batch holds a reference; gt_page_map_unref() unmaps
+ * both once the last record goes.
+ */
+typedef struct gt_page_map {
+	uint8_t *frames;
+	uint8_t *shadows;
+	size_t   count;
+	guint    refs;
+} gt_page_map;
 
 typedef struct gt_page_record {
-	addr_t      frame;
-	addr_t      shadow_page;
-	GHashTable *children;
-	GTLoop     *loop;
+	addr_t         frame;
+	addr_t         shadow_page;
+	gt_page_map   *map;
+	const uint8_t *frame_map;  /* Our mapping of frame, within map. */
+	uint8_t       *shadow_map; /* Our mapping of shadow_page, within map. */
+	GHashTable    *children;
+	GArray        *adopted;    /* Offsets of breakpoints set by a detached guestrace. */
+	GTLoop        *loop;
 } gt_page_record;
 
+/*
+ * Layout of the file in which a detaching guestrace saves its shadow view;
+ * see gt_loop_set_detach(). A header precedes a gt_state_page for each
+ * shadowed page, and each gt_state_page precedes the offsets of the
+ * breakpoints within the page.
+ */
+#define GT_STATE_MAGIC   0x54534754 /* "GTST" */
+#define GT_STATE_VERSION 2
+
+struct gt_state_header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t domid;
+	uint16_t shadow_view;
+	uint16_t reserved;
+	uint64_t lstar;
+	uint64_t page_count;
+};
+
+struct gt_state_page {
+	uint64_t frame;
+	uint64_t shadow_page;
+	uint64_t breakpoint_count;
+};
+
+/*
+ * Layout of the ledger of the frames guestrace adds to the guest. A header
+ * precedes one entry for each frame allocated and one for each frame
+ * released, the latter with GT_LEDGER_RELEASED set. Guestrace appends an
+ * entry before populating a frame, so that upon startup it can free the
+ * frames of a guestrace which crashed; see gt_recover_ledger().
+ */
+#define GT_LEDGER_MAGIC    0x52464754 /* "GTFR" */
+#define GT_LEDGER_VERSION  1
+#define GT_LEDGER_RELEASED ((uint64_t) 1 << 63)
+
+struct gt_ledger_header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t domid;
+	uint16_t shadow_view;
+	uint16_t reserved;
+	uint64_t init_max_memkb;
+};
+
 struct gt_paddr_record {
 	addr_t          offset;
 	GTSyscallFunc   syscall_cb;
@@ -70,12 +156,67 @@ struct gt_paddr_record {
 	void           *data; /* Optional user data set at initialization.  Passed to syscall_cb. */
 };
 
+/*
+ * Callbacks registered in lazy mode on a frame which guestrace has not yet
+ * shadowed; see gt_loop_set_lazy().
+ */
+typedef struct gt_lazy_page {
+	addr_t  frame;
+	GArray *callbacks; /* GTSyscallCallback values. */
+	GArray *pas;       /* Physical address of each callback. */
+	GTLoop *loop;
+} gt_lazy_page;
+
+/*
+ * The state of a pending system call. Guestrace keeps the states of
+ * returned system calls on a free list, so that in the long run a system
+ * call allocates nothing.
+ */
 typedef struct syscall_state {
 	struct gt_paddr_record *syscall_trap;
 	void                   *data;
 	addr_t                  thread_id; /* needed for teardown */
+	int                     args_count;
+	uint64_t                args[GT_SYSCALL_ARGS_MAX];
+	gboolean                returned;  /* The registers no longer hold args. */
+	uint64_t                call_time; /* See gt_guest_get_call_time(). */
+	gt_scratch             *scratch;   /* Created upon gt_guest_call_alloc(). */
+	struct syscall_state   *next_free;
 } syscall_state;
 
+/* Take a system-call state from the free list, or allocate one. */
+static syscall_state *
+gt_syscall_state_new (GTLoop *loop)
+{
+	syscall_state *sys_state = loop->free_states;
+
+	if (NULL == sys_state) {
+		sys_state = g_new0(syscall_state, 1);
+	} else {
+		loop->free_states = sys_state->next_free;
+	}
+
+	sys_state->args_count = 0;
+	sys_state->returned   = FALSE;
+
+	return sys_state;
+}
+
+/*
+ * Return a system-call state to the free list, along with whatever its
+ * callbacks allocated with gt_guest_call_alloc().
+ */
+static void
+gt_syscall_state_release (GTLoop *loop, syscall_state *sys_state)
+{
+	if (NULL != sys_state->scratch) {
+		gt_scratch_reset(sys_state->scratch);
+	}
+
+	sys_state->next_free = loop->free_states;
+	loop->free_states    = sys_state;
+}
+
 /*
  * Restore a stack return pointer; useful to ensure the kernel continues to
  * run after guestrace exit. Otherwise, guestrace's stack manipulation might
@@ -96,7 +237,32 @@ gt_restore_return_addr (gpointer data)
 		fprintf(stderr, "error restoring stack; guest will likely fail\n");
 	}
 
-	g_free(sys_state);
+	gt_syscall_state_release(loop, sys_state);
+}
+
+static void gt_release_shadow_page (GTLoop *loop, xen_pfn_t gfn);
+
+static void
+gt_page_map_unref (gt_page_map *map)
+{
+	if (NULL == map || 0 != --map->refs) {
+		return;
+	}
+
+	munmap(map->frames,  map->count * VF_PAGE_SIZE);
+	munmap(map->shadows, map->count * VF_PAGE_SIZE);
+	g_free(map);
+}
+
+/* Drop page_record's share of the mapping of its batch. */
+static void
+gt_unmap_page_record (gt_page_record *page_record)
+{
+	gt_page_map_unref(page_record->map);
+
+	page_record->map        = NULL;
+	page_record->frame_map  = NULL;
+	page_record->shadow_map = NULL;
 }
 
 static void
@@ -109,26 +275,104 @@ gt_destroy_page_record (gpointer data) {
 
 	g_hash_table_destroy(page_record->children);
 
+	if (NULL != page_record->adopted) {
+		g_array_free(page_record->adopted, TRUE);
+	}
+
+	gt_unmap_page_record(page_record);
+
+	if (page_record->loop->detached) {
+		/* Leave the page in the shadow view for the next guestrace. */
+		g_free(page_record);
+		return;
+	}
+
 	/* Stop monitoring this page. */
-	vmi_set_mem_event(page_record->loop->vmi,
-	                  page_record->frame,
-	                  VMI_MEMACCESS_N,
-	                  page_record->loop->shadow_view);
-
-	xc_altp2m_change_gfn(page_record->loop->xch,
-	                     page_record->loop->domid,
-	                     page_record->loop->shadow_view,
-	                     page_record->shadow_page,
-	                    ~0);
-
-	xc_domain_decrease_reservation_exact(page_record->loop->xch,
-	                                     page_record->loop->domid,
-	                                     1, 0,
-	                                    &page_record->shadow_page);
+	if (VMI_SUCCESS == vmi_set_mem_event(page_record->loop->vmi,
+	                                     page_record->frame,
+	                                     VMI_MEMACCESS_N,
+	                                     page_record->loop->shadow_view)) {
+		_gt_count_hypercall(page_record->loop);
+	}
+
+	if (0 == xc_altp2m_change_gfn(page_record->loop->xch,
+	                              page_record->loop->domid,
+	                              page_record->loop->shadow_view,
+	                              page_record->shadow_page,
+	                             ~0)) {
+		_gt_count_hypercall(page_record->loop);
+	}
+
+	gt_release_shadow_page(page_record->loop, page_record->shadow_page);
+
+	g_free(page_record);
+}
 
+/*
+ * Free a page record which never entered the shadow view, as its clone or
+ * activation failed, so that only its mapping and shadow page need go.
+ */
+static void
+gt_discard_page_record (gt_page_record *page_record)
+{
+	g_hash_table_destroy(page_record->children);
+	gt_unmap_page_record(page_record);
+	gt_release_shadow_page(page_record->loop, page_record->shadow_page);
 	g_free(page_record);
 }
 
+static void
+gt_free_lazy_page (gt_lazy_page *lazy_page)
+{
+	g_array_free(lazy_page->callbacks, TRUE);
+	g_array_free(lazy_page->pas, TRUE);
+	g_free(lazy_page);
+}
+
+static void
+gt_destroy_lazy_page (gpointer data)
+{
+	gt_lazy_page *lazy_page = data;
+
+	/* Stop monitoring this page for execution. */
+	if (VMI_SUCCESS == vmi_set_mem_event(lazy_page->loop->vmi,
+	                                     lazy_page->frame,
+	                                     VMI_MEMACCESS_N,
+	                                     lazy_page->loop->shadow_view)) {
+		_gt_count_hypercall(lazy_page->loop);
+	}
+
+	gt_free_lazy_page(lazy_page);
+}
+
+/* Charge the time since start, as given by g_get_monotonic_time(), to phase. */
+static void
+gt_phase_end (GTLoop *loop, gt_phase phase, gint64 start)
+{
+	loop->startup.usec[phase] += g_get_monotonic_time() - start;
+}
+
+/*
+ * Count a call into Xen which succeeded, if loop is still instrumenting the
+ * guest; see gt_loop_print_startup_report().
+ */
+void
+_gt_count_hypercall (GTLoop *loop)
+{
+	if (0 == loop->startup.end) {
+		loop->startup.hypercalls++;
+	}
+}
+
+static bool gt_materialize_lazy_page (GTLoop *loop, addr_t frame);
+static bool gt_recover_ledger (GTLoop *loop);
+static void gt_reclaim_orphans (GTLoop *loop, bool adopted);
+static bool gt_open_ledger (GTLoop *loop);
+static void gt_close_ledger (GTLoop *loop);
+static bool gt_save_state (GTLoop *loop);
+static bool gt_adopt_state (GTLoop *loop);
+static void gt_scrub_adopted_breakpoints (GTLoop *loop);
+
 /*
  * Callback after a step event on any VCPU.
  * Here we must reset any single-step changes we made.
@@ -174,6 +418,8 @@ gt_set_up_step_events (GTLoop *loop)
 			        vcpu);
 			goto done;
 		}
+
+		_gt_count_hypercall(loop);
 	}
 
 	status = true;
@@ -222,6 +468,71 @@ gt_paddr_record_from_va(GTLoop *loop, addr_t va) {
 	return gt_paddr_record_from_pa(loop, vmi_translate_kv2p(loop->vmi, va));
 }
 
+/*
+ * Find the task running on the event's VCPU. Each VCPU remembers the last
+ * task it ran, so that guestrace reads the task's IDs and name only after
+ * a context switch or, since exec keeps the task but replaces its name and
+ * address space, a change in CR3.
+ */
+static GTTask *
+gt_current_task(GTLoop *loop, vmi_event_t *event)
+{
+	GTTask *task = NULL;
+	gt_vcpu_task *current;
+	addr_t addr;
+
+	if (!loop->task_lookup || event->vcpu_id >= _GT_MAX_VCPUS) {
+		goto done;
+	}
+
+	if (!loop->os_functions->find_current_task(loop, event, &addr)) {
+		goto done;
+	}
+
+	current = &loop->current_task[event->vcpu_id];
+	if (addr == current->task.addr && event->x86_regs->cr3 == current->cr3) {
+		loop->task_cache.hits++;
+		task = &current->task;
+		goto done;
+	}
+
+	loop->task_cache.misses++;
+
+	if (!loop->os_functions->read_task(loop, addr, &current->task)) {
+		current->task.addr = 0;
+		goto done;
+	}
+
+	current->cr3 = event->x86_regs->cr3;
+	task = &current->task;
+
+done:
+	return task;
+}
+
+/*
+ * Find the IDs of the process and thread running on the event's VCPU. If
+ * guestrace cannot find the current task, tid retains the address which
+ * identifies the thread's system call.
+ */
+static vmi_pid_t
+gt_current_ids(GTLoop *loop, vmi_event_t *event, gt_tid_t *tid)
+{
+	vmi_pid_t pid;
+
+	loop->event_task = gt_current_task(loop, event);
+	if (NULL == loop->event_task) {
+		pid = vmi_dtb_to_pid(loop->vmi, event->x86_regs->cr3);
+		goto done;
+	}
+
+	pid  = loop->event_task->pid;
+	*tid = loop->event_task->tid;
+
+done:
+	return pid;
+}
+
 /*
  * Service a triggered breakpoint. Restore the original page table for one
  * single-step iteration and possibly print the system call parameters
@@ -239,6 +550,17 @@ gt_breakpoint_cb(vmi_instance_t vmi, vmi_event_t *event) {
 	GTLoop *loop = event->data;
 	event->interrupt_event.reinject = 0;
 
+	/* Time the breakpoint before guestrace spends any time of its own. */
+	loop->event_time = gt_host_clock_now();
+
+	/*
+	 * A process's pages may move between events without a system call, as
+	 * upon copy-on-write or swapping; have the frame cache check them.
+	 */
+	if (NULL != loop->frames) {
+		gt_frame_cache_next_event(loop->frames);
+	}
+
 	if (event->interrupt_event.gla != loop->trampoline_addr) {
 		/* Type-one breakpoint. */
 		struct gt_paddr_record *paddr_record
@@ -259,12 +581,17 @@ gt_breakpoint_cb(vmi_instance_t vmi, vmi_event_t *event) {
 		vmi_read_64_pa(vmi, ret_loc, &ret_addr);
 
 		if (ret_addr == loop->return_point_addr) {
-			vmi_pid_t pid = vmi_dtb_to_pid(vmi, event->x86_regs->cr3);
+			gt_tid_t tid  = thread_id;
+			vmi_pid_t pid = gt_current_ids(loop, event, &tid);
 
-			syscall_state *sys_state = g_new0(syscall_state, 1);
+			syscall_state *sys_state = gt_syscall_state_new(loop);
 			sys_state->syscall_trap  = paddr_record;
-			sys_state->data          = paddr_record->syscall_cb(vmi, event, pid, thread_id, paddr_record->data);
 			sys_state->thread_id     = thread_id;
+			sys_state->call_time     = loop->event_time;
+			loop->event_state        = sys_state;
+			sys_state->data          = paddr_record->syscall_cb(vmi, event, pid, tid, paddr_record->data);
+			loop->event_state        = NULL;
+			loop->event_task         = NULL;
 
 			vmi_write_64_pa(vmi, ret_loc, &loop->trampoline_addr);
 			g_hash_table_insert(loop->gt_ret_addr_mapping,
@@ -285,20 +612,32 @@ gt_breakpoint_cb(vmi_instance_t vmi, vmi_event_t *event) {
 		                                                GSIZE_TO_POINTER(thread_id));
 
 		if (NULL != sys_state) {
-			vmi_pid_t pid = vmi_dtb_to_pid(vmi, event->x86_regs->cr3);
-			sys_state->syscall_trap->sysret_cb(vmi, event, pid, thread_id, sys_state->data);
-
-			vmi_set_vcpureg(vmi, loop->return_point_addr, RIP, event->vcpu_id);
+			gt_tid_t tid  = thread_id;
+			vmi_pid_t pid = gt_current_ids(loop, event, &tid);
+			sys_state->returned = TRUE;
+			loop->event_state   = sys_state;
+			sys_state->syscall_trap->sysret_cb(vmi, event, pid, tid, sys_state->data);
+			loop->event_state   = NULL;
+			loop->event_task    = NULL;
+
+			if (VMI_SUCCESS == vmi_set_vcpureg(vmi, loop->return_point_addr, RIP, event->vcpu_id)) {
+				_gt_count_hypercall(loop);
+			}
 
 			/*
-			 * This will free our syscall_state object, but sysret_cb must have
-			 * freed sys_state->data.
+			 * This will release our syscall_state object, along with what
+			 * the callbacks allocated with gt_guest_call_alloc(), but
+			 * sysret_cb must have freed any other sys_state->data.
 			 */
 			g_hash_table_remove(loop->gt_ret_addr_mapping,
 			                    GSIZE_TO_POINTER(thread_id));
 		}
 	}
 
+	/* The callbacks are done with the strings they interned. */
+	gt_string_table_trim(loop->strings);
+	gt_scratch_reset(loop->scratch);
+
 done:
 	return status;
 }
@@ -306,9 +645,19 @@ done:
 /*
  * Callback invoked on a R/W of a monitored page (likely kernel patch protection).
  * Switch the VCPUs SLAT to its original, step once, switch SLAT back
+ *
+ * In lazy mode, this is also invoked upon the first execution of a page for
+ * which guestrace holds deferred callbacks. Shadow the page and emplace its
+ * breakpoints, and then let the VCPU retry the instruction on the shadow page.
  */
 static event_response_t
 gt_mem_rw_cb (vmi_instance_t vmi, vmi_event_t *event) {
+	GTLoop *loop = event->data;
+
+	if (gt_materialize_lazy_page(loop, event->mem_event.gfn)) {
+		return VMI_EVENT_RESPONSE_NONE;
+	}
+
 	/* Switch back to original SLAT for one step. */
 	event->slat_id = 0;
 
@@ -332,10 +681,16 @@ gt_set_up_generic_events (GTLoop *loop) {
 		goto done;
 	}
 
-	/* TODO: support write events? */
+	_gt_count_hypercall(loop);
+
+	/*
+	 * libvmi hands a generic event only the violations its access mask
+	 * covers, so it must cover the execution of the pages which lazy mode
+	 * restricts, too; see gt_defer_mem_traps().
+	 */
 	SETUP_MEM_EVENT(&loop->memory_event,
 	                ~0ULL,
-	                 VMI_MEMACCESS_RW,
+	                 VMI_MEMACCESS_RWX,
 	                 gt_mem_rw_cb,
 	                 1);
 
@@ -347,6 +702,8 @@ gt_set_up_generic_events (GTLoop *loop) {
 		goto done;
 	}
 
+	_gt_count_hypercall(loop);
+
 	status = true;
 
 done:
@@ -368,6 +725,8 @@ gt_find_trampoline_addr (GTLoop *loop)
 		goto done;
 	}
 
+	_gt_count_hypercall(loop);
+
 	addr_t lstar_p = vmi_translate_kv2p(loop->vmi, lstar);
 	if (0 == lstar_p) {
 		fprintf(stderr, "failed to translate virtual LSTAR to physical address");
@@ -411,13 +770,20 @@ GTLoop *gt_loop_new(const char *guest_name)
 	GTLoop *loop;
 	int rc;
 	status_t status = VMI_FAILURE;
+	gint64 start;
+
+	/* Calibrate the clock now, rather than upon the first event. */
+	gt_host_clock_calibrate();
 
 	loop = g_new0(GTLoop, 1);
+	loop->ledger_fd = -1;
+	loop->startup.begin = start = g_get_monotonic_time();
 
 	/* Initialize the libvmi library. */
 	status = vmi_init(&loop->vmi,
 	                   VMI_XEN | VMI_INIT_COMPLETE | VMI_INIT_EVENTS,
 	                   guest_name);
+	gt_phase_end(loop, GT_PHASE_VMI_INIT, start);
 	if (VMI_SUCCESS != status) {
 		fprintf(stderr, "failed to init LibVMI library.\n");
 		goto done;
@@ -434,8 +800,24 @@ GTLoop *gt_loop_new(const char *guest_name)
 	                                                  NULL,
 	                                                  NULL,
 	                                                  gt_restore_return_addr);
-
-	vmi_pause_vm(loop->vmi);
+	loop->gt_lazy_pages = g_hash_table_new_full(NULL,
+	                                            NULL,
+	                                            NULL,
+	                                            gt_destroy_lazy_page);
+	loop->gt_process_cache = g_hash_table_new_full(NULL,
+	                                               NULL,
+	                                               NULL,
+	                                               g_free);
+	loop->gt_task_processes = g_hash_table_new_full(NULL,
+	                                                NULL,
+	                                                NULL,
+	                                                g_free);
+	loop->strings = gt_string_table_new(GT_STRING_TABLE_MAX_BYTES);
+	loop->scratch = gt_scratch_new(GT_SCRATCH_CHUNK_SIZE, &loop->scratch_stats);
+
+	if (VMI_SUCCESS == vmi_pause_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
 
 	loop->os = vmi_get_ostype(loop->vmi);
 	switch (loop->os) {
@@ -453,6 +835,12 @@ GTLoop *gt_loop_new(const char *guest_name)
 
 	loop->return_address_width = vmi_get_address_width(loop->vmi);
 
+	/* Without the current task, callbacks fall back to walking processes. */
+	loop->task_lookup = NULL != loop->os_functions->init_task_layout
+	                 && loop->os_functions->init_task_layout(loop);
+
+	start = g_get_monotonic_time();
+
 	loop->xch = xc_interface_open(0, 0, 0);
 	if (NULL == loop->xch) {
 		fprintf(stderr, "failed to create xc interface\n");
@@ -475,28 +863,60 @@ GTLoop *gt_loop_new(const char *guest_name)
 		goto done;
 	}
 
-	loop->curr_mem_size = loop->init_mem_size = vmi_get_memsize(loop->vmi);
-	if (0 == loop->init_mem_size) {
-		fprintf(stderr, "failed to get guest memory size\n");
+	if (!gt_recover_ledger(loop)) {
                 status = VMI_FAILURE;
 		goto done;
 	}
 
-	rc = xc_altp2m_set_domain_state(loop->xch, loop->domid, 1);
-	if (rc < 0) {
-		fprintf(stderr, "failed to enable altp2m on guest\n");
-                status = VMI_FAILURE;
-		goto done;
+	loop->frames = gt_frame_cache_new(loop->vmi,
+	                                  loop->xch,
+	                                  loop->domid,
+	                                  GT_FRAME_CACHE_MAX_BYTES);
+
+	gt_phase_end(loop, GT_PHASE_XEN_INIT, start);
+
+	start = g_get_monotonic_time();
+
+	if (gt_adopt_state(loop)) {
+		/* The detached guestrace turned altp2m on, and passed it on with its view. */
+		loop->altp2m_owned = TRUE;
+		gt_reclaim_orphans(loop, true);
+		printf("adopted shadow view %u with %u pages\n",
+		        loop->shadow_view,
+		        g_hash_table_size(loop->gt_page_record_collection));
+	} else {
+		gt_reclaim_orphans(loop, false);
+
+		rc = xc_altp2m_set_domain_state(loop->xch, loop->domid, 1);
+		if (rc < 0) {
+			fprintf(stderr, "failed to enable altp2m on guest\n");
+			status = VMI_FAILURE;
+			goto done;
+		}
+
+		_gt_count_hypercall(loop);
+		loop->altp2m_owned = TRUE;
+
+		rc = xc_altp2m_create_view(loop->xch, loop->domid, 0, &loop->shadow_view);
+		if (rc < 0) {
+			fprintf(stderr, "failed to create view for shadow page\n");
+			status = VMI_FAILURE;
+			goto done;
+		}
+
+		_gt_count_hypercall(loop);
 	}
 
-	rc = xc_altp2m_create_view(loop->xch, loop->domid, 0, &loop->shadow_view);
-	if (rc < 0) {
-		fprintf(stderr, "failed to create view for shadow page\n");
-                status = VMI_FAILURE;
+	if (!gt_open_ledger(loop)) {
+		status = VMI_FAILURE;
 		goto done;
 	}
 
-	vmi_resume_vm(loop->vmi);
+	gt_phase_end(loop, GT_PHASE_SHADOW_VIEW, start);
+
+	if (VMI_SUCCESS == vmi_resume_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
 
 done:
 	if (VMI_SUCCESS != status) {
@@ -527,412 +947,2175 @@ gt_loop_get_ostype(GTLoop *loop)
 }
 
 /**
- * gt_loop_run:
+ * gt_loop_set_lazy:
  * @loop: a #GTLoop.
+ * @lazy: %TRUE to defer instrumentation.
  *
- * Uses libvmi to complete the preparations necessary to trace a guest's system
- * calls. Runs @loop until gt_loop_quit() is called on @loop.
+ * Sets whether @loop defers instrumenting the kernel. In lazy mode,
+ * gt_loop_set_cb() and gt_loop_set_cbs() merely record the callbacks they
+ * receive. The guestrace event loop allocates the shadow page and emplaces
+ * the breakpoints for a kernel page only when the guest first executes that
+ * page. System calls which the guest never makes thus cost neither memory
+ * nor VM exits. Call this before setting any callbacks.
  */
-void gt_loop_run(GTLoop *loop)
+void
+gt_loop_set_lazy(GTLoop *loop, gboolean lazy)
 {
-	int rc;
-
-	vmi_pause_vm(loop->vmi);
+	loop->lazy = lazy;
+}
 
-	rc = xc_altp2m_switch_to_view(loop->xch, loop->domid, loop->shadow_view);
-	if (rc < 0) {
-		fprintf(stderr, "failed to enable shadow view\n");
-		goto done;
-	}
+/**
+ * gt_loop_set_detach:
+ * @loop: a #GTLoop.
+ * @detach: %TRUE to detach upon quitting.
+ *
+ * Sets whether gt_loop_quit() detaches @loop from the guest rather than
+ * removing its instrumentation. A detaching loop stops the guest from using
+ * the shadow view, but it leaves the view and its shadow pages in place and
+ * saves a description of them in the guestrace state directory. The next
+ * gt_loop_new() on the same guest adopts them rather than cloning the kernel
+ * again; it retains those breakpoints which it receives callbacks for and
+ * removes the rest once it runs. If the guest no longer matches the saved
+ * state, gt_loop_new() discards the state and instruments the guest anew.
+ */
+void
+gt_loop_set_detach(GTLoop *loop, gboolean detach)
+{
+	loop->detach = detach;
+}
 
-	if (!gt_set_up_generic_events(loop)) {
-		goto done;
-	}
+/*
+ * Find the process with the given ID, preferably in the process cache. A
+ * cached entry remains valid so long as its task_struct or EPROCESS still
+ * bears the same ID. Upon exec, the process keeps its ID but changes its
+ * name, so each hit rereads the name too.
+ */
+static gt_process *
+gt_process_lookup (GTLoop *loop, vmi_pid_t pid)
+{
+	gt_process current;
+	gt_process *process = g_hash_table_lookup(loop->gt_process_cache,
+	                                          GINT_TO_POINTER(pid));
+
+	if (NULL != process) {
+		if (loop->os_functions->read_process(loop, process->addr, &current)
+		 && pid == current.pid) {
+			if (0 != strcmp(process->name, current.name)) {
+				loop->process_cache.renames++;
+				*process = current;
+			}
+			loop->process_cache.hits++;
+			goto done;
+		}
 
-	if (!gt_set_up_step_events(loop)) {
-		goto done;
+		/* The process exited, and its memory might now be anything. */
+		loop->process_cache.invalidations++;
+		g_hash_table_remove(loop->gt_process_cache, GINT_TO_POINTER(pid));
 	}
 
+	loop->process_cache.misses++;
 
-	loop->return_point_addr = loop->os_functions->find_return_point_addr(loop);
-	if (0 == loop->return_point_addr) {
+	process = g_new0(gt_process, 1);
+	if (!loop->os_functions->find_process(loop, pid, process)) {
+		g_free(process);
+		process = NULL;
 		goto done;
 	}
 
-	if (!gt_find_trampoline_addr(loop)) {
-		goto done;
+	if (g_hash_table_size(loop->gt_process_cache) >= GT_PROCESS_CACHE_MAX) {
+		/* Processes which exited untraced linger; start over. */
+		g_hash_table_remove_all(loop->gt_process_cache);
 	}
 
-	vmi_resume_vm(loop->vmi);
-
-	while(!gt_interrupted){
-		status_t status = vmi_events_listen(loop->vmi, 500);
-		if (status != VMI_SUCCESS) {
-			fprintf(stderr, "error waiting for events\n");
-			break;
-		}
-	}
+	g_hash_table_insert(loop->gt_process_cache, GINT_TO_POINTER(pid), process);
 
 done:
-
-	return;
+	return process;
 }
 
 /**
- * gt_loop_quit:
- * @loop: a #GTLoop.
+ * gt_guest_get_process_name:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @pid: a process ID.
  *
- * Stops @loop from running. Any calls to gt_loop_run() for the loop will return.
- * This removes any modifications to the guest's memory and allows the guest
- * to run without instrumentation.
+ * Finds the name of a process in the guest, for use by a #GTSyscallFunc or
+ * #GTSysretFunc. A cache shared by all callbacks holds the names, so that
+ * guestrace need not walk the guest's process list on each system call.
+ *
+ * Returns: the name of the process, or %NULL if guestrace cannot find the
+ * process. The name remains valid until the callback returns.
  */
-void gt_loop_quit(GTLoop *loop)
+const char *
+gt_guest_get_process_name(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid)
 {
-	int status;
-
-	vmi_pause_vm(loop->vmi);
-
-	g_hash_table_remove_all(loop->gt_page_translation);
-	g_hash_table_remove_all(loop->gt_ret_addr_mapping);
-	g_hash_table_remove_all(loop->gt_page_record_collection);
+	GTLoop *loop = event->data;
+	gt_process *process;
 
-	status = xc_altp2m_switch_to_view(loop->xch, loop->domid, 0);
-	if (0 > status) {
-		fprintf(stderr, "failed to reset EPT to point to default table\n");
+	/* The current task knows its process's name if it knows its process. */
+	if (NULL != loop->event_task
+	 && 0 != loop->event_task->process
+	 && pid == loop->event_task->pid) {
+		return loop->event_task->name;
 	}
 
-	vmi_resume_vm(loop->vmi);
+	process = gt_process_lookup(loop, pid);
 
-	gt_interrupted = TRUE;
+	return NULL == process ? NULL : process->name;
 }
 
 /**
- * gt_loop_free:
- * @loop: a #GTLoop.
+ * gt_guest_get_process_addr:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @pid: a process ID.
  *
- * Free @loop and its associated memory. If the loop is currently running, then
- * gt_loop_quit() must first terminate the loop and remove the guest
- * instrumentation.
+ * Finds a process in the guest, as with gt_guest_get_process_name().
+ *
+ * Returns: the virtual address of the process's task_struct on Linux or
+ * EPROCESS on Windows, or 0 if guestrace cannot find the process.
  */
-void gt_loop_free(GTLoop *loop)
+addr_t
+gt_guest_get_process_addr(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid)
 {
-	if (NULL == loop) {
-		goto done;
-	}
-
-	vmi_pause_vm(loop->vmi);
+	GTLoop *loop = event->data;
+	gt_process *process;
 
-	g_hash_table_destroy(loop->gt_page_translation);
-	g_hash_table_destroy(loop->gt_ret_addr_mapping);
-	g_hash_table_destroy(loop->gt_page_record_collection);
+	if (NULL != loop->event_task
+	 && 0 != loop->event_task->process
+	 && pid == loop->event_task->pid) {
+		return loop->event_task->process;
+	}
 
-	xc_altp2m_destroy_view(loop->xch, loop->domid, loop->shadow_view);
-	xc_altp2m_set_domain_state(loop->xch, loop->domid, 0);
-	/* TODO: find out why this isn't decreasing main memory on next run of guestrace */
-	xc_domain_setmaxmem(loop->xch, loop->domid, loop->init_mem_size);
+	process = gt_process_lookup(loop, pid);
 
-	libxl_ctx_free(loop->ctx);
-	xc_interface_close(loop->xch);
+	return NULL == process ? 0 : process->addr;
+}
 
-	vmi_resume_vm(loop->vmi);
+/**
+ * gt_guest_forget_process:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @pid: a process ID.
+ *
+ * Removes a process from the cache used by gt_guest_get_process_name(), and
+ * forgets the task each VCPU last ran. Callbacks for system calls which end
+ * or replace a process, such as exit and exec, call this so that guestrace
+ * never reports a stale name, even should the kernel reuse the task_struct.
+ * Since the process's address space goes with it, this also begins a new
+ * generation of the frame cache, as gt_guest_invalidate_frames() does.
+ */
+void
+gt_guest_forget_process(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid)
+{
+	GTLoop *loop = event->data;
 
-	vmi_destroy(loop->vmi);
+	gt_guest_invalidate_frames(vmi, event);
 
-	g_free(loop);
+	if (g_hash_table_remove(loop->gt_process_cache, GINT_TO_POINTER(pid))) {
+		loop->process_cache.invalidations++;
+	}
 
-done:
-	return;
+	for (int vcpu = 0; vcpu < _GT_MAX_VCPUS; vcpu++) {
+		loop->current_task[vcpu].task.addr = 0;
+	}
 }
 
-/* Allocate a new page of memory in the guest's address space. */
-static addr_t
-gt_allocate_shadow_page (GTLoop *loop)
+/**
+ * gt_guest_read_va:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @vaddr: the virtual address of the bytes in the guest.
+ * @pid: the ID of the process whose address space contains @vaddr, or 0
+ * for the kernel.
+ * @buf: where to store the bytes.
+ * @count: the number of bytes to read.
+ *
+ * Reads bytes from the guest as vmi_read_va() does, but through a cache of
+ * guest frames which guestrace keeps mapped across events, so that reading
+ * a page which guestrace has read before costs neither a translation nor a
+ * mapping. The cache holds the most recently read 16 MiB of frames.
+ *
+ * Returns: the number of bytes read, which is less than @count if
+ * guestrace cannot read all of them.
+ */
+size_t
+gt_guest_read_va(vmi_instance_t vmi,
+                 vmi_event_t *event,
+                 addr_t vaddr,
+                 vmi_pid_t pid,
+                 void *buf,
+                 size_t count)
 {
-	int status;
-	xen_pfn_t gfn = 0;
-	uint64_t proposed_mem_size = loop->curr_mem_size + VF_PAGE_SIZE;
+	return _gt_read_va(event->data, event, vaddr, pid, buf, count);
+}
 
-	status = xc_domain_setmaxmem(loop->xch, loop->domid, proposed_mem_size);
-	if (0 == status) {
-		loop->curr_mem_size = proposed_mem_size;
+/**
+ * gt_guest_invalidate_frames:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ *
+ * Makes gt_guest_read_va() translate each address anew before reading it
+ * again, and flushes libvmi's own cache of translations. Callbacks for
+ * system calls which change a process's mappings, such as munmap and
+ * NtFreeVirtualMemory, call this upon the call's return.
+ */
+void
+gt_guest_invalidate_frames(vmi_instance_t vmi, vmi_event_t *event)
+{
+	GTLoop *loop = event->data;
+
+	if (NULL != loop->frames) {
+		gt_frame_cache_invalidate(loop->frames);
+	}
+
+	vmi_v2pcache_flush(vmi, ~0ull);
+}
+
+/**
+ * gt_guest_intern:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @str: a string.
+ * @id: where to store the ID of the string, or %NULL.
+ *
+ * Interns a string in a table shared by all callbacks. Callbacks which
+ * repeatedly print or record the same strings, such as the names of
+ * processes, can use the interned copy, or its ID, rather than allocating
+ * their own. The table evicts the least recently used strings once they
+ * exceed its budget, so one-off strings belong in the per-event arena
+ * instead; see gt_guest_read_string().
+ *
+ * Returns: the interned copy of @str. The copy remains valid until the
+ * callback returns, and longer if the table does not evict it.
+ */
+const char *
+gt_guest_intern(vmi_instance_t vmi, vmi_event_t *event, const char *str, gt_str_id *id)
+{
+	GTLoop *loop = event->data;
+
+	return gt_string_table_intern(loop->strings, str, id);
+}
+
+/**
+ * gt_guest_get_string:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @id: the ID of an interned string.
+ *
+ * Finds a string interned by gt_guest_intern().
+ *
+ * Returns: the string, or %NULL if guestrace has since evicted it.
+ */
+const char *
+gt_guest_get_string(vmi_instance_t vmi, vmi_event_t *event, gt_str_id id)
+{
+	GTLoop *loop = event->data;
+
+	return gt_string_table_lookup(loop->strings, id);
+}
+
+/**
+ * gt_guest_read_string:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @vaddr: the virtual address of a NUL-terminated string in the guest.
+ * @pid: the ID of the process whose address space contains @vaddr.
+ *
+ * Reads a string from the guest into memory allocated as by
+ * gt_guest_scratch_alloc(), so that, unlike with vmi_read_str_va(), the
+ * caller need not free it. Callbacks for strings which recur, rather than
+ * one-off arguments, may intern the result with gt_guest_intern(). Strings
+ * longer than 4095 bytes are truncated.
+ *
+ * Returns: the string, or %NULL if guestrace cannot read it.
+ */
+const char *
+gt_guest_read_string(vmi_instance_t vmi,
+                     vmi_event_t *event,
+                     addr_t vaddr,
+                     vmi_pid_t pid)
+{
+	GTLoop *loop = event->data;
+	char *str = NULL;
+	char buf[GT_STRING_MAX];
+	size_t len = 0;
+
+	/* Read no further than the page which holds the terminator. */
+	while (len < sizeof buf - 1) {
+		size_t chunk = VF_PAGE_SIZE - (vaddr + len) % VF_PAGE_SIZE;
+		size_t count;
+		char *nul;
+
+		if (chunk > sizeof buf - 1 - len) {
+			chunk = sizeof buf - 1 - len;
+		}
+
+		count = gt_guest_read_va(vmi, event, vaddr + len, pid, buf + len, chunk);
+		nul   = memchr(buf + len, '\0', count);
+		if (NULL != nul) {
+			len = nul - buf;
+			goto copy;
+		}
+
+		len += count;
+		if (count < chunk) {
+			/* The string runs into memory we cannot read. */
+			break;
+		}
+	}
+
+	if (0 == len) {
+		goto done;
+	}
+
+copy:
+	str = gt_scratch_alloc(loop->scratch, len + 1);
+	memcpy(str, buf, len);
+	str[len] = '\0';
+
+done:
+	return str;
+}
+
+/**
+ * gt_guest_get_process_name_id:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @pid: a process ID.
+ *
+ * Finds the name of a process as with gt_guest_get_process_name(), and
+ * interns it as with gt_guest_intern().
+ *
+ * Returns: the ID of the process's name, or %GT_STR_NONE if guestrace
+ * cannot find the process.
+ */
+gt_str_id
+gt_guest_get_process_name_id(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid)
+{
+	gt_str_id id = GT_STR_NONE;
+	const char *name = gt_guest_get_process_name(vmi, event, pid);
+
+	if (NULL != name) {
+		gt_guest_intern(vmi, event, name, &id);
+	}
+
+	return id;
+}
+
+/**
+ * gt_guest_get_args:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @pid: the ID of the process passed to the callback.
+ * @count: the number of arguments the system call takes, at most
+ * %GT_SYSCALL_ARGS_MAX.
+ *
+ * Reads the arguments of a system call, for use by a #GTSyscallFunc. The
+ * arguments live in guestrace's state for the system call, so reading them
+ * allocates nothing, and guestrace reads all of the arguments passed on the
+ * stack at once. A #GTSysretFunc may call this too, and it receives the
+ * arguments its #GTSyscallFunc read, since by then the guest may have
+ * overwritten the registers and stack which held them. A #GTSyscallFunc
+ * may instead return the arguments so that its #GTSysretFunc can examine
+ * them; the #GTSysretFunc must not free them.
+ *
+ * Returns: the @count arguments, or %NULL if called outside of a
+ * #GTSyscallFunc or #GTSysretFunc, if @count is too large, or if a
+ * #GTSysretFunc asks for more arguments than its #GTSyscallFunc read. The
+ * arguments remain valid until the corresponding #GTSysretFunc returns.
+ */
+uint64_t *
+gt_guest_get_args(vmi_instance_t vmi, vmi_event_t *event, vmi_pid_t pid, int count)
+{
+	GTLoop *loop = event->data;
+	syscall_state *sys_state = loop->event_state;
+
+	if (NULL == sys_state || count < 0 || count > GT_SYSCALL_ARGS_MAX) {
+		return NULL;
+	}
+
+	if (count > sys_state->args_count) {
+		if (sys_state->returned) {
+			return NULL;
+		}
+
+		loop->os_functions->get_args(loop, event, pid, sys_state->args, count);
+		sys_state->args_count = count;
+	}
+
+	return sys_state->args;
+}
+
+/**
+ * gt_guest_call_alloc:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @size: the number of bytes to allocate.
+ *
+ * Allocates memory which guestrace reclaims once the system call at hand
+ * returns and its #GTSysretFunc returns in turn. A #GTSyscallFunc can
+ * return such memory as the data to pass to its #GTSysretFunc, which then
+ * need not, and must not, free it. Each pending system call has an arena
+ * of its own, which guestrace keeps along with the call's other state for
+ * later calls, so in the long run this calls malloc() not at all.
+ *
+ * Returns: @size bytes, aligned as by malloc(), or %NULL if called outside
+ * a #GTSyscallFunc or #GTSysretFunc.
+ */
+void *
+gt_guest_call_alloc(vmi_instance_t vmi, vmi_event_t *event, size_t size)
+{
+	GTLoop *loop = event->data;
+	syscall_state *sys_state = loop->event_state;
+
+	if (NULL == sys_state) {
+		return NULL;
+	}
+
+	if (NULL == sys_state->scratch) {
+		sys_state->scratch = gt_scratch_new(GT_CALL_SCRATCH_CHUNK_SIZE,
+		                                    &loop->call_scratch_stats);
+	}
+
+	return gt_scratch_alloc(sys_state->scratch, size);
+}
+
+/**
+ * gt_guest_get_event_time:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ *
+ * Gives the time at which the guest hit guestrace's breakpoint for the
+ * event at hand, on the clock of gt_clock_now(), before guestrace spent
+ * any time on the event. A #GTSysretFunc can subtract the time of the
+ * system call, as given by gt_guest_get_call_time(), to find how long the
+ * guest's kernel took to serve it.
+ *
+ * Returns: the time in nanoseconds.
+ */
+uint64_t
+gt_guest_get_event_time(vmi_instance_t vmi, vmi_event_t *event)
+{
+	GTLoop *loop = event->data;
+
+	return loop->event_time;
+}
+
+/**
+ * gt_guest_get_call_time:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ *
+ * Gives the time at which the system call at hand entered the guest's
+ * kernel, as gt_guest_get_event_time() gave it to the #GTSyscallFunc.
+ *
+ * Returns: the time in nanoseconds, or 0 if called outside of a
+ * #GTSyscallFunc or #GTSysretFunc.
+ */
+uint64_t
+gt_guest_get_call_time(vmi_instance_t vmi, vmi_event_t *event)
+{
+	GTLoop *loop = event->data;
+
+	if (NULL == loop->event_state) {
+		return 0;
+	}
+
+	return loop->event_state->call_time;
+}
+
+/**
+ * gt_guest_get_tsc:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @tsc: where to store the time stamp counter.
+ * @khz: where to store the counter's frequency, or 0 if Xen does not say.
+ *
+ * Reads the time stamp counter of the VCPU of the event at hand, as the
+ * guest would read it, so that callbacks can relate the host's time of
+ * an event to the guest's. Xen keeps the guest's counter in the VCPU's
+ * saved state, so this costs a hypercall, unlike the host's own time;
+ * see gt_clock_now().
+ *
+ * Returns: %TRUE on success, or %FALSE if Xen could not read the VCPU.
+ */
+gboolean
+gt_guest_get_tsc(vmi_instance_t vmi, vmi_event_t *event, uint64_t *tsc, uint32_t *khz)
+{
+	GTLoop *loop = event->data;
+	struct hvm_hw_cpu cpu;
+
+	if (0 != xc_domain_hvm_getcontext_partial(loop->xch, loop->domid,
+	                                          HVM_SAVE_CODE(CPU), event->vcpu_id,
+	                                          &cpu, sizeof cpu)) {
+		return FALSE;
+	}
+
+	_gt_count_hypercall(loop);
+
+	if (0 == loop->guest_tsc_khz) {
+		uint32_t tsc_mode, incarnation;
+		uint64_t elapsed;
+
+		if (0 == xc_domain_get_tsc_info(loop->xch, loop->domid, &tsc_mode, &elapsed,
+		                                &loop->guest_tsc_khz, &incarnation)) {
+			_gt_count_hypercall(loop);
+		}
+	}
+
+	*tsc = cpu.tsc;
+	*khz = loop->guest_tsc_khz;
+
+	return TRUE;
+}
+
+/**
+ * gt_clock_now:
+ *
+ * Gives the time on the clock by which guestrace times events; see
+ * gt_guest_get_event_time(). This is the host's monotonic clock, read
+ * from its time stamp counter where that is invariant rather than by
+ * clock_gettime(), once calibrated by gt_loop_new() or the first call.
+ *
+ * Returns: the time in nanoseconds.
+ */
+uint64_t
+gt_clock_now(void)
+{
+	return gt_host_clock_now();
+}
+
+/**
+ * gt_guest_get_task:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ *
+ * Finds the thread which caused the event, for use by a #GTSyscallFunc or
+ * #GTSysretFunc. Rather than walk the guest's process list, guestrace reads
+ * the per-CPU current_task on Linux and the processor block's CurrentThread
+ * on Windows, and it rereads the thread only after the VCPU switches to
+ * another thread.
+ *
+ * Returns: the thread, or %NULL if guestrace cannot find the current task
+ * on the guest's operating system. The thread remains valid until the
+ * callback returns.
+ */
+const GTTask *
+gt_guest_get_task(vmi_instance_t vmi, vmi_event_t *event)
+{
+	GTLoop *loop = event->data;
+
+	return loop->event_task;
+}
+
+/**
+ * gt_loop_print_stats:
+ * @loop: a #GTLoop.
+ * @stream: the stream to write to.
+ *
+ * Writes statistics about the caches @loop maintains while running to
+ * @stream, as a single-line JSON object with a member for each cache.
+ */
+void
+gt_loop_print_stats(GTLoop *loop, FILE *stream)
+{
+	gt_cache_stats *process_cache = &loop->process_cache;
+	gt_cache_stats *task_cache = &loop->task_cache;
+	uint64_t lookups = process_cache->hits + process_cache->misses;
+	uint64_t task_lookups = task_cache->hits + task_cache->misses;
+
+	fprintf(stream, "{\"process_cache\": {"
+	                "\"entries\": %u, "
+	                "\"hits\": %" PRIu64 ", "
+	                "\"misses\": %" PRIu64 ", "
+	                "\"invalidations\": %" PRIu64 ", "
+	                "\"renames\": %" PRIu64 ", "
+	                "\"hit_rate\": %.4f}, "
+	                "\"task_cache\": {"
+	                "\"enabled\": %s, "
+	                "\"hits\": %" PRIu64 ", "
+	                "\"misses\": %" PRIu64 ", "
+	                "\"hit_rate\": %.4f}, "
+	                "\"strings\": ",
+	        g_hash_table_size(loop->gt_process_cache),
+	        process_cache->hits,
+	        process_cache->misses,
+	        process_cache->invalidations,
+	        process_cache->renames,
+	        lookups ? (double) process_cache->hits / lookups : 0.0,
+	        loop->task_lookup ? "true" : "false",
+	        task_cache->hits,
+	        task_cache->misses,
+	        task_lookups ? (double) task_cache->hits / task_lookups : 0.0);
+
+	gt_string_table_print_stats(loop->strings, stream);
+	fprintf(stream, ", \"clock\": ");
+	gt_host_clock_print_stats(stream);
+	fprintf(stream, ", \"scratch\": ");
+	gt_scratch_print_stats(&loop->scratch_stats, stream);
+	fprintf(stream, ", \"call_scratch\": ");
+	gt_scratch_print_stats(&loop->call_scratch_stats, stream);
+	if (NULL != loop->frames) {
+		fprintf(stream, ", \"frame_cache\": ");
+		gt_frame_cache_print_stats(loop->frames, stream);
+	}
+	fprintf(stream, "}\n");
+
+	fflush(stream);
+}
+
+/**
+ * gt_loop_set_startup_report:
+ * @loop: a #GTLoop.
+ * @stream: the stream to which gt_loop_run() writes the report, or %NULL.
+ *
+ * Sets the stream to which gt_loop_run() writes its startup report once it
+ * has finished instrumenting the guest; see gt_loop_print_startup_report().
+ */
+void
+gt_loop_set_startup_report(GTLoop *loop, FILE *stream)
+{
+	loop->startup_report = stream;
+}
+
+/**
+ * gt_loop_print_startup_report:
+ * @loop: a #GTLoop.
+ * @stream: the stream to write to.
+ *
+ * Writes a report of the time @loop spent instrumenting the guest to
+ * @stream. The report is a single-line JSON object. Its "phases" member
+ * holds the microseconds spent in each phase of the setup, and its "counts"
+ * member counts the work done, such as the number of pages cloned and the
+ * number of hypercalls issued. A hypercall here is a call which succeeded
+ * to libxenctrl, to pause or resume the guest, to access a VCPU register,
+ * or to set up a libvmi event or memory restriction; guestrace counts these
+ * until gt_loop_run() begins to wait for events. Its "total_us" member
+ * holds the microseconds between gt_loop_new() and that point, or zero if
+ * gt_loop_run() has not yet reached that point.
+ */
+void
+gt_loop_print_startup_report(GTLoop *loop, FILE *stream)
+{
+	gt_startup_stats *startup = &loop->startup;
+
+	fprintf(stream, "{\"phases\": {");
+	for (int i = 0; i < GT_PHASE_COUNT; i++) {
+		fprintf(stream, "%s\"%s_us\": %" PRId64,
+		        i ? ", " : "", GT_PHASE_NAMES[i], startup->usec[i]);
+	}
+
+	fprintf(stream, "}, \"counts\": {"
+	                "\"symbols\": %" PRIu64 ", "
+	                "\"symbols_missing\": %" PRIu64 ", "
+	                "\"pages_cloned\": %" PRIu64 ", "
+	                "\"pages_adopted\": %" PRIu64 ", "
+	                "\"breakpoints\": %" PRIu64 ", "
+	                "\"deferred\": %" PRIu64 ", "
+	                "\"hypercalls\": %" PRIu64 "}, "
+	                "\"total_us\": %" PRId64 "}\n",
+	        startup->symbols,
+	        startup->symbols_missing,
+	        startup->pages_cloned,
+	        startup->pages_adopted,
+	        startup->breakpoints,
+	        startup->deferred,
+	        startup->hypercalls,
+	        startup->end ? startup->end - startup->begin : 0);
+
+	fflush(stream);
+}
+
+/**
+ * gt_loop_get_lazy:
+ * @loop: a #GTLoop.
+ *
+ * Returns: %TRUE if @loop is in lazy mode; see gt_loop_set_lazy().
+ **/
+gboolean
+gt_loop_get_lazy(GTLoop *loop)
+{
+	return loop->lazy;
+}
+
+/*
+ * Remove the instrumentation of loop, or leave it for the next guestrace if
+ * loop should detach, and return the guest to its own view of its memory.
+ */
+static void
+gt_loop_stop(GTLoop *loop)
+{
+	int status;
+
+	if (VMI_SUCCESS == vmi_pause_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
+
+	if (loop->detach && gt_save_state(loop)) {
+		loop->detached = TRUE;
+	}
+
+	g_hash_table_remove_all(loop->gt_page_translation);
+	g_hash_table_remove_all(loop->gt_ret_addr_mapping);
+	g_hash_table_remove_all(loop->gt_page_record_collection);
+	g_hash_table_remove_all(loop->gt_lazy_pages);
+
+	status = xc_altp2m_switch_to_view(loop->xch, loop->domid, 0);
+	if (0 > status) {
+		fprintf(stderr, "failed to reset EPT to point to default table\n");
+	} else {
+		_gt_count_hypercall(loop);
+	}
+
+	if (VMI_SUCCESS == vmi_resume_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
+}
+
+/**
+ * gt_loop_run:
+ * @loop: a #GTLoop.
+ *
+ * Uses libvmi to complete the preparations necessary to trace a guest's system
+ * calls. Runs @loop until gt_loop_quit() is called on @loop.
+ */
+void gt_loop_run(GTLoop *loop)
+{
+	int rc;
+	gint64 start;
+
+	if (VMI_SUCCESS == vmi_pause_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
+
+	start = g_get_monotonic_time();
+
+	gt_scrub_adopted_breakpoints(loop);
+
+	gt_phase_end(loop, GT_PHASE_BREAKPOINTS, start);
+
+	start = g_get_monotonic_time();
+
+	rc = xc_altp2m_switch_to_view(loop->xch, loop->domid, loop->shadow_view);
+	if (rc < 0) {
+		fprintf(stderr, "failed to enable shadow view\n");
+		goto done;
+	}
+
+	_gt_count_hypercall(loop);
+
+	if (!gt_set_up_generic_events(loop)) {
+		goto done;
+	}
+
+	if (!gt_set_up_step_events(loop)) {
+		goto done;
+	}
+
+	gt_phase_end(loop, GT_PHASE_EVENTS, start);
+
+	start = g_get_monotonic_time();
+
+	loop->return_point_addr = loop->os_functions->find_return_point_addr(loop);
+	if (0 == loop->return_point_addr) {
+		goto done;
+	}
+
+	if (!gt_find_trampoline_addr(loop)) {
+		goto done;
+	}
+
+	gt_phase_end(loop, GT_PHASE_KERNEL_SCAN, start);
+
+	if (VMI_SUCCESS == vmi_resume_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
+
+	loop->startup.end = g_get_monotonic_time();
+	if (NULL != loop->startup_report) {
+		gt_loop_print_startup_report(loop, loop->startup_report);
+	}
+
+	while(!gt_interrupted){
+		status_t status = vmi_events_listen(loop->vmi, 500);
+		if (status != VMI_SUCCESS && !gt_interrupted) {
+			fprintf(stderr, "error waiting for events\n");
+			break;
+		}
+	}
+
+	gt_loop_stop(loop);
+
+done:
+
+	return;
+}
+
+/**
+ * gt_loop_quit:
+ * @loop: a #GTLoop.
+ *
+ * Stops @loop from running. Any calls to gt_loop_run() for the loop will return
+ * within half a second, once they have removed any modifications to the
+ * guest's memory and allowed the guest to run without instrumentation. If
+ * @loop should detach (see gt_loop_set_detach()), they instead leave the
+ * modified memory in place but unused by the guest. This only sets a flag,
+ * so a signal handler may call it.
+ */
+void gt_loop_quit(GTLoop *loop)
+{
+	gt_interrupted = TRUE;
+}
+
+/**
+ * gt_loop_free:
+ * @loop: a #GTLoop.
+ *
+ * Free @loop and its associated memory. If the loop is currently running, then
+ * gt_loop_quit() must first terminate the loop and remove the guest
+ * instrumentation.
+ */
+void gt_loop_free(GTLoop *loop)
+{
+	if (NULL == loop) {
+		goto done;
+	}
+
+	if (VMI_SUCCESS == vmi_pause_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
+
+	g_hash_table_destroy(loop->gt_page_translation);
+	g_hash_table_destroy(loop->gt_ret_addr_mapping);
+
+	while (NULL != loop->free_states) {
+		syscall_state *sys_state = loop->free_states;
+		loop->free_states = sys_state->next_free;
+		gt_scratch_free(sys_state->scratch);
+		g_free(sys_state);
+	}
+	g_hash_table_destroy(loop->gt_page_record_collection);
+	g_hash_table_destroy(loop->gt_lazy_pages);
+	g_hash_table_destroy(loop->gt_process_cache);
+	g_hash_table_destroy(loop->gt_task_processes);
+	gt_string_table_free(loop->strings);
+	gt_scratch_free(loop->scratch);
+	gt_frame_cache_free(loop->frames);
+
+	gt_close_ledger(loop);
+
+	libxl_ctx_free(loop->ctx);
+	xc_interface_close(loop->xch);
+
+	if (VMI_SUCCESS == vmi_resume_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
+
+	vmi_destroy(loop->vmi);
+
+	g_free(loop);
+
+done:
+	return;
+}
+
+/* The maximum memory of the guest while guestrace holds count frames. */
+static uint64_t
+gt_max_memkb (GTLoop *loop, guint count)
+{
+	return loop->init_max_memkb + count * (VF_PAGE_SIZE >> 10);
+}
+
+/* Append an entry to the ledger; see struct gt_ledger_header. */
+static void
+gt_ledger_append (GTLoop *loop, uint64_t entry)
+{
+	if (-1 == loop->ledger_fd) {
+		return;
+	}
+
+	if (sizeof entry != write(loop->ledger_fd, &entry, sizeof entry)) {
+		fprintf(stderr, "failed to record frame 0x%" PRIx64 " in ledger\n",
+		        entry & ~GT_LEDGER_RELEASED);
+	}
+}
+
+/*
+ * Allocate a new page of memory in the guest's address space, above any
+ * memory the guest already has. Raise the guest's maximum memory by exactly
+ * one page to accommodate it.
+ */
+static addr_t
+gt_allocate_shadow_page (GTLoop *loop)
+{
+	int status;
+	xen_pfn_t gfn = loop->next_shadow_gfn;
+	guint count = g_hash_table_size(loop->shadow_frames);
+
+	status = xc_domain_setmaxmem(loop->xch, loop->domid,
+	                             gt_max_memkb(loop, count + 1));
+	if (0 != status) {
+		fprintf(stderr,
+		       "failed to increase memory size on guest to %lu KiB\n",
+		        gt_max_memkb(loop, count + 1));
+		gfn = 0;
+		goto done;
+	}
+
+	_gt_count_hypercall(loop);
+
+	/* Record the frame first, lest we crash and lose track of it. */
+	gt_ledger_append(loop, gfn);
+
+	status = xc_domain_populate_physmap_exact(loop->xch, loop->domid, 1, 0,
+	                                          0, &gfn);
+	if (0 != status) {
+		fprintf(stderr, "failed to populate GFN at 0x%lx\n", gfn);
+		gt_ledger_append(loop, gfn | GT_LEDGER_RELEASED);
+		if (0 == xc_domain_setmaxmem(loop->xch, loop->domid, gt_max_memkb(loop, count))) {
+			_gt_count_hypercall(loop);
+		}
+		gfn = 0;
+		goto done;
+	}
+
+	_gt_count_hypercall(loop);
+
+	g_hash_table_add(loop->shadow_frames, GSIZE_TO_POINTER(gfn));
+	loop->next_shadow_gfn++;
+
+done:
+	return gfn;
+}
+
+/* Return a page allocated by gt_allocate_shadow_page() to Xen. */
+static void
+gt_release_shadow_page (GTLoop *loop, xen_pfn_t gfn)
+{
+	if (!g_hash_table_remove(loop->shadow_frames, GSIZE_TO_POINTER(gfn))) {
+		return;
+	}
+
+	if (0 != xc_domain_decrease_reservation_exact(loop->xch, loop->domid,
+	                                              1, 0, &gfn)) {
+		fprintf(stderr, "failed to release GFN at 0x%lx\n", gfn);
+		return;
+	}
+
+	_gt_count_hypercall(loop);
+	gt_ledger_append(loop, gfn | GT_LEDGER_RELEASED);
+}
+
+/*
+ * Remove the breakpoint associated with paddr_record by restoring the
+ * original instruction byte from the frame into the shadow page.
+ */
+static void
+gt_remove_breakpoint(struct gt_paddr_record *paddr_record) {
+	gt_page_record *page_record = paddr_record->parent;
+
+	page_record->shadow_map[paddr_record->offset]
+		= page_record->frame_map[paddr_record->offset];
+}
+
+static void
+gt_destroy_paddr_record (gpointer data) {
+	struct gt_paddr_record *paddr_record = data;
+
+	fprintf(stderr,
+	       "destroying paddr record at shadow physical address %lx\n",
+	       (paddr_record->parent->shadow_page << VF_PAGE_OFFSET_BITS)
+	      + paddr_record->offset);
+
+	if (!paddr_record->parent->loop->detached) {
+		gt_remove_breakpoint(paddr_record);
+	}
+
+	g_free(paddr_record);
+}
+
+/*
+ * Allocate a shadow page for frame and create a record for it. The record
+ * is not yet mapped, and the shadow view does not yet refer to it; see
+ * gt_clone_page_records() and gt_activate_page_record().
+ */
+static gt_page_record *
+gt_page_record_new (GTLoop *loop, addr_t frame)
+{
+	gt_page_record *page_record = NULL;
+
+	addr_t shadow = gt_allocate_shadow_page(loop);
+	if (0 == shadow) {
+		fprintf(stderr, "failed to allocate shadow page\n");
+		goto done;
+	}
+
+	page_record              = g_new0(gt_page_record, 1);
+	page_record->shadow_page = shadow;
+	page_record->frame       = frame;
+	page_record->loop        = loop;
+	page_record->children    = g_hash_table_new_full(NULL,
+	                                       NULL,
+	                                       NULL,
+	                                       gt_destroy_paddr_record);
+
+done:
+	return page_record;
+}
+
+/*
+ * Map the frame and shadow page of each record into our address space: one
+ * foreign mapping covers the frames of every record, read-only so that no
+ * stray write patches the guest's kernel itself, and another covers their
+ * shadow pages. The records share both mappings for their lifetimes, so
+ * setting and removing breakpoints later requires neither another mapping
+ * nor a libvmi read or write.
+ */
+static bool
+gt_map_page_records (GTLoop *loop, gt_page_record *records[], size_t count)
+{
+	bool status = false;
+	gt_page_map *map = NULL;
+	xen_pfn_t *frames = NULL, *shadows = NULL;
+
+	if (0 == count) {
+		status = true;
+		goto done;
+	}
+
+	frames  = g_new0(xen_pfn_t, count);
+	shadows = g_new0(xen_pfn_t, count);
+	for (size_t i = 0; i < count; i++) {
+		frames[i]  = records[i]->frame;
+		shadows[i] = records[i]->shadow_page;
+	}
+
+	map        = g_new0(gt_page_map, 1);
+	map->count = count;
+
+	map->frames = xc_map_foreign_pages(loop->xch,
+	                                   loop->domid,
+	                                   PROT_READ,
+	                                   frames,
+	                                   count);
+	if (NULL == map->frames) {
+		fprintf(stderr, "failed to map %zu syscall pages\n", count);
+		goto done;
+	}
+
+	_gt_count_hypercall(loop);
+
+	map->shadows = xc_map_foreign_pages(loop->xch,
+	                                    loop->domid,
+	                                    PROT_READ | PROT_WRITE,
+	                                    shadows,
+	                                    count);
+	if (NULL == map->shadows) {
+		fprintf(stderr, "failed to map %zu shadow pages\n", count);
+		munmap(map->frames, count * VF_PAGE_SIZE);
+		goto done;
+	}
+
+	_gt_count_hypercall(loop);
+
+	for (size_t i = 0; i < count; i++) {
+		records[i]->map        = map;
+		records[i]->frame_map  = map->frames  + i * VF_PAGE_SIZE;
+		records[i]->shadow_map = map->shadows + i * VF_PAGE_SIZE;
+	}
+
+	map->refs = count;
+	map       = NULL;
+
+	status = true;
+
+done:
+	g_free(map);
+	g_free(shadows);
+	g_free(frames);
+
+	return status;
+}
+
+/* Map each record as gt_map_page_records() does, and copy each frame to its shadow page. */
+static bool
+gt_clone_page_records (GTLoop *loop, gt_page_record *records[], size_t count)
+{
+	bool status = false;
+
+	if (!gt_map_page_records(loop, records, count)) {
+		goto done;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		fprintf(stderr, "creating new page trap on 0x%lx -> 0x%lx\n",
+		        records[i]->shadow_page, records[i]->frame);
+
+		memcpy(records[i]->shadow_map, records[i]->frame_map, VF_PAGE_SIZE);
+	}
+
+	loop->startup.pages_cloned += count;
+
+	status = true;
+
+done:
+	return status;
+}
+
+/*
+ * Add a cloned page record to the loop's collections, substitute its shadow
+ * page for its frame in the shadow view, and establish a callback on a R/W
+ * of the page.
+ */
+static bool
+gt_activate_page_record (GTLoop *loop, gt_page_record *page_record)
+{
+	bool status = false;
+
+	int xc_status = xc_altp2m_change_gfn(loop->xch,
+	                                     loop->domid,
+	                                     loop->shadow_view,
+	                                     page_record->frame,
+	                                     page_record->shadow_page);
+	if (xc_status < 0) {
+		fprintf(stderr, "failed to update shadow view\n");
+		goto done;
+	}
+
+	_gt_count_hypercall(loop);
+
+	g_hash_table_insert(loop->gt_page_translation,
+	                    GSIZE_TO_POINTER(page_record->frame),
+	                    GSIZE_TO_POINTER(page_record->shadow_page));
+
+	g_hash_table_insert(loop->gt_page_record_collection,
+	                    GSIZE_TO_POINTER(page_record->shadow_page),
+	                    page_record);
+
+	if (VMI_SUCCESS == vmi_set_mem_event(loop->vmi, page_record->frame, VMI_MEMACCESS_RW,
+	                                     loop->shadow_view)) {
+		_gt_count_hypercall(loop);
+	}
+
+	status = true;
+
+done:
+	return status;
+}
+
+/*
+ * Write a breakpoint to the shadow page of page_record at offset, and add a
+ * physical-address record corresponding to the breakpoint to the page
+ * record's collection of children.
+ */
+static struct gt_paddr_record *
+gt_set_breakpoint (gt_page_record *page_record,
+                   addr_t offset,
+                   GTSyscallFunc syscall_cb,
+                   GTSysretFunc sysret_cb,
+                   void *user_data)
+{
+	struct gt_paddr_record *paddr_record;
+
+	paddr_record = g_hash_table_lookup(page_record->children,
+	                                   GSIZE_TO_POINTER(offset));
+	if (NULL != paddr_record) {
+		/* We have a paddr record already; done (no error). */
+		goto done;
+	}
+
+	paddr_record             = g_new0(struct gt_paddr_record, 1);
+	paddr_record->offset     = offset;
+	paddr_record->parent     = page_record;
+	paddr_record->syscall_cb = syscall_cb;
+	paddr_record->sysret_cb  = sysret_cb;
+	paddr_record->data       = user_data;
+
+	page_record->shadow_map[offset] = VF_BREAKPOINT_INST;
+
+	g_hash_table_insert(page_record->children,
+	                    GSIZE_TO_POINTER(offset),
+	                    paddr_record);
+
+done:
+	return paddr_record;
+}
+
+/*
+ * Ensure there exists a memory trap on the shadow page containing each
+ * physical address in pas, and emplace a breakpoint at each address.
+ * Guestrace clones every page not yet shadowed through a single mapping,
+ * and writes its breakpoints before the shadow view refers to it, so that
+ * no VCPU ever runs a new shadow page without them. An address of zero
+ * marks a callback which our caller could not resolve; skip it.
+ *
+ * Returns the number of breakpoints set.
+ */
+static int
+gt_setup_mem_traps (GTLoop *loop,
+                    const GTSyscallCallback callbacks[],
+                    const addr_t pas[],
+                    size_t count)
+{
+	int traps = 0;
+	gint64 start = g_get_monotonic_time();
+	GPtrArray  *new_records = g_ptr_array_new();
+	GHashTable *new_frames  = g_hash_table_new(NULL, NULL);
+
+	/* Create records for the frames which lack a shadow page. */
+	for (size_t i = 0; i < count; i++) {
+		addr_t frame = pas[i] >> VF_PAGE_OFFSET_BITS;
+
+		if (0 == pas[i]
+		 || g_hash_table_contains(loop->gt_page_translation,
+		                          GSIZE_TO_POINTER(frame))
+		 || g_hash_table_contains(new_frames, GSIZE_TO_POINTER(frame))) {
+			continue;
+		}
+
+		gt_page_record *page_record = gt_page_record_new(loop, frame);
+		if (NULL == page_record) {
+			continue;
+		}
+
+		g_ptr_array_add(new_records, page_record);
+		g_hash_table_insert(new_frames,
+		                    GSIZE_TO_POINTER(frame),
+		                    page_record);
+	}
+
+	gt_phase_end(loop, GT_PHASE_SHADOW_ALLOC, start);
+	start = g_get_monotonic_time();
+
+	if (!gt_clone_page_records(loop,
+	                          (gt_page_record **) new_records->pdata,
+	                           new_records->len)) {
+		for (guint i = 0; i < new_records->len; i++) {
+			gt_discard_page_record(new_records->pdata[i]);
+		}
+		goto done;
+	}
+
+	gt_phase_end(loop, GT_PHASE_PAGE_CLONE, start);
+	start = g_get_monotonic_time();
+
+	/* Emplace the breakpoints, in new pages before activating them. */
+	for (size_t i = 0; i < count; i++) {
+		addr_t frame  = pas[i] >> VF_PAGE_OFFSET_BITS;
+		addr_t offset = pas[i] % VF_PAGE_SIZE;
+
+		if (0 == pas[i]) {
+			continue;
+		}
+
+		gt_page_record *page_record;
+		page_record = g_hash_table_lookup(new_frames, GSIZE_TO_POINTER(frame));
+
+		if (NULL == page_record) {
+			addr_t shadow = (addr_t) g_hash_table_lookup(loop->gt_page_translation,
+			                                             GSIZE_TO_POINTER(frame));
+			if (0 == shadow) {
+				continue;
+			}
+
+			page_record = g_hash_table_lookup(loop->gt_page_record_collection,
+			                                  GSIZE_TO_POINTER(shadow));
+		}
+
+		if (NULL != gt_set_breakpoint(page_record,
+		                              offset,
+		                              callbacks[i].syscall_cb,
+		                              callbacks[i].sysret_cb,
+		                              callbacks[i].user_data)) {
+			traps++;
+		}
+	}
+
+	gt_phase_end(loop, GT_PHASE_BREAKPOINTS, start);
+	start = g_get_monotonic_time();
+
+	for (guint i = 0; i < new_records->len; i++) {
+		gt_page_record *page_record = new_records->pdata[i];
+
+		if (!gt_activate_page_record(loop, page_record)) {
+			traps -= g_hash_table_size(page_record->children);
+			gt_discard_page_record(page_record);
+		}
+	}
+
+	loop->startup.breakpoints += traps;
+	gt_phase_end(loop, GT_PHASE_TRAPS, start);
+
+done:
+	g_hash_table_destroy(new_frames);
+	g_ptr_array_free(new_records, TRUE);
+
+	return traps;
+}
+
+/*
+ * Record the callbacks for each physical address in pas without yet
+ * touching the page which contains it. Guestrace instead restricts execution
+ * of the page in the shadow view, and gt_materialize_lazy_page() sets up the
+ * memory trap once the guest first executes the page. Pages which guestrace
+ * already shadows receive their breakpoints immediately.
+ *
+ * Returns the number of callbacks recorded or set.
+ */
+static int
+gt_defer_mem_traps (GTLoop *loop,
+                    const GTSyscallCallback callbacks[],
+                    const addr_t pas[],
+                    size_t count)
+{
+	int traps = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		addr_t frame = pas[i] >> VF_PAGE_OFFSET_BITS;
+
+		if (0 == pas[i]) {
+			continue;
+		}
+
+		if (g_hash_table_contains(loop->gt_page_translation,
+		                          GSIZE_TO_POINTER(frame))) {
+			traps += gt_setup_mem_traps(loop, &callbacks[i], &pas[i], 1);
+			continue;
+		}
+
+		gt_lazy_page *lazy_page = g_hash_table_lookup(loop->gt_lazy_pages,
+		                                              GSIZE_TO_POINTER(frame));
+		if (NULL == lazy_page) {
+			lazy_page            = g_new0(gt_lazy_page, 1);
+			lazy_page->frame     = frame;
+			lazy_page->loop      = loop;
+			lazy_page->callbacks = g_array_new(FALSE, FALSE, sizeof(GTSyscallCallback));
+			lazy_page->pas       = g_array_new(FALSE, FALSE, sizeof(addr_t));
+
+			g_hash_table_insert(loop->gt_lazy_pages,
+			                    GSIZE_TO_POINTER(frame),
+			                    lazy_page);
+
+			/* Establish callback on an execution of this page. */
+			if (VMI_SUCCESS == vmi_set_mem_event(loop->vmi, frame, VMI_MEMACCESS_X,
+			                                     loop->shadow_view)) {
+				_gt_count_hypercall(loop);
+			}
+		}
+
+		g_array_append_val(lazy_page->callbacks, callbacks[i]);
+		g_array_append_val(lazy_page->pas, pas[i]);
+
+		loop->startup.deferred++;
+		traps++;
+	}
+
+	return traps;
+}
+
+/*
+ * Set up the memory trap and breakpoints deferred by gt_defer_mem_traps() on
+ * frame, if any.
+ *
+ * Returns %true if frame had deferred callbacks.
+ */
+static bool
+gt_materialize_lazy_page (GTLoop *loop, addr_t frame)
+{
+	bool status = false;
+	gt_lazy_page *lazy_page;
+
+	lazy_page = g_hash_table_lookup(loop->gt_lazy_pages,
+	                                GSIZE_TO_POINTER(frame));
+	if (NULL == lazy_page) {
+		goto done;
+	}
+
+	g_hash_table_steal(loop->gt_lazy_pages, GSIZE_TO_POINTER(frame));
+
+	/*
+	 * Lift the execute restriction first; if setting up the trap fails,
+	 * the guest must nonetheless continue to run the original page.
+	 */
+	if (VMI_SUCCESS == vmi_set_mem_event(loop->vmi, frame, VMI_MEMACCESS_N, loop->shadow_view)) {
+		_gt_count_hypercall(loop);
+	}
+
+	gt_setup_mem_traps(loop,
+	                  (GTSyscallCallback *) lazy_page->callbacks->data,
+	                  (addr_t *) lazy_page->pas->data,
+	                   lazy_page->pas->len);
+
+	gt_free_lazy_page(lazy_page);
+
+	status = true;
+
+done:
+	return status;
+}
+
+/* Translate the kernel function name to a physical address, or zero. */
+static addr_t
+gt_ksym2p (GTLoop *loop, const char *kernel_func)
+{
+	addr_t pa = 0;
+
+	addr_t va = vmi_translate_ksym2v(loop->vmi, (char *) kernel_func);
+	if (0 == va) {
+		goto done;
+	}
+
+	pa = vmi_translate_kv2p(loop->vmi, va);
+	if (0 == pa) {
+		fprintf(stderr, "virtual addr. translation failed: %lx\n", va);
+		goto done;
+	}
+
+done:
+	return pa;
+}
+
+/**
+ * gt_loop_set_cb:
+ * @loop: a #GTLoop.
+ * @kernel_func: the name of a function in the traced kernel which implements
+ * a system call.
+ * @syscall_cb: a #GTSyscallFunc which will handle the named system call.
+ * @sysret_cb: a #GTSysretFunc which will handle returns from the named
+ * system call.
+ * @user_data: optional data which the guestrace event loop will pass to each call of @syscall_cb
+ *
+ * Sets the callback functions associated with @kernel_func. Each time
+ * processing a system call in the guest kernel calls @kernel_func,
+ * The loop will invoke @syscall_cb with the parameters associated with the
+ * call. When @kernel_func returns, the loop will invoke @sysret_cb.
+ *
+ * Returns: %TRUE on success, %FALSE on failure.
+ **/
+gboolean gt_loop_set_cb(GTLoop *loop,
+                    const char *kernel_func,
+                    GTSyscallFunc syscall_cb,
+                    GTSysretFunc sysret_cb,
+                    void *user_data)
+{
+	GTSyscallCallback callback = {
+		.name       = (char *) kernel_func,
+		.syscall_cb = syscall_cb,
+		.sysret_cb  = sysret_cb,
+		.user_data  = user_data,
+	};
+
+	return gt_loop_set_cbs(loop, (GTSyscallCallback[]) { callback, { NULL } }) == 1;
+}
+
+/**
+ * gt_loop_set_cbs:
+ * @loop: a #GTLoop.
+ * @syscalls: an array of #GTSyscallCallback values, where each contains a
+ * function name and corresponding #GTSyscallFunc and #GTSysretFunc.
+ *
+ * Sets the callback functions for each callback defined in @syscalls, as
+ * gt_loop_set_cb() would. The @syscalls array must be terminated with
+ * an #GTSyscallCallback with each field set to NULL. Setting many callbacks
+ * at once is faster than repeatedly invoking gt_loop_set_cb(), because the
+ * guestrace event loop clones the kernel pages involved in a single batch.
+ * If @loop is in lazy mode, this instead records the callbacks; see
+ * gt_loop_set_lazy().
+ *
+ * Returns: the number of callbacks set.
+ **/
+int
+gt_loop_set_cbs(GTLoop *loop, const GTSyscallCallback callbacks[])
+{
+	int count = 0;
+	size_t total = 0;
+	addr_t *pas;
+	gint64 start;
+
+	while (callbacks[total].name) {
+		total++;
+	}
+
+	pas = g_new0(addr_t, total);
+
+	if (VMI_SUCCESS == vmi_pause_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
+
+	start = g_get_monotonic_time();
+
+	for (size_t i = 0; !gt_interrupted && i < total; i++) {
+		pas[i] = gt_ksym2p(loop, callbacks[i].name);
+		if (0 == pas[i]) {
+			loop->startup.symbols_missing++;
+		} else {
+			loop->startup.symbols++;
+		}
+	}
+
+	gt_phase_end(loop, GT_PHASE_SYMBOLS, start);
+
+	if (gt_interrupted) {
+		/* Nothing to do. */
+	} else if (loop->lazy) {
+		count = gt_defer_mem_traps(loop, callbacks, pas, total);
 	} else {
-		fprintf(stderr,
-		       "failed to increase memory size on guest to %lx\n",
-		        proposed_mem_size);
+		count = gt_setup_mem_traps(loop, callbacks, pas, total);
+	}
+
+	if (VMI_SUCCESS == vmi_resume_vm(loop->vmi)) {
+		_gt_count_hypercall(loop);
+	}
+
+	g_free(pas);
+
+	return count;
+}
+
+/* Path of the file which describes the shadow view of a detached guestrace. */
+static char *
+gt_state_path (GTLoop *loop)
+{
+	return g_strdup_printf("%s/%u.state", GT_STATE_DIR, loop->domid);
+}
+
+/*
+ * Save the shadow view, its pages, and their breakpoints for adoption by
+ * the next guestrace; see gt_loop_set_detach().
+ */
+static bool
+gt_save_state (GTLoop *loop)
+{
+	bool status = false;
+	GError *error = NULL;
+	GHashTableIter iter;
+	gpointer value;
+	char *path = gt_state_path(loop);
+	GByteArray *state = g_byte_array_new();
+	struct gt_state_header header = {
+		.magic         = GT_STATE_MAGIC,
+		.version       = GT_STATE_VERSION,
+		.domid         = loop->domid,
+		.shadow_view   = loop->shadow_view,
+		.page_count    = g_hash_table_size(loop->gt_page_record_collection),
+	};
+
+	if (VMI_SUCCESS != vmi_get_vcpureg(loop->vmi, &header.lstar, MSR_LSTAR, 0)) {
+		fprintf(stderr, "failed to get MSR_LSTAR address\n");
 		goto done;
 	}
 
-	status = xc_domain_increase_reservation_exact(loop->xch, loop->domid,
-	                                              1, 0, 0, &gfn);
+	_gt_count_hypercall(loop);
+
+	g_byte_array_append(state, (guint8 *) &header, sizeof header);
+
+	g_hash_table_iter_init(&iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&iter, NULL, &value)) {
+		gt_page_record *page_record = value;
+		gpointer offset;
+		GHashTableIter child_iter;
+		struct gt_state_page page = {
+			.frame            = page_record->frame,
+			.shadow_page      = page_record->shadow_page,
+			.breakpoint_count = g_hash_table_size(page_record->children),
+		};
+
+		g_byte_array_append(state, (guint8 *) &page, sizeof page);
+
+		g_hash_table_iter_init(&child_iter, page_record->children);
+		while (g_hash_table_iter_next(&child_iter, &offset, NULL)) {
+			uint64_t off = GPOINTER_TO_SIZE(offset);
+			g_byte_array_append(state, (guint8 *) &off, sizeof off);
+		}
+	}
 
-	if (status) {
-		fprintf(stderr, "failed to increase reservation on guest");
+	if (0 != g_mkdir_with_parents(GT_STATE_DIR, 0700)
+	 || !g_file_set_contents(path, (char *) state->data, state->len, &error)) {
+		fprintf(stderr, "failed to save state to %s: %s\n",
+		        path, error ? error->message : "cannot create directory");
+		g_clear_error(&error);
 		goto done;
 	}
 
-	status = xc_domain_populate_physmap_exact(loop->xch, loop->domid, 1, 0,
-	                                          0, &gfn);
+	fprintf(stderr, "saved state of shadow view %u to %s\n",
+	        loop->shadow_view, path);
+
+	status = true;
+
+done:
+	g_byte_array_free(state, TRUE);
+	g_free(path);
+
+	return status;
+}
+
+/*
+ * Ensure the shadow page of an adopted record is a copy of its frame, save
+ * for the breakpoints in the record.
+ */
+static bool
+gt_adopted_page_matches (gt_page_record *page_record)
+{
+	uint8_t expected[VF_PAGE_SIZE];
+
+	memcpy(expected, page_record->frame_map, VF_PAGE_SIZE);
+
+	for (guint i = 0; i < page_record->adopted->len; i++) {
+		expected[g_array_index(page_record->adopted, uint64_t, i)]
+			= VF_BREAKPOINT_INST;
+	}
+
+	return 0 == memcmp(expected, page_record->shadow_map, VF_PAGE_SIZE);
+}
+
+/*
+ * Free the shadow view described by a state file which guestrace cannot
+ * adopt, but which belongs to our guest. Its shadow pages are orphans,
+ * which gt_reclaim_orphans() frees.
+ */
+static void
+gt_release_state (GTLoop *loop,
+                  struct gt_state_header *header,
+                  gt_page_record *records[],
+                  size_t count)
+{
+	if (0 == xc_altp2m_switch_to_view(loop->xch, loop->domid, 0)) {
+		_gt_count_hypercall(loop);
+	}
+
+	if (0 == xc_altp2m_destroy_view(loop->xch, loop->domid, header->shadow_view)) {
+		_gt_count_hypercall(loop);
+	}
 
-	if (status) {
-		fprintf(stderr, "failed to populate GFN at 0x%lx\n", gfn);
-		gfn = 0;
-		goto done;
+	if (header->shadow_view == loop->orphan_view) {
+		loop->orphan_view = 0;
 	}
 
-done:
-	return gfn;
+	for (size_t i = 0; i < count; i++) {
+		g_hash_table_add(loop->orphan_frames,
+		                 GSIZE_TO_POINTER(records[i]->shadow_page));
+	}
 }
 
 /*
- * Remove the breakpoint associated with paddr_record.
+ * Adopt the shadow view left by a detached guestrace, if any; see
+ * gt_loop_set_detach(). Discard the state if it does not describe the
+ * running guest, or if the ledger does not list its view and shadow pages.
+ *
+ * Returns %true if the loop adopted a shadow view.
  */
-static status_t
-gt_remove_breakpoint(struct gt_paddr_record *paddr_record) {
-	uint8_t curr_inst;
-	status_t status    = VMI_FAILURE;
-	addr_t shadow_page = paddr_record->parent->shadow_page;
-	addr_t frame       = paddr_record->parent->frame;
-	addr_t offset      = paddr_record->offset;
-
-	status = vmi_read_8_pa(paddr_record->parent->loop->vmi,
-	                      (frame << VF_PAGE_OFFSET_BITS) + offset,
-	                      &curr_inst);
-	if (VMI_SUCCESS != status) {
+static bool
+gt_adopt_state (GTLoop *loop)
+{
+	bool status = false;
+	char *state = NULL;
+	gsize len = 0, off;
+	addr_t lstar = 0;
+	bool altp2m = false;
+	char *path = gt_state_path(loop);
+	struct gt_state_header *header;
+	GPtrArray *records = g_ptr_array_new();
+
+	if (!g_file_get_contents(path, &state, &len, NULL)) {
 		goto done;
 	}
 
-	status = vmi_write_8_pa(paddr_record->parent->loop->vmi,
-	                       (shadow_page << VF_PAGE_OFFSET_BITS) + offset,
-	                       &curr_inst);
+	header = (struct gt_state_header *) state;
+	if (len < sizeof *header
+	 || GT_STATE_MAGIC != header->magic
+	 || GT_STATE_VERSION != header->version) {
+		fprintf(stderr, "ignoring invalid state in %s\n", path);
+		goto discard;
+	}
+
+	if (header->domid != loop->domid) {
+		/* The shadow pages departed along with the old domain. */
+		goto discard;
+	}
+
+	/*
+	 * Trust only a view and pages which the ledger vouches for, lest
+	 * gt_release_state() destroy another view or free the guest's own
+	 * frames.
+	 */
+	if (header->shadow_view != loop->orphan_view) {
+		fprintf(stderr, "ignoring state in %s not in ledger\n", path);
+		goto discard;
+	}
+
+	off = sizeof *header;
+	for (uint64_t i = 0; i < header->page_count; i++) {
+		struct gt_state_page *page = (struct gt_state_page *) (state + off);
+
+		if (len < off + sizeof *page
+		 || page->breakpoint_count > (len - off - sizeof *page) / sizeof(uint64_t)) {
+			fprintf(stderr, "ignoring truncated state in %s\n", path);
+			goto discard;
+		}
+
+		uint64_t *offsets = (uint64_t *) (page + 1);
+
+		if (!g_hash_table_contains(loop->orphan_frames,
+		                           GSIZE_TO_POINTER(page->shadow_page))) {
+			fprintf(stderr, "ignoring state in %s not in ledger\n", path);
+			goto discard;
+		}
+
+		gt_page_record *page_record = g_new0(gt_page_record, 1);
+		page_record->frame          = page->frame;
+		page_record->shadow_page    = page->shadow_page;
+		page_record->loop           = loop;
+		page_record->adopted        = g_array_new(FALSE, FALSE, sizeof(uint64_t));
+		page_record->children       = g_hash_table_new_full(NULL,
+		                                       NULL,
+		                                       NULL,
+		                                       gt_destroy_paddr_record);
+
+		for (uint64_t j = 0; j < page->breakpoint_count; j++) {
+			if (offsets[j] < VF_PAGE_SIZE) {
+				g_array_append_val(page_record->adopted, offsets[j]);
+			}
+		}
+
+		g_ptr_array_add(records, page_record);
+
+		off += sizeof *page + page->breakpoint_count * sizeof(uint64_t);
+	}
+
+	if (VMI_SUCCESS != vmi_get_vcpureg(loop->vmi, &lstar, MSR_LSTAR, 0)) {
+		fprintf(stderr, "failed to get MSR_LSTAR address\n");
+		goto release;
+	}
+
+	_gt_count_hypercall(loop);
+
+	if (0 != xc_altp2m_get_domain_state(loop->xch, loop->domid, &altp2m)) {
+		fprintf(stderr, "failed to get altp2m state of guest\n");
+		goto release;
+	}
+
+	_gt_count_hypercall(loop);
+
+	if (lstar != header->lstar
+	 || !altp2m
+	 || !gt_map_page_records(loop,
+	                        (gt_page_record **) records->pdata,
+	                         records->len)) {
+		fprintf(stderr, "guest no longer matches state in %s\n", path);
+		goto release;
+	}
+
+	for (guint i = 0; i < records->len; i++) {
+		if (!gt_adopted_page_matches(records->pdata[i])) {
+			fprintf(stderr, "guest kernel no longer matches state in %s\n", path);
+			goto release;
+		}
+	}
+
+	loop->shadow_view = header->shadow_view;
+
+	for (guint i = 0; i < records->len; i++) {
+		gt_page_record *page_record = records->pdata[i];
+
+		g_hash_table_insert(loop->gt_page_translation,
+		                    GSIZE_TO_POINTER(page_record->frame),
+		                    GSIZE_TO_POINTER(page_record->shadow_page));
+
+		g_hash_table_insert(loop->gt_page_record_collection,
+		                    GSIZE_TO_POINTER(page_record->shadow_page),
+		                    page_record);
+
+		if (VMI_SUCCESS == vmi_set_mem_event(loop->vmi, page_record->frame, VMI_MEMACCESS_RW,
+		                                     loop->shadow_view)) {
+			_gt_count_hypercall(loop);
+		}
+	}
+
+	loop->startup.pages_adopted = records->len;
+
+	g_ptr_array_set_size(records, 0);
+
+	status = true;
+	goto discard;
+
+release:
+	gt_release_state(loop,
+	                 header,
+	                (gt_page_record **) records->pdata,
+	                 records->len);
+
+discard:
+	/* We own the described pages now, or nobody does; forget them. */
+	unlink(path);
 
 done:
+	for (guint i = 0; i < records->len; i++) {
+		gt_page_record *page_record = records->pdata[i];
+
+		gt_unmap_page_record(page_record);
+		g_hash_table_destroy(page_record->children);
+		g_array_free(page_record->adopted, TRUE);
+		g_free(page_record);
+	}
+
+	g_ptr_array_free(records, TRUE);
+	g_free(state);
+	g_free(path);
+
 	return status;
 }
 
+/*
+ * Remove each adopted breakpoint for which this guestrace received no
+ * callback, and release each adopted page which no longer contains a
+ * breakpoint.
+ */
 static void
-gt_destroy_paddr_record (gpointer data) {
-	struct gt_paddr_record *paddr_record = data;
+gt_scrub_adopted_breakpoints (GTLoop *loop)
+{
+	GHashTableIter iter;
+	gpointer value;
 
-	fprintf(stderr,
-	       "destroying paddr record at shadow physical address %lx\n",
-	       (paddr_record->parent->shadow_page << VF_PAGE_OFFSET_BITS)
-	      + paddr_record->offset);
+	g_hash_table_iter_init(&iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&iter, NULL, &value)) {
+		gt_page_record *page_record = value;
+
+		if (NULL == page_record->adopted) {
+			continue;
+		}
 
-	gt_remove_breakpoint(paddr_record);
+		for (guint i = 0; i < page_record->adopted->len; i++) {
+			uint64_t offset = g_array_index(page_record->adopted, uint64_t, i);
 
-	g_free(paddr_record);
+			if (!g_hash_table_contains(page_record->children,
+			                           GSIZE_TO_POINTER(offset))) {
+				page_record->shadow_map[offset]
+					= page_record->frame_map[offset];
+			}
+		}
+
+		g_array_free(page_record->adopted, TRUE);
+		page_record->adopted = NULL;
+
+		if (0 == g_hash_table_size(page_record->children)) {
+			g_hash_table_remove(loop->gt_page_translation,
+			                    GSIZE_TO_POINTER(page_record->frame));
+			g_hash_table_iter_remove(&iter);
+		}
+	}
+}
+
+/* Path of the ledger of the frames guestrace adds to the guest. */
+static char *
+gt_ledger_path (GTLoop *loop)
+{
+	return g_strdup_printf("%s/%u.frames", GT_STATE_DIR, loop->domid);
 }
 
 /*
- * Ensure there exists a memory trap on the shadow page containing virtual
- * address va, and create a page record if it does not yet exist. Add a
- * physical-address record corresponding to va to the page record's collection
- * of children.
+ * Note the guest's maximum memory before guestrace raised it. If the ledger
+ * of an earlier guestrace remains, then that guestrace either detached or
+ * crashed. Take the guest's original maximum memory from the ledger, and
+ * note the frames and shadow view it lists as orphans. gt_adopt_state()
+ * might claim them; gt_reclaim_orphans() frees the rest.
  */
-static struct gt_paddr_record *
-gt_setup_mem_trap (GTLoop *loop,
-                   addr_t va,
-                   GTSyscallFunc syscall_cb,
-                   GTSysretFunc sysret_cb,
-                   void *user_data)
+static bool
+gt_recover_ledger (GTLoop *loop)
 {
-	size_t ret;
-	status_t status;
-	gt_page_record  *page_record  = NULL;
-	struct gt_paddr_record *paddr_record = NULL;
+	bool status = false;
+	char *ledger = NULL;
+	gsize len = 0;
+	char *path = gt_ledger_path(loop);
+	struct gt_ledger_header *header;
+	xc_dominfo_t info;
+
+	if (1 != xc_domain_getinfo(loop->xch, loop->domid, 1, &info)
+	 || info.domid != loop->domid) {
+		fprintf(stderr, "failed to get guest memory size\n");
+		goto done;
+	}
 
-	addr_t pa = vmi_translate_kv2p(loop->vmi, va);
-	if (0 == pa) {
-		fprintf(stderr, "virtual addr. translation failed: %lx\n", va);
+	_gt_count_hypercall(loop);
+
+	/* Only now may gt_close_ledger() restore the guest's memory. */
+	loop->init_max_memkb = info.max_memkb;
+	loop->shadow_frames  = g_hash_table_new(NULL, NULL);
+	loop->orphan_frames  = g_hash_table_new(NULL, NULL);
+
+	status = true;
+
+	if (!g_file_get_contents(path, &ledger, &len, NULL)) {
 		goto done;
 	}
 
-	addr_t frame = pa >> VF_PAGE_OFFSET_BITS;
-	addr_t shadow = (addr_t) g_hash_table_lookup(loop->gt_page_translation,
-		                                     GSIZE_TO_POINTER(frame));
-	addr_t shadow_offset = pa % VF_PAGE_SIZE;
+	header = (struct gt_ledger_header *) ledger;
+	if (len < sizeof *header
+	 || GT_LEDGER_MAGIC != header->magic
+	 || GT_LEDGER_VERSION != header->version) {
+		fprintf(stderr, "ignoring invalid ledger in %s\n", path);
+		goto done;
+	}
 
-	if (0 == shadow) {
-		/* Record does not exist; allocate new page and create record. */
-		shadow = gt_allocate_shadow_page(loop);
-		if (0 == shadow) {
-			fprintf(stderr, "failed to allocate shadow page\n");
-			goto done;
-		}
+	if (header->domid != loop->domid) {
+		/* The frames departed along with the old domain. */
+		goto done;
+	}
 
-		g_hash_table_insert(loop->gt_page_translation,
-		                    GSIZE_TO_POINTER(frame),
-		                    GSIZE_TO_POINTER(shadow));
-
-		/* Activate in shadow view. */
-		int xc_status = xc_altp2m_change_gfn(loop->xch,
-		                                     loop->domid,
-		                                     loop->shadow_view,
-		                                     frame,
-		                                     shadow);
-		if (xc_status < 0) {
-			fprintf(stderr, "failed to update shadow view\n");
-			goto done;
+	loop->init_max_memkb = header->init_max_memkb;
+	loop->orphan_view    = header->shadow_view;
+
+	for (gsize off = sizeof *header; off + sizeof(uint64_t) <= len; off += sizeof(uint64_t)) {
+		uint64_t entry;
+
+		memcpy(&entry, ledger + off, sizeof entry);
+
+		if (entry & GT_LEDGER_RELEASED) {
+			g_hash_table_remove(loop->orphan_frames,
+			                    GSIZE_TO_POINTER(entry & ~GT_LEDGER_RELEASED));
+		} else {
+			g_hash_table_add(loop->orphan_frames, GSIZE_TO_POINTER(entry));
 		}
 	}
 
-	page_record = g_hash_table_lookup(loop->gt_page_record_collection,
-	                                  GSIZE_TO_POINTER(shadow));
-	if (NULL == page_record) {
-		/* No record for this page yet; create one. */
-		fprintf(stderr, "creating new page trap on 0x%lx -> 0x%lx\n",
-		        shadow, frame);
-
-		/* Copy page to shadow. */
-		uint8_t buff[VF_PAGE_SIZE] = {0};
-		ret = vmi_read_pa(loop->vmi,
-		                  frame << VF_PAGE_OFFSET_BITS,
-		                  buff,
-		                  VF_PAGE_SIZE);
-		if (VF_PAGE_SIZE != ret) {
-			fprintf(stderr, "failed to read in syscall page\n");
-			goto done;
-		}
+done:
+	g_free(ledger);
+	g_free(path);
 
-		ret = vmi_write_pa(loop->vmi,
-		                   shadow << VF_PAGE_OFFSET_BITS,
-		                   buff,
-		                   VF_PAGE_SIZE);
-		if (VF_PAGE_SIZE != ret) {
-			fprintf(stderr, "failed to write to shadow page\n");
-			goto done;
-		}
+	return status;
+}
 
-		/* Initialize record of this page. */
-		page_record              = g_new0(gt_page_record, 1);
-		page_record->shadow_page = shadow;
-		page_record->frame       = frame;
-		page_record->loop        = loop;
-		page_record->children    = g_hash_table_new_full(NULL,
-		                                       NULL,
-		                                       NULL,
-		                                       gt_destroy_paddr_record);
+/*
+ * Take ownership of the adopted shadow pages, if any, and free the shadow
+ * view and frames left by an earlier guestrace which nobody now uses.
+ */
+static void
+gt_reclaim_orphans (GTLoop *loop, bool adopted)
+{
+	GHashTableIter iter;
+	gpointer key;
+	guint count = 0;
+
+	g_hash_table_iter_init(&iter, loop->gt_page_record_collection);
+	while (g_hash_table_iter_next(&iter, &key, NULL)) {
+		g_hash_table_remove(loop->orphan_frames, key);
+		g_hash_table_add(loop->shadow_frames, key);
+	}
 
-		g_hash_table_insert(loop->gt_page_record_collection,
-		                    GSIZE_TO_POINTER(shadow),
-		                    page_record);
+	if (0 != loop->orphan_view
+	 && (!adopted || loop->orphan_view != loop->shadow_view)) {
+		if (0 == xc_altp2m_switch_to_view(loop->xch, loop->domid, 0)) {
+			_gt_count_hypercall(loop);
+		}
 
-		/* Establish callback on a R/W of this page. */
-		vmi_set_mem_event(loop->vmi, frame, VMI_MEMACCESS_RW,
-		                  loop->shadow_view);
-	} else {
-		/* We already have a page record for this page in collection. */
-		paddr_record = g_hash_table_lookup(page_record->children,
-		                                GSIZE_TO_POINTER(shadow_offset));
-		if (NULL != paddr_record) {
-			/* We have a paddr record too; done (no error). */
-			goto done;
+		if (0 == xc_altp2m_destroy_view(loop->xch, loop->domid, loop->orphan_view)) {
+			_gt_count_hypercall(loop);
 		}
 	}
 
-	/* Create physical-address record and add to page record. */
-	paddr_record             = g_new0(struct gt_paddr_record, 1);
-	paddr_record->offset     = shadow_offset;
-	paddr_record->parent     = page_record;
-	paddr_record->syscall_cb = syscall_cb;
-	paddr_record->sysret_cb  = sysret_cb;
-	paddr_record->data       = user_data;
+	g_hash_table_iter_init(&iter, loop->orphan_frames);
+	while (g_hash_table_iter_next(&iter, &key, NULL)) {
+		xen_pfn_t gfn = GPOINTER_TO_SIZE(key);
 
-	/* Write interrupt to our shadow page at the correct location. */
-	status = vmi_write_8_pa(loop->vmi,
-	                       (shadow << VF_PAGE_OFFSET_BITS) + shadow_offset,
-	                       &VF_BREAKPOINT_INST);
-	if (VMI_SUCCESS != status) {
-		fprintf(stderr, "failed to write interrupt to shadow page\n");
-		goto done;
+		if (0 == xc_domain_decrease_reservation_exact(loop->xch, loop->domid,
+		                                              1, 0, &gfn)) {
+			_gt_count_hypercall(loop);
+			count++;
+		}
 	}
 
-	g_hash_table_insert(page_record->children,
-	                    GSIZE_TO_POINTER(shadow_offset),
-	                    paddr_record);
+	if (0 < count) {
+		fprintf(stderr, "reclaimed %u orphaned shadow pages\n", count);
+	}
 
-done:
-	/* TODO: Should undo loop (e.g., remove from hash tables) on error */
-	return paddr_record;
+	g_hash_table_destroy(loop->orphan_frames);
+	loop->orphan_frames = NULL;
 }
 
-/**
- * gt_loop_set_cb:
- * @loop: a #GTLoop.
- * @kernel_func: the name of a function in the traced kernel which implements
- * a system call.
- * @syscall_cb: a #GTSyscallFunc which will handle the named system call.
- * @sysret_cb: a #GTSysretFunc which will handle returns from the named
- * system call.
- * @user_data: optional data which the guestrace event loop will pass to each call of @syscall_cb
- *
- * Sets the callback functions associated with @kernel_func. Each time
- * processing a system call in the guest kernel calls @kernel_func,
- * The loop will invoke @syscall_cb with the parameters associated with the
- * call. When @kernel_func returns, the loop will invoke @sysret_cb.
- *
- * Returns: %TRUE on success, %FALSE on failure.
- **/
-gboolean gt_loop_set_cb(GTLoop *loop,
-                    const char *kernel_func,
-                    GTSyscallFunc syscall_cb,
-                    GTSysretFunc sysret_cb,
-                    void *user_data)
+/*
+ * Start a new ledger listing the frames guestrace now holds, and set the
+ * guest's maximum memory to account for exactly those frames.
+ */
+static bool
+gt_open_ledger (GTLoop *loop)
 {
-	gboolean fnval = FALSE;
+	bool status = false;
+	GError *error = NULL;
+	GHashTableIter iter;
+	gpointer key;
+	xen_pfn_t max_gpfn = 0;
+	char *path = gt_ledger_path(loop);
+	GByteArray *ledger = g_byte_array_new();
+	struct gt_ledger_header header = {
+		.magic          = GT_LEDGER_MAGIC,
+		.version        = GT_LEDGER_VERSION,
+		.domid          = loop->domid,
+		.shadow_view    = loop->shadow_view,
+		.init_max_memkb = loop->init_max_memkb,
+	};
+
+	g_byte_array_append(ledger, (guint8 *) &header, sizeof header);
+
+	g_hash_table_iter_init(&iter, loop->shadow_frames);
+	while (g_hash_table_iter_next(&iter, &key, NULL)) {
+		uint64_t gfn = GPOINTER_TO_SIZE(key);
+		g_byte_array_append(ledger, (guint8 *) &gfn, sizeof gfn);
+	}
 
-	addr_t sysaddr;
-	struct gt_paddr_record *syscall_trap;
+	if (0 != g_mkdir_with_parents(GT_STATE_DIR, 0700)
+	 || !g_file_set_contents(path, (char *) ledger->data, ledger->len, &error)) {
+		fprintf(stderr, "failed to create ledger %s: %s\n",
+		        path, error ? error->message : "cannot create directory");
+		g_clear_error(&error);
+		goto done;
+	}
 
-	vmi_pause_vm(loop->vmi);
+	loop->ledger_fd = open(path, O_WRONLY | O_APPEND | O_CLOEXEC);
+	if (-1 == loop->ledger_fd) {
+		fprintf(stderr, "failed to open ledger %s\n", path);
+		goto done;
+	}
 
-	sysaddr = vmi_translate_ksym2v(loop->vmi, kernel_func);
-	if (0 == sysaddr) {
+	if (0 != xc_domain_setmaxmem(loop->xch, loop->domid,
+	                             gt_max_memkb(loop, g_hash_table_size(loop->shadow_frames)))) {
+		fprintf(stderr, "failed to reset memory size on guest\n");
 		goto done;
 	}
 
-	syscall_trap = gt_setup_mem_trap(loop, sysaddr, syscall_cb, sysret_cb, user_data);
-	if (NULL == syscall_trap) {
+	_gt_count_hypercall(loop);
+
+	if (0 != xc_domain_maximum_gpfn(loop->xch, loop->domid, &max_gpfn)) {
+		fprintf(stderr, "failed to get maximum GFN of guest\n");
 		goto done;
 	}
 
-	fnval = TRUE;
+	_gt_count_hypercall(loop);
+
+	loop->next_shadow_gfn = max_gpfn + 1;
+
+	status = true;
 
 done:
-	vmi_resume_vm(loop->vmi);
+	g_byte_array_free(ledger, TRUE);
+	g_free(path);
 
-	return fnval;
+	return status;
 }
 
-/**
- * gt_loop_set_cbs:
- * @loop: a #GTLoop.
- * @syscalls: an array of #GTSyscallCallback values, where each contains a
- * function name and corresponding #GTSyscallFunc and #GTSysretFunc.
- *
- * A convenience function which repeatedly invoke gt_loop_set_cb for each
- * callback defined in @syscalls. The @syscalls array must be terminated with
- * an #GTSyscallCallback with each field set to NULL.
- *
- * Returns: %TRUE on success, %FALSE on failure.
- **/
-int
-gt_loop_set_cbs(GTLoop *loop, const GTSyscallCallback callbacks[])
+/*
+ * Unless detached, release every frame guestrace still holds, restore the
+ * guest's original maximum memory, and remove the ledger.
+ */
+static void
+gt_close_ledger (GTLoop *loop)
 {
-	int count = 0;
+	if (NULL == loop->shadow_frames) {
+		/* We never took charge of the guest's memory. */
+		return;
+	}
 
-	for (int i = 0; !gt_interrupted && callbacks[i].name; i++) {
-		gboolean ok = gt_loop_set_cb(loop,
-		                             callbacks[i].name,
-		                             callbacks[i].syscall_cb,
-		                             callbacks[i].sysret_cb,
-		                             callbacks[i].user_data);
-		if (ok) {
-			count++;
+	if (!loop->detached) {
+		GList *frames = g_hash_table_get_keys(loop->shadow_frames);
+
+		for (GList *node = frames; NULL != node; node = node->next) {
+			gt_release_shadow_page(loop, GPOINTER_TO_SIZE(node->data));
+		}
+
+		g_list_free(frames);
+
+		if (0 != loop->shadow_view
+		 && 0 == xc_altp2m_destroy_view(loop->xch, loop->domid, loop->shadow_view)) {
+			_gt_count_hypercall(loop);
+		}
+
+		if (loop->altp2m_owned
+		 && 0 == xc_altp2m_set_domain_state(loop->xch, loop->domid, 0)) {
+			_gt_count_hypercall(loop);
+		}
+
+		if (0 != xc_domain_setmaxmem(loop->xch, loop->domid, loop->init_max_memkb)) {
+			fprintf(stderr, "failed to restore memory size on guest\n");
+		} else {
+			_gt_count_hypercall(loop);
+
+			if (0 == g_hash_table_size(loop->shadow_frames)) {
+				char *path = gt_ledger_path(loop);
+				unlink(path);
+				g_free(path);
+			}
 		}
 	}
 
-	return count;
+	if (-1 != loop->ledger_fd) {
+		close(loop->ledger_fd);
+		loop->ledger_fd = -1;
+	}
+
+	if (NULL != loop->orphan_frames) {
+		g_hash_table_destroy(loop->orphan_frames);
+	}
+
+	g_hash_table_destroy(loop->shadow_frames);
+	loop->shadow_frames = NULL;
+}
+
+/*
+ * Return the kernel's GS base, which points to the per-CPU area on Linux and
+ * to the KPCR on Windows. Whether or not the kernel has yet swapped GS upon
+ * entry, one of the two bases lies in the upper, kernel half of memory.
+ */
+addr_t
+_gt_kernel_gs_base(vmi_event_t *event)
+{
+	x86_registers_t *regs = event->x86_regs;
+
+	return 0 != (regs->gs_base >> 63) ? regs->gs_base : regs->shadow_gs;
+}
+
+/*
+ * Find the address space through which to read vaddr in the process pid,
+ * as the frame cache keys it. Every process shares the kernel's upper half,
+ * so kernel addresses share one key; the current process's space is the
+ * event's CR3.
+ */
+static bool
+gt_read_dtb(GTLoop *loop, vmi_event_t *event, addr_t vaddr, vmi_pid_t pid, addr_t *dtb)
+{
+	if (0 == pid || (8 == loop->return_address_width && 0 != (vaddr >> 63))) {
+		*dtb = GT_FRAME_KERNEL_DTB;
+		return true;
+	}
+
+	if (NULL != event && NULL != loop->event_task && pid == loop->event_task->pid) {
+		*dtb = event->x86_regs->cr3;
+	} else {
+		*dtb = vmi_pid_to_dtb(loop->vmi, pid);
+	}
+
+	return GT_FRAME_KERNEL_DTB != *dtb;
+}
+
+/*
+ * Read count bytes at vaddr in the process pid, or in the kernel if pid is
+ * 0, into buf, as vmi_read_va() does, but through the frame cache. Should
+ * the cache fail to map a page, fall back to libvmi for the rest. The event
+ * may be NULL if the read has nothing to do with the current process.
+ */
+size_t
+_gt_read_va(GTLoop *loop, vmi_event_t *event, addr_t vaddr, vmi_pid_t pid, void *buf, size_t count)
+{
+	size_t size = 0;
+	addr_t dtb;
+
+	if (NULL != loop->frames && gt_read_dtb(loop, event, vaddr, pid, &dtb)) {
+		size = gt_frame_cache_read(loop->frames, dtb, vaddr, buf, count);
+	}
+
+	if (size < count) {
+		size += vmi_read_va(loop->vmi, vaddr + size, pid, (uint8_t *) buf + size, count - size);
+	}
+
+	return size;
 }
 
 /*
@@ -1,10 +1,45 @@
 #ifndef TRACE_SYSCALLS_H
 #define TRACE_SYSCALLS_H
 
+/* Long enough for a Linux comm or a Windows ImageFileName. */
+#define GT_PROCESS_NAME_MAX 16
+
+/* An entry in the process cache; see gt_guest_get_process_name(). */
+typedef struct gt_process {
+	vmi_pid_t pid;
+	addr_t    addr; /* Of the task_struct or EPROCESS. */
+	char      name[GT_PROCESS_NAME_MAX];
+} gt_process;
+
 /* Operating-system-specific operations. */
 struct os_functions {
 	/* <private> */
         addr_t (*find_return_point_addr) (GTLoop *loop);
+
+	/* Find the process with the given ID by walking the process list. */
+	bool   (*find_process) (GTLoop *loop, vmi_pid_t pid, gt_process *process);
+
+	/* Read the ID and name of the process at the given address. */
+	bool   (*read_process) (GTLoop *loop, addr_t addr, gt_process *process);
+
+	/*
+	 * Fill in loop->task_layout, or return false if the guest offers no
+	 * constant-time way to find the current task. May be NULL.
+	 */
+	bool   (*init_task_layout) (GTLoop *loop);
+
+	/* Find the address of the task running on the event's VCPU. */
+	bool   (*find_current_task) (GTLoop *loop, vmi_event_t *event, addr_t *addr);
+
+	/* Read the IDs and name of the task at the given address. */
+	bool   (*read_task) (GTLoop *loop, addr_t addr, GTTask *task);
+
+	/* Read the first count arguments of the system call at its entry. */
+	void   (*get_args) (GTLoop *loop,
+	                    vmi_event_t *event,
+	                    vmi_pid_t pid,
+	                    uint64_t *args,
+	                    int count);
 };
 
 addr_t _gt_find_addr_after_instruction(GTLoop *loop,
@@ -12,4 +47,15 @@ addr_t _gt_find_addr_after_instruction(GTLoop *loop,
                                       char *mnemonic,
                                       char *ops);
 
+addr_t _gt_kernel_gs_base(vmi_event_t *event);
+
+void _gt_count_hypercall(GTLoop *loop);
+
+size_t _gt_read_va(GTLoop *loop,
+                   vmi_event_t *event,
+                   addr_t vaddr,
+                   vmi_pid_t pid,
+                   void *buf,
+                   size_t count);
+
 #endif
@@ -0,0 +1,795 @@
+#include <errno.h>
+#include <glib.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "trace-chunk.h"
+#include "trace-format.h"
+#include "trace-index.h"
+#include "trace-ring.h"
+#include "trace-shm.h"
+#include "trace-writer.h"
+
+/* Alignment of the buffer from which the writer writes a binary trace. */
+#define GT_TRACE_WRITE_ALIGN 4096
+
+static const char *GT_TRACE_FORMAT_NAMES[] = {
+	[GT_TRACE_TEXT]   = "text",
+	[GT_TRACE_BINARY] = "binary",
+	[GT_TRACE_NONE]   = "none",
+};
+
+/* A finished file of a rotating writer, which it may yet delete. */
+typedef struct gt_trace_file {
+	char     *path;
+	char     *index_path;     /* NULL if the file has no sidecar. */
+	uint64_t  size;           /* Of the file and its sidecar. */
+} gt_trace_file;
+
+struct gt_trace_writer {
+	FILE                    *stream;    /* The writer's own if options.rotate_path. */
+	gt_trace_format          format;
+	const gt_syscall_table  *table;
+	gt_record               *schema;
+	gt_trace_writer_options  options;
+	gt_shm                  *shm;       /* NULL unless options.shm_name. */
+	gt_chunker              *chunker;   /* NULL unless options.compress. */
+	gt_index_writer         *index;     /* NULL unless options.index_path. */
+
+	/* Created by the event thread upon each VCPU's first record. */
+	_Atomic(gt_ring *)       rings[GT_TRACE_MAX_VCPUS];
+	atomic_int               ring_limit; /* One past the highest ring. */
+
+	GThread                 *thread;
+	GMutex                   lock;
+	GCond                    cond;
+	gboolean                 stopping;  /* Under lock. */
+	gint                     wakeup;    /* Set by the event thread when a ring fills. */
+
+	/* The writer thread's own. */
+	uint8_t                 *out;       /* Of a binary trace, options.write_size bytes. */
+	size_t                   out_len;
+	gt_record               *record;    /* The record being written. */
+	size_t                   record_size;
+	gt_line                  line;
+	gboolean                 failed;
+
+	/* The files of a rotating writer. */
+	char                    *file_path;   /* The current file's. */
+	char                    *index_path;  /* Its sidecar's, or NULL. */
+	unsigned int             file_seq;
+	uint64_t                 file_start;  /* When the current file began. */
+	uint64_t                 file_bytes;  /* Of a binary trace, written to the current file. */
+	GQueue                  *old_files;   /* Of gt_trace_file, oldest first. */
+	uint64_t                 old_bytes;
+
+	uint64_t                 records;
+	uint64_t                 writes;
+	uint64_t                 bytes_written;
+	uint64_t                 flushes;
+	uint64_t                 wakeups;
+	uint64_t                 lag_total;  /* Nanoseconds from record to writer. */
+	uint64_t                 lag_max;
+	uint64_t                 rotations;
+	uint64_t                 files_deleted;
+	uint64_t                 bytes_deleted;
+};
+
+static void gt_trace_writer_rotate(gt_trace_writer *writer);
+
+/* Write len bytes of a binary trace, in one call if possible. */
+static void
+gt_trace_writer_write_fd(gt_trace_writer *writer, const void *data, size_t len)
+{
+	size_t done = 0;
+
+	while (!writer->failed && done < len) {
+		ssize_t n = write(fileno(writer->stream), (const uint8_t *) data + done, len - done);
+
+		if (n < 0 && EINTR == errno) {
+			continue;
+		}
+
+		if (n < 0) {
+			fprintf(stderr, "failed to write trace: %s\n", strerror(errno));
+			writer->failed = TRUE;
+			break;
+		}
+
+		writer->writes++;
+		writer->bytes_written += n;
+		writer->file_bytes    += n;
+		done += n;
+	}
+}
+
+/* Compress len bytes of whole records into a chunk, and write it. */
+static void
+gt_trace_writer_write_chunk(gt_trace_writer *writer, const void *records, size_t len)
+{
+	const void *chunk;
+	size_t chunk_len = gt_chunker_compress(writer->chunker, records, len, &chunk);
+
+	if (0 == chunk_len) {
+		writer->failed = TRUE;
+		return;
+	}
+
+	gt_trace_writer_write_fd(writer, chunk, chunk_len);
+
+	if (NULL != writer->index) {
+		gt_index_writer_add(writer->index, gt_chunker_get_last_entry(writer->chunker), records, len);
+	}
+}
+
+/* Write the binary trace buffered so far. */
+static void
+gt_trace_writer_write_out(gt_trace_writer *writer)
+{
+	if (NULL == writer->chunker) {
+		gt_trace_writer_write_fd(writer, writer->out, writer->out_len);
+	} else if (writer->out_len > 0 && !writer->failed) {
+		gt_trace_writer_write_chunk(writer, writer->out, writer->out_len);
+	}
+
+	writer->out_len = 0;
+}
+
+static void
+gt_trace_writer_append(gt_trace_writer *writer, const void *data, size_t len)
+{
+	while (len > 0) {
+		size_t n = MIN(len, writer->options.write_size - writer->out_len);
+
+		memcpy(writer->out + writer->out_len, data, n);
+		writer->out_len += n;
+		data             = (const uint8_t *) data + n;
+		len             -= n;
+
+		if (writer->out_len == writer->options.write_size) {
+			gt_trace_writer_write_out(writer);
+		}
+	}
+}
+
+/*
+ * Buffer record for a compressed trace. Each chunk holds whole records,
+ * so that it decompresses alone; a record larger than the buffer gets a
+ * chunk of its own.
+ */
+static void
+gt_trace_writer_append_record(gt_trace_writer *writer, const gt_record *record)
+{
+	if (writer->out_len + record->size > writer->options.write_size) {
+		gt_trace_writer_write_out(writer);
+	}
+
+	if (record->size > writer->options.write_size) {
+		if (!writer->failed) {
+			gt_trace_writer_write_chunk(writer, record, record->size);
+		}
+		return;
+	}
+
+	memcpy(writer->out + writer->out_len, record, record->size);
+	writer->out_len += record->size;
+}
+
+/*
+ * The bytes of the current file, buffered ones included; those of a
+ * compressed trace count once compressed.
+ */
+static uint64_t
+gt_trace_writer_file_size(gt_trace_writer *writer)
+{
+	switch (writer->format) {
+	case GT_TRACE_TEXT:
+		return writer->line.written;
+	case GT_TRACE_BINARY:
+		return writer->file_bytes + (NULL == writer->chunker ? writer->out_len : 0);
+	default:
+		return 0;
+	}
+}
+
+/* Whether a rotating writer should start a new file. */
+static gboolean
+gt_trace_writer_rotation_due(gt_trace_writer *writer, uint64_t now)
+{
+	uint64_t interval = (uint64_t) writer->options.rotate_interval * G_TIME_SPAN_SECOND * 1000;
+
+	if (NULL == writer->options.rotate_path || writer->failed) {
+		return FALSE;
+	}
+
+	return (0 != writer->options.rotate_size
+	     && gt_trace_writer_file_size(writer) >= writer->options.rotate_size)
+	    || (0 != interval && now - writer->file_start >= interval);
+}
+
+static void
+gt_trace_writer_emit(gt_trace_writer *writer, const gt_record *record)
+{
+	uint64_t now = gt_trace_clock();
+	/* Another CPU's clock may run a little ahead of the writer's own. */
+	uint64_t lag = now > record->timestamp ? now - record->timestamp : 0;
+
+	switch (writer->failed ? GT_TRACE_NONE : writer->format) {
+	case GT_TRACE_TEXT:
+		gt_format_record(&writer->line, writer->table, record);
+		break;
+	case GT_TRACE_BINARY:
+		if (NULL == writer->chunker) {
+			gt_trace_writer_append(writer, record, record->size);
+		} else {
+			gt_trace_writer_append_record(writer, record);
+		}
+		break;
+	case GT_TRACE_NONE:
+		break;
+	}
+
+	if (NULL != writer->shm) {
+		gt_shm_publish(writer->shm, record);
+	}
+
+	writer->records++;
+	writer->lag_total += lag;
+	writer->lag_max    = MAX(writer->lag_max, lag);
+
+	/* Files begin and end between records. */
+	if (gt_trace_writer_rotation_due(writer, now)) {
+		gt_trace_writer_rotate(writer);
+	}
+}
+
+/*
+ * Take the records out of the rings, earliest first, until they are empty.
+ * The rings hold the records of each VCPU in order, so the earliest record
+ * is at the head of one of them.
+ */
+static void
+gt_trace_writer_drain(gt_trace_writer *writer)
+{
+	for (;;) {
+		int limit = atomic_load_explicit(&writer->ring_limit, memory_order_acquire);
+		gt_ring *next = NULL;
+		gt_record head, next_head;
+
+		for (int i = 0; i < limit; i++) {
+			gt_ring *ring = atomic_load_explicit(&writer->rings[i], memory_order_acquire);
+
+			if (NULL == ring || 0 == gt_ring_peek(ring, &head, sizeof head)) {
+				continue;
+			}
+
+			if (NULL == next || head.timestamp < next_head.timestamp) {
+				next      = ring;
+				next_head = head;
+			}
+		}
+
+		if (NULL == next) {
+			break;
+		}
+
+		if (next_head.size > writer->record_size) {
+			writer->record_size = next_head.size;
+			writer->record      = g_realloc(writer->record, writer->record_size);
+		}
+
+		gt_ring_peek(next, writer->record, next_head.size);
+		gt_ring_consume(next, next_head.size);
+		gt_trace_writer_emit(writer, writer->record);
+	}
+}
+
+static void
+gt_trace_writer_flush(gt_trace_writer *writer)
+{
+	switch (writer->failed ? GT_TRACE_NONE : writer->format) {
+	case GT_TRACE_TEXT:
+		fflush(writer->stream);
+		break;
+	case GT_TRACE_BINARY:
+		gt_trace_writer_write_out(writer);
+		break;
+	case GT_TRACE_NONE:
+		break;
+	}
+
+	if (NULL != writer->index) {
+		gt_index_writer_flush(writer->index);
+	}
+
+	if (NULL != writer->shm) {
+		gt_shm_check_readers(writer->shm);
+	}
+
+	writer->flushes++;
+}
+
+/*
+ * Begin the current file. A binary trace begins with its header and
+ * schema, and a compressed one with those of trace-chunk.h, along with a
+ * sidecar index at index_path, unless it is NULL. Returns FALSE on
+ * failure.
+ */
+static gboolean
+gt_trace_writer_begin(gt_trace_writer *writer, const char *index_path)
+{
+	gt_trace_header header = { GT_TRACE_MAGIC, GT_TRACE_VERSION, sizeof header };
+	const void *begin;
+	size_t begin_len;
+
+	writer->line.stream  = writer->stream;
+	writer->line.written = 0;
+	writer->file_bytes   = 0;
+	writer->file_start   = gt_trace_clock();
+
+	switch (writer->format) {
+	case GT_TRACE_TEXT:
+		/* The text goes out through stdio, which buffers it likewise. */
+		if (stderr != writer->stream) {
+			setvbuf(writer->stream, NULL, _IOFBF, writer->options.write_size);
+		}
+		break;
+	case GT_TRACE_BINARY:
+		fflush(writer->stream);
+
+		if (!writer->options.compress) {
+			gt_trace_writer_append(writer, &header, sizeof header);
+			gt_trace_writer_append(writer, writer->schema, writer->schema->size);
+			break;
+		}
+
+		if (NULL != index_path) {
+			writer->index = gt_index_writer_new(index_path, writer->table->count);
+			if (NULL == writer->index) {
+				return FALSE;
+			}
+		}
+
+		if (NULL == writer->chunker) {
+			writer->chunker = gt_chunker_new(writer->options.compress_level);
+		}
+
+		begin_len = gt_chunker_begin(writer->chunker, writer->schema, &begin);
+		gt_trace_writer_write_fd(writer, begin, begin_len);
+		break;
+	case GT_TRACE_NONE:
+		break;
+	}
+
+	return TRUE;
+}
+
+/* End the current file: write what remains of it, and a compressed trace's index. */
+static void
+gt_trace_writer_end(gt_trace_writer *writer)
+{
+	gt_trace_writer_flush(writer);
+
+	if (NULL != writer->chunker && !writer->failed) {
+		const void *end;
+		size_t end_len = gt_chunker_finish(writer->chunker, &end);
+
+		gt_trace_writer_write_fd(writer, end, end_len);
+	}
+
+	gt_index_writer_free(writer->index);
+	writer->index = NULL;
+}
+
+static uint64_t
+gt_trace_file_size(const char *path)
+{
+	struct stat st;
+
+	return NULL != path && 0 == stat(path, &st) ? st.st_size : 0;
+}
+
+/* Delete the oldest finished files until those left fit options.retain_size. */
+static void
+gt_trace_writer_retire(gt_trace_writer *writer)
+{
+	while (0 != writer->options.retain_size
+	    && writer->old_bytes > writer->options.retain_size
+	    && !g_queue_is_empty(writer->old_files)) {
+		gt_trace_file *file = g_queue_pop_head(writer->old_files);
+
+		if (0 != unlink(file->path)) {
+			fprintf(stderr, "could not delete %s: %s\n", file->path, strerror(errno));
+		}
+
+		if (NULL != file->index_path) {
+			unlink(file->index_path);
+		}
+
+		writer->old_bytes -= file->size;
+		writer->files_deleted++;
+		writer->bytes_deleted += file->size;
+
+		g_free(file->path);
+		g_free(file->index_path);
+		g_free(file);
+	}
+}
+
+/*
+ * Create the next file of a rotating writer, named after
+ * options.rotate_path, and begin it. Only then does the writer point the
+ * link at options.rotate_path to the file, by renaming a new link over
+ * the old, so that a reader which opens that path always finds a whole
+ * file, from its header on. Returns FALSE on failure.
+ */
+static gboolean
+gt_trace_writer_open_file(gt_trace_writer *writer)
+{
+	const char *path = writer->options.rotate_path;
+	char *link_path = g_strconcat(path, ".link", NULL);
+	char *target;
+	gboolean ok = FALSE;
+
+	writer->file_path  = g_strdup_printf("%s.%06u", path, ++writer->file_seq);
+	writer->index_path = NULL;
+	if (writer->options.compress && NULL != writer->options.index_path) {
+		writer->index_path = g_strconcat(writer->file_path, GT_INDEX_SUFFIX, NULL);
+	}
+
+	writer->stream = fopen(writer->file_path, "w");
+	if (NULL == writer->stream) {
+		fprintf(stderr, "could not create %s: %s\n", writer->file_path, strerror(errno));
+		goto done;
+	}
+
+	if (!gt_trace_writer_begin(writer, writer->index_path)) {
+		goto done;
+	}
+
+	if (GT_TRACE_BINARY == writer->format && NULL == writer->chunker) {
+		gt_trace_writer_write_out(writer);
+	}
+
+	target = g_path_get_basename(writer->file_path);
+	unlink(link_path);
+	if (0 != symlink(target, link_path) || 0 != rename(link_path, path)) {
+		fprintf(stderr, "could not link %s to %s: %s\n", path, target, strerror(errno));
+		unlink(link_path);
+	}
+	g_free(target);
+
+	ok = !writer->failed;
+
+done:
+	g_free(link_path);
+	return ok;
+}
+
+/*
+ * Finish the current file of a rotating writer, and start the next. The
+ * event thread carries on filling the rings meanwhile.
+ */
+static void
+gt_trace_writer_rotate(gt_trace_writer *writer)
+{
+	gt_trace_file *file = g_new0(gt_trace_file, 1);
+
+	gt_trace_writer_end(writer);
+	if (0 != fclose(writer->stream)) {
+		fprintf(stderr, "failed to write %s: %s\n", writer->file_path, strerror(errno));
+	}
+	writer->stream = NULL;
+
+	file->path       = writer->file_path;
+	file->index_path = writer->index_path;
+	file->size       = gt_trace_file_size(file->path) + gt_trace_file_size(file->index_path);
+	g_queue_push_tail(writer->old_files, file);
+	writer->old_bytes += file->size;
+	writer->rotations++;
+
+	gt_trace_writer_retire(writer);
+
+	if (!gt_trace_writer_open_file(writer)) {
+		writer->failed = TRUE;
+	}
+}
+
+/*
+ * The writer thread. It drains the rings whenever the event thread finds
+ * one half full, and otherwise once each flush interval, after which it
+ * also flushes what it has buffered.
+ */
+static gpointer
+gt_trace_writer_run(gpointer data)
+{
+	gt_trace_writer *writer = data;
+	gint64 interval = writer->options.flush_interval * G_TIME_SPAN_MILLISECOND;
+	gint64 next_flush = g_get_monotonic_time() + interval;
+	gboolean stopping = FALSE;
+
+	while (!stopping) {
+		g_mutex_lock(&writer->lock);
+		while (!writer->stopping && !g_atomic_int_get(&writer->wakeup)) {
+			if (!g_cond_wait_until(&writer->cond, &writer->lock, next_flush)) {
+				break;
+			}
+		}
+
+		if (g_atomic_int_get(&writer->wakeup)) {
+			writer->wakeups++;
+			g_atomic_int_set(&writer->wakeup, FALSE);
+		}
+
+		stopping = writer->stopping;
+		g_mutex_unlock(&writer->lock);
+
+		gt_trace_writer_drain(writer);
+
+		if (stopping || g_get_monotonic_time() >= next_flush) {
+			gt_trace_writer_flush(writer);
+			next_flush = g_get_monotonic_time() + interval;
+		}
+
+		/* Rotate by time even while the guest is idle. */
+		if (!stopping && gt_trace_writer_rotation_due(writer, gt_trace_clock())) {
+			gt_trace_writer_rotate(writer);
+		}
+	}
+
+	gt_trace_writer_end(writer);
+
+	return NULL;
+}
+
+/*
+ * Create a writer of records which describe the system calls of table to
+ * stream, which remains the caller's to close after gt_trace_writer_free().
+ * A binary writer begins the trace at once with its header and schema, as
+ * does the ring in shared memory which the options may name; a binary
+ * writer whose options ask it to compress the trace writes the format of
+ * trace-chunk.h instead, along with any sidecar index which they name.
+ * Options which name a rotate_path make the writer write files of its own
+ * instead of stream, which may then be NULL. Options may be NULL for the
+ * defaults. Returns NULL on failure.
+ */
+gt_trace_writer *
+gt_trace_writer_new(FILE *stream,
+                    gt_trace_format format,
+                    const gt_syscall_table *table,
+                    const gt_trace_writer_options *options)
+{
+	gt_trace_writer *writer = g_new0(gt_trace_writer, 1);
+	sigset_t all, old;
+	void *out = NULL;
+
+	writer->stream    = stream;
+	writer->format    = format;
+	writer->table     = table;
+	writer->schema    = gt_record_new_schema(table);
+	writer->old_files = g_queue_new();
+
+	writer->options.ring_size      = GT_TRACE_RING_SIZE;
+	writer->options.write_size     = GT_TRACE_WRITE_SIZE;
+	writer->options.flush_interval = GT_TRACE_FLUSH_INTERVAL;
+	writer->options.shm_size       = GT_TRACE_SHM_SIZE;
+	writer->options.compress_level = GT_TRACE_COMPRESS_LEVEL;
+	if (NULL != options) {
+		writer->options = *options;
+	}
+
+	writer->options.write_size = MAX(writer->options.write_size, GT_TRACE_WRITE_ALIGN);
+	writer->options.flush_interval = MAX(writer->options.flush_interval, 1);
+	writer->line.timestamps = writer->options.timestamps;
+
+	for (int i = 0; i < GT_TRACE_MAX_VCPUS; i++) {
+		atomic_init(&writer->rings[i], NULL);
+	}
+	atomic_init(&writer->ring_limit, 0);
+
+	g_mutex_init(&writer->lock);
+	g_cond_init(&writer->cond);
+
+	if (NULL != writer->options.shm_name) {
+		writer->shm = gt_shm_new(writer->options.shm_name, writer->options.shm_size, writer->schema);
+		if (NULL == writer->shm) {
+			goto fail;
+		}
+	}
+
+	if (GT_TRACE_BINARY == format) {
+		if (0 != posix_memalign(&out, GT_TRACE_WRITE_ALIGN, writer->options.write_size)) {
+			fprintf(stderr, "could not allocate trace buffer\n");
+			goto fail;
+		}
+
+		writer->out = out;
+	}
+
+	if (NULL != writer->options.rotate_path) {
+		if (!gt_trace_writer_open_file(writer)) {
+			goto fail;
+		}
+	} else if (!gt_trace_writer_begin(writer, writer->options.index_path)) {
+		goto fail;
+	}
+
+	/* Leave guestrace's signals to the thread which runs the loop. */
+	sigfillset(&all);
+	pthread_sigmask(SIG_SETMASK, &all, &old);
+	writer->thread = g_thread_new("gt-writer", gt_trace_writer_run, writer);
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+	return writer;
+
+fail:
+	gt_trace_writer_free(writer);
+	return NULL;
+}
+
+/*
+ * Drain the rings, write what remains, and stop the writer thread. The
+ * event loop must no longer be running.
+ */
+void
+gt_trace_writer_stop(gt_trace_writer *writer)
+{
+	if (NULL == writer || NULL == writer->thread) {
+		return;
+	}
+
+	g_mutex_lock(&writer->lock);
+	writer->stopping = TRUE;
+	g_cond_signal(&writer->cond);
+	g_mutex_unlock(&writer->lock);
+
+	g_thread_join(writer->thread);
+	writer->thread = NULL;
+}
+
+void
+gt_trace_writer_free(gt_trace_writer *writer)
+{
+	if (NULL == writer) {
+		return;
+	}
+
+	gt_trace_writer_stop(writer);
+
+	for (int i = 0; i < GT_TRACE_MAX_VCPUS; i++) {
+		gt_ring_free(atomic_load(&writer->rings[i]));
+	}
+
+	gt_shm_free(writer->shm);
+	gt_chunker_free(writer->chunker);
+	gt_index_writer_free(writer->index);
+
+	if (NULL != writer->options.rotate_path && NULL != writer->stream) {
+		fclose(writer->stream);
+	}
+
+	while (!g_queue_is_empty(writer->old_files)) {
+		gt_trace_file *file = g_queue_pop_head(writer->old_files);
+
+		g_free(file->path);
+		g_free(file->index_path);
+		g_free(file);
+	}
+
+	g_queue_free(writer->old_files);
+	g_free(writer->file_path);
+	g_free(writer->index_path);
+	g_free(writer->schema);
+	g_mutex_clear(&writer->lock);
+	g_cond_clear(&writer->cond);
+	free(writer->out);
+	g_free(writer->record);
+	g_free(writer);
+}
+
+/*
+ * Queue record for the writer thread. Called by the event thread alone,
+ * which never waits for the writer: if the ring of the record's VCPU is
+ * full, the record is dropped, and counted in the ring's statistics.
+ */
+void
+gt_trace_writer_write(gt_trace_writer *writer, const gt_record *record)
+{
+	int vcpu = record->vcpu % GT_TRACE_MAX_VCPUS;
+	gt_ring *ring = atomic_load_explicit(&writer->rings[vcpu], memory_order_relaxed);
+
+	if (NULL == ring) {
+		ring = gt_ring_new(writer->options.ring_size);
+		atomic_store_explicit(&writer->rings[vcpu], ring, memory_order_release);
+		if (vcpu >= atomic_load_explicit(&writer->ring_limit, memory_order_relaxed)) {
+			atomic_store_explicit(&writer->ring_limit, vcpu + 1, memory_order_release);
+		}
+	}
+
+	gt_ring_push(ring, record, record->size);
+
+	if (gt_ring_used(ring) > gt_ring_size(ring) / 2 && !g_atomic_int_get(&writer->wakeup)) {
+		g_mutex_lock(&writer->lock);
+		g_atomic_int_set(&writer->wakeup, TRUE);
+		g_cond_signal(&writer->cond);
+		g_mutex_unlock(&writer->lock);
+	}
+}
+
+/*
+ * Write the writer's statistics to stream as a line of JSON: the occupancy
+ * of the ring of each VCPU, how far the writer lagged behind the guest,
+ * how well it compressed the trace, how far the readers of any shared
+ * memory lagged behind the writer, and what rotating the files deleted.
+ * Call this once the writer is stopped.
+ */
+void
+gt_trace_writer_print_stats(gt_trace_writer *writer, FILE *stream)
+{
+	const char *separator = "";
+
+	fprintf(stream, "{\"writer\": {"
+	                "\"format\": \"%s\", "
+	                "\"records\": %" PRIu64 ", "
+	                "\"writes\": %" PRIu64 ", "
+	                "\"bytes_written\": %" PRIu64 ", "
+	                "\"flushes\": %" PRIu64 ", "
+	                "\"wakeups\": %" PRIu64 ", "
+	                "\"mean_lag_ns\": %.0f, "
+	                "\"max_lag_ns\": %" PRIu64 "}, "
+	                "\"rings\": {",
+	        GT_TRACE_FORMAT_NAMES[writer->format],
+	        writer->records,
+	        writer->writes,
+	        writer->bytes_written,
+	        writer->flushes,
+	        writer->wakeups,
+	        writer->records ? (double) writer->lag_total / writer->records : 0.0,
+	        writer->lag_max);
+
+	for (int i = 0; i < GT_TRACE_MAX_VCPUS; i++) {
+		gt_ring *ring = atomic_load(&writer->rings[i]);
+
+		if (NULL == ring) {
+			continue;
+		}
+
+		fprintf(stream, "%s\"%d\": ", separator, i);
+		gt_ring_print_stats(ring, stream);
+		separator = ", ";
+	}
+
+	fprintf(stream, "}");
+
+	if (NULL != writer->options.rotate_path) {
+		fprintf(stream, ", \"rotation\": {"
+		                "\"files\": %u, "
+		                "\"rotations\": %" PRIu64 ", "
+		                "\"files_deleted\": %" PRIu64 ", "
+		                "\"bytes_deleted\": %" PRIu64 ", "
+		                "\"bytes_retained\": %" PRIu64 "}",
+		        writer->file_seq,
+		        writer->rotations,
+		        writer->files_deleted,
+		        writer->bytes_deleted,
+		        writer->old_bytes);
+	}
+
+	if (NULL != writer->chunker) {
+		fprintf(stream, ", \"compression\": ");
+		gt_chunker_print_stats(writer->chunker, stream);
+	}
+
+	if (NULL != writer->shm) {
+		fprintf(stream, ", \"shm\": ");
+		gt_shm_print_stats(writer->shm, stream);
+	}
+
+	fprintf(stream, "}\n");
+}
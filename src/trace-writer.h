@@ -0,0 +1,76 @@
+#ifndef TRACE_WRITER_H
+#define TRACE_WRITER_H
+
+#include <glib.h>
+#include <stdio.h>
+
+#include "trace-record.h"
+
+/*
+ * The destination of the records which the decoders produce: a stream to
+ * which the writer prints each record as text, or to which it writes the
+ * records themselves, after a header and a schema; see trace-record.h.
+ *
+ * The event thread only copies each record into a ring of its VCPU, and a
+ * thread of the writer's own drains the rings, in the order of the
+ * records' timestamps, to the stream. A guest thus never waits on the
+ * disk, though it outruns a writer whose rings fill; see trace-ring.h.
+ * A binary trace may be compressed, in chunks which readers can find by
+ * time; see trace-chunk.h. The writer can also publish the records to
+ * other processes through shared memory; see trace-shm.h.
+ *
+ * Rather than to a stream, the writer can write the trace to a series of
+ * files, each a whole trace of its own, starting the next once the last
+ * grows too large or too old, and deleting the oldest to bound the space
+ * they take. A link at the path of the series names the current file.
+ */
+typedef struct gt_trace_writer gt_trace_writer;
+
+typedef enum gt_trace_format {
+	GT_TRACE_TEXT,
+	GT_TRACE_BINARY,
+	GT_TRACE_NONE,    /* Write nothing to the stream. */
+} gt_trace_format;
+
+/* Defaults of gt_trace_writer_options. */
+#define GT_TRACE_RING_SIZE      (4 << 20)
+#define GT_TRACE_WRITE_SIZE     (1 << 20)
+#define GT_TRACE_FLUSH_INTERVAL 200
+#define GT_TRACE_SHM_SIZE       (64 << 20)
+#define GT_TRACE_COMPRESS_LEVEL 3
+
+/* The most VCPUs with rings of their own; others share them. */
+#define GT_TRACE_MAX_VCPUS 64
+
+typedef struct gt_trace_writer_options {
+	size_t ring_size;       /* Bytes in the ring of each VCPU. */
+	size_t write_size;      /* Bytes in each write of a binary trace. */
+	guint  flush_interval;  /* Milliseconds between flushes of the stream. */
+	const char *shm_name;   /* Of a ring in shared memory, or NULL for none. */
+	size_t shm_size;        /* Bytes of records in the ring in shared memory. */
+	gboolean compress;      /* Compress a binary trace, a chunk per write. */
+	int    compress_level;  /* Of zstd. */
+	const char *index_path; /* Of a compressed trace's sidecar index, or NULL for none. */
+	gboolean timestamps;    /* Begin each line of a text trace with its record's time. */
+
+	/*
+	 * Of the link to the current file, which the files' names extend, or
+	 * NULL to write to the stream instead. Each compressed file gets a
+	 * sidecar index of its own, unless index_path is NULL.
+	 */
+	const char *rotate_path;
+	uint64_t rotate_size;   /* Bytes after which to start a new file, or 0. */
+	guint  rotate_interval; /* Seconds likewise, or 0. */
+	uint64_t retain_size;   /* Bytes of finished files to keep, or 0 for all. */
+} gt_trace_writer_options;
+
+gt_trace_writer *gt_trace_writer_new(FILE *stream,
+                                     gt_trace_format format,
+                                     const gt_syscall_table *table,
+                                     const gt_trace_writer_options *options);
+void             gt_trace_writer_stop(gt_trace_writer *writer);
+void             gt_trace_writer_free(gt_trace_writer *writer);
+void             gt_trace_writer_write(gt_trace_writer *writer, const gt_record *record);
+void             gt_trace_writer_print_stats(gt_trace_writer *writer, FILE *stream);
+
+#endif
@@ -0,0 +1,149 @@
+#include <libvmi/libvmi.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "guestrace.h"
+#include "guestrace-private.h"
+#include "utf16.h"
+
+/* The replacement character, for unpaired surrogates. */
+#define GT_UTF16_REPLACEMENT 0xfffd
+
+static uint16_t
+gt_utf16_unit(const uint8_t *src, size_t i)
+{
+	return src[2 * i] | src[2 * i + 1] << 8;
+}
+
+/*
+ * Convert units of UTF-16LE at src, which need not be aligned, to UTF-8 at
+ * dst, which must hold GT_UTF8_MAX(units) bytes, and terminate it. Guests
+ * name nearly everything in ASCII, so convert runs of ASCII eight units at
+ * a time, and fall back to decoding one code point at a time only where
+ * the string leaves ASCII. Unpaired surrogates become U+FFFD rather than
+ * failing the whole string.
+ *
+ * Return the length of the UTF-8, terminator excluded.
+ */
+size_t
+gt_utf16le_to_utf8(const uint8_t *src, size_t units, char *dst)
+{
+	char *out = dst;
+	size_t i = 0;
+
+	while (i < units) {
+		uint32_t c;
+
+#ifdef __SSE2__
+		const __m128i non_ascii = _mm_set1_epi16((short) 0xff80);
+
+		while (i + 8 <= units) {
+			__m128i v = _mm_loadu_si128((const __m128i *) (src + 2 * i));
+
+			if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, non_ascii),
+			                                                _mm_setzero_si128()))) {
+				break;
+			}
+
+			_mm_storel_epi64((__m128i *) out, _mm_packus_epi16(v, v));
+			out += 8;
+			i   += 8;
+		}
+
+		if (i == units) {
+			break;
+		}
+#endif
+
+		c = gt_utf16_unit(src, i++);
+
+		if (c < 0x80) {
+			*out++ = c;
+			continue;
+		}
+
+		if (c < 0x800) {
+			*out++ = 0xc0 | c >> 6;
+			*out++ = 0x80 | (c & 0x3f);
+			continue;
+		}
+
+		if (c >= 0xd800 && c <= 0xdfff) {
+			uint16_t low = i < units ? gt_utf16_unit(src, i) : 0;
+
+			if (c <= 0xdbff && low >= 0xdc00 && low <= 0xdfff) {
+				c = 0x10000 + ((c - 0xd800) << 10) + (low - 0xdc00);
+				i++;
+
+				*out++ = 0xf0 | c >> 18;
+				*out++ = 0x80 | (c >> 12 & 0x3f);
+				*out++ = 0x80 | (c >> 6 & 0x3f);
+				*out++ = 0x80 | (c & 0x3f);
+				continue;
+			}
+
+			c = GT_UTF16_REPLACEMENT;
+		}
+
+		*out++ = 0xe0 | c >> 12;
+		*out++ = 0x80 | (c >> 6 & 0x3f);
+		*out++ = 0x80 | (c & 0x3f);
+	}
+
+	*out = '\0';
+
+	return out - dst;
+}
+
+/**
+ * gt_guest_read_unicode_string:
+ * @vmi: the libvmi instance passed to the callback.
+ * @event: the event passed to the callback.
+ * @vaddr: the virtual address of a Windows UNICODE_STRING in the guest.
+ * @pid: the ID of the process whose address space contains @vaddr.
+ *
+ * Reads a UNICODE_STRING and converts it to UTF-8. Unlike
+ * vmi_read_unicode_str_va() and vmi_convert_str_encoding(), this reads the
+ * string's Length and Buffer in one read and its characters in another,
+ * converts without iconv, and allocates from the per-event arena of
+ * gt_guest_scratch_alloc() rather than the heap.
+ *
+ * Returns: the string in UTF-8, or %NULL if guestrace cannot read it. The
+ * string remains valid until the callback returns; the caller must not free
+ * it.
+ */
+const char *
+gt_guest_read_unicode_string(vmi_instance_t vmi,
+                             vmi_event_t *event,
+                             addr_t vaddr,
+                             vmi_pid_t pid)
+{
+	GTLoop *loop = event->data;
+	uint8_t header[16], *utf16;
+	size_t header_size = 2 * loop->return_address_width;
+	uint16_t length;
+	addr_t buffer = 0;
+	char *str = NULL;
+
+	/* Length, MaximumLength, and Buffer, aligned to the address width. */
+	if (header_size > sizeof header
+	 || header_size != gt_guest_read_va(vmi, event, vaddr, pid, header, header_size)) {
+		goto done;
+	}
+
+	memcpy(&length, header, sizeof length);
+	memcpy(&buffer, header + loop->return_address_width, loop->return_address_width);
+
+	utf16 = gt_guest_read_bytes(vmi, event, buffer, pid, length);
+	if (NULL == utf16) {
+		goto done;
+	}
+
+	str = gt_scratch_alloc(loop->scratch, GT_UTF8_MAX(length / 2));
+	gt_utf16le_to_utf8(utf16, length / 2, str);
+
+done:
+	return str;
+}
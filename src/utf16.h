@@ -0,0 +1,12 @@
+#ifndef UTF16_H
+#define UTF16_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bytes of UTF-8, terminator included, which units of UTF-16 can need. */
+#define GT_UTF8_MAX(units) (3 * (units) + 1)
+
+size_t gt_utf16le_to_utf8(const uint8_t *src, size_t units, char *dst);
+
+#endif